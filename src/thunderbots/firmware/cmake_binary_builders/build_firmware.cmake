@@ -15,6 +15,8 @@ function(build_firmware FIRMWARE_SOURCE_DIR SRC_FILES BINARY_NAME OUT_DIR)
     set_include_dirs(${FIRMWARE_SOURCE_DIR})
     # add preprocessor definitions
     add_definitions(-DSTM32LIB_USE_FREERTOS)
+    # the FPU only supports single precision, so plan bang-bang trajectories in floats
+    add_definitions(-DBANG_BANG_TRAJECTORY_USE_FLOAT)
 
     # add the source files to our executable
     add_executable(${BINARY_NAME}.elf "${SRC_FILES}")
@@ -26,6 +26,8 @@
  */
 
 
+#include "shared_util/bang_bang_trajectory.h"
+
 //a full trajector plan for a vehicle undergoing maximum acceleration control
 typedef struct {
 	//inputs
@@ -43,17 +45,9 @@ typedef struct {
 	float MaxV;
 
 	//computed info
-	//The time spent accelerating with acceleration a1
-	float t1;
-	//the time spent coasting with velocity Vmid
-	float t2;
-	//the time spent accelerating with acceleration a3
-	float t3;
-
-	//see above
-	float a1;
-	float a3;
-	float Vmid;
+	//the planned trajectory, shared with the AI so that both agree on how
+	//long a movement takes
+	BangBangTrajectory1D trajectory;
 } BBProfile;
 
 
@@ -84,7 +78,7 @@ float ConstantJerkCompute(float Vinit, float Vfinal, float Distance, float time,
 
 
 //Computes how long a movement will take
-float GetBBTime(BBProfile *b);
+float GetBBTime(const BBProfile *b);
 
 
 //koko's magic function
@@ -1,4 +1,5 @@
 
+#include "bangbang_test.h"
 #include "math_test.h"
 #include "matrix_test.h"
 #include "move_test.h"
@@ -31,6 +32,7 @@ void run_test(TCase *tc, Suite *s) {
 int main(void)
 {
     printf("\nStart Tests\n");
+    run_bangbang_test();
     run_math_test();
     run_matrix_test();
     run_move_test();
@@ -0,0 +1,94 @@
+#include "main/bangbang.h"
+#include "test.h"
+#include "check.h"
+#include <math.h>
+
+START_TEST(test_rest_to_rest)
+{
+    BBProfile b;
+    PrepareBBTrajectory(&b, 1.0f, 0.0f, 0.0f, 1.0f);
+    PlanBBTrajectory(&b);
+    ck_assert_float_eq_tol(2.0f, GetBBTime(&b), TOL);
+    float d, v;
+    GetState(&b, 1.0f, &d, &v);
+    ck_assert_float_eq_tol(0.5f, d, TOL);
+    ck_assert_float_eq_tol(1.0f, v, TOL);
+    GetState(&b, 3.0f, &d, &v);
+    ck_assert_float_eq_tol(1.0f, d, TOL);
+    ck_assert_float_eq_tol(0.0f, v, TOL);
+}
+END_TEST
+
+START_TEST(test_coast_at_max_velocity)
+{
+    BBProfile b;
+    PrepareBBTrajectoryMaxV(&b, -4.0f, 0.0f, 0.0f, 1.0f, 1.0f);
+    PlanBBTrajectory(&b);
+    ck_assert_float_eq_tol(5.0f, GetBBTime(&b), TOL);
+    float d, v;
+    GetState(&b, 2.5f, &d, &v);
+    ck_assert_float_eq_tol(-2.0f, d, TOL);
+    ck_assert_float_eq_tol(-1.0f, v, TOL);
+}
+END_TEST
+
+START_TEST(test_final_velocity_is_folded_into_distance)
+{
+    BBProfile b;
+    PrepareBBTrajectory(&b, 1.0f, 0.0f, 1.0f, 1.0f);
+    PlanBBTrajectory(&b);
+    ck_assert_float_eq_tol(2.0f * sqrtf(1.5f), GetBBTime(&b), TOL);
+}
+END_TEST
+
+START_TEST(test_overshoot_comes_back)
+{
+    // we can not stop within the distance so we stop after 2m and come back 1m
+    BBProfile b;
+    PrepareBBTrajectory(&b, 1.0f, 2.0f, 0.0f, 1.0f);
+    PlanBBTrajectory(&b);
+    ck_assert_float_eq_tol(4.0f, GetBBTime(&b), TOL);
+    float d, v;
+    GetState(&b, 2.0f, &d, &v);
+    ck_assert_float_eq_tol(2.0f, d, TOL);
+    ck_assert_float_eq_tol(0.0f, v, TOL);
+}
+END_TEST
+
+START_TEST(test_faster_than_max_velocity_slows_down)
+{
+    BBProfile b;
+    PrepareBBTrajectoryMaxV(&b, 10.0f, 3.0f, 0.0f, 1.0f, 2.0f);
+    PlanBBTrajectory(&b);
+    // 1s slowing to 2m/s over 2.5m, 2s stopping over 2m and 2.75s coasting
+    ck_assert_float_eq_tol(5.75f, GetBBTime(&b), TOL);
+}
+END_TEST
+
+START_TEST(test_avg_accel)
+{
+    BBProfile b;
+    PrepareBBTrajectory(&b, 1.0f, 0.0f, 0.0f, 1.0f);
+    PlanBBTrajectory(&b);
+    ck_assert_float_eq_tol(1.0f, BBComputeAvgAccel(&b, 0.5f), TOL);
+}
+END_TEST
+
+/**
+ * Test function manager for bangbang.c
+ */
+void run_bangbang_test() {
+    // Put the name of the suite of tests in here
+    Suite *s = suite_create("Bang Bang Test");
+    // Creates a test case that you can add all of the tests to
+    TCase *tc_core = tcase_create("Core");
+    // add the tests for this file here
+    tcase_add_test(tc_core, test_rest_to_rest);
+    tcase_add_test(tc_core, test_coast_at_max_velocity);
+    tcase_add_test(tc_core, test_final_velocity_is_folded_into_distance);
+    tcase_add_test(tc_core, test_overshoot_comes_back);
+    tcase_add_test(tc_core, test_faster_than_max_velocity_slows_down);
+    tcase_add_test(tc_core, test_avg_accel);
+    // run the tests
+    run_test(tc_core, s);
+}
@@ -0,0 +1 @@
+void run_bangbang_test();
\ No newline at end of file
@@ -0,0 +1,413 @@
+#pragma once
+
+#include <math.h>
+
+// This file contains time-optimal bang-bang trajectories that are shared between our
+// software (AI, grSim) and firmware. A bang-bang trajectory only ever accelerates at
+// the maximum acceleration, coasts at the maximum velocity, or decelerates at the
+// maximum acceleration, so it is the fastest way to move to a destination with those
+// limits.
+//
+// Since this needs to be compiled by both C and C++, everything is plain C. All the
+// functions are static inline and only work on values passed to them, so they do not
+// need a source file, never allocate memory, and can be inlined into the control loop
+// of the firmware.
+//
+// The firmware's FPU only works on single precision floats, so it defines
+// BANG_BANG_TRAJECTORY_USE_FLOAT to do all the math in floats. Everywhere else uses
+// doubles. The constants are written as floats so that they are never promoted to
+// doubles in the firmware.
+
+#ifdef BANG_BANG_TRAJECTORY_USE_FLOAT
+typedef float BangBangScalar;
+#define BANG_BANG_SQRT sqrtf
+#define BANG_BANG_FMAX fmaxf
+#define BANG_BANG_FMIN fminf
+#define BANG_BANG_FABS fabsf
+#define BANG_BANG_COPYSIGN copysignf
+#define BANG_BANG_COS cosf
+#define BANG_BANG_SIN sinf
+#else
+typedef double BangBangScalar;
+#define BANG_BANG_SQRT sqrt
+#define BANG_BANG_FMAX fmax
+#define BANG_BANG_FMIN fmin
+#define BANG_BANG_FABS fabs
+#define BANG_BANG_COPYSIGN copysign
+#define BANG_BANG_COS cos
+#define BANG_BANG_SIN sin
+#endif
+
+// The number of parts of a 1D trajectory: accelerate, coast, and accelerate again
+#define BANG_BANG_TRAJECTORY_NUM_PARTS 3
+
+// The number of steps used to search for how to split the acceleration of a 2D
+// trajectory between its x and y components
+#define BANG_BANG_TRAJECTORY_2D_NUM_SEARCH_STEPS 20
+
+// The difference between the durations of the x and y components of a 2D trajectory
+// that is close enough to stop searching, in seconds
+#define BANG_BANG_TRAJECTORY_2D_DURATION_TOLERANCE_SECONDS 1e-4f
+
+/**
+ * A trajectory along one axis, made of up to three parts that each have a constant
+ * acceleration. Positions are relative to where the trajectory starts. After the last
+ * part, the trajectory continues at its final velocity.
+ */
+typedef struct
+{
+    // The constant acceleration of each part
+    BangBangScalar accelerations[BANG_BANG_TRAJECTORY_NUM_PARTS];
+    // How long each part lasts, in seconds
+    BangBangScalar durations[BANG_BANG_TRAJECTORY_NUM_PARTS];
+    // The position at the start of each part
+    BangBangScalar start_positions[BANG_BANG_TRAJECTORY_NUM_PARTS];
+    // The velocity at the start of each part
+    BangBangScalar start_velocities[BANG_BANG_TRAJECTORY_NUM_PARTS];
+} BangBangTrajectory1D;
+
+/**
+ * A trajectory in two dimensions, made of one trajectory along each axis. The
+ * acceleration and velocity limits are split between the axes so that both finish at
+ * about the same time.
+ */
+typedef struct
+{
+    BangBangTrajectory1D x;
+    BangBangTrajectory1D y;
+} BangBangTrajectory2D;
+
+/**
+ * Sets one part of a 1D trajectory, starting where the previous part ends
+ *
+ * @param trajectory the trajectory to set the part of
+ * @param part the index of the part
+ * @param acceleration the constant acceleration of the part
+ * @param duration how long the part lasts, in seconds. Negative durations, which can
+ * only come from rounding, are treated as 0
+ */
+static inline void setBangBangTrajectory1DPart(BangBangTrajectory1D *trajectory,
+                                               unsigned part, BangBangScalar acceleration,
+                                               BangBangScalar duration)
+{
+    duration                        = BANG_BANG_FMAX(duration, 0.0f);
+    trajectory->accelerations[part] = acceleration;
+    trajectory->durations[part]     = duration;
+    if (part + 1 < BANG_BANG_TRAJECTORY_NUM_PARTS)
+    {
+        trajectory->start_positions[part + 1] =
+            trajectory->start_positions[part] +
+            trajectory->start_velocities[part] * duration +
+            acceleration * duration * duration / 2.0f;
+        trajectory->start_velocities[part + 1] =
+            trajectory->start_velocities[part] + acceleration * duration;
+    }
+}
+
+/**
+ * Plans the fastest trajectory along one axis that moves by the given displacement
+ * and ends with the given velocity
+ *
+ * @param displacement how far to move, in metres (or radians)
+ * @param initial_velocity the velocity at the start of the trajectory
+ * @param final_velocity the velocity to have when the displacement is reached. It is
+ * clamped to the maximum velocity. If it is faster than we can speed up to in the
+ * direction of the displacement, the trajectory speeds up the whole way and reaches the
+ * displacement slower instead
+ * @param max_acceleration the maximum acceleration, which must be positive
+ * @param max_velocity the maximum velocity, which must be positive and can be
+ * INFINITY. If the initial velocity is faster, the trajectory slows down to it
+ *
+ * @return the fastest trajectory with the given start and end
+ */
+static inline BangBangTrajectory1D planBangBangTrajectory1D(
+    BangBangScalar displacement, BangBangScalar initial_velocity,
+    BangBangScalar final_velocity, BangBangScalar max_acceleration,
+    BangBangScalar max_velocity)
+{
+    final_velocity =
+        BANG_BANG_FMAX(BANG_BANG_FMIN(final_velocity, max_velocity), -max_velocity);
+
+    // The displacement needed to go straight from the initial to the final velocity
+    BangBangScalar displacement_to_final_velocity =
+        BANG_BANG_FABS(final_velocity - initial_velocity) *
+        (initial_velocity + final_velocity) / (2.0f * max_acceleration);
+
+    BangBangTrajectory1D trajectory;
+    trajectory.start_positions[0]  = 0.0f;
+    trajectory.start_velocities[0] = initial_velocity;
+
+    // Going the other way first just to have room to speed up to the final velocity
+    // would be slower than arriving early with a lower velocity
+    BangBangScalar travel_direction = displacement >= 0.0f ? 1.0f : -1.0f;
+    if (travel_direction * final_velocity > BANG_BANG_FABS(initial_velocity) &&
+        BANG_BANG_FABS(displacement) < travel_direction * displacement_to_final_velocity)
+    {
+        BangBangScalar arrival_speed =
+            BANG_BANG_SQRT(initial_velocity * initial_velocity +
+                           2.0f * max_acceleration * BANG_BANG_FABS(displacement));
+        setBangBangTrajectory1DPart(
+            &trajectory, 0, travel_direction * max_acceleration,
+            (arrival_speed - travel_direction * initial_velocity) / max_acceleration);
+        setBangBangTrajectory1DPart(&trajectory, 1, 0.0f, 0.0f);
+        setBangBangTrajectory1DPart(&trajectory, 2, 0.0f, 0.0f);
+        return trajectory;
+    }
+
+    // If we have further to go than it takes to reach the final velocity, the fastest
+    // trajectory first speeds up in the positive direction, otherwise it speeds up in
+    // the negative direction. We plan the positive case, mirroring everything first if
+    // needed
+    BangBangScalar direction =
+        displacement >= displacement_to_final_velocity ? 1.0f : -1.0f;
+    displacement *= direction;
+    initial_velocity *= direction;
+    final_velocity *= direction;
+
+    // Accelerate up to the peak velocity and then decelerate to the final velocity,
+    // which covers the displacement exactly:
+    // displacement = (peak^2 - initial^2) / (2a) + (peak^2 - final^2) / (2a)
+    BangBangScalar peak_velocity = BANG_BANG_SQRT(BANG_BANG_FMAX(
+        max_acceleration * displacement +
+            (initial_velocity * initial_velocity + final_velocity * final_velocity) /
+                2.0f,
+        0.0f));
+
+    if (peak_velocity <= max_velocity)
+    {
+        setBangBangTrajectory1DPart(
+            &trajectory, 0, direction * max_acceleration,
+            (peak_velocity - initial_velocity) / max_acceleration);
+        setBangBangTrajectory1DPart(&trajectory, 1, 0.0f, 0.0f);
+        setBangBangTrajectory1DPart(&trajectory, 2, -direction * max_acceleration,
+                                    (peak_velocity - final_velocity) / max_acceleration);
+    }
+    else
+    {
+        // Change speed to the maximum velocity, coast, and then decelerate to the final
+        // velocity. The initial velocity can be above the maximum, in which case the
+        // first part slows down instead
+        BangBangScalar first_duration =
+            BANG_BANG_FABS(max_velocity - initial_velocity) / max_acceleration;
+        BangBangScalar last_duration = (max_velocity - final_velocity) / max_acceleration;
+        BangBangScalar coast_displacement =
+            displacement - (initial_velocity + max_velocity) / 2.0f * first_duration -
+            (max_velocity + final_velocity) / 2.0f * last_duration;
+
+        setBangBangTrajectory1DPart(
+            &trajectory, 0,
+            direction *
+                BANG_BANG_COPYSIGN(max_acceleration, max_velocity - initial_velocity),
+            first_duration);
+        setBangBangTrajectory1DPart(&trajectory, 1, 0.0f,
+                                    coast_displacement / max_velocity);
+        setBangBangTrajectory1DPart(&trajectory, 2, -direction * max_acceleration,
+                                    last_duration);
+    }
+    return trajectory;
+}
+
+/**
+ * Returns how long a 1D trajectory takes to reach its destination
+ *
+ * @param trajectory the trajectory
+ *
+ * @return the duration of the trajectory, in seconds
+ */
+static inline BangBangScalar getBangBangTrajectory1DDuration(
+    const BangBangTrajectory1D *trajectory)
+{
+    return trajectory->durations[0] + trajectory->durations[1] + trajectory->durations[2];
+}
+
+/**
+ * Returns the part of a 1D trajectory at the given time, and how far into that part
+ * the time is
+ *
+ * @param trajectory the trajectory
+ * @param time the time since the start of the trajectory, in seconds
+ * @param time_into_part set to the time since the start of the returned part. After
+ * the end of the trajectory, this is past the end of the last part
+ *
+ * @return the index of the part at the given time
+ */
+static inline unsigned getBangBangTrajectory1DPartAtTime(
+    const BangBangTrajectory1D *trajectory, BangBangScalar time,
+    BangBangScalar *time_into_part)
+{
+    time = BANG_BANG_FMAX(time, 0.0f);
+    unsigned part;
+    for (part = 0; part + 1 < BANG_BANG_TRAJECTORY_NUM_PARTS; part++)
+    {
+        if (time <= trajectory->durations[part])
+        {
+            break;
+        }
+        time -= trajectory->durations[part];
+    }
+    *time_into_part = time;
+    return part;
+}
+
+/**
+ * Returns the position along a 1D trajectory at the given time
+ *
+ * @param trajectory the trajectory
+ * @param time the time since the start of the trajectory, in seconds
+ *
+ * @return the position at the given time, relative to the start of the trajectory
+ */
+static inline BangBangScalar getBangBangTrajectory1DPosition(
+    const BangBangTrajectory1D *trajectory, BangBangScalar time)
+{
+    BangBangScalar time_into_part;
+    unsigned part = getBangBangTrajectory1DPartAtTime(trajectory, time, &time_into_part);
+
+    // After the end of the trajectory, it continues at its final velocity
+    BangBangScalar acceleration_time =
+        BANG_BANG_FMIN(time_into_part, trajectory->durations[part]);
+    BangBangScalar end_velocity = trajectory->start_velocities[part] +
+                                  trajectory->accelerations[part] * acceleration_time;
+    return trajectory->start_positions[part] +
+           trajectory->start_velocities[part] * acceleration_time +
+           trajectory->accelerations[part] * acceleration_time * acceleration_time /
+               2.0f +
+           end_velocity * (time_into_part - acceleration_time);
+}
+
+/**
+ * Returns the velocity along a 1D trajectory at the given time
+ *
+ * @param trajectory the trajectory
+ * @param time the time since the start of the trajectory, in seconds
+ *
+ * @return the velocity at the given time
+ */
+static inline BangBangScalar getBangBangTrajectory1DVelocity(
+    const BangBangTrajectory1D *trajectory, BangBangScalar time)
+{
+    BangBangScalar time_into_part;
+    unsigned part = getBangBangTrajectory1DPartAtTime(trajectory, time, &time_into_part);
+    return trajectory->start_velocities[part] +
+           trajectory->accelerations[part] *
+               BANG_BANG_FMIN(time_into_part, trajectory->durations[part]);
+}
+
+/**
+ * Plans a 2D trajectory that moves by the given displacement and ends with the given
+ * velocity.
+ *
+ * The trajectory is planned as one 1D trajectory along each axis, with the maximum
+ * acceleration and velocity split between them by an angle. The angle is searched for
+ * so that both axes finish at about the same time, which gives a close to time-optimal
+ * trajectory that never goes over the limits.
+ *
+ * @param displacement the {x, y} distance to move, in metres
+ * @param initial_velocity the {x, y} velocity at the start of the trajectory
+ * @param final_velocity the {x, y} velocity to have when the displacement is reached
+ * @param max_acceleration the maximum magnitude of the acceleration, which must be
+ * positive
+ * @param max_velocity the maximum speed, which must be positive
+ *
+ * @return a trajectory with the given start and end
+ */
+static inline BangBangTrajectory2D planBangBangTrajectory2D(
+    const BangBangScalar displacement[2], const BangBangScalar initial_velocity[2],
+    const BangBangScalar final_velocity[2], BangBangScalar max_acceleration,
+    BangBangScalar max_velocity)
+{
+    BangBangTrajectory2D trajectory;
+
+    // If one axis has nothing to do, the other one gets the full limits
+    if (displacement[1] == 0.0f && initial_velocity[1] == 0.0f &&
+        final_velocity[1] == 0.0f)
+    {
+        trajectory.x =
+            planBangBangTrajectory1D(displacement[0], initial_velocity[0],
+                                     final_velocity[0], max_acceleration, max_velocity);
+        trajectory.y =
+            planBangBangTrajectory1D(0.0f, 0.0f, 0.0f, max_acceleration, max_velocity);
+        return trajectory;
+    }
+    if (displacement[0] == 0.0f && initial_velocity[0] == 0.0f &&
+        final_velocity[0] == 0.0f)
+    {
+        trajectory.x =
+            planBangBangTrajectory1D(0.0f, 0.0f, 0.0f, max_acceleration, max_velocity);
+        trajectory.y =
+            planBangBangTrajectory1D(displacement[1], initial_velocity[1],
+                                     final_velocity[1], max_acceleration, max_velocity);
+        return trajectory;
+    }
+
+    // Giving an axis a larger share of the limits makes it finish sooner, so we
+    // binary search for the angle at which both axes take the same time
+    BangBangScalar angle           = (BangBangScalar)M_PI / 4.0f;
+    BangBangScalar angle_increment = (BangBangScalar)M_PI / 8.0f;
+    for (unsigned step = 0; step < BANG_BANG_TRAJECTORY_2D_NUM_SEARCH_STEPS; step++)
+    {
+        trajectory.x = planBangBangTrajectory1D(
+            displacement[0], initial_velocity[0], final_velocity[0],
+            max_acceleration * BANG_BANG_COS(angle), max_velocity * BANG_BANG_COS(angle));
+        trajectory.y = planBangBangTrajectory1D(
+            displacement[1], initial_velocity[1], final_velocity[1],
+            max_acceleration * BANG_BANG_SIN(angle), max_velocity * BANG_BANG_SIN(angle));
+
+        BangBangScalar duration_difference =
+            getBangBangTrajectory1DDuration(&trajectory.x) -
+            getBangBangTrajectory1DDuration(&trajectory.y);
+        if (BANG_BANG_FABS(duration_difference) <
+            BANG_BANG_TRAJECTORY_2D_DURATION_TOLERANCE_SECONDS)
+        {
+            break;
+        }
+        angle += duration_difference > 0.0f ? -angle_increment : angle_increment;
+        angle_increment /= 2.0f;
+    }
+    return trajectory;
+}
+
+/**
+ * Returns how long a 2D trajectory takes to reach its destination
+ *
+ * @param trajectory the trajectory
+ *
+ * @return the duration of the trajectory, in seconds
+ */
+static inline BangBangScalar getBangBangTrajectory2DDuration(
+    const BangBangTrajectory2D *trajectory)
+{
+    return BANG_BANG_FMAX(getBangBangTrajectory1DDuration(&trajectory->x),
+                          getBangBangTrajectory1DDuration(&trajectory->y));
+}
+
+/**
+ * Finds the position along a 2D trajectory at the given time
+ *
+ * @param trajectory the trajectory
+ * @param time the time since the start of the trajectory, in seconds
+ * @param position set to the {x, y} position at the given time, relative to the start
+ * of the trajectory
+ */
+static inline void getBangBangTrajectory2DPosition(const BangBangTrajectory2D *trajectory,
+                                                   BangBangScalar time,
+                                                   BangBangScalar position[2])
+{
+    position[0] = getBangBangTrajectory1DPosition(&trajectory->x, time);
+    position[1] = getBangBangTrajectory1DPosition(&trajectory->y, time);
+}
+
+/**
+ * Finds the velocity along a 2D trajectory at the given time
+ *
+ * @param trajectory the trajectory
+ * @param time the time since the start of the trajectory, in seconds
+ * @param velocity set to the {x, y} velocity at the given time
+ */
+static inline void getBangBangTrajectory2DVelocity(const BangBangTrajectory2D *trajectory,
+                                                   BangBangScalar time,
+                                                   BangBangScalar velocity[2])
+{
+    velocity[0] = getBangBangTrajectory1DVelocity(&trajectory->x, time);
+    velocity[1] = getBangBangTrajectory1DVelocity(&trajectory->y, time);
+}
@@ -0,0 +1,279 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+extern "C"
+{
+#include "../bang_bang_trajectory.h"
+}
+
+#ifdef BANG_BANG_TRAJECTORY_USE_FLOAT
+// Floats only have about 7 significant digits, so the float build of these tests
+// allows larger errors
+constexpr double EPS                   = 1e-5;
+constexpr double END_TOLERANCE         = 1e-4;
+constexpr double INTEGRATION_TOLERANCE = 1e-3;
+#else
+constexpr double EPS                   = 1e-9;
+constexpr double END_TOLERANCE         = 1e-6;
+constexpr double INTEGRATION_TOLERANCE = 1e-4;
+#endif
+
+// Checks that a 1D trajectory ends at the displacement with the final velocity, and
+// that its velocity and position agree with its acceleration limit everywhere
+void checkTrajectoryIsValid(const BangBangTrajectory1D& trajectory,
+                            BangBangScalar displacement, BangBangScalar initial_velocity,
+                            BangBangScalar final_velocity,
+                            BangBangScalar max_acceleration)
+{
+    BangBangScalar duration = getBangBangTrajectory1DDuration(&trajectory);
+    EXPECT_NEAR(0, getBangBangTrajectory1DPosition(&trajectory, 0), EPS);
+    EXPECT_NEAR(initial_velocity, getBangBangTrajectory1DVelocity(&trajectory, 0), EPS);
+    EXPECT_NEAR(displacement, getBangBangTrajectory1DPosition(&trajectory, duration),
+                END_TOLERANCE);
+    EXPECT_NEAR(final_velocity, getBangBangTrajectory1DVelocity(&trajectory, duration),
+                END_TOLERANCE);
+
+    // Integrate the velocity with the trapezoid rule, which is exact for piecewise
+    // linear velocities except at the ends of the parts
+    const unsigned int num_steps = 10000;
+    BangBangScalar time_step     = duration / num_steps;
+    double integrated_position   = 0;
+    for (unsigned int i = 0; i < num_steps; i++)
+    {
+        BangBangScalar start_velocity =
+            getBangBangTrajectory1DVelocity(&trajectory, i * time_step);
+        BangBangScalar end_velocity =
+            getBangBangTrajectory1DVelocity(&trajectory, (i + 1) * time_step);
+        EXPECT_LE(std::abs(end_velocity - start_velocity),
+                  max_acceleration * time_step + EPS);
+        integrated_position += (start_velocity + end_velocity) / 2 * time_step;
+    }
+    EXPECT_NEAR(displacement, integrated_position, INTEGRATION_TOLERANCE);
+}
+
+TEST(BangBangTrajectoryTest, test_1d_accelerate_then_decelerate_from_rest)
+{
+    BangBangTrajectory1D trajectory = planBangBangTrajectory1D(1, 0, 0, 2, 10);
+
+    // Accelerate for half the distance and decelerate for the other half
+    BangBangScalar expected_duration = 2 * std::sqrt(2 * 0.5 / 2);
+    EXPECT_NEAR(expected_duration, getBangBangTrajectory1DDuration(&trajectory), EPS);
+    EXPECT_NEAR(0.5, getBangBangTrajectory1DPosition(&trajectory, expected_duration / 2),
+                EPS);
+    EXPECT_NEAR(std::sqrt(2.0),
+                getBangBangTrajectory1DVelocity(&trajectory, expected_duration / 2), EPS);
+    checkTrajectoryIsValid(trajectory, 1, 0, 0, 2);
+}
+
+TEST(BangBangTrajectoryTest, test_1d_coasts_at_max_velocity)
+{
+    BangBangTrajectory1D trajectory = planBangBangTrajectory1D(10, 0, 0, 2, 2);
+
+    // 1s to accelerate over 1m, 4s to coast over 8m and 1s to decelerate over 1m
+    EXPECT_NEAR(6, getBangBangTrajectory1DDuration(&trajectory), EPS);
+    EXPECT_NEAR(2, getBangBangTrajectory1DVelocity(&trajectory, 3), EPS);
+    EXPECT_NEAR(5, getBangBangTrajectory1DPosition(&trajectory, 3), EPS);
+    checkTrajectoryIsValid(trajectory, 10, 0, 0, 2);
+}
+
+TEST(BangBangTrajectoryTest, test_1d_negative_displacement)
+{
+    BangBangTrajectory1D trajectory = planBangBangTrajectory1D(-10, 0, 0, 2, 2);
+
+    EXPECT_NEAR(6, getBangBangTrajectory1DDuration(&trajectory), EPS);
+    EXPECT_NEAR(-2, getBangBangTrajectory1DVelocity(&trajectory, 3), EPS);
+    checkTrajectoryIsValid(trajectory, -10, 0, 0, 2);
+}
+
+TEST(BangBangTrajectoryTest, test_1d_initial_velocity_away_from_destination)
+{
+    BangBangTrajectory1D trajectory = planBangBangTrajectory1D(1, -1, 0, 2, 10);
+
+    // 0.5s to stop after going 0.25m the wrong way, then 1.25m from rest
+    BangBangScalar expected_duration = 0.5 + 2 * std::sqrt(2 * 0.625 / 2);
+    EXPECT_NEAR(expected_duration, getBangBangTrajectory1DDuration(&trajectory), EPS);
+    EXPECT_NEAR(-0.25, getBangBangTrajectory1DPosition(&trajectory, 0.5), EPS);
+    checkTrajectoryIsValid(trajectory, 1, -1, 0, 2);
+}
+
+TEST(BangBangTrajectoryTest, test_1d_overshoots_when_too_fast_to_stop)
+{
+    BangBangTrajectory1D trajectory = planBangBangTrajectory1D(1, 3, 0, 2, 10);
+
+    // 1.5s to stop 2.25m away, then 1.25m back from rest
+    BangBangScalar expected_duration = 1.5 + 2 * std::sqrt(2 * 0.625 / 2);
+    EXPECT_NEAR(expected_duration, getBangBangTrajectory1DDuration(&trajectory), EPS);
+    EXPECT_NEAR(2.25, getBangBangTrajectory1DPosition(&trajectory, 1.5), EPS);
+    checkTrajectoryIsValid(trajectory, 1, 3, 0, 2);
+}
+
+TEST(BangBangTrajectoryTest, test_1d_slows_down_when_faster_than_max_velocity)
+{
+    BangBangTrajectory1D trajectory = planBangBangTrajectory1D(10, 4, 0, 2, 2);
+
+    // 1s to slow down to 2m/s over 3m, 3s to coast over 6m and 1s to stop over 1m
+    EXPECT_NEAR(5, getBangBangTrajectory1DDuration(&trajectory), EPS);
+    EXPECT_NEAR(2, getBangBangTrajectory1DVelocity(&trajectory, 1), EPS);
+    checkTrajectoryIsValid(trajectory, 10, 4, 0, 2);
+}
+
+TEST(BangBangTrajectoryTest, test_1d_reaches_final_velocity)
+{
+    BangBangTrajectory1D trajectory = planBangBangTrajectory1D(1, 0, 1, 2, 10);
+
+    checkTrajectoryIsValid(trajectory, 1, 0, 1, 2);
+    // After the end, the trajectory continues at its final velocity
+    BangBangScalar duration = getBangBangTrajectory1DDuration(&trajectory);
+    EXPECT_NEAR(1, getBangBangTrajectory1DVelocity(&trajectory, duration + 1), EPS);
+    EXPECT_NEAR(2, getBangBangTrajectory1DPosition(&trajectory, duration + 1),
+                END_TOLERANCE);
+}
+
+TEST(BangBangTrajectoryTest, test_1d_arrives_slower_when_final_velocity_is_out_of_reach)
+{
+    // Speeding up from 0 to 2m/s takes 1m, so over 0.25m we only reach 1m/s
+    BangBangTrajectory1D trajectory = planBangBangTrajectory1D(0.25, 0, 2, 2, 10);
+
+    EXPECT_NEAR(0.5, getBangBangTrajectory1DDuration(&trajectory), EPS);
+    checkTrajectoryIsValid(trajectory, 0.25, 0, 1, 2);
+}
+
+TEST(BangBangTrajectoryTest, test_1d_final_velocity_is_clamped_to_max_velocity)
+{
+    BangBangTrajectory1D trajectory = planBangBangTrajectory1D(10, 0, 5, 2, 2);
+
+    checkTrajectoryIsValid(trajectory, 10, 0, 2, 2);
+}
+
+TEST(BangBangTrajectoryTest, test_1d_already_at_destination)
+{
+    BangBangTrajectory1D trajectory = planBangBangTrajectory1D(0, 0, 0, 2, 2);
+
+    EXPECT_EQ(0, getBangBangTrajectory1DDuration(&trajectory));
+    EXPECT_EQ(0, getBangBangTrajectory1DPosition(&trajectory, 1));
+    EXPECT_EQ(0, getBangBangTrajectory1DVelocity(&trajectory, 1));
+}
+
+TEST(BangBangTrajectoryTest, test_1d_infinite_max_velocity)
+{
+    BangBangTrajectory1D trajectory = planBangBangTrajectory1D(100, 0, 0, 2, INFINITY);
+
+    EXPECT_NEAR(2 * std::sqrt(2 * 50.0 / 2), getBangBangTrajectory1DDuration(&trajectory),
+                EPS);
+    checkTrajectoryIsValid(trajectory, 100, 0, 0, 2);
+}
+
+TEST(BangBangTrajectoryTest, test_1d_random_trajectories_are_valid)
+{
+    std::mt19937 random_number_generator(0);
+    std::uniform_real_distribution<BangBangScalar> displacement_distribution(-5, 5);
+    std::uniform_real_distribution<BangBangScalar> velocity_distribution(-3, 3);
+    std::uniform_real_distribution<BangBangScalar> limit_distribution(0.5, 4);
+
+    for (unsigned int i = 0; i < 200; i++)
+    {
+        BangBangScalar displacement = displacement_distribution(random_number_generator);
+        BangBangScalar initial_velocity = velocity_distribution(random_number_generator);
+        BangBangScalar max_acceleration = limit_distribution(random_number_generator);
+        BangBangScalar max_velocity     = limit_distribution(random_number_generator);
+        BangBangScalar final_velocity   = std::clamp(
+            velocity_distribution(random_number_generator), -max_velocity, max_velocity);
+
+        BangBangTrajectory1D trajectory =
+            planBangBangTrajectory1D(displacement, initial_velocity, final_velocity,
+                                     max_acceleration, max_velocity);
+
+        // The final velocity is reached, unless the trajectory has to speed up the
+        // whole way and reaches the displacement slower
+        BangBangScalar duration = getBangBangTrajectory1DDuration(&trajectory);
+        BangBangScalar reached_final_velocity =
+            getBangBangTrajectory1DVelocity(&trajectory, duration);
+        if (std::abs(reached_final_velocity - final_velocity) > END_TOLERANCE)
+        {
+            EXPECT_LT(std::abs(reached_final_velocity), std::abs(final_velocity));
+            EXPECT_GE(reached_final_velocity * final_velocity, 0);
+        }
+        checkTrajectoryIsValid(trajectory, displacement, initial_velocity,
+                               reached_final_velocity, max_acceleration);
+        // The trajectory never goes faster than the maximum velocity, unless it starts
+        // faster than it
+        for (BangBangScalar time = 0; time <= duration; time += duration / 100)
+        {
+            EXPECT_LE(std::abs(getBangBangTrajectory1DVelocity(&trajectory, time)),
+                      std::max(max_velocity, std::abs(initial_velocity)) + EPS);
+        }
+    }
+}
+
+TEST(BangBangTrajectoryTest, test_2d_along_one_axis_matches_1d)
+{
+    BangBangScalar displacement[2]     = {3, 0};
+    BangBangScalar initial_velocity[2] = {1, 0};
+    BangBangScalar final_velocity[2]   = {0, 0};
+
+    BangBangTrajectory2D trajectory =
+        planBangBangTrajectory2D(displacement, initial_velocity, final_velocity, 3, 2);
+    BangBangTrajectory1D expected_trajectory = planBangBangTrajectory1D(3, 1, 0, 3, 2);
+
+    EXPECT_EQ(getBangBangTrajectory1DDuration(&expected_trajectory),
+              getBangBangTrajectory2DDuration(&trajectory));
+    BangBangScalar position[2];
+    getBangBangTrajectory2DPosition(&trajectory, 0.5, position);
+    EXPECT_EQ(getBangBangTrajectory1DPosition(&expected_trajectory, 0.5), position[0]);
+    EXPECT_EQ(0, position[1]);
+}
+
+TEST(BangBangTrajectoryTest, test_2d_axes_finish_together_within_limits)
+{
+    BangBangScalar displacement[2]     = {2, -1};
+    BangBangScalar initial_velocity[2] = {0.5, 1};
+    BangBangScalar final_velocity[2]   = {0, 0};
+    BangBangScalar max_acceleration    = 3;
+    BangBangScalar max_velocity        = 2;
+
+    BangBangTrajectory2D trajectory = planBangBangTrajectory2D(
+        displacement, initial_velocity, final_velocity, max_acceleration, max_velocity);
+
+    EXPECT_NEAR(getBangBangTrajectory1DDuration(&trajectory.x),
+                getBangBangTrajectory1DDuration(&trajectory.y),
+                BANG_BANG_TRAJECTORY_2D_DURATION_TOLERANCE_SECONDS);
+
+    BangBangScalar duration = getBangBangTrajectory2DDuration(&trajectory);
+    BangBangScalar position[2];
+    getBangBangTrajectory2DPosition(&trajectory, duration, position);
+    EXPECT_NEAR(displacement[0], position[0], END_TOLERANCE);
+    EXPECT_NEAR(displacement[1], position[1], END_TOLERANCE);
+
+    for (BangBangScalar time = 0; time <= duration; time += duration / 100)
+    {
+        BangBangScalar velocity[2];
+        getBangBangTrajectory2DVelocity(&trajectory, time, velocity);
+        EXPECT_LE(std::hypot(velocity[0], velocity[1]),
+                  std::max<BangBangScalar>(max_velocity, std::hypot(1.5, 1)));
+    }
+    for (unsigned int part = 0; part < BANG_BANG_TRAJECTORY_NUM_PARTS; part++)
+    {
+        EXPECT_LE(std::hypot(trajectory.x.accelerations[part],
+                             trajectory.y.accelerations[part]),
+                  max_acceleration + EPS);
+    }
+}
+
+TEST(BangBangTrajectoryTest, test_2d_is_not_faster_than_1d_along_the_straight_line)
+{
+    // Moving diagonally from rest, the fastest trajectory goes along the straight line
+    // with the full limits, which the split axes can't beat
+    BangBangScalar displacement[2]     = {3, 4};
+    BangBangScalar initial_velocity[2] = {0, 0};
+    BangBangScalar final_velocity[2]   = {0, 0};
+
+    BangBangTrajectory2D trajectory =
+        planBangBangTrajectory2D(displacement, initial_velocity, final_velocity, 3, 2);
+    BangBangTrajectory1D straight_line_trajectory =
+        planBangBangTrajectory1D(5, 0, 0, 3, 2);
+
+    EXPECT_NEAR(getBangBangTrajectory1DDuration(&straight_line_trajectory),
+                getBangBangTrajectory2DDuration(&trajectory), 1e-3);
+}
@@ -0,0 +1,14 @@
+/**
+ * main function for the shared tests that don't have their own
+ */
+
+#include <gtest/gtest.h>
+
+#include <iostream>
+
+int main(int argc, char **argv)
+{
+    std::cout << argv[0] << std::endl;
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -1,24 +1,75 @@
 #include "ai/ai.h"
 
+#include <algorithm>
 #include <chrono>
+#include <thread>
 
 #include "ai/hl/stp/stp.h"
+#include "ai/navigator/path_planning_navigator/path_planning_navigator.h"
 #include "ai/navigator/placeholder_navigator/placeholder_navigator.h"
+#include "util/parameter/dynamic_parameters.h"
+
+namespace
+{
+    // The number of worker threads STP runs tactics on. The current tactics are cheap
+    // enough that waking up worker threads costs more than it saves (see
+    // parallel_tactic_benchmark), so they are run on the AI thread for now
+    const size_t STP_NUM_WORKER_THREADS = 0;
+
+    // How long the PathPlanningNavigator may spend planning every robot's path per tick
+    const Duration NAVIGATOR_PLANNING_BUDGET = Duration::fromMilliseconds(5);
+    // Paths are planned on every core, with the AI thread as one of the planners
+    const size_t NAVIGATOR_NUM_WORKER_THREADS =
+        std::max(1u, std::thread::hardware_concurrency()) - 1;
+}  // namespace
 
 AI::AI()
+    // We use the current time in nanoseconds to initialize STP with a "random" seed
+    : AI(std::chrono::system_clock::now().time_since_epoch().count(),
+         NAVIGATOR_NUM_WORKER_THREADS, TickBudget::getInstance())
+{
+}
+
+AI::AI(long random_seed, size_t num_navigator_worker_threads,
+       std::shared_ptr<TickBudget> tick_budget)
     : navigator(std::make_unique<PlaceholderNavigator>()),
-      // We use the current time in nanoseconds to initialize STP with a "random" seed
-      high_level(std::make_unique<STP>(
-          std::chrono::system_clock::now().time_since_epoch().count()))
+      high_level(std::make_unique<STP>(random_seed, STP_NUM_WORKER_THREADS)),
+      path_planning_navigator(),
+      num_navigator_worker_threads(num_navigator_worker_threads),
+      tick_budget(tick_budget)
 {
 }
 
-std::vector<std::unique_ptr<Primitive>> AI::getPrimitives(const World &world) const
+const std::vector<PrimitiveVariant> &AI::getPrimitives(const World &world) const
 {
-    std::vector<std::unique_ptr<Intent>> assignedIntents = high_level->getIntents(world);
+    auto start_time                            = std::chrono::steady_clock::now();
+    std::vector<IntentVariant> assignedIntents = high_level->getIntents(world);
+    auto high_level_end_time                   = std::chrono::steady_clock::now();
+
+    bool use_path_planning_navigator =
+        Util::DynamicParameters::Navigator::use_path_planning_navigator.value();
+    // The PathPlanningNavigator starts its worker threads when it is created, so it
+    // is only created once it is first used
+    if (use_path_planning_navigator && !path_planning_navigator)
+    {
+        path_planning_navigator = std::make_unique<PathPlanningNavigator>(
+            NAVIGATOR_PLANNING_BUDGET, num_navigator_worker_threads, tick_budget);
+    }
+    const std::unique_ptr<Navigator> &current_navigator =
+        use_path_planning_navigator ? path_planning_navigator : navigator;
+    const std::vector<PrimitiveVariant> &assignedPrimitives =
+        current_navigator->getAssignedPrimitives(world, assignedIntents);
+    auto navigator_end_time = std::chrono::steady_clock::now();
 
-    std::vector<std::unique_ptr<Primitive>> assignedPrimitives =
-        navigator->getAssignedPrimitives(world, assignedIntents);
+    // Record how long each stage took, so the TickScheduler can report it
+    tick_budget->recordStage(
+        "high_level",
+        Duration::fromSeconds(
+            std::chrono::duration<double>(high_level_end_time - start_time).count()));
+    tick_budget->recordStage(
+        "navigator", Duration::fromSeconds(std::chrono::duration<double>(
+                                               navigator_end_time - high_level_end_time)
+                                               .count()));
 
     return assignedPrimitives;
 }
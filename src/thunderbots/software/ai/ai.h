@@ -2,7 +2,8 @@
 
 #include "ai/hl/hl.h"
 #include "ai/navigator/navigator.h"
-#include "ai/primitive/primitive.h"
+#include "ai/primitive/primitive_variant.h"
+#include "ai/tick_scheduler/tick_budget.h"
 #include "ai/world/world.h"
 #include "util/time/timestamp.h"
 
@@ -18,6 +19,19 @@ class AI final
      */
     explicit AI();
 
+    /**
+     * Creates a new AI that makes the same decisions every time it is given the same
+     * Worlds, for example to replay simulated games
+     *
+     * @param random_seed The seed for the random decisions made by the AI
+     * @param num_navigator_worker_threads The number of threads, other than the one
+     * calling getPrimitives, that the PathPlanningNavigator plans paths on
+     * @param tick_budget The TickBudget to record how long each stage of the AI took
+     * in. Several AIs can be run on separate threads if each has its own TickBudget
+     */
+    explicit AI(long random_seed, size_t num_navigator_worker_threads,
+                std::shared_ptr<TickBudget> tick_budget);
+
     /**
      * Calculates the Primitives that should be run by our Robots given the current
      * state of the world.
@@ -25,11 +39,17 @@ class AI final
      * @param world The state of the World with which to make the decisions
      *
      * @return the Primitives that should be run by our Robots given the current state
-     * of the world.
+     * of the world. The Primitives are only valid until the next call to getPrimitives
      */
-    std::vector<std::unique_ptr<Primitive>> getPrimitives(const World& world) const;
+    const std::vector<PrimitiveVariant>& getPrimitives(const World& world) const;
 
    private:
     std::unique_ptr<HL> high_level;
     std::unique_ptr<Navigator> navigator;
+    // Used instead of the navigator when the use_path_planning_navigator parameter is
+    // set. It is only created the first time the parameter is set, so its worker
+    // threads are not started unless it is used
+    mutable std::unique_ptr<Navigator> path_planning_navigator;
+    size_t num_navigator_worker_threads;
+    std::shared_ptr<TickBudget> tick_budget;
 };
@@ -1,5 +1,7 @@
 #include "ai/evaluation/pass.h"
 
+#include "shared/bang_bang_trajectory.h"
+
 Duration AI::Evaluation::getTimeToOrientationForRobot(const Robot& robot,
                                                       const Angle& desired_orientation,
                                                       const double& max_velocity,
@@ -46,39 +48,25 @@ Duration AI::Evaluation::getTimeToPositionForRobot(const Robot& robot, const Poi
                                                    const double& max_velocity,
                                                    const double& max_acceleration)
 {
-    // We assume a linear acceleration profile:
-    // (1) velocity = MAX_ACCELERATION*time
-    // we integrate (1) to get:
-    // (2) displacement = MAX_ACCELERATION/2 * time^2
-    // we rearrange to get:
-    // (3) time = sqrt(2 * displacement / MAX_ACCELERATION)
-    // we sub. (3) into (1) to get:
-    // (4) velocity = MAX_ACCELERATION*sqrt(2 * displacement / MAX_ACCELERATION)
-    // and rearrange to get:
-    // (5) displacement = (velocity / MAX_ACCELERATION)^2 * MAX_ACCELERATION/2
-    // We re-arrange (3) to get:
-    // (6) displacement = time^2 * MAX_ACCELERATION/2
+    // We plan the trajectory along and perpendicular to the line from the robot to the
+    // destination, so that a robot that is still or moving along that line gets the
+    // exact time of the 1D trajectory along it
+    Vector displacement = dest - robot.position();
+    Vector direction    = displacement.norm();
+    if (direction.len() == 0)
+    {
+        // Any direction works when the robot is already at the destination
+        direction = Vector(1, 0);
+    }
 
-    double dist = (robot.position() - dest).len();
+    double displacement_in_direction[2]     = {displacement.len(), 0};
+    double initial_velocity_in_direction[2] = {robot.velocity().dot(direction),
+                                               robot.velocity().dot(direction.perp())};
+    double final_velocity[2]                = {0, 0};
 
-    // Calculate the distance required to reach max possible velocity of the robot
-    // using (5)
-    double dist_to_max_possible_vel =
-        std::pow(max_velocity / max_acceleration, 2) * max_acceleration / 2;
-
-    // Calculate how long we'll accelerate for using (3), taking into account that we
-    // might not actually reach the max velocity if it will take too much distance
-    double acceleration_time =
-        std::sqrt(2 * std::min(dist / 2, dist_to_max_possible_vel) / max_acceleration);
+    BangBangTrajectory2D trajectory =
+        planBangBangTrajectory2D(displacement_in_direction, initial_velocity_in_direction,
+                                 final_velocity, max_acceleration, max_velocity);
 
-    // Calculate how long we'll be at the max possible velocity (if any time at all)
-    double time_at_max_velocity =
-        std::max(0.0, dist - 2 * dist_to_max_possible_vel) / max_velocity;
-
-    // The time taken to get to the receiver point is:
-    // time to accelerate + time at the max velocity + time to de-accelerate
-    // Note that the acceleration time is the same as a de-acceleration time
-    double travel_time = 2 * acceleration_time + time_at_max_velocity;
-
-    return Duration::fromSeconds(travel_time);
+    return Duration::fromSeconds(getBangBangTrajectory2DDuration(&trajectory));
 }
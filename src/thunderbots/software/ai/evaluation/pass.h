@@ -28,8 +28,10 @@ namespace AI::Evaluation
 
     /**
      * Calculate minimum time it would take for the given robot to reach the given point
+     * and stop there, starting from its current velocity
      *
-     * This is only a rough calculation in order to be as performant as possible
+     * This uses the same bang-bang trajectories as the motion controllers, so it is
+     * cheap to calculate and agrees with how the robots actually move
      *
      * @param robot The robot to calculate the time for
      * @param dest The destination that the robot is going to
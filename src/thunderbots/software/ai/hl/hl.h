@@ -3,7 +3,7 @@
 #include <memory>
 #include <vector>
 
-#include "ai/intent/intent.h"
+#include "ai/intent/intent_variant.h"
 #include "ai/world/world.h"
 
 /**
@@ -25,10 +25,9 @@ class HL
      *
      * @param world The current state of the world
      *
-     * @return A vector of unique pointers to the Intents our friendly robots should be
-     * running
+     * @return A vector of the Intents our friendly robots should be running
      */
-    virtual std::vector<std::unique_ptr<Intent>> getIntents(const World &world) = 0;
+    virtual std::vector<IntentVariant> getIntents(const World &world) = 0;
 
     virtual ~HL() = default;
 };
@@ -2,14 +2,11 @@
 
 #include "util/logger/init.h"
 
-Action::Action()
-    : intent_sequence(boost::bind(&Action::calculateNextIntentWrapper, this, _1))
-{
-}
+Action::Action() : intent_sequence(), robot() {}
 
 bool Action::done() const
 {
-    return !static_cast<bool>(intent_sequence);
+    return intent_sequence.done();
 }
 
 std::unique_ptr<Intent> Action::getNextIntent()
@@ -22,26 +19,12 @@ std::unique_ptr<Intent> Action::getNextIntent()
         return std::unique_ptr<Intent>{};
     }
 
-    // If the coroutine "iterator" is done, the calculateNextIntent function has completed
+    // If the coroutine is done, the calculateNextIntent function has completed
     // and therefore the Action is done, so we return a null pointer
-    if (intent_sequence)
+    if (!intent_sequence.done())
     {
         // Calculate and return the next Intent
-        intent_sequence();
-        auto next_intent = intent_sequence.get();
-        return next_intent;
+        return calculateNextIntent(intent_sequence);
     }
     return std::unique_ptr<Intent>{};
 }
-
-std::unique_ptr<Intent> Action::calculateNextIntentWrapper(
-    intent_coroutine::push_type &yield)
-{
-    // Yield a null pointer the very first time the function is called. This value will
-    // never be seen/used by the rest of the system.
-    yield(std::unique_ptr<Intent>{});
-
-    // Anytime after the first function call, the calculateNextIntent function will be
-    // used to perform the real logic
-    return calculateNextIntent(yield);
-}
\ No newline at end of file
@@ -51,8 +51,7 @@ class ChipAction : public Action
                                                         double chip_distance_meters);
 
    private:
-    std::unique_ptr<Intent> calculateNextIntent(
-        intent_coroutine::push_type& yield) override;
+    std::unique_ptr<Intent> calculateNextIntent(StacklessCoroutine& coroutine) override;
 
     // Action parameters
     Point chip_origin;
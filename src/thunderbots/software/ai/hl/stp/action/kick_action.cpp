@@ -30,8 +30,7 @@ std::unique_ptr<Intent> KickAction::updateStateAndGetNextIntent(
     return getNextIntent();
 }
 
-std::unique_ptr<Intent> KickAction::calculateNextIntent(
-    intent_coroutine::push_type& yield)
+std::unique_ptr<Intent> KickAction::calculateNextIntent(StacklessCoroutine& coroutine)
 {
     // How large the triangle is that defines the region where the robot is
     // behind the ball and ready to kick.
@@ -67,47 +66,55 @@ std::unique_ptr<Intent> KickAction::calculateNextIntent(
     //                             V
     //                     direction of kick
 
-    do
+    BOOST_ASIO_CORO_REENTER(coroutine)
     {
-        // A vector in the direction opposite the kick (behind the ball)
-        Vector behind_ball =
-            Vector::createFromAngle(this->kick_direction + Angle::half());
-
+        do
+        {
+            BOOST_ASIO_CORO_YIELD
+            {
+                // A vector in the direction opposite the kick (behind the ball)
+                Vector behind_ball =
+                    Vector::createFromAngle(this->kick_direction + Angle::half());
 
-        // The points below make up the triangle that defines the region we treat as
-        // "behind the ball". They correspond to the vertices labeled 'A', 'B', and 'C'
-        // in the ASCII diagram
+                // The points below make up the triangle that defines the region we treat
+                // as "behind the ball". They correspond to the vertices labeled 'A', 'B',
+                // and 'C' in the ASCII diagram
 
-        // We make the region close enough to the ball so that the robot will still be
-        // inside it when taking the kick.
-        Point behind_ball_vertex_A =
-            kick_origin + behind_ball.norm(DIST_TO_FRONT_OF_ROBOT_METERS * 0.5);
-        Point behind_ball_vertex_B =
-            behind_ball_vertex_A + behind_ball.norm(size_of_region_behind_ball) +
-            behind_ball.perp().norm(size_of_region_behind_ball / 2);
-        Point behind_ball_vertex_C =
-            behind_ball_vertex_A + behind_ball.norm(size_of_region_behind_ball) -
-            behind_ball.perp().norm(size_of_region_behind_ball / 2);
+                // We make the region close enough to the ball so that the robot will
+                // still be inside it when taking the kick.
+                Point behind_ball_vertex_A =
+                    kick_origin + behind_ball.norm(DIST_TO_FRONT_OF_ROBOT_METERS * 0.5);
+                Point behind_ball_vertex_B =
+                    behind_ball_vertex_A + behind_ball.norm(size_of_region_behind_ball) +
+                    behind_ball.perp().norm(size_of_region_behind_ball / 2);
+                Point behind_ball_vertex_C =
+                    behind_ball_vertex_A + behind_ball.norm(size_of_region_behind_ball) -
+                    behind_ball.perp().norm(size_of_region_behind_ball / 2);
 
-        Polygon behind_ball_region =
-            Polygon({behind_ball_vertex_A, behind_ball_vertex_B, behind_ball_vertex_C});
+                Polygon behind_ball_region = Polygon(
+                    {behind_ball_vertex_A, behind_ball_vertex_B, behind_ball_vertex_C});
 
-        bool robot_behind_ball = behind_ball_region.containsPoint(robot->position());
-        // The point in the middle of the region behind the ball
-        Point point_behind_ball =
-            kick_origin + behind_ball.norm(DIST_TO_FRONT_OF_ROBOT_METERS * 0.5 +
-                                           size_of_region_behind_ball / 2);
+                bool robot_behind_ball =
+                    behind_ball_region.containsPoint(robot->position());
+                // The point in the middle of the region behind the ball
+                Point point_behind_ball =
+                    kick_origin + behind_ball.norm(DIST_TO_FRONT_OF_ROBOT_METERS * 0.5 +
+                                                   size_of_region_behind_ball / 2);
 
-        // If we're not in position to kick, move into position
-        if (!robot_behind_ball)
-        {
-            yield(std::make_unique<MoveIntent>(robot->id(), point_behind_ball,
-                                               kick_direction, 0.0, 0));
-        }
-        else
-        {
-            yield(std::make_unique<KickIntent>(robot->id(), kick_origin, kick_direction,
-                                               kick_speed_meters_per_second, 0));
-        }
-    } while (true);
+                // If we're not in position to kick, move into position
+                if (!robot_behind_ball)
+                {
+                    return std::make_unique<MoveIntent>(robot->id(), point_behind_ball,
+                                                        kick_direction, 0.0, 0);
+                }
+                else
+                {
+                    return std::make_unique<KickIntent>(robot->id(), kick_origin,
+                                                        kick_direction,
+                                                        kick_speed_meters_per_second, 0);
+                }
+            }
+        } while (true);
+    }
+    return std::unique_ptr<Intent>{};
 }
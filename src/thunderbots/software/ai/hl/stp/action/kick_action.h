@@ -49,8 +49,7 @@ class KickAction : public Action
         double kick_speed_meters_per_second);
 
    private:
-    std::unique_ptr<Intent> calculateNextIntent(
-        intent_coroutine::push_type& yield) override;
+    std::unique_ptr<Intent> calculateNextIntent(StacklessCoroutine& coroutine) override;
 
     // Action parameters
     Point kick_origin;
@@ -39,8 +39,7 @@ class MoveAction : public Action
                                                         double final_speed);
 
    private:
-    std::unique_ptr<Intent> calculateNextIntent(
-        intent_coroutine::push_type& yield) override;
+    std::unique_ptr<Intent> calculateNextIntent(StacklessCoroutine& coroutine) override;
 
     // Action parameters
     Point destination;
@@ -41,8 +41,7 @@ class MoveSpinAction : public Action
                                                         AngularVelocity angular_velocity);
 
    private:
-    std::unique_ptr<Intent> calculateNextIntent(
-        intent_coroutine::push_type& yield) override;
+    std::unique_ptr<Intent> calculateNextIntent(StacklessCoroutine& coroutine) override;
 
     // Action parameters
     Point destination;
@@ -9,9 +9,9 @@
 
 namespace Evaluation
 {
-    std::optional<std::pair<Point, Duration>> findBestInterceptForBall(Ball ball,
-                                                                       Field field,
-                                                                       Robot robot)
+    std::optional<std::pair<Point, Duration>> findBestInterceptForBall(const Ball &ball,
+                                                                       const Field &field,
+                                                                       const Robot &robot)
     {
         static const double gradient_approx_step_size = 0.000001;
 
@@ -23,7 +23,6 @@ namespace Evaluation
      *         relative to the timestamp of the robot. If no possible intercept could be
      * found within the field bounds, returns std::nullopt
      */
-    std::optional<std::pair<Point, Duration>> findBestInterceptForBall(Ball ball,
-                                                                       Field field,
-                                                                       Robot robot);
+    std::optional<std::pair<Point, Duration>> findBestInterceptForBall(
+        const Ball &ball, const Field &field, const Robot &robot);
 }  // namespace Evaluation
@@ -11,24 +11,24 @@ namespace Evaluation
                                                              const Ball &ball,
                                                              const Field &field)
     {
-        if (team.numRobots() == 0)
+        std::vector<Robot> robots = team.getAllRobots();
+        if (robots.empty())
         {
             return std::nullopt;
         }
 
-        auto best_intercept =
-            Evaluation::findBestInterceptForBall(ball, field, team.getAllRobots().at(0));
-        auto baller_robot = team.getAllRobots().at(0);
+        std::optional<std::pair<Point, Duration>> best_intercept;
+        const Robot *baller_robot = &robots.at(0);
 
         // Find the robot that can intercept the ball the quickest
-        for (const auto &robot : team.getAllRobots())
+        for (const auto &robot : robots)
         {
             auto intercept = Evaluation::findBestInterceptForBall(ball, field, robot);
             if (!best_intercept ||
                 (intercept && intercept->second < best_intercept->second))
             {
                 best_intercept = intercept;
-                baller_robot   = robot;
+                baller_robot   = &robot;
             }
         }
 
@@ -37,7 +37,7 @@ namespace Evaluation
         // robot to the ball
         if (best_intercept)
         {
-            return baller_robot;
+            return *baller_robot;
         }
         else
         {
@@ -17,7 +17,7 @@ bool Evaluation::robotOrientationWithinAngleThresholdOfTarget(const Point positi
     return diff_orientation < threshold;
 }
 
-bool Evaluation::robotHasPossession(const Ball ball, const Robot robot)
+bool Evaluation::robotHasPossession(const Ball &ball, const Robot &robot)
 {
     // The actual vector to the ball from the center of the robot
     Vector robot_center_to_ball = ball.position() - robot.position();
@@ -38,7 +38,7 @@ namespace Evaluation
      * @param robot The Robot which wants to know if it has the ball.
      * @return True if the ball is close to the front dribbler and false otherwise
      */
-    bool robotHasPossession(Ball ball, Robot robot);
+    bool robotHasPossession(const Ball &ball, const Robot &robot);
 }  // namespace Evaluation
 
 
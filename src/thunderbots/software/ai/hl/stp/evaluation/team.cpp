@@ -1,24 +1,25 @@
 #include "ai/hl/stp/evaluation/team.h"
 
-std::optional<Robot> Evaluation::nearest_robot(const Team team, const Point ref_point)
+std::optional<Robot> Evaluation::nearest_robot(const Team &team, const Point &ref_point)
 {
-    if (team.getAllRobots().empty())
+    std::vector<Robot> robots = team.getAllRobots();
+    if (robots.empty())
     {
         return std::nullopt;
     }
 
-    unsigned nearestRobotId = team.getAllRobots()[0].id();
-    double minDist          = (ref_point - team.getAllRobots()[0].position()).len();
+    const Robot *nearestRobot = &robots[0];
+    double minDist            = (ref_point - robots[0].position()).len();
 
-    for (const Robot &curRobot : team.getAllRobots())
+    for (const Robot &curRobot : robots)
     {
         double curDistance = (ref_point - curRobot.position()).len();
         if (curDistance < minDist)
         {
-            nearestRobotId = curRobot.id();
-            minDist        = curDistance;
+            nearestRobot = &curRobot;
+            minDist      = curDistance;
         }
     }
 
-    return team.getRobotById(nearestRobotId).value();
+    return *nearestRobot;
 }
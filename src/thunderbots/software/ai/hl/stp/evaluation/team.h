@@ -12,6 +12,6 @@ namespace Evaluation
      * @param ref_point The point where the distance to each robot will be measured.
      * @return Robot that is closest to the reference point.
      */
-    std::optional<Robot> nearest_robot(const Team team, const Point ref_point);
+    std::optional<Robot> nearest_robot(const Team &team, const Point &ref_point);
 
 };  // namespace Evaluation
@@ -0,0 +1,213 @@
+#include "ai/hl/stp/evaluation/world_analysis.h"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+#include "ai/hl/stp/evaluation/possession.h"
+#include "ai/hl/stp/evaluation/robot.h"
+
+WorldAnalysis::WorldAnalysis(const World& world)
+    : world_(world),
+      friendly_robots(world.friendlyTeam().getAllRobots()),
+      enemy_robots(world.enemyTeam().getAllRobots())
+{
+}
+
+const World& WorldAnalysis::world() const
+{
+    return world_;
+}
+
+const std::vector<Robot>& WorldAnalysis::getFriendlyRobots() const
+{
+    return friendly_robots;
+}
+
+const std::vector<Robot>& WorldAnalysis::getEnemyRobots() const
+{
+    return enemy_robots;
+}
+
+const std::vector<double>& WorldAnalysis::getFriendlyDistancesToBall() const
+{
+    std::call_once(ball_distances_calculated, [this] {
+        friendly_ball_distances = calculateTeamBallDistances(friendly_robots);
+        enemy_ball_distances    = calculateTeamBallDistances(enemy_robots);
+    });
+    return friendly_ball_distances.distances_to_ball;
+}
+
+const std::vector<double>& WorldAnalysis::getEnemyDistancesToBall() const
+{
+    // Both teams are calculated together, so this makes sure they have been
+    getFriendlyDistancesToBall();
+    return enemy_ball_distances.distances_to_ball;
+}
+
+const std::vector<Robot>& WorldAnalysis::getFriendlyRobotsByDistanceToBall() const
+{
+    getFriendlyDistancesToBall();
+    return friendly_ball_distances.robots_by_distance_to_ball;
+}
+
+const std::vector<Robot>& WorldAnalysis::getEnemyRobotsByDistanceToBall() const
+{
+    getFriendlyDistancesToBall();
+    return enemy_ball_distances.robots_by_distance_to_ball;
+}
+
+double WorldAnalysis::getDistanceBetweenFriendlyRobots(size_t first_index,
+                                                       size_t second_index) const
+{
+    if (first_index >= friendly_robots.size() || second_index >= friendly_robots.size())
+    {
+        throw std::out_of_range("Error: Index is not a friendly robot");
+    }
+    return getDistanceBetweenRobots(first_index, second_index);
+}
+
+double WorldAnalysis::getDistanceBetweenEnemyRobots(size_t first_index,
+                                                    size_t second_index) const
+{
+    if (first_index >= enemy_robots.size() || second_index >= enemy_robots.size())
+    {
+        throw std::out_of_range("Error: Index is not an enemy robot");
+    }
+    return getDistanceBetweenRobots(friendly_robots.size() + first_index,
+                                    friendly_robots.size() + second_index);
+}
+
+double WorldAnalysis::getDistanceBetweenFriendlyAndEnemyRobots(size_t friendly_index,
+                                                               size_t enemy_index) const
+{
+    if (friendly_index >= friendly_robots.size() || enemy_index >= enemy_robots.size())
+    {
+        throw std::out_of_range(
+            "Error: Index is not a friendly robot, or index is not an enemy robot");
+    }
+    return getDistanceBetweenRobots(friendly_index, friendly_robots.size() + enemy_index);
+}
+
+const std::vector<Point>& WorldAnalysis::getObstaclePoints() const
+{
+    std::call_once(obstacle_points_calculated, [this] {
+        obstacle_points.reserve(friendly_robots.size() + enemy_robots.size());
+        for (const Robot& robot : friendly_robots)
+        {
+            obstacle_points.emplace_back(robot.position());
+        }
+        for (const Robot& robot : enemy_robots)
+        {
+            obstacle_points.emplace_back(robot.position());
+        }
+    });
+    return obstacle_points;
+}
+
+const std::optional<Robot>& WorldAnalysis::getFriendlyRobotWithEffectiveBallPossession()
+    const
+{
+    std::call_once(friendly_possession_calculated, [this] {
+        friendly_possession =
+            calculateTeamPossession(world_.friendlyTeam(), friendly_robots);
+    });
+    return friendly_possession.robot_with_effective_possession;
+}
+
+const std::optional<Robot>& WorldAnalysis::getEnemyRobotWithEffectiveBallPossession()
+    const
+{
+    std::call_once(enemy_possession_calculated, [this] {
+        enemy_possession = calculateTeamPossession(world_.enemyTeam(), enemy_robots);
+    });
+    return enemy_possession.robot_with_effective_possession;
+}
+
+const std::optional<Robot>& WorldAnalysis::getFriendlyRobotWithPossession() const
+{
+    getFriendlyRobotWithEffectiveBallPossession();
+    return friendly_possession.robot_with_possession;
+}
+
+const std::optional<Robot>& WorldAnalysis::getEnemyRobotWithPossession() const
+{
+    getEnemyRobotWithEffectiveBallPossession();
+    return enemy_possession.robot_with_possession;
+}
+
+WorldAnalysis::TeamBallDistances WorldAnalysis::calculateTeamBallDistances(
+    const std::vector<Robot>& robots) const
+{
+    TeamBallDistances team_ball_distances;
+    const Point& ball_position = world_.ball().position();
+
+    team_ball_distances.distances_to_ball.reserve(robots.size());
+    for (const Robot& robot : robots)
+    {
+        team_ball_distances.distances_to_ball.emplace_back(
+            (robot.position() - ball_position).len());
+    }
+
+    // Sort the indices rather than the robots, so each distance is only looked up
+    // rather than calculated again. A stable sort keeps robots that are the same
+    // distance from the ball in the same order every tick
+    std::vector<size_t> indices(robots.size());
+    std::iota(indices.begin(), indices.end(), 0);
+    std::stable_sort(indices.begin(), indices.end(),
+                     [&team_ball_distances](size_t first, size_t second) {
+                         return team_ball_distances.distances_to_ball[first] <
+                                team_ball_distances.distances_to_ball[second];
+                     });
+
+    team_ball_distances.robots_by_distance_to_ball.reserve(robots.size());
+    for (size_t index : indices)
+    {
+        team_ball_distances.robots_by_distance_to_ball.emplace_back(robots[index]);
+    }
+
+    return team_ball_distances;
+}
+
+WorldAnalysis::TeamPossession WorldAnalysis::calculateTeamPossession(
+    const Team& team, const std::vector<Robot>& robots) const
+{
+    TeamPossession team_possession;
+    team_possession.robot_with_effective_possession =
+        Evaluation::getRobotWithEffectiveBallPossession(team, world_.ball(),
+                                                        world_.field());
+
+    for (const Robot& robot : robots)
+    {
+        if (Evaluation::robotHasPossession(world_.ball(), robot))
+        {
+            team_possession.robot_with_possession = robot;
+            break;
+        }
+    }
+
+    return team_possession;
+}
+
+double WorldAnalysis::getDistanceBetweenRobots(size_t first_index,
+                                               size_t second_index) const
+{
+    size_t num_robots = friendly_robots.size() + enemy_robots.size();
+
+    std::call_once(robot_distances_calculated, [this, num_robots] {
+        const std::vector<Point>& positions = getObstaclePoints();
+        robot_distances.resize(num_robots * num_robots);
+        for (size_t i = 0; i < num_robots; i++)
+        {
+            robot_distances[i * num_robots + i] = 0;
+            for (size_t j = i + 1; j < num_robots; j++)
+            {
+                double distance                     = (positions[i] - positions[j]).len();
+                robot_distances[i * num_robots + j] = distance;
+                robot_distances[j * num_robots + i] = distance;
+            }
+        }
+    });
+
+    return robot_distances[first_index * num_robots + second_index];
+}
@@ -0,0 +1,243 @@
+#pragma once
+
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "ai/world/robot.h"
+#include "ai/world/world.h"
+#include "geom/point.h"
+#include "util/noncopyable.h"
+
+/**
+ * Facts derived from the World that many Plays, Tactics and evaluation functions need,
+ * such as how far every robot is from the ball and which robot has possession. A
+ * WorldAnalysis is created once per tick from the World for that tick, and passed
+ * alongside it, so each fact is only calculated once per tick no matter how many times
+ * it is used.
+ *
+ * Every fact is calculated the first time it is asked for, so facts that are never
+ * used cost nothing. The functions may be called from several threads at once (for
+ * example, by tactics running in parallel), and each fact is still only calculated
+ * once.
+ *
+ * Robots are referred to by their index in getFriendlyRobots() or getEnemyRobots(),
+ * which are in the same order as Team::getAllRobots().
+ *
+ * The WorldAnalysis keeps a reference to the World it was created from, so the World
+ * must not be changed or destroyed while the WorldAnalysis is in use.
+ */
+class WorldAnalysis : public NonCopyable
+{
+   public:
+    /**
+     * Creates a new WorldAnalysis for the given World. Nothing is calculated until it
+     * is asked for
+     *
+     * @param world The World to analyze
+     */
+    explicit WorldAnalysis(const World& world);
+
+    /**
+     * Returns the World this WorldAnalysis was created from
+     *
+     * @return the World this WorldAnalysis was created from
+     */
+    const World& world() const;
+
+    /**
+     * Returns the robots on the friendly team
+     *
+     * @return the robots on the friendly team, in the same order as
+     * Team::getAllRobots()
+     */
+    const std::vector<Robot>& getFriendlyRobots() const;
+
+    /**
+     * Returns the robots on the enemy team
+     *
+     * @return the robots on the enemy team, in the same order as Team::getAllRobots()
+     */
+    const std::vector<Robot>& getEnemyRobots() const;
+
+    /**
+     * Returns the distance from every friendly robot to the ball
+     *
+     * @return the distance from every friendly robot to the ball, in the same order as
+     * getFriendlyRobots()
+     */
+    const std::vector<double>& getFriendlyDistancesToBall() const;
+
+    /**
+     * Returns the distance from every enemy robot to the ball
+     *
+     * @return the distance from every enemy robot to the ball, in the same order as
+     * getEnemyRobots()
+     */
+    const std::vector<double>& getEnemyDistancesToBall() const;
+
+    /**
+     * Returns the friendly robots sorted by their distance to the ball. The first k
+     * robots are the k robots nearest to the ball
+     *
+     * @return the friendly robots sorted from nearest to furthest from the ball
+     */
+    const std::vector<Robot>& getFriendlyRobotsByDistanceToBall() const;
+
+    /**
+     * Returns the enemy robots sorted by their distance to the ball. The first k robots
+     * are the k robots nearest to the ball
+     *
+     * @return the enemy robots sorted from nearest to furthest from the ball
+     */
+    const std::vector<Robot>& getEnemyRobotsByDistanceToBall() const;
+
+    /**
+     * Returns the distance between two friendly robots
+     *
+     * @param first_index The index of the first robot in getFriendlyRobots()
+     * @param second_index The index of the second robot in getFriendlyRobots()
+     *
+     * @throws std::out_of_range if either index is not a friendly robot
+     * @return the distance between the two robots
+     */
+    double getDistanceBetweenFriendlyRobots(size_t first_index,
+                                            size_t second_index) const;
+
+    /**
+     * Returns the distance between two enemy robots
+     *
+     * @param first_index The index of the first robot in getEnemyRobots()
+     * @param second_index The index of the second robot in getEnemyRobots()
+     *
+     * @throws std::out_of_range if either index is not an enemy robot
+     * @return the distance between the two robots
+     */
+    double getDistanceBetweenEnemyRobots(size_t first_index, size_t second_index) const;
+
+    /**
+     * Returns the distance between a friendly robot and an enemy robot
+     *
+     * @param friendly_index The index of the friendly robot in getFriendlyRobots()
+     * @param enemy_index The index of the enemy robot in getEnemyRobots()
+     *
+     * @throws std::out_of_range if either index is not a robot on its team
+     * @return the distance between the two robots
+     */
+    double getDistanceBetweenFriendlyAndEnemyRobots(size_t friendly_index,
+                                                    size_t enemy_index) const;
+
+    /**
+     * Returns the positions of every robot on the field, which are the obstacles for
+     * shots and passes
+     *
+     * @return the positions of every friendly robot, in the same order as
+     * getFriendlyRobots(), followed by the positions of every enemy robot, in the same
+     * order as getEnemyRobots()
+     */
+    const std::vector<Point>& getObstaclePoints() const;
+
+    /**
+     * Returns the friendly robot that either has the ball, or is the closest to having
+     * it. See Evaluation::getRobotWithEffectiveBallPossession
+     *
+     * @return the friendly robot with effective possession of the ball, or
+     * std::nullopt if the friendly team has no robots
+     */
+    const std::optional<Robot>& getFriendlyRobotWithEffectiveBallPossession() const;
+
+    /**
+     * Returns the enemy robot that either has the ball, or is the closest to having
+     * it. See Evaluation::getRobotWithEffectiveBallPossession
+     *
+     * @return the enemy robot with effective possession of the ball, or std::nullopt
+     * if the enemy team has no robots
+     */
+    const std::optional<Robot>& getEnemyRobotWithEffectiveBallPossession() const;
+
+    /**
+     * Returns the friendly robot that has the ball at its dribbler. See
+     * Evaluation::robotHasPossession
+     *
+     * @return the friendly robot that has possession of the ball, or std::nullopt if
+     * no friendly robot does
+     */
+    const std::optional<Robot>& getFriendlyRobotWithPossession() const;
+
+    /**
+     * Returns the enemy robot that has the ball at its dribbler. See
+     * Evaluation::robotHasPossession
+     *
+     * @return the enemy robot that has possession of the ball, or std::nullopt if no
+     * enemy robot does
+     */
+    const std::optional<Robot>& getEnemyRobotWithPossession() const;
+
+   private:
+    // The facts about how one team is placed relative to the ball
+    struct TeamBallDistances
+    {
+        std::vector<double> distances_to_ball;
+        std::vector<Robot> robots_by_distance_to_ball;
+    };
+
+    // The facts about which robot on one team has the ball
+    struct TeamPossession
+    {
+        std::optional<Robot> robot_with_effective_possession;
+        std::optional<Robot> robot_with_possession;
+    };
+
+    /**
+     * Calculates the distances from every robot on a team to the ball
+     *
+     * @param robots The robots on the team
+     * @return the distances from the robots to the ball
+     */
+    TeamBallDistances calculateTeamBallDistances(const std::vector<Robot>& robots) const;
+
+    /**
+     * Calculates which robot on a team has the ball
+     *
+     * @param team The team
+     * @param robots The robots on the team
+     * @return which robot on the team has the ball
+     */
+    TeamPossession calculateTeamPossession(const Team& team,
+                                           const std::vector<Robot>& robots) const;
+
+    /**
+     * Returns the distance between two robots
+     *
+     * @param first_index The index of the first robot, counting the friendly robots
+     * and then the enemy robots
+     * @param second_index The index of the second robot, counted the same way
+     *
+     * @return the distance between the two robots
+     */
+    double getDistanceBetweenRobots(size_t first_index, size_t second_index) const;
+
+    const World& world_;
+    // Every other fact needs the robots, so they are copied out of the Teams up front
+    const std::vector<Robot> friendly_robots;
+    const std::vector<Robot> enemy_robots;
+
+    // Each fact is calculated by the first thread to ask for it. The other threads
+    // wait on its once_flag until it is ready, and it is never changed after that
+    mutable std::once_flag ball_distances_calculated;
+    mutable TeamBallDistances friendly_ball_distances;
+    mutable TeamBallDistances enemy_ball_distances;
+
+    // The distances between every pair of robots, counting the friendly robots and then
+    // the enemy robots. The distance between robots i and j is at i * num_robots + j
+    mutable std::once_flag robot_distances_calculated;
+    mutable std::vector<double> robot_distances;
+
+    mutable std::once_flag obstacle_points_calculated;
+    mutable std::vector<Point> obstacle_points;
+
+    mutable std::once_flag friendly_possession_calculated;
+    mutable TeamPossession friendly_possession;
+    mutable std::once_flag enemy_possession_calculated;
+    mutable TeamPossession enemy_possession;
+};
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ai/hl/stp/play/play.h"
+#include "ai/hl/stp/tactic/move_tactic.h"
 
 /**
  * An example Play that moves the robots in a circle around the ball
@@ -14,10 +15,21 @@ class ExamplePlay : public Play
 
     std::string getName() const override;
 
-    bool isApplicable(const World &world) const override;
+    static bool isApplicable(const World &world);
 
-    bool invariantHolds(const World &world) const override;
+    static bool invariantHolds(const World &world);
 
-    std::vector<std::shared_ptr<Tactic>> getNextTactics(TacticCoroutine::push_type &yield,
-                                                        const World &world) override;
+    std::vector<std::shared_ptr<Tactic>> getNextTactics(
+        StacklessCoroutine &coroutine, const World &world,
+        const WorldAnalysis &world_analysis) override;
+
+   private:
+    // The Tactics this Play runs. They are kept here rather than in getNextTactics so
+    // that they live between calls
+    std::shared_ptr<MoveTactic> move_tactic_1;
+    std::shared_ptr<MoveTactic> move_tactic_2;
+    std::shared_ptr<MoveTactic> move_tactic_3;
+    std::shared_ptr<MoveTactic> move_tactic_4;
+    std::shared_ptr<MoveTactic> move_tactic_5;
+    std::shared_ptr<MoveTactic> move_tactic_6;
 };
@@ -1,18 +1,12 @@
 #pragma once
 
-#include <boost/coroutine2/all.hpp>
 #include <memory>
 #include <vector>
 
+#include "ai/hl/stp/stackless_coroutine.h"
 #include "ai/hl/stp/tactic/tactic.h"
 #include "ai/world/world.h"
 
-// We typedef the coroutine return type to make it shorter, more descriptive,
-// and easier to work with.
-// This coroutine returns a list of shared_ptrs to Tactic objects
-typedef boost::coroutines2::coroutine<std::vector<std::shared_ptr<Tactic>>>
-    TacticCoroutine;
-
 /**
  * In the STP framework, a Play is a collection of tactics that represent some
  * "team-wide" goal. It can be thought of like a traditional play in soccer, such as an
@@ -22,11 +16,30 @@ typedef boost::coroutines2::coroutine<std::vector<std::shared_ptr<Tactic>>>
  * based on the state of the world, and this switching of Plays is what allows our AI to
  * play a full game of soccer, as long a we provide a Play for any given scenario.
  *
- * Plays must define what conditions must be met for them to start (with the isApplicable
- * function), and what conditions must be continously met for the Play to continue
- * running (with the invariantHolds function). These are very important to get right,
- * so that we can always run at least 1 Play in every scenario, and that Plays don't
- * unexpectedly stop.
+ * Plays must define what conditions must be met for them to start (with a static
+ * isApplicable function), and what conditions must be continously met for the Play to
+ * continue running (with a static invariantHolds function). These are very important to
+ * get right, so that we can always run at least 1 Play in every scenario, and that Plays
+ * don't unexpectedly stop.
+ *
+ * isApplicable and invariantHolds are static so that they can be checked for every Play
+ * in the PlayFactory without creating the Plays, which is expensive because every Play
+ * creates its own Tactics. They are declared in every concrete Play as:
+ *
+ * static bool isApplicable(const World &world);
+ * static bool invariantHolds(const World &world);
+ *
+ * isApplicable returns whether or not the Play can be started. For example, the Enemy
+ * Team must have the ball for a defensive play to be applicable.
+ *
+ * invariantHolds returns whether or not the invariant for the Play holds (is true). The
+ * invariant is a set of conditions that must remain true for the Play to continue
+ * running (not necessarily the same as the Applicable conditions). For example, the
+ * Invariant for an Offensive Play might be that our team must have possession of the
+ * ball. If our team no longer has possession of the ball (ie. the invariant no longer
+ * holds), then we should probably run a different Play.
+ *
+ * The TPlayFactory checks that both functions are declared when the Play is registered.
  */
 class Play
 {
@@ -36,28 +49,6 @@ class Play
      */
     explicit Play();
 
-    /**
-     * Returns whether or not this Play can be started. For example, the Enemy Team
-     * must have the ball for a defensive play to be applicable.
-     *
-     * @param world The current state of the world
-     * @return true if this Play can be started, and false otherwise
-     */
-    virtual bool isApplicable(const World& world) const = 0;
-
-    /**
-     * Returns whether or not the invariant for this Play holds (is true). The invariant
-     * is a set of conditions that must remain true for the Play to continue running
-     * (not necessarily the same as the Applicable conditions). For example, the Invariant
-     * for an Offensive Play might be that our team must have possession of the ball. If
-     * our team no longer has possession of the ball (ie. the invariant no longer holds),
-     * then we should probably run a different Play.
-     *
-     * @param world The current state of the world
-     * @return true if this Play's invariant holds (is true), and false otherwise
-     */
-    virtual bool invariantHolds(const World& world) const = 0;
-
     /**
      * Returns a list of shared_ptrs to the Tactics the Play wants to run at this time, in
      * order of priority. The Tactic at the beginning of the vector has the highest
@@ -70,10 +61,12 @@ class Play
      * time the function is called.
      *
      * @param world The current state of the world
+     * @param world_analysis The analysis of the same world
      * @return A list of shared_ptrs to the Tactics the Play wants to run at this time, in
      * order of priority
      */
-    std::optional<std::vector<std::shared_ptr<Tactic>>> getTactics(const World& world);
+    std::optional<std::vector<std::shared_ptr<Tactic>>> getTactics(
+        const World &world, const WorldAnalysis &world_analysis);
 
     /**
      * Returns true if the Play is done and false otherwise. The Play is considered
@@ -94,44 +87,22 @@ class Play
     virtual ~Play() = default;
 
    private:
-    /**
-     * A wrapper function for the getNextTactics function.
-     *
-     * This function exists because when the coroutine (tactic_sequence) is first
-     * constructed the coroutine is called/entered. This would normally cause the
-     * getNextTactics to be run once and potentially return incorrect results
-     * due to default constructed values.
-     *
-     * This wrapper function will yield an empty vector the first time it's called and
-     * otherwise use the getNextTactics function. This first "empty" value will never
-     * be seen/used by the rest of the system since this will be during construction,
-     * and the coroutine will be called again with valid parameters before any values are
-     * returned. This effectively "shields" the logic from any errors caused by default
-     * values during construction.
-     *
-     * @param yield The coroutine push_type for the Play
-     *
-     * @return A list of shared_ptrs to the Tactics the Play wants to run at this time, in
-     * order of priority
-     */
-    std::vector<std::shared_ptr<Tactic>> getNextTacticsWrapper(
-        TacticCoroutine::push_type& yield);
-
     /**
      * Returns a list of shared_ptrs to the Tactics the Play wants to run at this time, in
      * order of priority
      *
-     * @param yield The coroutine push_type for the Play
+     * @param coroutine The coroutine of the Play, which keeps track of where the Play's
+     * logic continues from. See StacklessCoroutine for how to use it
      * @param world The current state of the World
+     * @param world_analysis The analysis of the same world
      *
      * @return A list of shared_ptrs to the Tactics the Play wants to run at this time, in
      * order of priority
      */
     virtual std::vector<std::shared_ptr<Tactic>> getNextTactics(
-        TacticCoroutine::push_type& yield, const World& world) = 0;
+        StacklessCoroutine &coroutine, const World &world,
+        const WorldAnalysis &world_analysis) = 0;
 
     // The coroutine that sequentially returns the Tactics the Play wants to run
-    TacticCoroutine::pull_type tactic_sequence;
-    // The Play's knowledge of the most up-to-date World
-    World world;
+    StacklessCoroutine tactic_sequence;
 };
@@ -33,24 +33,23 @@ PlayFactory::getRegisteredPlayConstructors()
     for (auto it = PlayFactory::getRegistry().begin();
          it != PlayFactory::getRegistry().end(); it++)
     {
-        constructors.emplace_back(it->second);
+        constructors.emplace_back(it->second.create);
     }
     return constructors;
 }
 
-void PlayFactory::registerPlay(std::string play_name,
-                               std::function<std::unique_ptr<Play>()> play_creator)
+void PlayFactory::registerPlay(std::string play_name, RegisteredPlay registered_play)
 {
-    PlayFactory::getMutableRegistry().insert(std::make_pair(play_name, play_creator));
+    PlayFactory::getMutableRegistry().insert(std::make_pair(play_name, registered_play));
 }
 
-std::unique_ptr<Play> PlayFactory::createPlay(const std::string& play_name)
+const RegisteredPlay& PlayFactory::getRegisteredPlay(const std::string& play_name)
 {
-    auto registry = PlayFactory::getRegistry();
-    auto it       = registry.find(play_name);
+    const auto& registry = PlayFactory::getRegistry();
+    auto it              = registry.find(play_name);
     if (it != registry.end())
     {
-        return it->second();
+        return it->second;
     }
     else
     {
@@ -59,3 +58,8 @@ std::unique_ptr<Play> PlayFactory::createPlay(const std::string& play_name)
         throw std::invalid_argument(msg);
     }
 }
+
+std::unique_ptr<Play> PlayFactory::createPlay(const std::string& play_name)
+{
+    return PlayFactory::getRegisteredPlay(play_name).create();
+}
@@ -1,13 +1,27 @@
 #pragma once
+#include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
 
 #include "ai/hl/stp/play/play.h"
 
+/**
+ * Everything the PlayFactory knows about a Play. The isApplicable and invariantHolds
+ * functions of a Play are static, so they can be checked without creating the Play
+ */
+struct RegisteredPlay
+{
+    // Creates and returns a unique_ptr to a new instance of the Play
+    std::function<std::unique_ptr<Play>()> create;
+    // The static isApplicable function of the Play
+    std::function<bool(const World&)> is_applicable;
+    // The static invariantHolds function of the Play
+    std::function<bool(const World&)> invariant_holds;
+};
+
 // A quality of life typedef to make things shorter and more readable
-typedef std::unordered_map<std::string, std::function<std::unique_ptr<Play>()>>
-    PlayRegistry;
+typedef std::unordered_map<std::string, RegisteredPlay> PlayRegistry;
 
 /**
  * The PlayFactory is an Abstract class that provides an interface for Play Factories
@@ -29,10 +43,21 @@ class PlayFactory
      */
     static std::unique_ptr<Play> createPlay(const std::string& play_name);
 
+    /**
+     * Returns everything the PlayFactory knows about the Play of the given type/name
+     *
+     * @param play_name The name of the Play. This value must be in the Play registry
+     * @throws std::invalid_argument if the given play_name is not found in the Play
+     * registry
+     *
+     * @return a const reference to the registry entry of the Play
+     */
+    static const RegisteredPlay& getRegisteredPlay(const std::string& play_name);
+
     /**
      * Returns a const reference to the Play registry. The registry is a map of Play names
-     * to a "create" function that will create and return a unique_ptr to a new concrete
-     * instance of the Play.
+     * to a RegisteredPlay, which can check whether the Play is applicable and whether its
+     * invariant holds, and can create a new concrete instance of the Play.
      *
      * @return a const reference to the Play registry
      */
@@ -58,18 +83,16 @@ class PlayFactory
      * Adds a Play to the Play Registry
      *
      * @param play_name The name of the Play to be added
-     * @param play_creator A "create" function that takes no arguments and will return
-     * a unique_ptr to a new instance of the specified Play
+     * @param registered_play The functions that create the Play and check whether it is
+     * applicable and whether its invariant holds
      */
-    static void registerPlay(std::string play_name,
-                             std::function<std::unique_ptr<Play>()> play_creator);
+    static void registerPlay(std::string play_name, RegisteredPlay registered_play);
 
    private:
     /**
      * Returns a reference to the Play registry. The registry is a map of Play names
-     * to a "create" function that will create and return a unique_ptr to a new concrete
-     * instance of the Play, which allows the code to be aware
-     * of all the Plays that are available.
+     * to a RegisteredPlay, which allows the code to be aware of all the Plays that are
+     * available.
      *
      * This is the same as the above public getRegistry function. We need a mutable
      * version in order to add entries to the registry. The function is private so that
@@ -102,13 +125,22 @@ class TPlayFactory : public PlayFactory
 {
     // compile time type checking that T is derived class of Play
     static_assert(std::is_base_of<Play, T>::value, "T must be derived class of Play!");
+    // compile time type checking that T declares the static functions every Play needs
+    static_assert(std::is_same<decltype(&T::isApplicable), bool (*)(const World&)>::value,
+                  "T must declare static bool isApplicable(const World&)!");
+    static_assert(
+        std::is_same<decltype(&T::invariantHolds), bool (*)(const World&)>::value,
+        "T must declare static bool invariantHolds(const World&)!");
 
    public:
     TPlayFactory()
     {
-        auto play_creator = []() -> std::unique_ptr<Play> {
+        RegisteredPlay registered_play;
+        registered_play.create = []() -> std::unique_ptr<Play> {
             return std::make_unique<T>();
         };
-        PlayFactory::registerPlay(T::name, play_creator);
+        registered_play.is_applicable   = &T::isApplicable;
+        registered_play.invariant_holds = &T::invariantHolds;
+        PlayFactory::registerPlay(T::name, registered_play);
     }
 };
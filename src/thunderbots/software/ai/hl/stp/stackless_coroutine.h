@@ -0,0 +1,61 @@
+#pragma once
+
+#include <boost/asio/coroutine.hpp>
+
+/**
+ * The coroutine that Plays, Tactics and Actions use to run their logic as a sequence of
+ * steps over many ticks of the AI.
+ *
+ * This is a stackless coroutine (see boost::asio::coroutine). Rather than giving every
+ * coroutine its own stack and switching to it, the coroutine only stores which yield it
+ * stopped at, and the function that runs the logic jumps back to that yield the next
+ * time it is called. This makes a coroutine the size of an int, so creating, running
+ * and restarting one costs about as much as a function call and never allocates.
+ *
+ * The function that runs the logic of a coroutine wraps it in a
+ * BOOST_ASIO_CORO_REENTER block and returns each value with BOOST_ASIO_CORO_YIELD. The
+ * next call to the function continues right after the last yield. For example, a Tactic
+ * that moves to a destination until it gets there looks like:
+ *
+ * std::unique_ptr<Intent> MoveTactic::calculateNextIntent(StacklessCoroutine &coroutine)
+ * {
+ *     BOOST_ASIO_CORO_REENTER(coroutine)
+ *     {
+ *         do
+ *         {
+ *             BOOST_ASIO_CORO_YIELD return std::make_unique<MoveIntent>(...);
+ *         } while (!robotAtDestination());
+ *     }
+ *     return std::unique_ptr<Intent>{};
+ * }
+ *
+ * When the end of the BOOST_ASIO_CORO_REENTER block is reached, the coroutine is done.
+ *
+ * Because there is no stack, local variables are not kept between yields, and the
+ * compiler will refuse to jump to a yield past the declaration of a local variable in
+ * the same scope. Anything that must be kept between yields has to be a member of the
+ * class instead, and local variables used before a yield have to be declared in their
+ * own block.
+ */
+class StacklessCoroutine : public boost::asio::coroutine
+{
+   public:
+    /**
+     * Returns whether the coroutine has reached the end of its logic
+     *
+     * @return true if the coroutine is done, and false otherwise
+     */
+    bool done() const
+    {
+        return is_complete();
+    }
+
+    /**
+     * Restarts the coroutine, so the next time its logic is run it starts from the
+     * beginning
+     */
+    void restart()
+    {
+        *this = StacklessCoroutine();
+    }
+};
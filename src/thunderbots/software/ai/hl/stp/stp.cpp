@@ -1,7 +1,6 @@
 #include "ai/hl/stp/stp.h"
 
 #include <ai/hl/stp/play/play_factory.h>
-#include <munkres/munkres.h>
 
 #include <chrono>
 #include <exception>
@@ -9,20 +8,26 @@
 
 #include "ai/hl/stp/play/play.h"
 #include "ai/hl/stp/tactic/tactic.h"
-#include "ai/intent/move_intent.h"
 #include "util/logger/init.h"
+#include "util/parameter/dynamic_parameters.h"
 
-STP::STP(long random_seed) : random_number_generator(random_seed) {}
+STP::STP(long random_seed, size_t num_worker_threads)
+    : random_number_generator(random_seed),
+      thread_pool(std::make_unique<Util::ThreadPool>(num_worker_threads))
+{
+}
 
-std::vector<std::unique_ptr<Intent>> STP::getIntents(const World& world)
+std::vector<IntentVariant> STP::getIntents(const World& world)
 {
     // Assign a new play if we don't currently have a play assigned, the current play's
     // invariant no longer holds, or the current play is done
-    if (!current_play || !current_play->invariantHolds(world) || current_play->done())
+    if (!current_play || !current_play_invariant_holds(world) || current_play->done())
     {
         try
         {
             current_play = calculateNewPlay(world);
+            current_play_invariant_holds =
+                PlayFactory::getRegisteredPlay(current_play->getName()).invariant_holds;
         }
         catch (const std::runtime_error& e)
         {
@@ -33,22 +38,32 @@ std::vector<std::unique_ptr<Intent>> STP::getIntents(const World& world)
         }
     }
 
+    // Everything derived from the World this tick is calculated at most once, and
+    // shared by the Play and all of its Tactics
+    WorldAnalysis world_analysis(world);
+
     // Run the current play
-    auto tactics = current_play->getTactics(world);
+    auto tactics = current_play->getTactics(world, world_analysis);
 
-    std::vector<std::unique_ptr<Intent>> intents;
+    std::vector<IntentVariant> intents;
     if (tactics)
     {
         // Assign robots to tactics
-        auto assigned_tactics = assignRobotsToTactics(world, *tactics);
+        auto assigned_tactics = assignRobotsToTactics(world, world_analysis, *tactics);
+
+        // Get the Intent each tactic wants to run. Tactics are independent of each
+        // other, so they can be run in parallel
+        tactic_intents.clear();
+        tactic_intents.resize(assigned_tactics.size());
+        thread_pool->parallelFor(assigned_tactics.size(), [&](size_t i) {
+            tactic_intents[i] = assigned_tactics[i]->getNextIntent();
+        });
 
-        for (const auto& tactic : assigned_tactics)
+        for (const auto& intent : tactic_intents)
         {
-            // Get the Intent the tactic wants to run
-            auto intent = tactic->getNextIntent();
             if (intent)
             {
-                intents.emplace_back(std::move(intent));
+                intents.emplace_back(createIntentVariant(*intent));
             }
         }
     }
@@ -57,77 +72,86 @@ std::vector<std::unique_ptr<Intent>> STP::getIntents(const World& world)
 }
 
 std::vector<std::shared_ptr<Tactic>> STP::assignRobotsToTactics(
-    const World& world, std::vector<std::shared_ptr<Tactic>> tactics) const
+    const World& world, std::vector<std::shared_ptr<Tactic>> tactics)
+{
+    return assignRobotsToTactics(world, WorldAnalysis(world), std::move(tactics));
+}
+
+std::vector<std::shared_ptr<Tactic>> STP::assignRobotsToTactics(
+    const World& world, const WorldAnalysis& world_analysis,
+    std::vector<std::shared_ptr<Tactic>> tactics)
 {
     // This functions optimizes the assignment of robots to tactics by minimizing
     // the total cost of assignment using the Hungarian algorithm
     // (also known as the Munkres algorithm)
     // https://en.wikipedia.org/wiki/Hungarian_algorithm
     //
-    // https://github.com/saebyn/munkres-cpp is the implementation of the Hungarian
-    // algorithm that we use here
+    // See Util::AssignmentSolver for the implementation we use here
+
+    std::vector<Robot> friendly_team_robots = world_analysis.getFriendlyRobots();
+    if (friendly_team_robots.size() > MAX_NUM_ROBOTS)
+    {
+        LOG(WARNING) << "There are " << friendly_team_robots.size()
+                     << " friendly robots, but tactics can only be assigned to "
+                     << MAX_NUM_ROBOTS << " of them" << std::endl;
+        friendly_team_robots.erase(friendly_team_robots.begin() + MAX_NUM_ROBOTS,
+                                   friendly_team_robots.end());
+    }
 
-    if (world.friendlyTeam().numRobots() < tactics.size())
+    if (friendly_team_robots.size() < tactics.size())
     {
         // We do not have enough robots to assign all the tactics to. We "drop"
         // (aka don't assign) the tactics at the end of the vector since they are
         // considered lower priority
-        tactics.resize(world.friendlyTeam().numRobots());
+        tactics.resize(friendly_team_robots.size());
     }
 
-    auto friendly_team        = world.friendlyTeam();
-    auto friendly_team_robots = friendly_team.getAllRobots();
-    auto friendly_team_size   = friendly_team.numRobots();
-
-    size_t num_rows = world.friendlyTeam().numRobots();
-    size_t num_cols = tactics.size();
+    size_t num_rows = tactics.size();
+    size_t num_cols = friendly_team_robots.size();
 
-    // The Matrix constructor will assert if the rows and columns of the matrix are
-    // not >= 1, so we perform that check first and return an empty vector of tactics.
     // This represents the cases where there are either no tactics or no robots
-    if (num_rows == 0 || num_cols == 0)
+    if (num_rows == 0)
     {
         return {};
     }
 
-    // The rows of the matrix are the "workers" (the robots) and the columns are the
-    // "jobs" (the Tactics).
-    Matrix<double> matrix(num_rows, num_cols);
-
-    // Initialize the matrix with the cost of assigning each Robot to each Tactic
-    for (int row = 0; row < num_rows; row++)
-    {
-        for (int col = 0; col < num_cols; col++)
+    double tactic_reassignment_cost =
+        Util::DynamicParameters::AI::STP::tactic_reassignment_cost.value();
+
+    // The rows of the matrix are the "jobs" (the Tactics) and the columns are the
+    // "workers" (the robots). The robot each tactic was assigned to last time is used
+    // to warm start the solver, and assigning it to any other robot costs a bit more.
+    // Each row only depends on its own tactic, so the rows are calculated in parallel
+    TacticAssignmentSolver::CostMatrix costs;
+    TacticAssignmentSolver::Assignment previous_assignment;
+    previous_assignment.fill(TacticAssignmentSolver::UNASSIGNED);
+    thread_pool->parallelFor(num_rows, [&](size_t row) {
+        std::optional<Robot> previous_robot = tactics[row]->getAssignedRobot();
+        for (size_t col = 0; col < num_cols; col++)
         {
-            matrix(row, col) =
-                tactics.at(col)->calculateRobotCost(friendly_team_robots.at(row), world);
-        }
-    }
-
-    // Apply the Munkres/Hungarian algorithm to the matrix.
-    Munkres<double> m;
-    m.solve(matrix);
+            costs[row][col] = tactics[row]->calculateRobotCost(friendly_team_robots[col],
+                                                               world, world_analysis);
 
-    // The Munkres matrix gets solved such that there will be exactly one 0 in every row
-    // and exactly one 0 in every column. All other values will be -1. The 0's indicate
-    // the "workers" and "jobs" (robots and tactics for us) that are most optimally paired
-    // together
-    //
-    // Example matrices:
-    //        -1, 0,-1,         and            0,-1,
-    //         0,-1,-1,                       -1, 0,
-    //        -1,-1, 0,
-    for (int row = 0; row < num_rows; row++)
-    {
-        for (int col = 0; col < num_cols; col++)
-        {
-            auto val = matrix(row, col);
-            if (val == 0)
+            if (!previous_robot)
             {
-                tactics.at(col)->updateRobot(friendly_team_robots.at(row));
-                break;
+                continue;
+            }
+            if (previous_robot->id() == friendly_team_robots[col].id())
+            {
+                previous_assignment[row] = col;
+            }
+            else
+            {
+                costs[row][col] += tactic_reassignment_cost;
             }
         }
+    });
+
+    const TacticAssignmentSolver::Assignment& assignment =
+        assignment_solver.solve(costs, num_rows, num_cols, previous_assignment);
+    for (size_t row = 0; row < num_rows; row++)
+    {
+        tactics[row]->updateRobot(friendly_team_robots[assignment[row]]);
     }
 
     return tactics;
@@ -135,13 +159,14 @@ std::vector<std::shared_ptr<Tactic>> STP::assignRobotsToTactics(
 
 std::unique_ptr<Play> STP::calculateNewPlay(const World& world)
 {
-    std::vector<std::unique_ptr<Play>> applicable_plays;
-    for (const auto& play_constructor : PlayFactory::getRegisteredPlayConstructors())
+    // Plays are only checked here, not created, since only the Play that is chosen
+    // needs to be created
+    std::vector<const RegisteredPlay*> applicable_plays;
+    for (const auto& [play_name, registered_play] : PlayFactory::getRegistry())
     {
-        auto play = play_constructor();
-        if (play->isApplicable(world))
+        if (registered_play.is_applicable(world))
         {
-            applicable_plays.emplace_back(std::move(play));
+            applicable_plays.emplace_back(&registered_play);
         }
     }
 
@@ -157,7 +182,7 @@ std::unique_ptr<Play> STP::calculateNewPlay(const World& world)
         0, applicable_plays.size() - 1);
     auto play_index = uniform_distribution(random_number_generator);
 
-    return std::move(applicable_plays[play_index]);
+    return applicable_plays[play_index]->create();
 }
 
 std::optional<std::string> STP::getCurrentPlayName() const
@@ -1,10 +1,13 @@
 #pragma once
 
+#include <functional>
 #include <random>
 
 #include "ai/hl/hl.h"
 #include "ai/hl/stp/play/play.h"
-#include "ai/intent/intent.h"
+#include "ai/intent/intent_variant.h"
+#include "util/assignment_solver.h"
+#include "util/thread_pool.h"
 
 /**
  * The STP module is an implementation of the high-level logic Abstract class, that
@@ -19,10 +22,14 @@ class STP : public HL
      *
      * @param random_seed The random seed used for STP's internal random number generator.
      * The default value is 0
+     * @param num_worker_threads The number of threads, in addition to the thread that
+     * calls getIntents, used to calculate the costs of assigning robots to tactics and
+     * the Intents of the tactics in parallel. If this is 0, everything is calculated on
+     * the calling thread. The results are the same no matter how many threads are used
      */
-    explicit STP(long random_seed = 0);
+    explicit STP(long random_seed = 0, size_t num_worker_threads = 0);
 
-    std::vector<std::unique_ptr<Intent>> getIntents(const World &world) override;
+    std::vector<IntentVariant> getIntents(const World &world) override;
 
     /**
      * Given a list of tactics and the current World, returns a new list of tactics
@@ -36,14 +43,37 @@ class STP : public HL
      * only 4 robots on the field at the time, only the first 4 Tactics in the vector
      * would be assigned to robots and run.
      *
+     * The assignment from the last call is used to warm start the assignment, and
+     * assigning a tactic to a different robot than last time costs a little extra, so
+     * robots don't swap tactics back and forth when their costs are almost the same.
+     *
+     * The costs for each tactic are calculated in parallel if STP has worker threads, so
+     * calculateRobotCost must not change anything shared between tactics.
+     *
+     * @param world The state of the world, which contains the friendly Robots that will
+     * be mapped to a Tactic
+     * @param tactics The list of tactics that should be run (and paired with a Robot)
+     * @return A list of tactics, where each tactic has a robot assigned to it. Only
+     * tactics with a robot assigned are returned
+     */
+    std::vector<std::shared_ptr<Tactic>> assignRobotsToTactics(
+        const World &world, std::vector<std::shared_ptr<Tactic>> tactics);
+
+    /**
+     * The same as assignRobotsToTactics above, but uses a WorldAnalysis of the world
+     * that has already been created, so the Tactics can share it with the rest of the
+     * tick
+     *
      * @param world The state of the world, which contains the friendly Robots that will
      * be mapped to a Tactic
+     * @param world_analysis The analysis of the same world
      * @param tactics The list of tactics that should be run (and paired with a Robot)
      * @return A list of tactics, where each tactic has a robot assigned to it. Only
      * tactics with a robot assigned are returned
      */
     std::vector<std::shared_ptr<Tactic>> assignRobotsToTactics(
-        const World &world, std::vector<std::shared_ptr<Tactic>> tactics) const;
+        const World &world, const WorldAnalysis &world_analysis,
+        std::vector<std::shared_ptr<Tactic>> tactics);
 
     /**
      * Given the state of the world, returns a unique_ptr to the Play that should be run
@@ -67,8 +97,26 @@ class STP : public HL
     std::optional<std::string> getCurrentPlayName() const;
 
    private:
+    // The most robots we can have on the field at once, which is the number of robots
+    // allowed in Division A
+    static constexpr size_t MAX_NUM_ROBOTS = 11;
+
+    using TacticAssignmentSolver = Util::AssignmentSolver<MAX_NUM_ROBOTS>;
+
     // The Play that is currently running
     std::unique_ptr<Play> current_play;
+    // The invariantHolds function of the Play that is currently running
+    std::function<bool(const World &)> current_play_invariant_holds;
     // The random number generator
     std::mt19937 random_number_generator;
+    // Solves the assignment of robots to tactics. It keeps the state of the last
+    // assignment, which is used to warm start the next one
+    TacticAssignmentSolver assignment_solver;
+    // Runs the tactics in parallel. Each tactic only ever runs on one thread at a
+    // time, and only changes its own state, so tactics do not need to be thread-safe.
+    // The pool is kept behind a pointer so that STP can still be moved
+    std::unique_ptr<Util::ThreadPool> thread_pool;
+    // The Intents of the assigned tactics, in the same order as the tactics. Each
+    // thread only writes to the slots of the tactics it runs
+    std::vector<std::unique_ptr<Intent>> tactic_intents;
 };
@@ -25,7 +25,8 @@ void BlockShotPathTactic::updateParams(const Point& shot_origin)
     this->shot_origin = shot_origin;
 }
 
-double BlockShotPathTactic::calculateRobotCost(const Robot& robot, const World& world)
+double BlockShotPathTactic::calculateRobotCost(const Robot& robot, const World& world,
+                                               const WorldAnalysis& world_analysis)
 {
     // Prefer robots closer to the block position
     // We normalize with the total field length so that robots that are within the field
@@ -44,15 +45,24 @@ Point BlockShotPathTactic::getBlockPosition()
 }
 
 std::unique_ptr<Intent> BlockShotPathTactic::calculateNextIntent(
-    intent_coroutine::push_type& yield)
+    StacklessCoroutine& coroutine)
 {
-    MoveAction move_action = MoveAction();
-    do
+    BOOST_ASIO_CORO_REENTER(coroutine)
     {
-        Point block_position = getBlockPosition();
-        // We want to face the shot
-        Angle block_orientation = (this->shot_origin - block_position).orientation();
-        yield(move_action.updateStateAndGetNextIntent(*robot, block_position,
-                                                      block_orientation, 0.0));
-    } while (!move_action.done());
+        // Start a new MoveAction every time the Tactic is restarted
+        move_action = MoveAction();
+        do
+        {
+            BOOST_ASIO_CORO_YIELD
+            {
+                Point block_position = getBlockPosition();
+                // We want to face the shot
+                Angle block_orientation =
+                    (this->shot_origin - block_position).orientation();
+                return move_action.updateStateAndGetNextIntent(*robot, block_position,
+                                                               block_orientation, 0.0);
+            }
+        } while (!move_action.done());
+    }
+    return std::unique_ptr<Intent>{};
 }
@@ -41,14 +41,15 @@ class BlockShotPathTactic : public Tactic
      *
      * @param robot The robot to evaluate the cost for
      * @param world The state of the world with which to perform the evaluation
+     * @param world_analysis The analysis of the same world
      * @return A cost in the range [0,1] indicating the cost of assigning the given robot
      * to this tactic. Lower cost values indicate a more preferred robot.
      */
-    double calculateRobotCost(const Robot& robot, const World& world) override;
+    double calculateRobotCost(const Robot& robot, const World& world,
+                              const WorldAnalysis& world_analysis) override;
 
    private:
-    std::unique_ptr<Intent> calculateNextIntent(
-        intent_coroutine::push_type& yield) override;
+    std::unique_ptr<Intent> calculateNextIntent(StacklessCoroutine& coroutine) override;
 
     /**
      * Calculates the location to move to in order to block the shot.
@@ -61,4 +62,8 @@ class BlockShotPathTactic : public Tactic
     Point shot_origin;
     // The field we are playing on
     Field field;
+
+    // The Action used to move the robot. It is kept here rather than in
+    // calculateNextIntent so that it lives between calls
+    MoveAction move_action;
 };
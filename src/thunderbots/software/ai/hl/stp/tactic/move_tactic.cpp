@@ -18,7 +18,8 @@ void MoveTactic::updateParams(Point destination, Angle final_orientation,
     this->final_speed       = final_speed;
 }
 
-double MoveTactic::calculateRobotCost(const Robot &robot, const World &world)
+double MoveTactic::calculateRobotCost(const Robot &robot, const World &world,
+                                      const WorldAnalysis &world_analysis)
 {
     // Prefer robots closer to the destination
     // We normalize with the total field length so that robots that are within the field
@@ -27,13 +28,17 @@ double MoveTactic::calculateRobotCost(const Robot &robot, const World &world)
     return std::clamp<double>(cost, 0, 1);
 }
 
-std::unique_ptr<Intent> MoveTactic::calculateNextIntent(
-    intent_coroutine::push_type &yield)
+std::unique_ptr<Intent> MoveTactic::calculateNextIntent(StacklessCoroutine &coroutine)
 {
-    MoveAction move_action = MoveAction();
-    do
+    BOOST_ASIO_CORO_REENTER(coroutine)
     {
-        yield(move_action.updateStateAndGetNextIntent(*robot, destination,
-                                                      final_orientation, final_speed));
-    } while (!move_action.done());
+        // Start a new MoveAction every time the Tactic is restarted
+        move_action = MoveAction();
+        do
+        {
+            BOOST_ASIO_CORO_YIELD return move_action.updateStateAndGetNextIntent(
+                *robot, destination, final_orientation, final_speed);
+        } while (!move_action.done());
+    }
+    return std::unique_ptr<Intent>{};
 }
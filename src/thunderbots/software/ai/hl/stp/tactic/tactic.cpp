@@ -3,9 +3,7 @@
 #include "util/logger/init.h"
 
 Tactic::Tactic(bool loop_forever)
-    : intent_sequence(boost::bind(&Tactic::calculateNextIntentWrapper, this, _1)),
-      done_(false),
-      loop_forever(loop_forever)
+    : intent_sequence(), done_(false), loop_forever(loop_forever)
 {
 }
 
@@ -36,44 +34,28 @@ std::unique_ptr<Intent> Tactic::getNextIntent()
     auto next_intent = getNextIntentHelper();
     if (done_ && loop_forever)
     {
-        // If the tactic is done and is supposed to loop forever, we re-create the
-        // intent_sequence which "restarts" the coroutine. We then run the coroutine
-        // again, and return the result from the restarted coroutine rather than the
-        // old one. This way, any callers of this function won't accidentally get a
-        // nullptr returned for a single call (which could come from the "old" coroutine)
-        // when this Tactic restarts
-        intent_sequence = intent_coroutine::pull_type(
-            boost::bind(&Tactic::calculateNextIntentWrapper, this, _1));
+        // If the tactic is done and is supposed to loop forever, we restart the
+        // intent_sequence coroutine. We then run the coroutine again, and return the
+        // result from the restarted coroutine rather than the old one. This way, any
+        // callers of this function won't accidentally get a nullptr returned for a
+        // single call (which could come from the "old" coroutine) when this Tactic
+        // restarts
+        intent_sequence.restart();
         next_intent = getNextIntentHelper();
     }
 
     return next_intent;
 }
 
-std::unique_ptr<Intent> Tactic::calculateNextIntentWrapper(
-    intent_coroutine::push_type &yield)
-{
-    // Yield a null pointer the very first time the function is called. This value will
-    // never be seen/used by the rest of the system.
-    yield(std::unique_ptr<Intent>{});
-
-    // Anytime after the first function call, the calculateNextIntent function will be
-    // used to perform the real logic
-    return calculateNextIntent(yield);
-}
-
 std::unique_ptr<Intent> Tactic::getNextIntentHelper()
 {
     std::unique_ptr<Intent> next_intent;
-    // Check if the coroutine "iterator" has any more work to do. Only run the coroutine
-    // if there is work to be done otherwise the coroutine library will fail on an assert.
-    if (intent_sequence)
+    // Check if the coroutine has any more work to do. Once the coroutine is done, running
+    // it again would start the logic over, so we only run it if there is work to be done
+    if (!intent_sequence.done())
     {
-        // Run the coroutine
-        intent_sequence();
-        // Get the result of running the coroutine, which is the next Intent the Tactic
-        // wants to run
-        next_intent = intent_sequence.get();
+        // Run the coroutine, which returns the next Intent the Tactic wants to run
+        next_intent = calculateNextIntent(intent_sequence);
     }
 
     // The Tactic is considered done once the next_intent becomes a nullptr. This could
@@ -1,9 +1,10 @@
 #pragma once
 
-#include <boost/coroutine2/all.hpp>
 #include <optional>
 
 #include "ai/hl/stp/action/action.h"
+#include "ai/hl/stp/evaluation/world_analysis.h"
+#include "ai/hl/stp/stackless_coroutine.h"
 #include "ai/intent/intent.h"
 #include "ai/world/world.h"
 
@@ -74,11 +75,15 @@ class Tactic
      *
      * @param robot The Robot to calculate the cost for
      * @param world The state of the world used to perform the cost calculation
+     * @param world_analysis The analysis of the same world. Facts like the distances
+     * between robots should be taken from here, since they are only calculated once per
+     * tick for every Tactic
      *
      * @return A cost value in the range [0, 1] indicating the cost of assigning the given
      * robot to this Tactic. Lower cost values indicate more preferred robots.
      */
-    virtual double calculateRobotCost(const Robot &robot, const World &world) = 0;
+    virtual double calculateRobotCost(const Robot &robot, const World &world,
+                                      const WorldAnalysis &world_analysis) = 0;
 
     /**
      * Runs the coroutine and get the next Intent to run from the calculateNextIntent
@@ -104,43 +109,19 @@ class Tactic
     std::optional<Robot> robot;
 
    private:
-    /**
-     * A wrapper function for the calculateNextIntent function.
-     *
-     * This function exists because when the coroutine (intent_sequence) is first
-     * constructed the coroutine is called/entered. This would normally cause the
-     * calculateNextIntent to be run once and potentially return incorrect results
-     * due to default constructed values.
-     *
-     * This wrapper function will yield a null pointer the first time it's called and
-     * otherwise use the calculateNextIntent function. This first "null" value will never
-     * be seen/used by the rest of the system since this will be during construction,
-     * and the coroutine will be called again with valid parameters before any values are
-     * returned. This effectively "shields" the logic from any errors caused by default
-     * values during construction.
-     *
-     * @param yield The coroutine push_type for the Tactic
-     *
-     * @return A unique pointer to the next Intent that should be run for the Tactic.
-     * If the Tactic is done, an empty/null unique pointer is returned. The very first
-     * time this function is called, a null pointer will be returned (this does not
-     * signify the Tactic is done).
-     */
-    std::unique_ptr<Intent> calculateNextIntentWrapper(
-        intent_coroutine::push_type &yield);
-
     /**
      * Calculates the next Intent for the Tactic. If the Tactic is done
      * (ie. it has achieved its objective and has no more Intents to return),
      * a nullptr is returned.
      *
-     * @param yield The coroutine push_type for the Tactic
+     * @param coroutine The coroutine of the Tactic, which keeps track of where the
+     * Tactic's logic continues from. See StacklessCoroutine for how to use it
      *
      * @return A unique pointer to the next Intent that should be run for the Tactic.
      * If the Tactic is done, a nullptr is returned.
      */
     virtual std::unique_ptr<Intent> calculateNextIntent(
-        intent_coroutine::push_type &yield) = 0;
+        StacklessCoroutine &coroutine) = 0;
 
     /**
      * A helper function that runs the intent_sequence coroutine and returns the result
@@ -153,7 +134,7 @@ class Tactic
     std::unique_ptr<Intent> getNextIntentHelper();
 
     // The coroutine that sequentially returns the Intents the Tactic wants to run
-    intent_coroutine::pull_type intent_sequence;
+    StacklessCoroutine intent_sequence;
     // Whether or not this Tactic is done
     bool done_;
     // Whether or not this tactic should loop forever by restarting each time it is done
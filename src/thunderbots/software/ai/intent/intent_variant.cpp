@@ -0,0 +1,82 @@
+#include "ai/intent/intent_variant.h"
+
+#include <optional>
+
+#include "ai/intent/visitor/intent_visitor.h"
+
+namespace
+{
+    /**
+     * Copies the Intent it visits into an IntentVariant
+     */
+    class IntentVariantVisitor : public IntentVisitor
+    {
+       public:
+        void visit(const CatchIntent &catch_intent) override
+        {
+            intent_variant = catch_intent;
+        }
+
+        void visit(const ChipIntent &chip_intent) override
+        {
+            intent_variant = chip_intent;
+        }
+
+        void visit(const DirectVelocityIntent &direct_velocity_intent) override
+        {
+            intent_variant = direct_velocity_intent;
+        }
+
+        void visit(const DirectWheelsIntent &direct_wheels_intent) override
+        {
+            intent_variant = direct_wheels_intent;
+        }
+
+        void visit(const DribbleIntent &dribble_intent) override
+        {
+            intent_variant = dribble_intent;
+        }
+
+        void visit(const KickIntent &kick_intent) override
+        {
+            intent_variant = kick_intent;
+        }
+
+        void visit(const MoveIntent &move_intent) override
+        {
+            intent_variant = move_intent;
+        }
+
+        void visit(const MoveSpinIntent &move_spin_intent) override
+        {
+            intent_variant = move_spin_intent;
+        }
+
+        void visit(const PivotIntent &pivot_intent) override
+        {
+            intent_variant = pivot_intent;
+        }
+
+        void visit(const StopIntent &stop_intent) override
+        {
+            intent_variant = stop_intent;
+        }
+
+        // The copy of the last Intent visited
+        std::optional<IntentVariant> intent_variant;
+    };
+}  // namespace
+
+IntentVariant createIntentVariant(const Intent &intent)
+{
+    IntentVariantVisitor visitor;
+    intent.accept(visitor);
+    return *visitor.intent_variant;
+}
+
+const Intent &getIntent(const IntentVariant &intent)
+{
+    return std::visit(
+        [](const auto &concrete_intent) -> const Intent & { return concrete_intent; },
+        intent);
+}
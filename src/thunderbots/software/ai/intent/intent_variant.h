@@ -0,0 +1,50 @@
+#pragma once
+
+#include <variant>
+
+#include "ai/intent/catch_intent.h"
+#include "ai/intent/chip_intent.h"
+#include "ai/intent/direct_velocity_intent.h"
+#include "ai/intent/direct_wheels_intent.h"
+#include "ai/intent/dribble_intent.h"
+#include "ai/intent/kick_intent.h"
+#include "ai/intent/move_intent.h"
+#include "ai/intent/movespin_intent.h"
+#include "ai/intent/pivot_intent.h"
+#include "ai/intent/stop_intent.h"
+
+/**
+ * Holds any one of the concrete Intents by value.
+ *
+ * Unlike a std::unique_ptr<Intent>, an IntentVariant does not need its own heap
+ * allocation, so a std::vector of them stores every Intent contiguously and can be
+ * cleared and refilled every tick without allocating. The concrete type is found with
+ * std::visit rather than a virtual IntentVisitor, for example:
+ *
+ * std::visit([](const auto &intent) { ... }, intent_variant);
+ *
+ * The concrete Intent classes are still used to create and read Intents, and
+ * createIntentVariant converts any Intent to an IntentVariant.
+ */
+using IntentVariant = std::variant<CatchIntent, ChipIntent, DirectVelocityIntent,
+                                   DirectWheelsIntent, DribbleIntent, KickIntent,
+                                   MoveIntent, MoveSpinIntent, PivotIntent, StopIntent>;
+
+/**
+ * Copies the given Intent into an IntentVariant holding its concrete type
+ *
+ * @param intent The Intent to copy
+ *
+ * @return An IntentVariant holding a copy of the given Intent
+ */
+IntentVariant createIntentVariant(const Intent &intent);
+
+/**
+ * Returns the Intent held by the given IntentVariant, so the functions all Intents
+ * share can be used without visiting it
+ *
+ * @param intent The IntentVariant to get the Intent from
+ *
+ * @return A reference to the Intent held by the given IntentVariant
+ */
+const Intent &getIntent(const IntentVariant &intent);
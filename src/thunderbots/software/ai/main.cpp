@@ -1,15 +1,18 @@
 #include <ros/ros.h>
 
 #include "ai/ai.h"
+#include "ai/tick_scheduler/tick_scheduler.h"
 #include "thunderbots_msgs/PrimitiveArray.h"
-#include "thunderbots_msgs/World.h"
+#include "thunderbots_msgs/WorldDelta.h"
 #include "util/constants.h"
+#include "util/latency_tracker/latency_tracker.h"
 #include "util/logger/init.h"
 #include "util/parameter/dynamic_parameter_utils.h"
 #include "util/parameter/dynamic_parameters.h"
-#include "util/ros_messages.h"
+#include "util/shared_memory/shared_world_subscriber.h"
 #include "util/time/timestamp.h"
 #include "util/visualizer_messenger/visualizer_messenger.h"
+#include "util/world_delta/world_delta_decoder.h"
 
 // Member variables we need to maintain state
 // They are kept in an anonymous namespace so they are not accessible outside this
@@ -20,30 +23,69 @@ namespace
     ros::Publisher primitive_publisher;
     // Our instance of the AI that decides what Primitives to run
     AI ai;
+    // Measures how long the World takes to reach the AI and how long the AI takes to run
+    Util::LatencyTracker latency_tracker("ai_logic");
+    // Receives the World from network_input through shared memory, if enabled
+    std::unique_ptr<Util::SharedWorldSubscriber> shared_world_subscriber;
+    // Runs the AI on the latest World at a fixed period, with a deadline for each tick
+    std::unique_ptr<TickScheduler> tick_scheduler;
+    // Rebuilds the World from the changes network_input publishes over ROS
+    Util::WorldDeltaDecoder world_delta_decoder;
 }  // namespace
 
-// Runs the AI and sends new Primitive commands every time we get new information
-// about the World
-void worldUpdateCallback(const thunderbots_msgs::World::ConstPtr &msg)
+// Runs the AI and sends new Primitive commands for the given World. This is only called
+// by the TickScheduler, so the AI is only ever run by one thread
+void runAI(const World &world, const thunderbots_msgs::FrameTrace &world_trace)
 {
-    thunderbots_msgs::World world_msg = *msg;
-    World world = Util::ROSMessages::createWorldFromROSMessage(world_msg);
+    double ai_start_timestamp = Util::LatencyTracker::getCurrentTimestamp();
 
     // Get the Primitives the Robots should run from the AI
-    std::vector<std::unique_ptr<Primitive>> assignedPrimitives = ai.getPrimitives(world);
+    const std::vector<PrimitiveVariant> &assignedPrimitives = ai.getPrimitives(world);
 
     // Put these Primitives into a message and publish it
     thunderbots_msgs::PrimitiveArray primitive_array_message;
     for (auto const &prim : assignedPrimitives)
     {
-        primitive_array_message.primitives.emplace_back(prim->createMsg());
+        primitive_array_message.primitives.emplace_back(getPrimitive(prim).createMsg());
     }
+
+    // Pass the trace of the World along with the Primitives so the nodes that send them
+    // to the robots can measure the full latency from the vision data being received
+    primitive_array_message.trace                    = world_trace;
+    primitive_array_message.trace.ai_start_timestamp = ai_start_timestamp;
+    primitive_array_message.trace.primitives_publish_timestamp =
+        Util::LatencyTracker::getCurrentTimestamp();
     primitive_publisher.publish(primitive_array_message);
 
+    latency_tracker.recordStageLatency(
+        "world_transport", world_trace.world_publish_timestamp, ai_start_timestamp);
+    latency_tracker.recordStageLatency(
+        "ai_tick", ai_start_timestamp,
+        primitive_array_message.trace.primitives_publish_timestamp);
+    latency_tracker.publishAndLogIfReportDue();
+
     // On every tick, send the layer messages
     Util::VisualizerMessenger::getInstance()->publishAndClearLayers();
 }
 
+// Applies every change to the World we get over ROS, and gives the result to the
+// TickScheduler unless we are already getting the World through shared memory
+void worldDeltaCallback(const thunderbots_msgs::WorldDelta::ConstPtr &msg)
+{
+    // Every change is applied even while we are using the World from shared memory, so
+    // the World from ROS is ready to use as soon as shared memory stops working
+    bool world_valid = world_delta_decoder.apply(*msg);
+
+    if (!world_valid ||
+        (shared_world_subscriber && shared_world_subscriber->isReceiving()))
+    {
+        return;
+    }
+
+    // The TickScheduler only keeps the latest World, so handing over every one is safe
+    tick_scheduler->updateWorld(world_delta_decoder.world(), msg->trace);
+}
+
 int main(int argc, char **argv)
 {
     // Init ROS node
@@ -55,15 +97,55 @@ int main(int argc, char **argv)
         Util::Constants::AI_PRIMITIVES_TOPIC, 1);
 
     // Create subscribers
-    ros::Subscriber world_subscriber = node_handle.subscribe(
-        Util::Constants::NETWORK_INPUT_WORLD_TOPIC, 1, worldUpdateCallback);
+    ros::Subscriber world_delta_subscriber = node_handle.subscribe(
+        Util::Constants::NETWORK_INPUT_WORLD_DELTA_TOPIC,
+        Util::Constants::NETWORK_INPUT_WORLD_DELTA_QUEUE_SIZE, worldDeltaCallback);
 
     // Initialize the logger
     Util::Logger::LoggerSingleton::initializeLogger(node_handle);
 
+    // Initialize the latency diagnostics publisher
+    latency_tracker.initializePublisher(node_handle);
+
     // Initialize the draw visualizer messenger
     Util::VisualizerMessenger::getInstance()->initializePublisher(node_handle);
 
+    // Run the AI at the rate vision data arrives, leaving some time at the end of each
+    // tick for the Primitives to be published before the next World arrives
+    ros::NodeHandle private_node_handle("~");
+    double tick_period_milliseconds;
+    double tick_deadline_milliseconds;
+    private_node_handle.param<double>("tick_period_milliseconds",
+                                      tick_period_milliseconds, 1000.0 / 60.0);
+    private_node_handle.param<double>("tick_deadline_milliseconds",
+                                      tick_deadline_milliseconds, 12.0);
+    try
+    {
+        tick_scheduler = std::make_unique<TickScheduler>(
+            Duration::fromMilliseconds(tick_period_milliseconds),
+            Duration::fromMilliseconds(tick_deadline_milliseconds),
+            TickBudget::getInstance(), latency_tracker, runAI);
+    }
+    catch (const std::invalid_argument &ex)
+    {
+        // LOG(FATAL) will terminate the ai_logic process
+        LOG(FATAL) << "Invalid AI tick period or deadline: " << ex.what() << std::endl;
+    }
+
+    // Receive the World through shared memory when network_input is on the same machine,
+    // falling back to the ROS topic otherwise
+    bool use_shared_memory_world;
+    private_node_handle.param<bool>("shared_memory_world", use_shared_memory_world, true);
+    if (use_shared_memory_world)
+    {
+        shared_world_subscriber = std::make_unique<Util::SharedWorldSubscriber>(
+            Util::SharedWorldRing::NETWORK_INPUT_WORLD_SEGMENT,
+            [](const World &world, const thunderbots_msgs::FrameTrace &trace) {
+                tick_scheduler->updateWorld(world, trace);
+            });
+        shared_world_subscriber->startBackgroundThread();
+    }
+
     // Initialize Dynamic Parameters
     auto update_subscribers =
         Util::DynamicParameters::initUpdateSubscriptions(node_handle);
@@ -73,5 +155,9 @@ int main(int argc, char **argv)
     // http://wiki.ros.org/roscpp/Overview/Callbacks%20and%20Spinning
     ros::spin();
 
+    // Stop receiving the World before anything it uses is destroyed
+    shared_world_subscriber.reset();
+    tick_scheduler.reset();
+
     return 0;
 }
@@ -40,9 +40,10 @@ std::vector<RobotObstacle> generate_friendly_obstacles(const Team& friendly_team
                                                        double avoid_dist)
 {
     std::vector<RobotObstacle> obst;
-    for (Robot r : friendly_team.getAllRobots())
+    obst.reserve(friendly_team.numRobots());
+    for (const Robot& r : friendly_team.getAllRobots())
     {
-        obst.push_back(RobotObstacle(r, avoid_dist));
+        obst.emplace_back(r, avoid_dist);
     }
 
     return obst;
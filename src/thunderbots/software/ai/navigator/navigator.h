@@ -1,7 +1,7 @@
 #pragma once
 
-#include "ai/intent/intent.h"
-#include "ai/primitive/primitive.h"
+#include "ai/intent/intent_variant.h"
+#include "ai/primitive/primitive_variant.h"
 #include "ai/world/world.h"
 
 /**
@@ -22,14 +22,17 @@ class Navigator
      * returns a list of Primitives that our Robots should perform in order to
      * work towards achieving their Intent.
      *
+     * The Primitives are stored in the Navigator, so the memory used for them is
+     * reused every tick rather than allocated again.
+     *
      * @param world The current state of the world
      * @param assignedIntents A list of Intents assigned to our friendly robots
      * @return A list of Primitives to be run by our Robots in order to work towards
-     * achieving their Intents
+     * achieving their Intents. The list is only valid until the next call to
+     * getAssignedPrimitives
      */
-    virtual std::vector<std::unique_ptr<Primitive>> getAssignedPrimitives(
-        const World &world,
-        const std::vector<std::unique_ptr<Intent>> &assignedIntents) = 0;
+    virtual const std::vector<PrimitiveVariant> &getAssignedPrimitives(
+        const World &world, const std::vector<IntentVariant> &assignedIntents) = 0;
 
     virtual ~Navigator() = default;
 };
@@ -0,0 +1,307 @@
+#include "ai/navigator/obstacle/clearance_grid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "geom/util.h"
+
+namespace
+{
+    // The squared distance of a cell with no target cell anywhere in the grid. It is
+    // finite so that the distance transform's arithmetic stays well defined
+    const double NO_TARGET_SQUARED_DISTANCE = 1e20;
+
+    /**
+     * Computes the one dimensional squared euclidean distance transform of a sampled
+     * function, using the lower envelope of parabolas from Felzenszwalb and
+     * Huttenlocher's "Distance Transforms of Sampled Functions"
+     *
+     * @param f The sampled function
+     * @param d Set to the squared distance transform of f, and must be as long as f
+     * @param parabola_vertices Scratch space as long as f
+     * @param parabola_boundaries Scratch space one longer than f
+     */
+    void squaredDistanceTransform(const std::vector<double> &f, std::vector<double> &d,
+                                  std::vector<size_t> &parabola_vertices,
+                                  std::vector<double> &parabola_boundaries)
+    {
+        auto intersection = [&f](size_t q, size_t v) {
+            double q_value = static_cast<double>(q);
+            double v_value = static_cast<double>(v);
+            return ((f[q] + q_value * q_value) - (f[v] + v_value * v_value)) /
+                   (2 * q_value - 2 * v_value);
+        };
+
+        size_t k               = 0;
+        parabola_vertices[0]   = 0;
+        parabola_boundaries[0] = -std::numeric_limits<double>::infinity();
+        parabola_boundaries[1] = std::numeric_limits<double>::infinity();
+        for (size_t q = 1; q < f.size(); q++)
+        {
+            double s = intersection(q, parabola_vertices[k]);
+            while (k > 0 && s <= parabola_boundaries[k])
+            {
+                k--;
+                s = intersection(q, parabola_vertices[k]);
+            }
+            k++;
+            parabola_vertices[k]       = q;
+            parabola_boundaries[k]     = s;
+            parabola_boundaries[k + 1] = std::numeric_limits<double>::infinity();
+        }
+
+        k = 0;
+        for (size_t q = 0; q < f.size(); q++)
+        {
+            while (parabola_boundaries[k + 1] < static_cast<double>(q))
+            {
+                k++;
+            }
+            double offset = static_cast<double>(q) - parabola_vertices[k];
+            d[q]          = offset * offset + f[parabola_vertices[k]];
+        }
+    }
+}  // namespace
+
+ClearanceGrid::ClearanceGrid(const Rectangle &area, double resolution)
+    : area(area), resolution(resolution)
+{
+    if (resolution <= 0)
+    {
+        throw std::invalid_argument("ClearanceGrid resolution must be positive");
+    }
+    // The grid needs at least two cells in each direction to interpolate between
+    num_columns = std::max<size_t>(2, std::ceil(area.width() / resolution));
+    num_rows    = std::max<size_t>(2, std::ceil(area.height() / resolution));
+}
+
+void ClearanceGrid::addCircle(const Circle &circle)
+{
+    circles.emplace_back(circle);
+}
+
+void ClearanceGrid::addCapsule(const Segment &segment, double radius)
+{
+    capsules.emplace_back(segment, radius);
+}
+
+void ClearanceGrid::addRectangle(const Rectangle &rectangle)
+{
+    rectangles.emplace_back(rectangle);
+}
+
+void ClearanceGrid::build(Util::ThreadPool &thread_pool)
+{
+    size_t num_cells = num_columns * num_rows;
+    occupied.assign(num_cells, false);
+    clearances.assign(num_cells, 0);
+
+    // The squared distances, in cells, from each cell to the nearest occupied cell and
+    // to the nearest free cell
+    std::vector<double> squared_distances_to_occupied(num_cells);
+    std::vector<double> squared_distances_to_free(num_cells);
+
+    // Each chunk of rows or columns is handled by one thread, so the scratch space for
+    // the distance transform is only allocated once per thread
+    size_t num_chunks        = thread_pool.getNumWorkerThreads() + 1;
+    auto parallel_for_ranges = [&](size_t size,
+                                   const std::function<void(size_t, size_t)> &task) {
+        thread_pool.parallelFor(num_chunks, [&](size_t chunk) {
+            task(size * chunk / num_chunks, size * (chunk + 1) / num_chunks);
+        });
+    };
+
+    parallel_for_ranges(num_rows, [this](size_t first_row, size_t end_row) {
+        rasterizeRows(first_row, end_row);
+    });
+
+    // The two dimensional transform is a one dimensional transform down every column,
+    // followed by one along every row
+    parallel_for_ranges(num_columns, [&](size_t first_column, size_t end_column) {
+        std::vector<double> f(num_rows), d(num_rows), parabola_boundaries(num_rows + 1);
+        std::vector<size_t> parabola_vertices(num_rows);
+        for (size_t column = first_column; column < end_column; column++)
+        {
+            for (bool to_occupied : {true, false})
+            {
+                for (size_t row = 0; row < num_rows; row++)
+                {
+                    bool is_target = occupied[row * num_columns + column] == to_occupied;
+                    f[row]         = is_target ? 0 : NO_TARGET_SQUARED_DISTANCE;
+                }
+                squaredDistanceTransform(f, d, parabola_vertices, parabola_boundaries);
+                std::vector<double> &squared_distances =
+                    to_occupied ? squared_distances_to_occupied
+                                : squared_distances_to_free;
+                for (size_t row = 0; row < num_rows; row++)
+                {
+                    squared_distances[row * num_columns + column] = d[row];
+                }
+            }
+        }
+    });
+
+    parallel_for_ranges(num_rows, [&](size_t first_row, size_t end_row) {
+        std::vector<double> f(num_columns), d(num_columns),
+            parabola_boundaries(num_columns + 1);
+        std::vector<size_t> parabola_vertices(num_columns);
+        for (size_t row = first_row; row < end_row; row++)
+        {
+            size_t row_start = row * num_columns;
+            for (std::vector<double> *squared_distances :
+                 {&squared_distances_to_occupied, &squared_distances_to_free})
+            {
+                std::copy(squared_distances->begin() + row_start,
+                          squared_distances->begin() + row_start + num_columns,
+                          f.begin());
+                squaredDistanceTransform(f, d, parabola_vertices, parabola_boundaries);
+                std::copy(d.begin(), d.end(), squared_distances->begin() + row_start);
+            }
+
+            // The edge of an obstacle is taken to be half way between the centres of
+            // an occupied cell and the free cell next to it
+            for (size_t column = 0; column < num_columns; column++)
+            {
+                size_t cell = row_start + column;
+                if (occupied[cell])
+                {
+                    clearances[cell] =
+                        -(std::sqrt(squared_distances_to_free[cell]) - 0.5) * resolution;
+                }
+                else
+                {
+                    // The distance to the area's edge is known exactly, so it is used
+                    // instead of the nearest occupied cell outside the area
+                    Point centre          = getCellCentre(column, row);
+                    double edge_clearance = std::min({centre.x() - area.swCorner().x(),
+                                                      area.neCorner().x() - centre.x(),
+                                                      centre.y() - area.swCorner().y(),
+                                                      area.neCorner().y() - centre.y()});
+                    clearances[cell] =
+                        std::min(edge_clearance,
+                                 (std::sqrt(squared_distances_to_occupied[cell]) - 0.5) *
+                                     resolution);
+                }
+            }
+        }
+    });
+}
+
+double ClearanceGrid::getClearance(const Point &point) const
+{
+    // Outside the area, the nearest point outside the obstacles is on the area's edge
+    Vector outside_area(
+        std::max({0.0, area.swCorner().x() - point.x(), point.x() - area.neCorner().x()}),
+        std::max(
+            {0.0, area.swCorner().y() - point.y(), point.y() - area.neCorner().y()}));
+    if (outside_area.len() > 0)
+    {
+        return -outside_area.len();
+    }
+
+    // Bilinearly interpolate between the centres of the four nearest cells
+    double column_position = std::clamp(
+        (point.x() - area.swCorner().x()) / resolution - 0.5, 0.0, num_columns - 1.0);
+    double row_position = std::clamp((point.y() - area.swCorner().y()) / resolution - 0.5,
+                                     0.0, num_rows - 1.0);
+    size_t column       = std::min<size_t>(column_position, num_columns - 2);
+    size_t row          = std::min<size_t>(row_position, num_rows - 2);
+    double column_fraction = column_position - column;
+    double row_fraction    = row_position - row;
+
+    const double *lower_row = &clearances[row * num_columns + column];
+    const double *upper_row = lower_row + num_columns;
+    double lower_clearance =
+        lower_row[0] + (lower_row[1] - lower_row[0]) * column_fraction;
+    double upper_clearance =
+        upper_row[0] + (upper_row[1] - upper_row[0]) * column_fraction;
+    return lower_clearance + (upper_clearance - lower_clearance) * row_fraction;
+}
+
+Vector ClearanceGrid::getGradient(const Point &point) const
+{
+    Vector x_step(resolution, 0);
+    Vector y_step(0, resolution);
+    return Vector(getClearance(point + x_step) - getClearance(point - x_step),
+                  getClearance(point + y_step) - getClearance(point - y_step)) /
+           (2 * resolution);
+}
+
+void ClearanceGrid::rasterizeRows(size_t first_row, size_t end_row)
+{
+    if (first_row >= end_row)
+    {
+        return;
+    }
+
+    for (size_t row = first_row; row < end_row; row++)
+    {
+        for (size_t column = 0; column < num_columns; column++)
+        {
+            occupied[row * num_columns + column] =
+                !area.containsPoint(getCellCentre(column, row));
+        }
+    }
+
+    // Only the cells within each obstacle's bounding box need to be checked
+    auto mark_obstacle = [&](const Point &min_corner, const Point &max_corner,
+                             const std::function<bool(const Point &)> &contains_point) {
+        auto to_index = [this](double offset, size_t num_cells) {
+            return static_cast<size_t>(
+                std::clamp(offset / resolution - 0.5, 0.0, num_cells - 1.0));
+        };
+        size_t min_column = to_index(min_corner.x() - area.swCorner().x(), num_columns);
+        size_t max_column =
+            to_index(max_corner.x() - area.swCorner().x(), num_columns) + 1;
+        size_t min_row =
+            std::max(first_row, to_index(min_corner.y() - area.swCorner().y(), num_rows));
+        size_t max_row = std::min(
+            end_row - 1, to_index(max_corner.y() - area.swCorner().y(), num_rows) + 1);
+        for (size_t row = min_row; row <= max_row; row++)
+        {
+            for (size_t column = min_column; column <= max_column && column < num_columns;
+                 column++)
+            {
+                if (contains_point(getCellCentre(column, row)))
+                {
+                    occupied[row * num_columns + column] = true;
+                }
+            }
+        }
+    };
+
+    for (const Circle &circle : circles)
+    {
+        Vector radius(circle.getRadius(), circle.getRadius());
+        mark_obstacle(circle.getOrigin() - radius, circle.getOrigin() + radius,
+                      [&circle](const Point &point) {
+                          return distsq(point, circle.getOrigin()) <=
+                                 circle.getRadius() * circle.getRadius();
+                      });
+    }
+    for (const auto &[segment, radius] : capsules)
+    {
+        Point start = segment.getSegStart();
+        Point end   = segment.getEnd();
+        mark_obstacle(Point(std::min(start.x(), end.x()) - radius,
+                            std::min(start.y(), end.y()) - radius),
+                      Point(std::max(start.x(), end.x()) + radius,
+                            std::max(start.y(), end.y()) + radius),
+                      [&segment, radius](const Point &point) {
+                          return distsq(point, segment) <= radius * radius;
+                      });
+    }
+    for (const Rectangle &rectangle : rectangles)
+    {
+        mark_obstacle(
+            rectangle.swCorner(), rectangle.neCorner(),
+            [&rectangle](const Point &point) { return rectangle.containsPoint(point); });
+    }
+}
+
+Point ClearanceGrid::getCellCentre(size_t column, size_t row) const
+{
+    return area.swCorner() +
+           Vector((column + 0.5) * resolution, (row + 0.5) * resolution);
+}
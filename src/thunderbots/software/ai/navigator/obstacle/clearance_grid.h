@@ -0,0 +1,124 @@
+#pragma once
+
+#include <vector>
+
+#include "geom/circle.h"
+#include "geom/rectangle.h"
+#include "geom/segment.h"
+#include "util/thread_pool.h"
+
+/**
+ * A ClearanceGrid stores how far every point in an area is from the nearest obstacle,
+ * so that the clearance of a point can be looked up in constant time no matter how
+ * many obstacles there are.
+ *
+ * Obstacles are added as circles, capsules (segments with a radius, such as a robot
+ * extended along its velocity) and rectangles. Everything outside the grid's area is
+ * also an obstacle, so the area's edge acts as a boundary. Once every obstacle has
+ * been added, build() rasterizes them and runs a separable euclidean distance
+ * transform over the grid, after which getClearance() and getGradient() can be called.
+ *
+ * The clearance is a signed distance: it is positive outside the obstacles, and
+ * negative inside them with the magnitude of how far the point is from leaving them.
+ * Clearances are accurate to about one grid cell.
+ */
+class ClearanceGrid
+{
+   public:
+    /**
+     * Creates a new ClearanceGrid with no obstacles
+     *
+     * @param area The area covered by the grid. Everything outside it is an obstacle
+     * @param resolution The side length of each grid cell, in metres
+     *
+     * @throws std::invalid_argument if the resolution is not positive
+     */
+    explicit ClearanceGrid(const Rectangle &area, double resolution);
+
+    /**
+     * Adds a circular obstacle
+     *
+     * @param circle The obstacle
+     */
+    void addCircle(const Circle &circle);
+
+    /**
+     * Adds an obstacle covering every point within the given radius of a segment
+     *
+     * @param segment The segment the obstacle is around
+     * @param radius How far the obstacle extends from the segment
+     */
+    void addCapsule(const Segment &segment, double radius);
+
+    /**
+     * Adds a rectangular obstacle
+     *
+     * @param rectangle The obstacle
+     */
+    void addRectangle(const Rectangle &rectangle);
+
+    /**
+     * Computes the clearance of every grid cell from the obstacles added so far. The
+     * rows and columns of the grid are split across the given thread pool
+     *
+     * @param thread_pool The thread pool to build the grid on
+     */
+    void build(Util::ThreadPool &thread_pool);
+
+    /**
+     * Returns the signed distance from the given point to the nearest obstacle. Only
+     * valid after build() has been called
+     *
+     * @param point The point to find the clearance of
+     *
+     * @return the distance from the point to the nearest obstacle if it is outside
+     * every obstacle, or minus the distance to the nearest point outside the obstacles
+     * if it is inside one
+     */
+    double getClearance(const Point &point) const;
+
+    /**
+     * Returns the gradient of the clearance at the given point, which points away
+     * from the nearest obstacle. Only valid after build() has been called
+     *
+     * @param point The point to find the gradient at
+     *
+     * @return the gradient of the clearance at the point
+     */
+    Vector getGradient(const Point &point) const;
+
+   private:
+    /**
+     * Marks the cells of the given rows whose centres are inside an obstacle or
+     * outside the grid's area
+     *
+     * @param first_row The first row to mark
+     * @param end_row One past the last row to mark
+     */
+    void rasterizeRows(size_t first_row, size_t end_row);
+
+    /**
+     * Returns the centre of the given grid cell
+     *
+     * @param column The column of the cell
+     * @param row The row of the cell
+     *
+     * @return the centre of the cell
+     */
+    Point getCellCentre(size_t column, size_t row) const;
+
+    Rectangle area;
+    double resolution;
+    size_t num_columns;
+    size_t num_rows;
+
+    std::vector<Circle> circles;
+    std::vector<std::pair<Segment, double>> capsules;
+    std::vector<Rectangle> rectangles;
+
+    // Whether the centre of each cell is inside an obstacle, stored row by row. This is
+    // not a std::vector<bool> so that different rows can be written in parallel
+    std::vector<char> occupied;
+    // The signed clearance at the centre of each cell, stored row by row
+    std::vector<double> clearances;
+};
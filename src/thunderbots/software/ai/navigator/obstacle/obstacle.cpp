@@ -0,0 +1,41 @@
+#include "ai/navigator/obstacle/obstacle.h"
+
+#include "shared/constants.h"
+
+Obstacle::Obstacle(const Polygon& boundary) : boundary(boundary) {}
+
+Obstacle Obstacle::createRobotObstacle(const Robot& robot, double robot_radius_scaling,
+                                       double velocity_projection_scaling)
+{
+    return Obstacle(
+        getBoundaryPolygon(robot, robot_radius_scaling, velocity_projection_scaling));
+}
+
+Polygon Obstacle::getBoundaryPolygon(const Robot& robot, double robot_radius_scaling,
+                                     double velocity_projection_scaling)
+{
+    double radius              = ROBOT_MAX_RADIUS_METERS * robot_radius_scaling;
+    Vector velocity_projection = robot.velocity() * velocity_projection_scaling;
+
+    // A hexagon around the robot, with its vertices in order around the centre. The
+    // vertices on the side the robot is moving towards are pushed out along the
+    // velocity, which keeps the polygon convex and covers where the robot will be soon
+    std::vector<Point> points;
+    for (int i = 0; i < 6; i++)
+    {
+        Vector offset =
+            Vector::createFromAngle(Angle::ofDegrees(30 + 60 * i)).norm(radius);
+        if (offset.dot(velocity_projection) > 0)
+        {
+            offset = offset + velocity_projection;
+        }
+        points.emplace_back(robot.position() + offset);
+    }
+
+    return Polygon(points);
+}
+
+const Polygon& Obstacle::getBoundary() const
+{
+    return boundary;
+}
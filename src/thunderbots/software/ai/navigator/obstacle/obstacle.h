@@ -11,6 +11,28 @@
 class Obstacle
 {
    public:
+    /**
+     * Creates an Obstacle that covers the area inside the given polygon
+     *
+     * @param boundary the boundary of the area to avoid
+     */
+    explicit Obstacle(const Polygon& boundary);
+
+    /**
+     * Creates an Obstacle around the given robot, with the boundary from
+     * getBoundaryPolygon
+     *
+     * @param robot robot to create the obstacle around
+     * @param robot_radius_scaling safety factor to vary the radius size of the buffer
+     * zone (1=default), must be greater than 0
+     * @param velocity_projection_scaling scales the projection buffer in the direction
+     * of the velocity (1=default), must be greater than 0
+     *
+     * @return an Obstacle around the given robot
+     */
+    static Obstacle createRobotObstacle(const Robot& robot, double robot_radius_scaling,
+                                        double velocity_projection_scaling);
+
     /*
      * Gets the boundary polygon around the given robot obstacle that other robots
      * should not enter with a buffer scaled by radiusScaling and
@@ -26,4 +48,14 @@ class Obstacle
      */
     static Polygon getBoundaryPolygon(const Robot& robot, double robot_radius_scaling,
                                       double velocity_projection_scaling);
+
+    /**
+     * Returns the boundary of the area this Obstacle covers
+     *
+     * @return the boundary of the area this Obstacle covers
+     */
+    const Polygon& getBoundary() const;
+
+   private:
+    Polygon boundary;
 };
@@ -0,0 +1,525 @@
+#include "ai/navigator/path_planner/d_star_lite_path_planner.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "geom/util.h"
+
+namespace
+{
+    const double INFINITE_COST = std::numeric_limits<double>::infinity();
+    const double KEY_TOLERANCE = 1e-9;
+}  // namespace
+
+DStarLitePathPlanner::DStarLitePathPlanner(const Rectangle &navigable_area,
+                                           double resolution)
+    : navigable_area(navigable_area),
+      resolution(resolution),
+      start_cell(0),
+      last_start_cell(0),
+      key_modifier(0),
+      num_expansions(0)
+{
+    if (resolution <= 0)
+    {
+        throw std::invalid_argument("DStarLitePathPlanner resolution must be positive");
+    }
+    num_columns = std::max<size_t>(1, std::ceil(navigable_area.width() / resolution));
+    num_rows    = std::max<size_t>(1, std::ceil(navigable_area.height() / resolution));
+}
+
+std::optional<std::vector<Point>> DStarLitePathPlanner::findPath(
+    const Point &start, const Point &dest, const std::vector<Obstacle> &obstacles,
+    const ViolationFunction &violation_function)
+{
+    num_expansions   = 0;
+    start_cell       = getCell(start);
+    size_t dest_cell = getCell(dest);
+    std::vector<size_t> changed_cells =
+        updateCellCosts(start, dest, obstacles, violation_function);
+
+    bool is_new_search = goal_cell != dest_cell;
+    if (is_new_search)
+    {
+        initializeSearch(dest_cell);
+    }
+    else
+    {
+        // The heuristic is measured from the start, so every key in the queue is now
+        // too large by at most how far the start moved
+        key_modifier +=
+            (getCellCentre(last_start_cell) - getCellCentre(start_cell)).len();
+        last_start_cell = start_cell;
+
+        // A cell's cost changes the cost of every edge into and out of it
+        for (size_t cell : changed_cells)
+        {
+            updateCell(cell);
+            for (size_t neighbour : getNeighbours(cell))
+            {
+                updateCell(neighbour);
+            }
+        }
+    }
+
+    computeShortestPath();
+    std::optional<std::vector<Point>> lattice_path =
+        followCheapestCells(start, dest, dest_cell);
+    if (!lattice_path && !is_new_search && costs_to_goal[start_cell] != INFINITE_COST)
+    {
+        // The incremental search only guarantees the start is consistent, so cells it
+        // left inconsistent can make following the cheapest neighbours go round in
+        // circles. The search is started again from scratch when that happens
+        initializeSearch(dest_cell);
+        computeShortestPath();
+        lattice_path = followCheapestCells(start, dest, dest_cell);
+    }
+    if (!lattice_path)
+    {
+        return std::nullopt;
+    }
+
+    std::vector<Point> path = shortenPath(*lattice_path);
+
+    // Cells are only blocked by their centres, and the start and destination are not
+    // at cell centres, so the final path is checked against the obstacles themselves
+    for (size_t i = 0; i + 1 < path.size(); i++)
+    {
+        if (!isCollisionFree(Segment(path[i], path[i + 1])))
+        {
+            return std::nullopt;
+        }
+    }
+    return path;
+}
+
+std::optional<std::vector<Point>> DStarLitePathPlanner::followCheapestCells(
+    const Point &start, const Point &dest, size_t dest_cell) const
+{
+    if (costs_to_goal[start_cell] == INFINITE_COST)
+    {
+        return std::nullopt;
+    }
+
+    // Follow the cheapest neighbour from the start to the goal. The start and goal
+    // cells are replaced by the start and destination themselves
+    std::vector<Point> path = {start};
+    size_t cell             = start_cell;
+    for (size_t step = 0; cell != dest_cell && step < cell_costs.size(); step++)
+    {
+        size_t next_cell = cell;
+        double best_cost = INFINITE_COST;
+        for (size_t neighbour : getNeighbours(cell))
+        {
+            double cost = getEdgeCost(cell, neighbour) + costs_to_goal[neighbour];
+            if (cost < best_cost)
+            {
+                best_cost = cost;
+                next_cell = neighbour;
+            }
+        }
+        if (next_cell == cell)
+        {
+            return std::nullopt;
+        }
+        cell = next_cell;
+        if (cell != dest_cell)
+        {
+            path.emplace_back(getCellCentre(cell));
+        }
+    }
+    if (cell != dest_cell)
+    {
+        return std::nullopt;
+    }
+    path.emplace_back(dest);
+
+    return path;
+}
+
+unsigned int DStarLitePathPlanner::getNumExpansionsOfLastSearch() const
+{
+    return num_expansions;
+}
+
+void DStarLitePathPlanner::invalidateViolationCosts()
+{
+    violation_costs.clear();
+}
+
+std::vector<size_t> DStarLitePathPlanner::updateCellCosts(
+    const Point &start, const Point &dest, const std::vector<Obstacle> &obstacles,
+    const ViolationFunction &violation_function)
+{
+    if (violation_costs.empty())
+    {
+        violation_costs.assign(num_columns * num_rows, 1);
+        if (violation_function)
+        {
+            for (size_t cell = 0; cell < violation_costs.size(); cell++)
+            {
+                violation_costs[cell] +=
+                    VIOLATION_COST_PER_METRE *
+                    std::max(0.0, violation_function(getCellCentre(cell)));
+            }
+        }
+        num_blocking_obstacles.assign(violation_costs.size(), 0);
+        blocking_boundaries.clear();
+        endpoint_cells.clear();
+        cell_costs = violation_costs;
+        // Every cell may have changed, so the search starts again
+        goal_cell = std::nullopt;
+    }
+
+    // Obstacles that contain the start are left out, otherwise a robot inside one
+    // could never leave it
+    search_obstacles.clear();
+    bool dest_is_blocked = false;
+    for (const Obstacle &obstacle : obstacles)
+    {
+        const Polygon &boundary = obstacle.getBoundary();
+        if (boundary.containsPoint(start))
+        {
+            continue;
+        }
+        search_obstacles.emplace_back(&obstacle);
+        dest_is_blocked = dest_is_blocked || boundary.containsPoint(dest);
+    }
+
+    // Only the cells around obstacles that were added, moved or removed since the last
+    // call can have changed, along with the cells of the start and destination
+    std::vector<size_t> affected_cells = endpoint_cells;
+    std::vector<bool> is_still_blocking(blocking_boundaries.size(), false);
+    std::vector<const Polygon *> added_boundaries;
+    for (const Obstacle *obstacle : search_obstacles)
+    {
+        const Polygon &boundary = obstacle->getBoundary();
+        bool was_blocking       = false;
+        for (size_t i = 0; i < blocking_boundaries.size() && !was_blocking; i++)
+        {
+            if (!is_still_blocking[i] &&
+                blocking_boundaries[i].getPoints() == boundary.getPoints())
+            {
+                is_still_blocking[i] = true;
+                was_blocking         = true;
+            }
+        }
+        if (!was_blocking)
+        {
+            added_boundaries.emplace_back(&boundary);
+        }
+    }
+    for (size_t i = blocking_boundaries.size(); i-- > 0;)
+    {
+        if (!is_still_blocking[i])
+        {
+            changeBlockedCells(blocking_boundaries[i], -1, affected_cells);
+            blocking_boundaries.erase(blocking_boundaries.begin() + i);
+        }
+    }
+    for (const Polygon *boundary : added_boundaries)
+    {
+        changeBlockedCells(*boundary, 1, affected_cells);
+        blocking_boundaries.emplace_back(*boundary);
+    }
+
+    // The start and destination are not at the centres of their cells, so their cells
+    // are only blocked if the points themselves are
+    size_t dest_cell = getCell(dest);
+    endpoint_cells   = {start_cell, dest_cell};
+    affected_cells.insert(affected_cells.end(), endpoint_cells.begin(),
+                          endpoint_cells.end());
+    auto get_point_cost = [&violation_function](const Point &point) {
+        return 1 +
+               VIOLATION_COST_PER_METRE *
+                   (violation_function ? std::max(0.0, violation_function(point)) : 0);
+    };
+    double start_cost = get_point_cost(start);
+    double dest_cost  = dest_is_blocked ? INFINITE_COST : get_point_cost(dest);
+
+    std::vector<size_t> changed_cells;
+    for (size_t cell : affected_cells)
+    {
+        double cost;
+        if (cell == dest_cell && dest_is_blocked)
+        {
+            cost = INFINITE_COST;
+        }
+        else if (cell == start_cell)
+        {
+            cost = start_cost;
+        }
+        else if (cell == dest_cell)
+        {
+            cost = dest_cost;
+        }
+        else
+        {
+            cost =
+                num_blocking_obstacles[cell] > 0 ? INFINITE_COST : violation_costs[cell];
+        }
+
+        // A cell can be affected more than once, but it only changes the first time
+        if (cell_costs[cell] != cost)
+        {
+            cell_costs[cell] = cost;
+            changed_cells.emplace_back(cell);
+        }
+    }
+    return changed_cells;
+}
+
+void DStarLitePathPlanner::changeBlockedCells(const Polygon &boundary, int change,
+                                              std::vector<size_t> &cells)
+{
+    // Block every cell within half a diagonal of the obstacle, so that moving between
+    // the centres of unblocked cells does not cut through it
+    double half_cell_diagonal        = resolution * std::sqrt(2) / 2;
+    const std::vector<Point> &points = boundary.getPoints();
+    Point min_corner                 = points.front();
+    Point max_corner                 = points.front();
+    for (const Point &point : points)
+    {
+        min_corner = Point(std::min(min_corner.x(), point.x()),
+                           std::min(min_corner.y(), point.y()));
+        max_corner = Point(std::max(max_corner.x(), point.x()),
+                           std::max(max_corner.y(), point.y()));
+    }
+    Vector margin(half_cell_diagonal, half_cell_diagonal);
+    size_t min_cell = getCell(min_corner - margin);
+    size_t max_cell = getCell(max_corner + margin);
+    for (size_t row = min_cell / num_columns; row <= max_cell / num_columns; row++)
+    {
+        for (size_t column = min_cell % num_columns; column <= max_cell % num_columns;
+             column++)
+        {
+            size_t cell     = row * num_columns + column;
+            Point centre    = getCellCentre(cell);
+            bool is_blocked = boundary.containsPoint(centre);
+            for (size_t i = 0; i < points.size() && !is_blocked; i++)
+            {
+                is_blocked =
+                    dist(centre, Segment(points[i], points[(i + 1) % points.size()])) <
+                    half_cell_diagonal;
+            }
+            if (is_blocked)
+            {
+                num_blocking_obstacles[cell] += change;
+                cells.emplace_back(cell);
+            }
+        }
+    }
+}
+
+void DStarLitePathPlanner::initializeSearch(size_t goal_cell)
+{
+    this->goal_cell = goal_cell;
+    last_start_cell = start_cell;
+    key_modifier    = 0;
+    costs_to_goal.assign(cell_costs.size(), INFINITE_COST);
+    lookahead_costs_to_goal.assign(cell_costs.size(), INFINITE_COST);
+    queue.clear();
+    queued_keys.assign(cell_costs.size(), std::nullopt);
+
+    lookahead_costs_to_goal[goal_cell] = 0;
+    queued_keys[goal_cell]             = calculateKey(goal_cell);
+    queue.emplace(*queued_keys[goal_cell], goal_cell);
+}
+
+void DStarLitePathPlanner::computeShortestPath()
+{
+    // Cells with the same key as the start are expanded too. On an open lattice every
+    // cell on the cheapest path has exactly that key, and leaving them with the costs
+    // of an earlier search makes following the cheapest neighbours take a longer path
+    while (
+        !queue.empty() &&
+        (queue.begin()->first.first <= calculateKey(start_cell).first + KEY_TOLERANCE ||
+         lookahead_costs_to_goal[start_cell] != costs_to_goal[start_cell]))
+    {
+        auto [old_key, cell] = *queue.begin();
+        Key new_key          = calculateKey(cell);
+        num_expansions++;
+
+        if (old_key < new_key)
+        {
+            // The start has moved since the cell was queued, so it is requeued with its
+            // current key instead of being expanded
+            queue.erase(queue.begin());
+            queued_keys[cell] = new_key;
+            queue.emplace(new_key, cell);
+        }
+        else if (costs_to_goal[cell] > lookahead_costs_to_goal[cell])
+        {
+            costs_to_goal[cell] = lookahead_costs_to_goal[cell];
+            queue.erase(queue.begin());
+            queued_keys[cell] = std::nullopt;
+            for (size_t neighbour : getNeighbours(cell))
+            {
+                updateCell(neighbour);
+            }
+        }
+        else
+        {
+            costs_to_goal[cell] = INFINITE_COST;
+            for (size_t neighbour : getNeighbours(cell))
+            {
+                updateCell(neighbour);
+            }
+            updateCell(cell);
+        }
+    }
+}
+
+void DStarLitePathPlanner::updateCell(size_t cell)
+{
+    if (cell != goal_cell)
+    {
+        double lookahead_cost = INFINITE_COST;
+        for (size_t neighbour : getNeighbours(cell))
+        {
+            lookahead_cost = std::min(
+                lookahead_cost, getEdgeCost(cell, neighbour) + costs_to_goal[neighbour]);
+        }
+        lookahead_costs_to_goal[cell] = lookahead_cost;
+    }
+
+    if (queued_keys[cell])
+    {
+        queue.erase(std::make_pair(*queued_keys[cell], cell));
+        queued_keys[cell] = std::nullopt;
+    }
+    if (costs_to_goal[cell] != lookahead_costs_to_goal[cell])
+    {
+        queued_keys[cell] = calculateKey(cell);
+        queue.emplace(*queued_keys[cell], cell);
+    }
+}
+
+DStarLitePathPlanner::Key DStarLitePathPlanner::calculateKey(size_t cell) const
+{
+    double cost = std::min(costs_to_goal[cell], lookahead_costs_to_goal[cell]);
+    // Every move costs at least its length, so the distance to the start is a lower
+    // bound on the cost from the start to the cell
+    double heuristic = (getCellCentre(start_cell) - getCellCentre(cell)).len();
+    return Key(cost + heuristic + key_modifier, cost);
+}
+
+double DStarLitePathPlanner::getEdgeCost(size_t from, size_t to) const
+{
+    if (cell_costs[from] == INFINITE_COST || cell_costs[to] == INFINITE_COST)
+    {
+        return INFINITE_COST;
+    }
+
+    // Diagonal moves may not cut the corner of a blocked cell
+    size_t from_row = from / num_columns, from_column = from % num_columns;
+    size_t to_row = to / num_columns, to_column = to % num_columns;
+    if (from_row != to_row && from_column != to_column &&
+        (cell_costs[from_row * num_columns + to_column] == INFINITE_COST ||
+         cell_costs[to_row * num_columns + from_column] == INFINITE_COST))
+    {
+        return INFINITE_COST;
+    }
+
+    double length = (getCellCentre(to) - getCellCentre(from)).len();
+    return length * (cell_costs[from] + cell_costs[to]) / 2;
+}
+
+std::vector<size_t> DStarLitePathPlanner::getNeighbours(size_t cell) const
+{
+    std::vector<size_t> neighbours;
+    size_t row    = cell / num_columns;
+    size_t column = cell % num_columns;
+    for (size_t neighbour_row = row > 0 ? row - 1 : row;
+         neighbour_row <= std::min(row + 1, num_rows - 1); neighbour_row++)
+    {
+        for (size_t neighbour_column = column > 0 ? column - 1 : column;
+             neighbour_column <= std::min(column + 1, num_columns - 1);
+             neighbour_column++)
+        {
+            size_t neighbour = neighbour_row * num_columns + neighbour_column;
+            if (neighbour != cell)
+            {
+                neighbours.emplace_back(neighbour);
+            }
+        }
+    }
+    return neighbours;
+}
+
+size_t DStarLitePathPlanner::getCell(const Point &point) const
+{
+    auto to_index = [this](double offset, size_t num_cells) {
+        return static_cast<size_t>(
+            std::clamp(std::floor(offset / resolution), 0.0, num_cells - 1.0));
+    };
+    size_t column = to_index(point.x() - navigable_area.swCorner().x(), num_columns);
+    size_t row    = to_index(point.y() - navigable_area.swCorner().y(), num_rows);
+    return row * num_columns + column;
+}
+
+Point DStarLitePathPlanner::getCellCentre(size_t cell) const
+{
+    return navigable_area.swCorner() + Vector((cell % num_columns + 0.5) * resolution,
+                                              (cell / num_columns + 0.5) * resolution);
+}
+
+std::vector<Point> DStarLitePathPlanner::shortenPath(const std::vector<Point> &path) const
+{
+    std::vector<Point> shortened_path = {path.front()};
+    size_t anchor                     = 0;
+    // The most expensive cell on the path between the anchor and the current point
+    double max_path_cell_cost = cell_costs[getCell(path.front())];
+    for (size_t i = 1; i + 1 < path.size(); i++)
+    {
+        double next_max_path_cell_cost =
+            std::max(max_path_cell_cost, cell_costs[getCell(path[i + 1])]);
+        Segment shortcut(path[anchor], path[i + 1]);
+        bool can_skip_point = getMaxCellCost(shortcut) <= next_max_path_cell_cost &&
+                              isCollisionFree(shortcut);
+        if (can_skip_point)
+        {
+            max_path_cell_cost = next_max_path_cell_cost;
+        }
+        else
+        {
+            shortened_path.emplace_back(path[i]);
+            anchor = i;
+            max_path_cell_cost =
+                std::max(cell_costs[getCell(path[i])], cell_costs[getCell(path[i + 1])]);
+        }
+    }
+    shortened_path.emplace_back(path.back());
+    return shortened_path;
+}
+
+double DStarLitePathPlanner::getMaxCellCost(const Segment &segment) const
+{
+    Vector direction = segment.getEnd() - segment.getSegStart();
+    size_t num_samples =
+        static_cast<size_t>(std::ceil(direction.len() / (resolution / 2)));
+    double max_cost = 0;
+    for (size_t i = 0; i <= num_samples; i++)
+    {
+        Point sample =
+            segment.getSegStart() +
+            direction * (num_samples == 0 ? 0.0 : static_cast<double>(i) / num_samples);
+        max_cost = std::max(max_cost, cell_costs[getCell(sample)]);
+    }
+    return max_cost;
+}
+
+bool DStarLitePathPlanner::isCollisionFree(const Segment &segment) const
+{
+    for (const Obstacle *obstacle : search_obstacles)
+    {
+        const Polygon &boundary = obstacle->getBoundary();
+        if (boundary.intersects(segment) || boundary.containsPoint(segment.getEnd()))
+        {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,257 @@
+#pragma once
+
+#include <set>
+#include <utility>
+
+#include "ai/navigator/path_planner/path_planner.h"
+#include "geom/rectangle.h"
+
+/**
+ * DStarLitePathPlanner plans paths across a lattice of points covering the navigable
+ * area, using D* Lite (Koenig and Likhachev, "D* Lite", AAAI 2002).
+ *
+ * D* Lite searches backwards from the destination and keeps its search between calls
+ * to findPath. As long as the destination stays in the same lattice cell, the next
+ * call only re-expands the cells affected by the obstacles and violations that changed
+ * and by the start moving, which is much cheaper than searching from scratch when
+ * the world has only changed a little. A new destination starts a new search.
+ *
+ * Robots move between the centres of neighbouring cells (including diagonals). A cell
+ * is blocked if it is closer than half its diagonal to an obstacle, and moving through
+ * a cell where the violation function is greater than 0 costs extra. The path found
+ * across the lattice is then shortened by skipping points wherever the straight line
+ * is no worse.
+ *
+ * The cost the violation function adds to each cell is only calculated on the first
+ * call to findPath, and after invalidateViolationCosts is called, so the violation
+ * function must otherwise be the same on every call. On later calls only the cells
+ * around the obstacles that were added, moved or removed are updated.
+ */
+class DStarLitePathPlanner : public PathPlanner
+{
+   public:
+    /**
+     * Creates a new DStarLitePathPlanner
+     *
+     * @param navigable_area The area paths can go through
+     * @param resolution The distance between neighbouring lattice points, in metres
+     *
+     * @throws std::invalid_argument if the resolution is not positive
+     */
+    explicit DStarLitePathPlanner(const Rectangle &navigable_area, double resolution);
+
+    /**
+     * Returns the cheapest path from start to dest across the lattice. Obstacles that
+     * already contain the start are ignored, so a robot inside an obstacle can still
+     * leave it.
+     *
+     * @param start start point
+     * @param dest destination point
+     * @param obstacles the obstacles the path must not cross
+     * @param violation_function a function that returns the distance that a point is
+     * violating a boundary by. Paths avoid points where it is greater than 0 when they
+     * can
+     *
+     * @return the cheapest path found from start to dest, starting with start and
+     * ending with dest, or std::nullopt if there is no path across the lattice
+     */
+    std::optional<std::vector<Point>> findPath(
+        const Point &start, const Point &dest, const std::vector<Obstacle> &obstacles,
+        const ViolationFunction &violation_function) override;
+
+    /**
+     * Returns how many cells were expanded by the last call to findPath
+     *
+     * @return how many cells were expanded by the last call to findPath
+     */
+    unsigned int getNumExpansionsOfLastSearch() const;
+
+    /**
+     * Makes the next call to findPath calculate the cost the violation function adds
+     * to every cell again, and start a new search. This must be called whenever the
+     * violation function changes
+     */
+    void invalidateViolationCosts();
+
+   private:
+    // The priority of a cell in the search queue
+    using Key = std::pair<double, double>;
+
+    /**
+     * Updates the cost of moving through the cells affected by the obstacles that
+     * changed and by the start and destination moving, and returns the cells whose
+     * cost changed. The cells of the start and destination are only blocked if an
+     * obstacle contains the point itself
+     *
+     * @param start start point
+     * @param dest destination point
+     * @param obstacles the obstacles the path must not cross
+     * @param violation_function the violation function
+     *
+     * @return the cells whose cost changed since the last call
+     */
+    std::vector<size_t> updateCellCosts(const Point &start, const Point &dest,
+                                        const std::vector<Obstacle> &obstacles,
+                                        const ViolationFunction &violation_function);
+
+    /**
+     * Adds the given change to the number of obstacles blocking every cell the given
+     * boundary blocks, and adds those cells to the given cells
+     *
+     * @param boundary the boundary of the obstacle
+     * @param change how much to change the number of blocking obstacles by
+     * @param cells the cells to add the blocked cells to
+     */
+    void changeBlockedCells(const Polygon &boundary, int change,
+                            std::vector<size_t> &cells);
+
+    /**
+     * Returns true if a robot can travel along the given segment without entering an
+     * obstacle, and false otherwise
+     *
+     * @param segment the segment to check
+     *
+     * @return true if the segment does not enter an obstacle, and false otherwise
+     */
+    bool isCollisionFree(const Segment &segment) const;
+
+    /**
+     * Follows the cheapest neighbour of each cell from the start cell to the
+     * destination cell, using the costs to the goal found by the search
+     *
+     * @param start start point, which replaces the start cell in the path
+     * @param dest destination point, which replaces the destination cell in the path
+     * @param dest_cell the cell of the destination
+     *
+     * @return the path across the lattice from start to dest, or std::nullopt if the
+     * start cannot reach the goal or following the cheapest neighbours does not lead
+     * to it
+     */
+    std::optional<std::vector<Point>> followCheapestCells(const Point &start,
+                                                          const Point &dest,
+                                                          size_t dest_cell) const;
+
+    /**
+     * Starts a new search towards the given cell
+     *
+     * @param goal_cell the cell the search is towards
+     */
+    void initializeSearch(size_t goal_cell);
+
+    /**
+     * Expands cells until the cost from the start cell to the goal is known
+     */
+    void computeShortestPath();
+
+    /**
+     * Recalculates the cost from a cell to the goal from its neighbours, and adds it
+     * to the queue if that cost is inconsistent
+     *
+     * @param cell the cell to update
+     */
+    void updateCell(size_t cell);
+
+    /**
+     * Returns the priority of a cell in the search queue
+     *
+     * @param cell the cell
+     *
+     * @return the priority of the cell
+     */
+    Key calculateKey(size_t cell) const;
+
+    /**
+     * Returns the cost of moving directly between two neighbouring cells
+     *
+     * @param from the cell moved from
+     * @param to the cell moved to
+     *
+     * @return the cost of moving between the cells, or infinity if either is blocked
+     */
+    double getEdgeCost(size_t from, size_t to) const;
+
+    /**
+     * Returns the cells next to the given cell
+     *
+     * @param cell the cell
+     *
+     * @return the cells next to the given cell
+     */
+    std::vector<size_t> getNeighbours(size_t cell) const;
+
+    /**
+     * Returns the cell whose centre is closest to the given point
+     *
+     * @param point the point
+     *
+     * @return the cell closest to the point
+     */
+    size_t getCell(const Point &point) const;
+
+    /**
+     * Returns the centre of a cell
+     *
+     * @param cell the cell
+     *
+     * @return the centre of the cell
+     */
+    Point getCellCentre(size_t cell) const;
+
+    /**
+     * Removes points from a path wherever going straight to a later point does not
+     * enter an obstacle and is no more expensive
+     *
+     * @param path the path to shorten
+     *
+     * @return the shortened path
+     */
+    std::vector<Point> shortenPath(const std::vector<Point> &path) const;
+
+    /**
+     * Returns the most expensive cell the segment passes through, or infinity if it
+     * passes through a blocked cell
+     *
+     * @param segment the segment
+     *
+     * @return the largest cell cost along the segment
+     */
+    double getMaxCellCost(const Segment &segment) const;
+
+    // The cost added for every metre travelled, per metre the violation function is
+    // violated by. This matches the RRTStarPathPlanner
+    static constexpr double VIOLATION_COST_PER_METRE = 10.0;
+
+    Rectangle navigable_area;
+    double resolution;
+    size_t num_columns;
+    size_t num_rows;
+
+    // The cost of moving a metre through each cell, which is infinity if it is blocked
+    std::vector<double> cell_costs;
+    // The cost of moving a metre through each cell if it is not blocked, from the
+    // violation function. This is empty until it is next calculated
+    std::vector<double> violation_costs;
+    // How many obstacles block each cell, and the boundaries of those obstacles
+    std::vector<unsigned int> num_blocking_obstacles;
+    std::vector<Polygon> blocking_boundaries;
+    // The cells whose cost was set from the start and destination rather than their
+    // centres by the last call to findPath
+    std::vector<size_t> endpoint_cells;
+    // The obstacles that were not ignored by the current call to findPath
+    std::vector<const Obstacle *> search_obstacles;
+
+    // The state of the search, which is kept between calls with the same goal
+    std::optional<size_t> goal_cell;
+    size_t start_cell;
+    size_t last_start_cell;
+    // How much the heuristic has shrunk because the start moved since the search began
+    double key_modifier;
+    // The cost of the cheapest path to the goal from each cell, and the one step
+    // lookahead of that cost from the cell's neighbours
+    std::vector<double> costs_to_goal;
+    std::vector<double> lookahead_costs_to_goal;
+    // The cells that are waiting to be expanded, and the key each one is queued with
+    std::set<std::pair<Key, size_t>> queue;
+    std::vector<std::optional<Key>> queued_keys;
+    unsigned int num_expansions;
+};
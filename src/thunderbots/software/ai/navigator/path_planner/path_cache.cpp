@@ -0,0 +1,189 @@
+#include "ai/navigator/path_planner/path_cache.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include "geom/util.h"
+
+double PathCache::Statistics::getHitRate() const
+{
+    return num_lookups > 0 ? static_cast<double>(num_hits) / num_lookups : 0;
+}
+
+PathCache::Statistics &PathCache::Statistics::operator+=(const Statistics &other)
+{
+    num_lookups += other.num_lookups;
+    num_hits += other.num_hits;
+    num_repairs += other.num_repairs;
+    total_repair_duration = total_repair_duration + other.total_repair_duration;
+    return *this;
+}
+
+PathCache::PathCache(const Rectangle &navigable_area, double lattice_resolution)
+    : repair_planner(navigable_area, lattice_resolution)
+{
+}
+
+std::optional<std::vector<Point>> PathCache::findPath(
+    const Point &start, const Point &dest, const std::vector<Obstacle> &obstacles,
+    const PathPlanner::ViolationFunction &violation_function, PathPlanner &path_planner)
+{
+    statistics.num_lookups++;
+
+    if (cached_path && (cached_path->back() - dest).len() <= DESTINATION_TOLERANCE_METERS)
+    {
+        std::vector<Point> path = getRemainingPath(start);
+        path.back()             = dest;
+
+        // Obstacles that contain the start are ignored, like the path planners do.
+        // They are left out here so that the repaired part of the path ignores them
+        // too. Only pointers are kept, so the obstacles are not copied unless the
+        // path has to be repaired
+        path_obstacles.clear();
+        for (const Obstacle &obstacle : obstacles)
+        {
+            if (!obstacle.getBoundary().containsPoint(start))
+            {
+                path_obstacles.emplace_back(&obstacle);
+            }
+        }
+
+        // Boundaries the robot is already violating are treated like obstacles that
+        // contain the start, so the path may leave them but not go further into them
+        double max_violation =
+            violation_function ? std::max(0.0, violation_function(start)) : 0;
+
+        // Repairs never shorten a detour, so once the destination can be reached
+        // directly without any violation the path is planned again rather than
+        // keeping the detour forever. The path planner returns the direct path then,
+        // so this does not happen again on the next call
+        if (path.size() > 2 &&
+            isSegmentValid(Segment(start, dest), path_obstacles, violation_function, 0))
+        {
+            cached_path =
+                path_planner.findPath(start, dest, obstacles, violation_function);
+            return cached_path;
+        }
+
+        std::optional<size_t> first_invalid_segment = findFirstInvalidSegment(
+            path, path_obstacles, violation_function, max_violation);
+        if (!first_invalid_segment)
+        {
+            statistics.num_hits++;
+            cached_path = path;
+            return cached_path;
+        }
+
+        // Keep the path up to the first segment that enters an obstacle, and repair
+        // the rest of it
+        auto repair_start_time = std::chrono::steady_clock::now();
+        std::vector<Obstacle> repair_obstacles;
+        repair_obstacles.reserve(path_obstacles.size());
+        for (const Obstacle *obstacle : path_obstacles)
+        {
+            repair_obstacles.emplace_back(*obstacle);
+        }
+        std::optional<std::vector<Point>> repaired_path = repair_planner.findPath(
+            path[*first_invalid_segment], dest, repair_obstacles, violation_function);
+        statistics.total_repair_duration =
+            statistics.total_repair_duration +
+            Duration::fromSeconds(
+                std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                              repair_start_time)
+                    .count());
+        if (repaired_path)
+        {
+            statistics.num_repairs++;
+            path.erase(path.begin() + *first_invalid_segment + 1, path.end());
+            path.insert(path.end(), repaired_path->begin() + 1, repaired_path->end());
+            cached_path = path;
+            return cached_path;
+        }
+    }
+
+    cached_path = path_planner.findPath(start, dest, obstacles, violation_function);
+    return cached_path;
+}
+
+const PathCache::Statistics &PathCache::getStatistics() const
+{
+    return statistics;
+}
+
+void PathCache::clearStatistics()
+{
+    statistics = Statistics();
+}
+
+std::vector<Point> PathCache::getRemainingPath(const Point &start) const
+{
+    // The robot is taken to be on the segment of the path it is closest to
+    size_t closest_segment  = 0;
+    double closest_distance = std::numeric_limits<double>::infinity();
+    for (size_t i = 0; i + 1 < cached_path->size(); i++)
+    {
+        double distance = dist(start, Segment((*cached_path)[i], (*cached_path)[i + 1]));
+        if (distance < closest_distance)
+        {
+            closest_distance = distance;
+            closest_segment  = i;
+        }
+    }
+
+    std::vector<Point> path = {start};
+    path.insert(path.end(), cached_path->begin() + closest_segment + 1,
+                cached_path->end());
+    return path;
+}
+
+std::optional<size_t> PathCache::findFirstInvalidSegment(
+    const std::vector<Point> &path, const std::vector<const Obstacle *> &obstacles,
+    const PathPlanner::ViolationFunction &violation_function, double max_violation)
+{
+    for (size_t i = 0; i + 1 < path.size(); i++)
+    {
+        if (!isSegmentValid(Segment(path[i], path[i + 1]), obstacles, violation_function,
+                            max_violation))
+        {
+            return i;
+        }
+    }
+    return std::nullopt;
+}
+
+bool PathCache::isSegmentValid(const Segment &segment,
+                               const std::vector<const Obstacle *> &obstacles,
+                               const PathPlanner::ViolationFunction &violation_function,
+                               double max_violation)
+{
+    for (const Obstacle *obstacle : obstacles)
+    {
+        // Every segment starts outside every obstacle, so it is only inside one if it
+        // crosses the boundary or ends inside it
+        const Polygon &boundary = obstacle->getBoundary();
+        if (boundary.intersects(segment) || boundary.containsPoint(segment.getEnd()))
+        {
+            return false;
+        }
+    }
+
+    if (!violation_function)
+    {
+        return true;
+    }
+
+    // Check the violation at the end of evenly spaced pieces of the segment. The start
+    // of the segment was checked as the end of the previous one
+    size_t num_pieces = static_cast<size_t>(
+        std::max(1.0, std::ceil(len(segment) / VIOLATION_CHECK_SPACING_METERS)));
+    Vector piece = segment.toVector() / static_cast<double>(num_pieces);
+    for (size_t i = 1; i <= num_pieces; i++)
+    {
+        if (violation_function(segment.getSegStart() + piece * i) > max_violation)
+        {
+            return false;
+        }
+    }
+    return true;
+}
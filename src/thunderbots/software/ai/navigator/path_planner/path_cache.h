@@ -0,0 +1,158 @@
+#pragma once
+
+#include "ai/navigator/path_planner/d_star_lite_path_planner.h"
+#include "ai/navigator/path_planner/path_planner.h"
+#include "util/time/duration.h"
+
+/**
+ * A PathCache keeps the last path planned for one robot, so that it does not have to
+ * be planned again every tick while the destination stays the same.
+ *
+ * Every call to findPath first checks the cached path from the robot's current
+ * position against the current obstacles and violation function, which only looks at
+ * the segments of the path. If none of them enter an obstacle or violate a boundary
+ * the cached path is used. Otherwise the path is kept up to the first segment that
+ * does, and the rest is repaired with a DStarLitePathPlanner, whose search is kept
+ * between repairs so repeated repairs towards the same destination only redo the part
+ * of the search that changed. The given path planner is only used when there is no
+ * cached path to the destination, the repair fails, or the cached path is a detour
+ * and the destination can now be reached directly.
+ *
+ * Each robot needs its own PathCache, so the cache is keyed by robot by whoever owns
+ * it and by destination here. The repair planner keeps the cost of the violation
+ * function across its lattice between repairs, so a PathCache must be given the same
+ * violation function on every call.
+ */
+class PathCache
+{
+   public:
+    // How often the cache was used, and how long repairs took
+    struct Statistics
+    {
+        // The number of calls to findPath
+        unsigned int num_lookups = 0;
+        // The number of calls that used the cached path unchanged
+        unsigned int num_hits = 0;
+        // The number of calls that repaired the cached path
+        unsigned int num_repairs = 0;
+        // The total time spent repairing paths, including repairs that failed
+        Duration total_repair_duration = Duration::fromSeconds(0);
+
+        /**
+         * Returns the fraction of lookups that used the cached path unchanged
+         *
+         * @return the fraction of lookups that were hits, or 0 if there were none
+         */
+        double getHitRate() const;
+
+        /**
+         * Adds the counts and durations of other statistics to these
+         *
+         * @param other the statistics to add
+         *
+         * @return these statistics
+         */
+        Statistics &operator+=(const Statistics &other);
+    };
+
+    /**
+     * Creates a new PathCache
+     *
+     * @param navigable_area The area paths can go through
+     * @param lattice_resolution The distance between neighbouring points of the
+     * lattice that paths are repaired across, in metres
+     */
+    explicit PathCache(const Rectangle &navigable_area, double lattice_resolution);
+
+    /**
+     * Returns a path from start to dest, from the cache if possible
+     *
+     * @param start start point
+     * @param dest destination point
+     * @param obstacles the obstacles the path must not cross
+     * @param violation_function a function that returns the distance that a point is
+     * violating a boundary by. This must be the same on every call
+     * @param path_planner the path planner to plan with if the cached path can't be
+     * used or repaired
+     *
+     * @return a path from start to dest, starting with start and ending with dest, or
+     * std::nullopt if no path was found
+     */
+    std::optional<std::vector<Point>> findPath(
+        const Point &start, const Point &dest, const std::vector<Obstacle> &obstacles,
+        const PathPlanner::ViolationFunction &violation_function,
+        PathPlanner &path_planner);
+
+    /**
+     * Returns how the cache has been used since the statistics were last cleared
+     *
+     * @return how the cache has been used
+     */
+    const Statistics &getStatistics() const;
+
+    /**
+     * Clears the statistics of the cache, without clearing the cached path
+     */
+    void clearStatistics();
+
+   private:
+    /**
+     * Returns the cached path starting from the given start, skipping the points the
+     * robot has already passed
+     *
+     * @param start start point
+     *
+     * @return the remaining cached path, starting with start
+     */
+    std::vector<Point> getRemainingPath(const Point &start) const;
+
+    /**
+     * Returns the index of the first segment of the path that enters an obstacle or
+     * violates a boundary
+     *
+     * @param path the path
+     * @param obstacles the obstacles, except for those that contain the start of the
+     * path
+     * @param violation_function a function that returns the distance that a point is
+     * violating a boundary by
+     * @param max_violation the largest violation allowed anywhere on the path
+     *
+     * @return the index of the first invalid segment, or std::nullopt if every segment
+     * is valid
+     */
+    static std::optional<size_t> findFirstInvalidSegment(
+        const std::vector<Point> &path, const std::vector<const Obstacle *> &obstacles,
+        const PathPlanner::ViolationFunction &violation_function, double max_violation);
+
+    /**
+     * Returns whether a segment stays out of every obstacle, and violates boundaries by
+     * no more than the given amount
+     *
+     * @param segment the segment, which must start outside every obstacle
+     * @param obstacles the obstacles
+     * @param violation_function a function that returns the distance that a point is
+     * violating a boundary by
+     * @param max_violation the largest violation allowed anywhere on the segment
+     *
+     * @return true if the segment is valid, and false otherwise
+     */
+    static bool isSegmentValid(const Segment &segment,
+                               const std::vector<const Obstacle *> &obstacles,
+                               const PathPlanner::ViolationFunction &violation_function,
+                               double max_violation);
+
+    // Destinations closer than this to the cached destination reuse the cached path,
+    // with its last point moved to the new destination
+    static constexpr double DESTINATION_TOLERANCE_METERS = 0.05;
+    // The distance between the points of a segment that the violation function is
+    // checked at
+    static constexpr double VIOLATION_CHECK_SPACING_METERS = 0.05;
+
+    DStarLitePathPlanner repair_planner;
+    std::optional<std::vector<Point>> cached_path;
+    // The obstacles of the current call to findPath that don't contain the start. It
+    // is a member so its memory is reused between calls, and must not be read outside
+    // of findPath because the obstacles it points to are the caller's
+    std::vector<const Obstacle *> path_obstacles;
+    Statistics statistics;
+};
@@ -0,0 +1,392 @@
+#include "ai/navigator/path_planner/rrt_star_path_planner.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+#include "geom/util.h"
+
+RRTStarPathPlanner::RRTStarPathPlanner(const Rectangle &navigable_area,
+                                       const Duration &time_budget,
+                                       unsigned int max_iterations, long random_seed)
+    : navigable_area(navigable_area),
+      time_budget(time_budget),
+      max_iterations(max_iterations),
+      random_number_generator(random_seed),
+      sampling_area(navigable_area),
+      destination_edge_cost(0),
+      next_reused_sample(0),
+      num_iterations(0)
+{
+}
+
+std::optional<std::vector<Point>> RRTStarPathPlanner::findPath(
+    const Point &start, const Point &dest, const std::vector<Obstacle> &obstacles,
+    const ViolationFunction &violation_function)
+{
+    auto start_time = std::chrono::steady_clock::now();
+
+    // Obstacles that contain the start are left out, otherwise a robot inside one
+    // could never leave it
+    search_obstacles.clear();
+    for (const Obstacle &obstacle : obstacles)
+    {
+        const Polygon &boundary = obstacle.getBoundary();
+        if (boundary.containsPoint(start))
+        {
+            continue;
+        }
+
+        BoundedObstacle bounded_obstacle = {&obstacle, boundary.getPoints().front(),
+                                            boundary.getPoints().front()};
+        for (const Point &point : boundary.getPoints())
+        {
+            bounded_obstacle.min_corner =
+                Point(std::min(bounded_obstacle.min_corner.x(), point.x()),
+                      std::min(bounded_obstacle.min_corner.y(), point.y()));
+            bounded_obstacle.max_corner =
+                Point(std::max(bounded_obstacle.max_corner.x(), point.x()),
+                      std::max(bounded_obstacle.max_corner.y(), point.y()));
+        }
+        search_obstacles.emplace_back(bounded_obstacle);
+    }
+    search_violation_function = violation_function;
+    search_destination        = dest;
+
+    // Make sure the start and destination can be sampled even if they are outside the
+    // navigable area
+    sampling_area =
+        Rectangle(Point(std::min({navigable_area.swCorner().x(), start.x(), dest.x()}),
+                        std::min({navigable_area.swCorner().y(), start.y(), dest.y()})),
+                  Point(std::max({navigable_area.neCorner().x(), start.x(), dest.x()}),
+                        std::max({navigable_area.neCorner().y(), start.y(), dest.y()})));
+
+    // The points from the last search are good samples for this one, as long as the
+    // world has not changed much. The last path goes first so it is found again
+    // quickly, followed by the first points of the last tree, which were spread out
+    // over the whole sampling area before the search focused on the path
+    reused_samples.clear();
+    if (previous_path.size() > 2)
+    {
+        reused_samples.insert(reused_samples.end(), previous_path.begin() + 1,
+                              previous_path.end() - 1);
+    }
+    reused_samples.insert(
+        reused_samples.end(), previous_tree_points.begin(),
+        previous_tree_points.begin() +
+            std::min(previous_tree_points.size(), MAX_REUSED_TREE_POINTS));
+    reused_samples.resize(
+        std::min(reused_samples.size(),
+                 static_cast<size_t>(max_iterations * MAX_REUSED_SAMPLE_FRACTION)));
+    next_reused_sample = 0;
+
+    nodes.clear();
+    nodes.emplace_back(Node{start, 0, 0, {}});
+    destination_parent.reset();
+    num_iterations = 0;
+
+    bool dest_in_obstacle = std::any_of(
+        search_obstacles.begin(), search_obstacles.end(),
+        [&dest](const BoundedObstacle &bounded_obstacle) {
+            return bounded_obstacle.obstacle->getBoundary().containsPoint(dest);
+        });
+    if (!dest_in_obstacle)
+    {
+        tryToReachDestination(0, dest);
+
+        // If the straight line has no violations it is the shortest possible path, so
+        // there is no point searching for anything better
+        bool straight_line_is_optimal =
+            destination_parent &&
+            destination_edge_cost <= (dest - start).len() + Point::EPSILON;
+
+        while (!straight_line_is_optimal && num_iterations < max_iterations &&
+               std::chrono::steady_clock::now() - start_time <
+                   std::chrono::duration<double>(time_budget.getSeconds()))
+        {
+            num_iterations++;
+            std::optional<size_t> new_node = addNode(samplePoint(start, dest));
+            if (new_node)
+            {
+                tryToReachDestination(*new_node, dest);
+            }
+        }
+    }
+
+    previous_tree_points.clear();
+    for (auto node = nodes.begin() + 1; node != nodes.end(); node++)
+    {
+        previous_tree_points.emplace_back(node->point);
+    }
+    previous_path.clear();
+
+    if (!destination_parent)
+    {
+        return std::nullopt;
+    }
+
+    for (size_t i = *destination_parent; i != 0; i = nodes[i].parent)
+    {
+        previous_path.emplace_back(nodes[i].point);
+    }
+    previous_path.emplace_back(start);
+    std::reverse(previous_path.begin(), previous_path.end());
+    previous_path.emplace_back(dest);
+
+    return previous_path;
+}
+
+unsigned int RRTStarPathPlanner::getNumIterationsOfLastSearch() const
+{
+    return num_iterations;
+}
+
+void RRTStarPathPlanner::setTimeBudget(const Duration &time_budget)
+{
+    this->time_budget = time_budget;
+}
+
+Point RRTStarPathPlanner::samplePoint(const Point &start, const Point &dest)
+{
+    if (next_reused_sample < reused_samples.size())
+    {
+        return reused_samples[next_reused_sample++];
+    }
+
+    std::uniform_real_distribution<double> unit_distribution(0, 1);
+    if (unit_distribution(random_number_generator) < DESTINATION_SAMPLE_PROBABILITY)
+    {
+        return dest;
+    }
+
+    // Every path that is cheaper than the best one is also shorter, so it lies inside
+    // the ellipse of points whose distances to the start and destination add up to
+    // less than the best cost
+    double best_cost = getBestPathCost();
+    if (best_cost < std::numeric_limits<double>::infinity())
+    {
+        double straight_line_distance = (dest - start).len();
+        double semi_major_axis        = best_cost / 2;
+        double semi_minor_axis =
+            std::sqrt(std::max(0.0, best_cost * best_cost - straight_line_distance *
+                                                                straight_line_distance)) /
+            2;
+
+        double radius = std::sqrt(unit_distribution(random_number_generator));
+        Angle angle =
+            Angle::ofRadians(2 * M_PI * unit_distribution(random_number_generator));
+        Point point_in_ellipse = Point(semi_major_axis * radius * angle.cos(),
+                                       semi_minor_axis * radius * angle.sin())
+                                     .rotate((dest - start).orientation()) +
+                                 (start + dest) / 2;
+
+        // Points outside the sampling area can't be on a path, so look everywhere
+        // instead
+        if (sampling_area.containsPoint(point_in_ellipse))
+        {
+            return point_in_ellipse;
+        }
+    }
+
+    return Point(sampling_area.swCorner().x() +
+                     sampling_area.width() * unit_distribution(random_number_generator),
+                 sampling_area.swCorner().y() +
+                     sampling_area.height() * unit_distribution(random_number_generator));
+}
+
+std::optional<size_t> RRTStarPathPlanner::addNode(const Point &point)
+{
+    auto nearest_node = std::min_element(
+        nodes.begin(), nodes.end(), [&point](const Node &a, const Node &b) {
+            return (a.point - point).lensq() < (b.point - point).lensq();
+        });
+
+    // Only go part of the way towards points that are far away
+    Vector to_point = point - nearest_node->point;
+    if (to_point.len() < Point::EPSILON)
+    {
+        return std::nullopt;
+    }
+
+    Point new_point = to_point.len() > MAX_EDGE_LENGTH_METERS
+                          ? nearest_node->point + to_point.norm(MAX_EDGE_LENGTH_METERS)
+                          : point;
+    if (!isCollisionFree(Segment(nearest_node->point, new_point)))
+    {
+        return std::nullopt;
+    }
+
+    // The radius that nodes are rewired within shrinks as the tree gets denser. See the
+    // RRT* paper for where this comes from. Once a path has been found, points are only
+    // sampled from the ellipse around it, so the tree gets denser faster
+    double sampled_area = sampling_area.area();
+    double best_cost    = getBestPathCost();
+    if (best_cost < std::numeric_limits<double>::infinity())
+    {
+        double straight_line_distance = (search_destination - nodes[0].point).len();
+        sampled_area                  = std::min(
+            sampled_area, M_PI / 4 * best_cost *
+                              std::sqrt(std::max(0.0, best_cost * best_cost -
+                                                          straight_line_distance *
+                                                              straight_line_distance)));
+    }
+    double rewire_radius =
+        std::min(MAX_EDGE_LENGTH_METERS,
+                 2 * std::sqrt(1.5 * sampled_area / M_PI) *
+                     std::sqrt(std::log(nodes.size() + 1.0) / (nodes.size() + 1.0)));
+
+    std::vector<size_t> nearby_nodes;
+    for (size_t i = 0; i < nodes.size(); i++)
+    {
+        if ((nodes[i].point - new_point).lensq() <= rewire_radius * rewire_radius)
+        {
+            nearby_nodes.emplace_back(i);
+        }
+    }
+
+    // Reach the new node from whichever node makes it cheapest
+    size_t parent           = static_cast<size_t>(nearest_node - nodes.begin());
+    double parent_edge_cost = getEdgeCost(Segment(nodes[parent].point, new_point));
+    for (size_t i : nearby_nodes)
+    {
+        if (i == parent)
+        {
+            continue;
+        }
+        // An edge can't cost less than its length, so most edges can be skipped
+        // without finding their cost
+        Segment edge(nodes[i].point, new_point);
+        if (nodes[i].cost + len(edge) >= nodes[parent].cost + parent_edge_cost)
+        {
+            continue;
+        }
+        double edge_cost = getEdgeCost(edge);
+        if (nodes[i].cost + edge_cost < nodes[parent].cost + parent_edge_cost &&
+            isCollisionFree(edge))
+        {
+            parent           = i;
+            parent_edge_cost = edge_cost;
+        }
+    }
+
+    size_t new_node = nodes.size();
+    nodes.emplace_back(
+        Node{new_point, parent, nodes[parent].cost + parent_edge_cost, {}});
+    nodes[parent].children.emplace_back(new_node);
+
+    // Reach the nearby nodes through the new node if that is cheaper
+    for (size_t i : nearby_nodes)
+    {
+        if (i == parent)
+        {
+            continue;
+        }
+        Segment edge(new_point, nodes[i].point);
+        if (nodes[new_node].cost + len(edge) >= nodes[i].cost)
+        {
+            continue;
+        }
+        double edge_cost = getEdgeCost(edge);
+        if (nodes[new_node].cost + edge_cost < nodes[i].cost && isCollisionFree(edge))
+        {
+            changeParent(i, new_node, edge_cost);
+        }
+    }
+
+    return new_node;
+}
+
+void RRTStarPathPlanner::tryToReachDestination(size_t node_index, const Point &dest)
+{
+    Segment edge(nodes[node_index].point, dest);
+    // The edge can't cost less than its length, so most edges can be skipped without
+    // finding their cost
+    if (nodes[node_index].cost + len(edge) >= getBestPathCost())
+    {
+        return;
+    }
+
+    double edge_cost = getEdgeCost(edge);
+    if (nodes[node_index].cost + edge_cost < getBestPathCost() && isCollisionFree(edge))
+    {
+        destination_parent    = node_index;
+        destination_edge_cost = edge_cost;
+    }
+}
+
+void RRTStarPathPlanner::changeParent(size_t node_index, size_t new_parent_index,
+                                      double new_cost)
+{
+    std::vector<size_t> &old_siblings = nodes[nodes[node_index].parent].children;
+    old_siblings.erase(std::find(old_siblings.begin(), old_siblings.end(), node_index));
+    nodes[new_parent_index].children.emplace_back(node_index);
+    nodes[node_index].parent = new_parent_index;
+
+    double cost_change = nodes[new_parent_index].cost + new_cost - nodes[node_index].cost;
+    std::vector<size_t> nodes_to_update = {node_index};
+    while (!nodes_to_update.empty())
+    {
+        size_t i = nodes_to_update.back();
+        nodes_to_update.pop_back();
+        nodes[i].cost += cost_change;
+        nodes_to_update.insert(nodes_to_update.end(), nodes[i].children.begin(),
+                               nodes[i].children.end());
+    }
+}
+
+double RRTStarPathPlanner::getBestPathCost() const
+{
+    if (!destination_parent)
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+    return nodes[*destination_parent].cost + destination_edge_cost;
+}
+
+bool RRTStarPathPlanner::isCollisionFree(const Segment &segment) const
+{
+    Point start = segment.getSegStart();
+    Point end   = segment.getEnd();
+    for (const BoundedObstacle &bounded_obstacle : search_obstacles)
+    {
+        if (std::max(start.x(), end.x()) < bounded_obstacle.min_corner.x() ||
+            std::min(start.x(), end.x()) > bounded_obstacle.max_corner.x() ||
+            std::max(start.y(), end.y()) < bounded_obstacle.min_corner.y() ||
+            std::min(start.y(), end.y()) > bounded_obstacle.max_corner.y())
+        {
+            continue;
+        }
+
+        // Every segment starts outside every obstacle, so it is only inside one if it
+        // crosses the boundary or ends inside it
+        const Polygon &boundary = bounded_obstacle.obstacle->getBoundary();
+        if (boundary.intersects(segment) || boundary.containsPoint(end))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+double RRTStarPathPlanner::getEdgeCost(const Segment &segment) const
+{
+    double length = len(segment);
+    if (!search_violation_function)
+    {
+        return length;
+    }
+
+    // Check the violation at the middle of evenly spaced pieces of the segment
+    size_t num_pieces = static_cast<size_t>(
+        std::max(1.0, std::ceil(length / VIOLATION_CHECK_SPACING_METERS)));
+    Vector piece           = segment.toVector() / static_cast<double>(num_pieces);
+    double total_violation = 0;
+    for (size_t i = 0; i < num_pieces; i++)
+    {
+        total_violation +=
+            search_violation_function(segment.getSegStart() + piece * (i + 0.5));
+    }
+
+    return length + VIOLATION_COST_PER_METRE * total_violation * piece.len();
+}
@@ -0,0 +1,211 @@
+#pragma once
+
+#include <random>
+
+#include "ai/navigator/path_planner/path_planner.h"
+#include "geom/rectangle.h"
+#include "geom/segment.h"
+#include "util/time/duration.h"
+
+/**
+ * RRTStarPathPlanner is an anytime, sampling-based implementation of the PathPlanner
+ * interface, based on RRT* with informed sampling.
+ *
+ * It grows a tree of collision-free straight line edges from the start by sampling
+ * random points, and keeps rewiring the tree so every point is reached as cheaply as
+ * possible. Once the destination has been reached, it only samples points that could
+ * be on a cheaper path, so the path keeps getting shorter the longer it runs. Each call
+ * to findPath stops when it runs out of time or iterations, and returns the best path
+ * found so far.
+ *
+ * Paths never cross an Obstacle. The cost of a path is its length, plus a penalty for
+ * every metre travelled while the violation function is greater than 0, so paths only
+ * pass through violating areas when there is no other way around.
+ *
+ * The planner remembers the tree and path from the last call to findPath, and uses
+ * them as the first samples of the next call, so while the world changes slowly it
+ * does not have to search from scratch every tick. Because of this, each robot should
+ * have its own RRTStarPathPlanner.
+ *
+ * See https://arxiv.org/abs/1105.1186 for RRT*, and https://arxiv.org/abs/1404.2334 for
+ * informed sampling
+ */
+class RRTStarPathPlanner : public PathPlanner
+{
+   public:
+    /**
+     * Creates a new RRTStarPathPlanner
+     *
+     * @param navigable_area The area paths can go through. Points are only sampled
+     * from this area (and the start and destination)
+     * @param time_budget The longest each call to findPath may spend searching
+     * @param max_iterations The most points each call to findPath may sample
+     * @param random_seed The seed for the planner's random number generator
+     */
+    explicit RRTStarPathPlanner(const Rectangle &navigable_area,
+                                const Duration &time_budget, unsigned int max_iterations,
+                                long random_seed = 0);
+
+    /**
+     * Returns the cheapest path from start to dest found within the time and iteration
+     * budgets. Obstacles that already contain the start are ignored, so a robot inside
+     * an obstacle can still leave it.
+     *
+     * @param start start point
+     * @param dest destination point
+     * @param obstacles the obstacles the path must not cross
+     * @param violation_function a function that returns the distance that a point is
+     * violating a boundary by. Paths avoid points where it is greater than 0 when they
+     * can
+     *
+     * @return the cheapest path found from start to dest, starting with start and
+     * ending with dest, or std::nullopt if no path was found within the budgets
+     */
+    std::optional<std::vector<Point>> findPath(
+        const Point &start, const Point &dest, const std::vector<Obstacle> &obstacles,
+        const ViolationFunction &violation_function) override;
+
+    /**
+     * Returns how many points were sampled by the last call to findPath
+     *
+     * @return how many points were sampled by the last call to findPath
+     */
+    unsigned int getNumIterationsOfLastSearch() const;
+
+    /**
+     * Sets the longest each call to findPath may spend searching
+     *
+     * @param time_budget The longest each call to findPath may spend searching
+     */
+    void setTimeBudget(const Duration &time_budget);
+
+   private:
+    // A point in the tree, and how it is reached from the start
+    struct Node
+    {
+        Point point;
+        // The index of the node this node is reached from. The start is its own parent
+        size_t parent;
+        // The cost of the cheapest known path from the start to this node
+        double cost;
+        std::vector<size_t> children;
+    };
+
+    // An obstacle and the bounding box of its boundary, so most edges can be checked
+    // against it without looking at the boundary at all
+    struct BoundedObstacle
+    {
+        const Obstacle *obstacle;
+        Point min_corner;
+        Point max_corner;
+    };
+
+    /**
+     * Returns a random point to grow the tree towards. Points left over from the last
+     * search are used first, then points near the path that could make it cheaper if
+     * one has been found, and then points from anywhere in the sampling area
+     *
+     * @param start start point
+     * @param dest destination point
+     *
+     * @return the point to grow the tree towards
+     */
+    Point samplePoint(const Point &start, const Point &dest);
+
+    /**
+     * Adds a point to the tree, reached from whichever nearby node makes it cheapest,
+     * and then reaches any nearby nodes through the new point if that is cheaper
+     *
+     * @param point the point to add to the tree
+     *
+     * @return the index of the new node, or std::nullopt if the point could not be
+     * reached from the tree
+     */
+    std::optional<size_t> addNode(const Point &point);
+
+    /**
+     * Reaches the destination from the given node if it is cheaper than the best
+     * path so far
+     *
+     * @param node_index the node to try reaching the destination from
+     * @param dest destination point
+     */
+    void tryToReachDestination(size_t node_index, const Point &dest);
+
+    /**
+     * Changes the node a node is reached from, and updates the cost of every node
+     * reached through it
+     *
+     * @param node_index the node to change the parent of
+     * @param new_parent_index the node it is now reached from
+     * @param new_cost the cost of reaching the node from its new parent
+     */
+    void changeParent(size_t node_index, size_t new_parent_index, double new_cost);
+
+    /**
+     * Returns the cost of the best path found to the destination
+     *
+     * @return the cost of the best path found to the destination, or infinity if no
+     * path has been found
+     */
+    double getBestPathCost() const;
+
+    /**
+     * Returns true if a robot can travel along the given segment without entering an
+     * obstacle, and false otherwise
+     *
+     * @param segment the segment to check
+     *
+     * @return true if the segment does not enter an obstacle, and false otherwise
+     */
+    bool isCollisionFree(const Segment &segment) const;
+
+    /**
+     * Returns the cost of travelling along the given segment: its length, plus a
+     * penalty for how far along it the violation function is greater than 0
+     *
+     * @param segment the segment to find the cost of
+     *
+     * @return the cost of travelling along the segment
+     */
+    double getEdgeCost(const Segment &segment) const;
+
+    // The furthest a new node can be from the node it is reached from, in metres
+    static constexpr double MAX_EDGE_LENGTH_METERS = 1.0;
+    // How often the destination itself is sampled, which pulls the tree towards it
+    static constexpr double DESTINATION_SAMPLE_PROBABILITY = 0.1;
+    // The cost added for every metre travelled, per metre the violation function is
+    // violated by
+    static constexpr double VIOLATION_COST_PER_METRE = 10.0;
+    // How far apart the points the violation function is checked at along an edge are
+    static constexpr double VIOLATION_CHECK_SPACING_METERS = 0.05;
+    // The largest fraction of the iterations that can be spent on points left over
+    // from the last search, so there are always some new points
+    static constexpr double MAX_REUSED_SAMPLE_FRACTION = 0.5;
+    // The most points from the last tree that are reused. Later points are mostly
+    // close to the last path, so they are not worth the time
+    static constexpr size_t MAX_REUSED_TREE_POINTS = 100;
+
+    Rectangle navigable_area;
+    Duration time_budget;
+    unsigned int max_iterations;
+    std::mt19937 random_number_generator;
+
+    // The state of the current search
+    std::vector<Node> nodes;
+    std::vector<BoundedObstacle> search_obstacles;
+    ViolationFunction search_violation_function;
+    Point search_destination;
+    Rectangle sampling_area;
+    // The node the destination is reached from, and the cost of that last edge
+    std::optional<size_t> destination_parent;
+    double destination_edge_cost;
+    // Points kept from the last search, which are sampled before any random points
+    std::vector<Point> reused_samples;
+    size_t next_reused_sample;
+    unsigned int num_iterations;
+
+    // The path and tree points found by the last search
+    std::vector<Point> previous_path;
+    std::vector<Point> previous_tree_points;
+};
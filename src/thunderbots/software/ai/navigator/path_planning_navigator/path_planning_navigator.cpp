@@ -0,0 +1,273 @@
+#include "ai/navigator/path_planning_navigator/path_planning_navigator.h"
+
+#include <algorithm>
+
+#include "ai/navigator/util.h"
+#include "geom/util.h"
+#include "shared/constants.h"
+#include "util/constants.h"
+#include "util/logger/init.h"
+
+PathPlanningNavigator::PathPlanningNavigator(const Duration &planning_budget,
+                                             size_t num_worker_threads,
+                                             std::shared_ptr<TickBudget> tick_budget)
+    : planning_budget(planning_budget),
+      thread_pool(num_worker_threads),
+      tick_budget(tick_budget),
+      time_path_cache_statistics_last_logged(std::chrono::steady_clock::now())
+{
+}
+
+const std::vector<PrimitiveVariant> &PathPlanningNavigator::getAssignedPrimitives(
+    const World &world, const std::vector<IntentVariant> &assignedIntents)
+{
+    // Start from the Primitives the PlaceholderNavigator would send, and replace the
+    // ones for robots that are moving
+    assigned_primitives =
+        placeholder_navigator.getAssignedPrimitives(world, assignedIntents);
+
+    if (!planning_field || !(*planning_field == world.field()))
+    {
+        path_planners.clear();
+        path_caches.clear();
+        planning_field              = world.field();
+        field_clearance_grid        = createFieldClearanceGrid(world.field(), false);
+        goalie_field_clearance_grid = createFieldClearanceGrid(world.field(), true);
+    }
+
+    robot_moves.clear();
+    for (size_t i = 0; i < assignedIntents.size(); i++)
+    {
+        const MoveIntent *move_intent = std::get_if<MoveIntent>(&assignedIntents[i]);
+        if (!move_intent)
+        {
+            continue;
+        }
+        std::optional<Robot> robot =
+            world.friendlyTeam().getRobotById(move_intent->getRobotId());
+        if (!robot)
+        {
+            continue;
+        }
+        robot_moves.emplace_back(
+            RobotMove{i, move_intent, robot->position(), std::nullopt, Point(), 0});
+    }
+
+    if (robot_moves.empty())
+    {
+        return assigned_primitives;
+    }
+
+    createObstacles(world);
+    std::optional<unsigned int> goalie_id = world.friendlyTeam().getGoalieID();
+    // A PathCache must always be given the same violation function, so the caches of
+    // the robots that became or stopped being the goalie are recreated
+    if (goalie_id != path_caches_goalie_id)
+    {
+        for (const std::optional<unsigned int> &robot_id :
+             {goalie_id, path_caches_goalie_id})
+        {
+            if (robot_id)
+            {
+                path_caches.erase(*robot_id);
+            }
+        }
+        path_caches_goalie_id = goalie_id;
+    }
+    PathPlanner::ViolationFunction field_violation_function = [this](const Point &point) {
+        return std::max(0.0, -field_clearance_grid->getClearance(point));
+    };
+    PathPlanner::ViolationFunction goalie_field_violation_function =
+        [this](const Point &point) {
+            return std::max(0.0, -goalie_field_clearance_grid->getClearance(point));
+        };
+
+    // Every thread plans one path at a time, so each path gets the budget divided by
+    // the number of paths each thread plans
+    size_t num_threads          = thread_pool.getNumWorkerThreads() + 1;
+    size_t num_paths_per_thread = (robot_moves.size() + num_threads - 1) / num_threads;
+    Duration path_planning_budget =
+        Duration::fromSeconds(planning_budget.getSeconds() / num_paths_per_thread);
+
+    // The planners and caches are found or created before planning, so the maps are
+    // not changed while the paths are planned in parallel
+    std::vector<RRTStarPathPlanner *> robot_path_planners;
+    std::vector<PathCache *> robot_path_caches;
+    for (const RobotMove &robot_move : robot_moves)
+    {
+        unsigned int robot_id    = robot_move.move_intent->getRobotId();
+        Rectangle navigable_area = world.field().fieldLines();
+        navigable_area.expand(world.field().boundaryWidth());
+
+        std::unique_ptr<RRTStarPathPlanner> &path_planner = path_planners[robot_id];
+        if (!path_planner)
+        {
+            path_planner = std::make_unique<RRTStarPathPlanner>(
+                navigable_area, path_planning_budget, MAX_PLANNING_ITERATIONS, robot_id);
+        }
+        path_planner->setTimeBudget(path_planning_budget);
+        robot_path_planners.emplace_back(path_planner.get());
+
+        std::unique_ptr<PathCache> &path_cache = path_caches[robot_id];
+        if (!path_cache)
+        {
+            path_cache = std::make_unique<PathCache>(navigable_area,
+                                                     PATH_CACHE_LATTICE_RESOLUTION);
+        }
+        robot_path_caches.emplace_back(path_cache.get());
+    }
+
+    thread_pool.parallelFor(robot_moves.size(), [&](size_t i) {
+        RobotMove &robot_move = robot_moves[i];
+        bool is_goalie        = goalie_id == robot_move.move_intent->getRobotId();
+        robot_move.path       = robot_path_caches[i]->findPath(
+            robot_move.start, robot_move.move_intent->getDestination(), obstacles,
+            is_goalie ? goalie_field_violation_function : field_violation_function,
+            *robot_path_planners[i]);
+    });
+
+    recordPathCacheStatistics();
+    chooseNextDestinations();
+    resolveConflicts();
+
+    for (const RobotMove &robot_move : robot_moves)
+    {
+        assigned_primitives[robot_move.intent_index] = MovePrimitive(
+            robot_move.move_intent->getRobotId(), robot_move.next_destination,
+            robot_move.move_intent->getFinalAngle(), robot_move.next_final_speed);
+    }
+
+    return assigned_primitives;
+}
+
+void PathPlanningNavigator::createObstacles(const World &world)
+{
+    obstacles.clear();
+    // Iterating over pointers avoids copying the Teams into an initializer_list
+    for (const Team *team : {&world.friendlyTeam(), &world.enemyTeam()})
+    {
+        for (const Robot &robot : team->getAllRobots())
+        {
+            // A robot's own obstacle contains its position, so the path planner ignores
+            // it when planning that robot's path
+            obstacles.emplace_back(Obstacle::createRobotObstacle(
+                robot, ROBOT_OBSTACLE_RADIUS_SCALING, ROBOT_OBSTACLE_VELOCITY_SECONDS));
+        }
+    }
+}
+
+ClearanceGrid PathPlanningNavigator::createFieldClearanceGrid(
+    const Field &field, bool can_enter_friendly_defense_area)
+{
+    ClearanceGrid clearance_grid(field.fieldLines(), FIELD_CLEARANCE_GRID_RESOLUTION);
+    clearance_grid.addRectangle(field.enemyDefenseArea());
+    if (!can_enter_friendly_defense_area)
+    {
+        clearance_grid.addRectangle(field.friendlyDefenseArea());
+    }
+    clearance_grid.build(thread_pool);
+    return clearance_grid;
+}
+
+void PathPlanningNavigator::recordPathCacheStatistics()
+{
+    PathCache::Statistics tick_statistics;
+    for (const auto &[robot_id, path_cache] : path_caches)
+    {
+        tick_statistics += path_cache->getStatistics();
+        path_cache->clearStatistics();
+    }
+    path_cache_statistics += tick_statistics;
+    tick_budget->recordStage("navigator/path_repair",
+                             tick_statistics.total_repair_duration);
+
+    auto now = std::chrono::steady_clock::now();
+    if (now - time_path_cache_statistics_last_logged <
+        std::chrono::seconds(Util::Constants::LATENCY_REPORT_PERIOD_SECONDS))
+    {
+        return;
+    }
+    LOG(INFO) << "Used cached paths for " << path_cache_statistics.getHitRate() * 100
+              << "% of " << path_cache_statistics.num_lookups << " paths, and repaired "
+              << path_cache_statistics.num_repairs << " cached paths in "
+              << path_cache_statistics.total_repair_duration.getMilliseconds() << "ms"
+              << std::endl;
+    path_cache_statistics                  = PathCache::Statistics();
+    time_path_cache_statistics_last_logged = now;
+}
+
+void PathPlanningNavigator::chooseNextDestinations()
+{
+    for (RobotMove &robot_move : robot_moves)
+    {
+        if (!robot_move.path)
+        {
+            robot_move.next_destination = robot_move.start;
+            robot_move.next_final_speed = 0;
+        }
+        else if (robot_move.path->size() == 2)
+        {
+            robot_move.next_destination = robot_move.path->at(1);
+            robot_move.next_final_speed = robot_move.move_intent->getFinalSpeed();
+        }
+        else
+        {
+            // Slow down for the turn onto the next part of the path
+            const std::vector<Point> &path = *robot_move.path;
+            robot_move.next_destination    = path[1];
+            robot_move.next_final_speed    = calculateTransitionSpeedBetweenSegments(
+                path[0], path[1], path[2], ROBOT_MAX_SPEED_METERS_PER_SECOND);
+        }
+    }
+}
+
+void PathPlanningNavigator::resolveConflicts()
+{
+    // Higher priority Intents move first. The robot id breaks ties so the order is the
+    // same every tick
+    std::vector<RobotMove *> moves_by_priority;
+    for (RobotMove &robot_move : robot_moves)
+    {
+        moves_by_priority.emplace_back(&robot_move);
+    }
+    std::sort(moves_by_priority.begin(), moves_by_priority.end(),
+              [](const RobotMove *a, const RobotMove *b) {
+                  if (a->move_intent->getPriority() != b->move_intent->getPriority())
+                  {
+                      return a->move_intent->getPriority() >
+                             b->move_intent->getPriority();
+                  }
+                  return a->move_intent->getRobotId() < b->move_intent->getRobotId();
+              });
+
+    for (size_t i = 1; i < moves_by_priority.size(); i++)
+    {
+        RobotMove &robot_move = *moves_by_priority[i];
+        Vector move           = robot_move.next_destination - robot_move.start;
+
+        // Find the furthest the robot can go along its move without coming too close
+        // to the moves of the robots before it
+        for (int step = NUM_CONFLICT_STEPS; step >= 0; step--)
+        {
+            Segment shortened_move(robot_move.start,
+                                   robot_move.start + move * step / NUM_CONFLICT_STEPS);
+            bool conflicts = std::any_of(
+                moves_by_priority.begin(), moves_by_priority.begin() + i,
+                [&shortened_move](const RobotMove *higher_priority_move) {
+                    return dist(shortened_move,
+                                Segment(higher_priority_move->start,
+                                        higher_priority_move->next_destination)) <
+                           MIN_MOVE_CLEARANCE_METERS;
+                });
+            if (!conflicts || step == 0)
+            {
+                if (step != NUM_CONFLICT_STEPS)
+                {
+                    robot_move.next_destination = shortened_move.getEnd();
+                    robot_move.next_final_speed = 0;
+                }
+                break;
+            }
+        }
+    }
+}
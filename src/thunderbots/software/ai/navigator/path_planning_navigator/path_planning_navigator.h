@@ -0,0 +1,153 @@
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <memory>
+
+#include "ai/intent/intent_variant.h"
+#include "ai/navigator/navigator.h"
+#include "ai/navigator/obstacle/clearance_grid.h"
+#include "ai/navigator/obstacle/obstacle.h"
+#include "ai/navigator/path_planner/path_cache.h"
+#include "ai/navigator/path_planner/rrt_star_path_planner.h"
+#include "ai/navigator/placeholder_navigator/placeholder_navigator.h"
+#include "ai/primitive/primitive_variant.h"
+#include "ai/tick_scheduler/tick_budget.h"
+#include "util/thread_pool.h"
+#include "util/time/duration.h"
+
+/**
+ * The PathPlanningNavigator plans a path around the other robots for every friendly
+ * robot with a MoveIntent, and sends each robot to the next point on its path.
+ *
+ * All the robots are planned together once per tick:
+ * - The obstacles around every robot on both teams are built once and shared by
+ *   every robot. The clearance grids that keep robots inside the field and out of the
+ *   defense areas are only rebuilt when the field changes
+ * - The paths are planned in parallel on a thread pool, with a time budget that keeps
+ *   the whole navigator inside a fixed budget per tick. Each robot's path is cached
+ *   while its destination stays the same, and only replanned when the cached path
+ *   enters an obstacle and can't be repaired
+ * - Robots whose next moves would hit each other are resolved by priority: the robot
+ *   with the higher priority Intent keeps its move, and the other robot stops short
+ *   of it
+ *
+ * Intents that do not need a path are converted to Primitives the same way the
+ * PlaceholderNavigator converts them.
+ */
+class PathPlanningNavigator : public Navigator
+{
+   public:
+    /**
+     * Creates a new PathPlanningNavigator
+     *
+     * @param planning_budget How long planning every robot's path may take per tick
+     * @param num_worker_threads The number of threads to plan paths on, in addition to
+     * the thread that calls getAssignedPrimitives
+     * @param tick_budget The TickBudget to record how long repairing cached paths took
+     * in
+     */
+    explicit PathPlanningNavigator(
+        const Duration &planning_budget, size_t num_worker_threads,
+        std::shared_ptr<TickBudget> tick_budget = TickBudget::getInstance());
+
+    const std::vector<PrimitiveVariant> &getAssignedPrimitives(
+        const World &world, const std::vector<IntentVariant> &assignedIntents) override;
+
+   private:
+    // A robot that is moving, and where it moves this tick
+    struct RobotMove
+    {
+        // The index of the robot's Intent in the Intents being navigated
+        size_t intent_index;
+        const MoveIntent *move_intent;
+        Point start;
+        std::optional<std::vector<Point>> path;
+        // The point the robot moves to this tick, and its speed when it gets there
+        Point next_destination;
+        double next_final_speed;
+    };
+
+    /**
+     * Creates the obstacles around every robot on both teams
+     *
+     * @param world The world to create the obstacles for
+     */
+    void createObstacles(const World &world);
+
+    /**
+     * Creates a clearance grid whose obstacles are everything outside the field lines
+     * and the defense areas that a robot may not enter
+     *
+     * @param field The field
+     * @param can_enter_friendly_defense_area Whether the robot may enter the friendly
+     * defense area, which only the goalie may
+     *
+     * @return a clearance grid for the field
+     */
+    ClearanceGrid createFieldClearanceGrid(const Field &field,
+                                           bool can_enter_friendly_defense_area);
+
+    /**
+     * Collects the statistics of every path cache, records how long repairing paths
+     * took in the TickBudget, and logs the statistics periodically
+     */
+    void recordPathCacheStatistics();
+
+    /**
+     * Sets where each robot moves to this tick from its path. Robots without a path
+     * stop where they are
+     */
+    void chooseNextDestinations();
+
+    /**
+     * Stops robots short of where they would hit a robot moving for a higher priority
+     * Intent
+     */
+    void resolveConflicts();
+
+    // Obstacles are made bigger than the robots by this factor, so paths keep some
+    // distance from them
+    static constexpr double ROBOT_OBSTACLE_RADIUS_SCALING = 2.0;
+    // How many seconds of each robot's velocity its obstacle covers
+    static constexpr double ROBOT_OBSTACLE_VELOCITY_SECONDS = 0.3;
+    // The side length of the cells of the field clearance grids, in metres
+    static constexpr double FIELD_CLEARANCE_GRID_RESOLUTION = 0.02;
+    // The distance between the points of the lattice that cached paths are repaired
+    // across, in metres
+    static constexpr double PATH_CACHE_LATTICE_RESOLUTION = 0.1;
+    // The most points each path planner may sample per tick
+    static constexpr unsigned int MAX_PLANNING_ITERATIONS = 2000;
+    // The closest two robots' next moves may come to each other, in metres
+    static constexpr double MIN_MOVE_CLEARANCE_METERS = 0.2;
+    // How many points along a move are tried when stopping a robot short of another
+    static constexpr int NUM_CONFLICT_STEPS = 10;
+
+    Duration planning_budget;
+    Util::ThreadPool thread_pool;
+    std::shared_ptr<TickBudget> tick_budget;
+    PlaceholderNavigator placeholder_navigator;
+
+    // Each robot keeps its own path planner, so it can warm start from its last path.
+    // The planners and the field clearance grids are recreated if the field changes
+    std::map<unsigned int, std::unique_ptr<RRTStarPathPlanner>> path_planners;
+    std::map<unsigned int, std::unique_ptr<PathCache>> path_caches;
+    // The goalie when the path caches were last used, since the goalie's path cache is
+    // given a different violation function
+    std::optional<unsigned int> path_caches_goalie_id;
+    std::optional<Field> planning_field;
+    // How far points are from leaving the field or entering a defense area, for the
+    // goalie and for every other robot. The path planners' violation functions look
+    // points up in these grids
+    std::optional<ClearanceGrid> field_clearance_grid;
+    std::optional<ClearanceGrid> goalie_field_clearance_grid;
+
+    // The statistics of every robot's path cache since they were last logged
+    PathCache::Statistics path_cache_statistics;
+    std::chrono::steady_clock::time_point time_path_cache_statistics_last_logged;
+
+    // The state of the current tick, which is kept to reuse its memory
+    std::vector<Obstacle> obstacles;
+    std::vector<RobotMove> robot_moves;
+    std::vector<PrimitiveVariant> assigned_primitives;
+};
@@ -1,15 +1,16 @@
 #include "ai/navigator/placeholder_navigator/placeholder_navigator.h"
 
-std::vector<std::unique_ptr<Primitive>> PlaceholderNavigator::getAssignedPrimitives(
-    const World &world, const std::vector<std::unique_ptr<Intent>> &assignedIntents)
+const std::vector<PrimitiveVariant> &PlaceholderNavigator::getAssignedPrimitives(
+    const World &world, const std::vector<IntentVariant> &assignedIntents)
 {
     this->world = world;
 
-    auto assigned_primitives = std::vector<std::unique_ptr<Primitive>>();
+    // Clearing the Primitives keeps their memory, so it is reused every tick
+    assigned_primitives.clear();
     for (const auto &intent : assignedIntents)
     {
-        intent->accept(*this);
-        assigned_primitives.emplace_back(std::move(current_primitive));
+        std::visit([this](const auto &concrete_intent) { visit(concrete_intent); },
+                   intent);
     }
 
     return assigned_primitives;
@@ -17,60 +18,54 @@ std::vector<std::unique_ptr<Primitive>> PlaceholderNavigator::getAssignedPrimiti
 
 void PlaceholderNavigator::visit(const CatchIntent &catch_intent)
 {
-    auto p            = std::make_unique<CatchPrimitive>(catch_intent);
-    current_primitive = std::move(p);
+    assigned_primitives.emplace_back(std::in_place_type<CatchPrimitive>, catch_intent);
 }
 
 void PlaceholderNavigator::visit(const ChipIntent &chip_intent)
 {
-    auto p            = std::make_unique<ChipPrimitive>(chip_intent);
-    current_primitive = std::move(p);
+    assigned_primitives.emplace_back(std::in_place_type<ChipPrimitive>, chip_intent);
 }
 
 void PlaceholderNavigator::visit(const DirectVelocityIntent &direct_velocity_intent)
 {
-    auto p            = std::make_unique<DirectVelocityPrimitive>(direct_velocity_intent);
-    current_primitive = std::move(p);
+    assigned_primitives.emplace_back(std::in_place_type<DirectVelocityPrimitive>,
+                                     direct_velocity_intent);
 }
 
 void PlaceholderNavigator::visit(const DirectWheelsIntent &direct_wheels_intent)
 {
-    auto p            = std::make_unique<DirectWheelsPrimitive>(direct_wheels_intent);
-    current_primitive = std::move(p);
+    assigned_primitives.emplace_back(std::in_place_type<DirectWheelsPrimitive>,
+                                     direct_wheels_intent);
 }
 
 void PlaceholderNavigator::visit(const DribbleIntent &dribble_intent)
 {
-    auto p            = std::make_unique<DribblePrimitive>(dribble_intent);
-    current_primitive = std::move(p);
+    assigned_primitives.emplace_back(std::in_place_type<DribblePrimitive>,
+                                     dribble_intent);
 }
 
 void PlaceholderNavigator::visit(const KickIntent &kick_intent)
 {
-    auto p            = std::make_unique<KickPrimitive>(kick_intent);
-    current_primitive = std::move(p);
+    assigned_primitives.emplace_back(std::in_place_type<KickPrimitive>, kick_intent);
 }
 
 void PlaceholderNavigator::visit(const MoveIntent &move_intent)
 {
-    auto p            = std::make_unique<MovePrimitive>(move_intent);
-    current_primitive = std::move(p);
+    assigned_primitives.emplace_back(std::in_place_type<MovePrimitive>, move_intent);
 }
 
 void PlaceholderNavigator::visit(const MoveSpinIntent &move_spin_intent)
 {
-    auto p            = std::make_unique<MoveSpinPrimitive>(move_spin_intent);
-    current_primitive = std::move(p);
+    assigned_primitives.emplace_back(std::in_place_type<MoveSpinPrimitive>,
+                                     move_spin_intent);
 }
 
 void PlaceholderNavigator::visit(const PivotIntent &pivot_intent)
 {
-    auto p            = std::make_unique<PivotPrimitive>(pivot_intent);
-    current_primitive = std::move(p);
+    assigned_primitives.emplace_back(std::in_place_type<PivotPrimitive>, pivot_intent);
 }
 
 void PlaceholderNavigator::visit(const StopIntent &stop_intent)
 {
-    auto p            = std::make_unique<StopPrimitive>(stop_intent);
-    current_primitive = std::move(p);
+    assigned_primitives.emplace_back(std::in_place_type<StopPrimitive>, stop_intent);
 }
@@ -1,9 +1,9 @@
 #pragma once
 
-#include "ai/intent/intent.h"
+#include "ai/intent/intent_variant.h"
 #include "ai/intent/visitor/intent_visitor.h"
 #include "ai/navigator/navigator.h"
-#include "ai/primitive/primitive.h"
+#include "ai/primitive/primitive_variant.h"
 
 /**
  * This PlaceholderNavigator is a simple navigator that will convert the given Intents
@@ -16,9 +16,8 @@ class PlaceholderNavigator : public Navigator, public IntentVisitor
    public:
     explicit PlaceholderNavigator() = default;
 
-    std::vector<std::unique_ptr<Primitive>> getAssignedPrimitives(
-        const World &world,
-        const std::vector<std::unique_ptr<Intent>> &assignedIntents) override;
+    const std::vector<PrimitiveVariant> &getAssignedPrimitives(
+        const World &world, const std::vector<IntentVariant> &assignedIntents) override;
 
     /**
      * Visits a CatchIntent to perform an operation.
@@ -93,7 +92,7 @@ class PlaceholderNavigator : public Navigator, public IntentVisitor
    private:
     // This navigators knowledge / state of the world
     World world;
-    // The current Primitive the navigator has created from an Intent.
-    // This variable is set by each `visit` function
-    std::unique_ptr<Primitive> current_primitive;
+    // The Primitives the navigator has created from the Intents. Each `visit` function
+    // adds the Primitive for the Intent it visits
+    std::vector<PrimitiveVariant> assigned_primitives;
 };
@@ -206,8 +206,10 @@ double AI::Passing::calculateInterceptRisk(Robot enemy_robot, const Pass& pass)
 double AI::Passing::ratePassFriendlyCapability(const Team& friendly_team,
                                                const Pass& pass)
 {
+    std::vector<Robot> friendly_robots = friendly_team.getAllRobots();
+
     // We need at least one robot to pass to
-    if (friendly_team.getAllRobots().empty())
+    if (friendly_robots.empty())
     {
         return 0;
     }
@@ -218,18 +220,21 @@ double AI::Passing::ratePassFriendlyCapability(const Team& friendly_team,
         return 0;
     }
 
-    // Get the robot that is closest to where the pass would be received
-    Robot best_receiver = friendly_team.getAllRobots()[0];
-    for (Robot& robot : friendly_team.getAllRobots())
+    // Get the robot that is closest to where the pass would be received. Comparing
+    // squared distances gives the same robot without taking any square roots
+    const Robot* best_receiver_ptr = &friendly_robots[0];
+    double best_distance_squared =
+        (friendly_robots[0].position() - pass.receiverPoint()).lensq();
+    for (const Robot& robot : friendly_robots)
     {
-        double distance = (robot.position() - pass.receiverPoint()).len();
-        double curr_best_distance =
-            (best_receiver.position() - pass.receiverPoint()).len();
-        if (distance < curr_best_distance)
+        double distance_squared = (robot.position() - pass.receiverPoint()).lensq();
+        if (distance_squared < best_distance_squared)
         {
-            best_receiver = robot;
+            best_receiver_ptr     = &robot;
+            best_distance_squared = distance_squared;
         }
     }
+    const Robot& best_receiver = *best_receiver_ptr;
 
     // Figure out what time the robot would have to receive the ball at
     Duration ball_travel_time = Duration::fromSeconds(
@@ -5,6 +5,7 @@
 #include "ai/primitive/primitive_factory.h"
 
 #include <exception>
+#include <type_traits>
 
 #include "ai/primitive/catch_primitive.h"
 #include "ai/primitive/chip_primitive.h"
@@ -17,57 +18,62 @@
 #include "ai/primitive/pivot_primitive.h"
 #include "ai/primitive/stop_primitive.h"
 
-
 std::unique_ptr<::Primitive> AI::Primitive::createPrimitiveFromROSMessage(
     const thunderbots_msgs::Primitive& primitive_msg)
 {
-    std::unique_ptr<::Primitive> prim_ptr;
+    return std::visit(
+        [](auto&& primitive) -> std::unique_ptr<::Primitive> {
+            return std::make_unique<std::decay_t<decltype(primitive)>>(primitive);
+        },
+        createPrimitiveVariantFromROSMessage(primitive_msg));
+}
 
+PrimitiveVariant AI::Primitive::createPrimitiveVariantFromROSMessage(
+    const thunderbots_msgs::Primitive& primitive_msg)
+{
     if (primitive_msg.primitive_name == MovePrimitive::PRIMITIVE_NAME)
     {
-        prim_ptr = std::make_unique<MovePrimitive>(primitive_msg);
+        return MovePrimitive(primitive_msg);
     }
     else if (primitive_msg.primitive_name == MoveSpinPrimitive::PRIMITIVE_NAME)
     {
-        prim_ptr = std::make_unique<MoveSpinPrimitive>(primitive_msg);
+        return MoveSpinPrimitive(primitive_msg);
     }
     else if (primitive_msg.primitive_name == DirectWheelsPrimitive::PRIMITIVE_NAME)
     {
-        prim_ptr = std::make_unique<DirectWheelsPrimitive>(primitive_msg);
+        return DirectWheelsPrimitive(primitive_msg);
     }
     else if (primitive_msg.primitive_name == CatchPrimitive::PRIMITIVE_NAME)
     {
-        prim_ptr = std::make_unique<CatchPrimitive>(primitive_msg);
+        return CatchPrimitive(primitive_msg);
     }
     else if (primitive_msg.primitive_name == ChipPrimitive::PRIMITIVE_NAME)
     {
-        prim_ptr = std::make_unique<ChipPrimitive>(primitive_msg);
+        return ChipPrimitive(primitive_msg);
     }
     else if (primitive_msg.primitive_name == DirectVelocityPrimitive::PRIMITIVE_NAME)
     {
-        prim_ptr = std::make_unique<DirectVelocityPrimitive>(primitive_msg);
+        return DirectVelocityPrimitive(primitive_msg);
     }
     else if (primitive_msg.primitive_name == KickPrimitive::PRIMITIVE_NAME)
     {
-        prim_ptr = std::make_unique<KickPrimitive>(primitive_msg);
+        return KickPrimitive(primitive_msg);
     }
     else if (primitive_msg.primitive_name == DribblePrimitive::PRIMITIVE_NAME)
     {
-        prim_ptr = std::make_unique<DribblePrimitive>(primitive_msg);
+        return DribblePrimitive(primitive_msg);
     }
     else if (primitive_msg.primitive_name == PivotPrimitive::PRIMITIVE_NAME)
     {
-        prim_ptr = std::make_unique<PivotPrimitive>(primitive_msg);
+        return PivotPrimitive(primitive_msg);
     }
     else if (primitive_msg.primitive_name == StopPrimitive::PRIMITIVE_NAME)
     {
-        prim_ptr = std::make_unique<StopPrimitive>(primitive_msg);
+        return StopPrimitive(primitive_msg);
     }
     else
     {
         throw std::invalid_argument("Error: Unknown Primitive (" +
                                     primitive_msg.primitive_name + ") ");
     }
-
-    return prim_ptr;
 }
@@ -6,6 +6,7 @@
 #include <memory>
 
 #include "ai/primitive/primitive.h"
+#include "ai/primitive/primitive_variant.h"
 #include "thunderbots_msgs/Primitive.h"
 
 namespace AI::Primitive
@@ -22,4 +23,15 @@ namespace AI::Primitive
     std::unique_ptr<::Primitive> createPrimitiveFromROSMessage(
         const thunderbots_msgs::Primitive& primitive_msg);
 
+    /**
+     * Given a ROS Primitive message, constructs the concrete Primitive it describes
+     * and returns it by value in a PrimitiveVariant, without allocating
+     *
+     * @param primitive_msg the Primitive message from which to construct the Primitive
+     * @throws std::invalid_argument if primitive is unknown
+     * @return a PrimitiveVariant holding the Primitive
+     */
+    PrimitiveVariant createPrimitiveVariantFromROSMessage(
+        const thunderbots_msgs::Primitive& primitive_msg);
+
 }  // namespace AI::Primitive
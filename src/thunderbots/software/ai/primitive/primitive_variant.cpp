@@ -0,0 +1,17 @@
+#include "ai/primitive/primitive_variant.h"
+
+const Primitive &getPrimitive(const PrimitiveVariant &primitive)
+{
+    return std::visit(
+        [](const auto &concrete_primitive) -> const Primitive & {
+            return concrete_primitive;
+        },
+        primitive);
+}
+
+void visitPrimitive(const PrimitiveVariant &primitive, PrimitiveVisitor &visitor)
+{
+    std::visit(
+        [&visitor](const auto &concrete_primitive) { visitor.visit(concrete_primitive); },
+        primitive);
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <variant>
+
+#include "ai/primitive/catch_primitive.h"
+#include "ai/primitive/chip_primitive.h"
+#include "ai/primitive/direct_velocity_primitive.h"
+#include "ai/primitive/direct_wheels_primitive.h"
+#include "ai/primitive/dribble_primitive.h"
+#include "ai/primitive/kick_primitive.h"
+#include "ai/primitive/move_primitive.h"
+#include "ai/primitive/movespin_primitive.h"
+#include "ai/primitive/pivot_primitive.h"
+#include "ai/primitive/stop_primitive.h"
+#include "ai/primitive/visitor/primitive_visitor.h"
+
+/**
+ * Holds any one of the concrete Primitives by value.
+ *
+ * Unlike a std::unique_ptr<Primitive>, a PrimitiveVariant does not need its own heap
+ * allocation, so a std::vector of them stores every Primitive contiguously. The
+ * Primitives for a tick are written into a vector that is kept between ticks, which
+ * then acts as an arena: clearing it keeps its memory, so once it has grown to fit a
+ * full team no more memory is allocated for Primitives.
+ *
+ * The concrete type is found with std::visit rather than the virtual accept function.
+ * The concrete Primitive classes are still used to create and read Primitives.
+ */
+using PrimitiveVariant =
+    std::variant<CatchPrimitive, ChipPrimitive, DirectVelocityPrimitive,
+                 DirectWheelsPrimitive, DribblePrimitive, KickPrimitive, MovePrimitive,
+                 MoveSpinPrimitive, PivotPrimitive, StopPrimitive>;
+
+/**
+ * Returns the Primitive held by the given PrimitiveVariant, so the functions all
+ * Primitives share can be used without visiting it
+ *
+ * @param primitive The PrimitiveVariant to get the Primitive from
+ *
+ * @return A reference to the Primitive held by the given PrimitiveVariant
+ */
+const Primitive &getPrimitive(const PrimitiveVariant &primitive);
+
+/**
+ * Visits the Primitive held by the given PrimitiveVariant with a PrimitiveVisitor. The
+ * concrete type is found with std::visit, so this can be used anywhere a Primitive
+ * would otherwise accept the visitor
+ *
+ * @param primitive The PrimitiveVariant to visit
+ * @param visitor The PrimitiveVisitor to visit the Primitive with
+ */
+void visitPrimitive(const PrimitiveVariant &primitive, PrimitiveVisitor &visitor);
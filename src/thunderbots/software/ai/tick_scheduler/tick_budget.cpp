@@ -0,0 +1,64 @@
+#include "ai/tick_scheduler/tick_budget.h"
+
+#include <limits>
+
+std::shared_ptr<TickBudget> TickBudget::getInstance()
+{
+    static std::shared_ptr<TickBudget> tick_budget = std::make_shared<TickBudget>();
+    return tick_budget;
+}
+
+TickBudget::TickBudget()
+    : deadline(std::chrono::steady_clock::time_point::max()),
+      stage_durations(),
+      num_degraded_evaluations(0),
+      cached_results()
+{
+}
+
+void TickBudget::startTick(const std::chrono::steady_clock::time_point& deadline)
+{
+    this->deadline = deadline;
+    stage_durations.clear();
+    num_degraded_evaluations = 0;
+}
+
+Duration TickBudget::getTimeRemaining() const
+{
+    if (deadline == std::chrono::steady_clock::time_point::max())
+    {
+        return Duration::fromSeconds(std::numeric_limits<double>::infinity());
+    }
+
+    return Duration::fromSeconds(
+        std::chrono::duration<double>(deadline - std::chrono::steady_clock::now())
+            .count());
+}
+
+bool TickBudget::isExhausted() const
+{
+    return std::chrono::steady_clock::now() >= deadline;
+}
+
+void TickBudget::recordStage(const std::string& stage_name, const Duration& duration)
+{
+    auto existing_stage = stage_durations.find(stage_name);
+    if (existing_stage != stage_durations.end())
+    {
+        existing_stage->second = existing_stage->second + duration;
+    }
+    else
+    {
+        stage_durations.emplace(stage_name, duration);
+    }
+}
+
+const std::map<std::string, Duration>& TickBudget::getStageDurations() const
+{
+    return stage_durations;
+}
+
+unsigned int TickBudget::getNumDegradedEvaluations() const
+{
+    return num_degraded_evaluations;
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <any>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "util/time/duration.h"
+
+/**
+ * How an evaluation should be treated when the AI is running out of time in a tick
+ */
+enum class EvaluationPriority
+{
+    // The evaluation is always run, even if the tick is already past its deadline.
+    // Use this for anything the AI can't make a safe decision without
+    MUST_RUN,
+    // The evaluation can cut its work back to fit the time left in the tick (see
+    // TickBudget::getTimeRemaining). If there is no time left at all, it is not run and
+    // the result from the last time it was run is used instead
+    ANYTIME
+};
+
+/**
+ * Keeps track of how much time the AI has left in the current tick, so that expensive
+ * work can be cut back rather than making the AI fall behind the vision data.
+ *
+ * The TickScheduler starts a new tick with a deadline before every run of the AI.
+ * Evaluations are run through runEvaluation, which times them and decides whether
+ * ANYTIME evaluations can run or should be served from their previous result. Other
+ * stages of the AI can record how long they took with recordStage, and the
+ * TickScheduler reports these timings after every tick.
+ *
+ * If no tick has been started, the budget never runs out, so code that uses the
+ * TickBudget still works when the AI is not run by a TickScheduler.
+ *
+ * The TickBudget must only be used by the thread running the AI.
+ */
+class TickBudget
+{
+   public:
+    /**
+     * Returns the TickBudget used by the AI
+     *
+     * @return A shared pointer to the TickBudget used by the AI
+     */
+    static std::shared_ptr<TickBudget> getInstance();
+
+    /**
+     * Creates a new TickBudget with no deadline
+     */
+    explicit TickBudget();
+
+    /**
+     * Starts a new tick that must be finished by the given deadline. The stage timings
+     * and degraded evaluation count of the previous tick are cleared, but the cached
+     * evaluation results are kept
+     *
+     * @param deadline When the tick must be finished by
+     */
+    void startTick(const std::chrono::steady_clock::time_point& deadline);
+
+    /**
+     * Returns how much time is left before the deadline of the current tick
+     *
+     * @return How much time is left before the deadline of the current tick, which is
+     * negative if the deadline has passed
+     */
+    Duration getTimeRemaining() const;
+
+    /**
+     * Returns whether the deadline of the current tick has passed
+     *
+     * @return true if the deadline of the current tick has passed, and false otherwise
+     */
+    bool isExhausted() const;
+
+    /**
+     * Runs an evaluation according to its priority and records how long it took as the
+     * stage "evaluation/<name>".
+     *
+     * An ANYTIME evaluation is not run if the budget is exhausted and it has been run
+     * before, and the result from the last time it ran is returned instead.
+     *
+     * @tparam T The type of the result of the evaluation
+     *
+     * @param name A name that identifies the evaluation. The same name must always be
+     * used with the same result type
+     * @param priority The priority of the evaluation
+     * @param evaluation The function that calculates the result of the evaluation
+     *
+     * @return The result of the evaluation
+     */
+    template <typename T>
+    T runEvaluation(const std::string& name, EvaluationPriority priority,
+                    const std::function<T()>& evaluation);
+
+    /**
+     * Records how long a stage of the current tick took. If the same stage is recorded
+     * more than once in a tick, the durations are added together
+     *
+     * @param stage_name The name of the stage
+     * @param duration How long the stage took
+     */
+    void recordStage(const std::string& stage_name, const Duration& duration);
+
+    /**
+     * Returns how long each stage of the current tick took
+     *
+     * @return A map from the name of each stage recorded in the current tick to how
+     * long it took
+     */
+    const std::map<std::string, Duration>& getStageDurations() const;
+
+    /**
+     * Returns how many evaluations were served from a previous result in the current
+     * tick because there was no time left to run them
+     *
+     * @return The number of evaluations that were degraded in the current tick
+     */
+    unsigned int getNumDegradedEvaluations() const;
+
+   private:
+    std::chrono::steady_clock::time_point deadline;
+
+    // How long each stage of the current tick took
+    std::map<std::string, Duration> stage_durations;
+
+    unsigned int num_degraded_evaluations;
+
+    // The result of the last run of every ANYTIME evaluation, by name
+    std::map<std::string, std::any> cached_results;
+};
+
+#include "ai/tick_scheduler/tick_budget.tpp"
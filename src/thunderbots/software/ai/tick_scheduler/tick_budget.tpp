@@ -0,0 +1,36 @@
+/**
+ * This file contains the implementation of the templated functions of the TickBudget
+ */
+
+#pragma once
+
+#include "ai/tick_scheduler/tick_budget.h"
+
+template <typename T>
+T TickBudget::runEvaluation(const std::string& name, EvaluationPriority priority,
+                            const std::function<T()>& evaluation)
+{
+    if (priority == EvaluationPriority::ANYTIME && isExhausted())
+    {
+        auto cached_result = cached_results.find(name);
+        if (cached_result != cached_results.end())
+        {
+            num_degraded_evaluations++;
+            return std::any_cast<T>(cached_result->second);
+        }
+    }
+
+    auto start_time = std::chrono::steady_clock::now();
+    T result        = evaluation();
+    recordStage("evaluation/" + name,
+                Duration::fromSeconds(std::chrono::duration<double>(
+                                          std::chrono::steady_clock::now() - start_time)
+                                          .count()));
+
+    if (priority == EvaluationPriority::ANYTIME)
+    {
+        cached_results[name] = result;
+    }
+
+    return result;
+}
@@ -0,0 +1,178 @@
+#include "ai/tick_scheduler/tick_scheduler.h"
+
+#include <stdexcept>
+
+#include "util/constants.h"
+#include "util/logger/init.h"
+
+namespace
+{
+    std::chrono::steady_clock::duration toSteadyClockDuration(const Duration& duration)
+    {
+        return std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(duration.getSeconds()));
+    }
+
+    Duration toDuration(const std::chrono::steady_clock::duration& duration)
+    {
+        return Duration::fromSeconds(std::chrono::duration<double>(duration).count());
+    }
+}  // namespace
+
+TickScheduler::TickScheduler(
+    const Duration& tick_period, const Duration& tick_deadline,
+    std::shared_ptr<TickBudget> tick_budget, Util::LatencyTracker& latency_tracker,
+    std::function<void(const World&, const thunderbots_msgs::FrameTrace&)> tick_function)
+    : tick_period(toSteadyClockDuration(tick_period)),
+      tick_deadline(toSteadyClockDuration(tick_deadline)),
+      tick_budget(tick_budget),
+      latency_tracker(latency_tracker),
+      tick_function(tick_function),
+      latest_world(),
+      latest_trace(),
+      has_new_world(false),
+      is_running(true),
+      tick_world(),
+      tick_trace(),
+      num_ticks(0),
+      num_missed_deadlines(0),
+      num_ticks_since_report(0),
+      num_missed_deadlines_since_report(0),
+      num_degraded_evaluations_since_report(0),
+      time_last_reported(std::chrono::steady_clock::now())
+{
+    if (tick_period.getSeconds() <= 0 || tick_deadline.getSeconds() <= 0)
+    {
+        throw std::invalid_argument(
+            "Error: The tick period and deadline of a TickScheduler must be positive");
+    }
+
+    tick_thread = std::thread([this]() { runTicks(); });
+}
+
+TickScheduler::~TickScheduler()
+{
+    {
+        std::lock_guard<std::mutex> world_lock(world_mutex);
+        is_running = false;
+    }
+    world_updated.notify_one();
+    tick_thread.join();
+}
+
+void TickScheduler::updateWorld(const World& world,
+                                const thunderbots_msgs::FrameTrace& trace)
+{
+    {
+        std::lock_guard<std::mutex> world_lock(world_mutex);
+        latest_world              = world;
+        latest_trace              = trace;
+        latest_world_arrival_time = std::chrono::steady_clock::now();
+        has_new_world             = true;
+    }
+    world_updated.notify_one();
+}
+
+uint64_t TickScheduler::getNumTicks() const
+{
+    return num_ticks;
+}
+
+uint64_t TickScheduler::getNumMissedDeadlines() const
+{
+    return num_missed_deadlines;
+}
+
+void TickScheduler::runTicks()
+{
+    // The first World always arrives after now, so the first tick can start as soon as
+    // it does
+    std::chrono::steady_clock::time_point next_tick_time =
+        std::chrono::steady_clock::now();
+
+    while (true)
+    {
+        std::chrono::steady_clock::time_point world_arrival_time;
+        {
+            std::unique_lock<std::mutex> world_lock(world_mutex);
+            world_updated.wait(world_lock,
+                               [this]() { return has_new_world || !is_running; });
+
+            // If the World arrived before the tick period is up, wait for the rest of
+            // the period. Any World that arrives in the meantime replaces this one
+            world_updated.wait_until(world_lock, next_tick_time,
+                                     [this]() { return !is_running; });
+            if (!is_running)
+            {
+                break;
+            }
+
+            // Swapping avoids copying the World while we hold the lock
+            std::swap(tick_world, latest_world);
+            tick_trace         = latest_trace;
+            world_arrival_time = latest_world_arrival_time;
+            has_new_world      = false;
+        }
+
+        auto tick_start_time = std::chrono::steady_clock::now();
+        auto deadline        = tick_start_time + tick_deadline;
+        next_tick_time       = tick_start_time +
+                         std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                             tick_period * (1 - TICK_PERIOD_TOLERANCE));
+
+        tick_budget->startTick(deadline);
+        tick_function(tick_world, tick_trace);
+
+        recordTick(world_arrival_time, tick_start_time, deadline,
+                   std::chrono::steady_clock::now());
+    }
+}
+
+void TickScheduler::recordTick(
+    const std::chrono::steady_clock::time_point& world_arrival_time,
+    const std::chrono::steady_clock::time_point& tick_start_time,
+    const std::chrono::steady_clock::time_point& deadline,
+    const std::chrono::steady_clock::time_point& tick_end_time)
+{
+    num_ticks_since_report++;
+    num_degraded_evaluations_since_report += tick_budget->getNumDegradedEvaluations();
+
+    latency_tracker.recordStageDuration("tick_wait",
+                                        toDuration(tick_start_time - world_arrival_time));
+    latency_tracker.recordStageDuration("tick",
+                                        toDuration(tick_end_time - tick_start_time));
+    for (const auto& [stage_name, duration] : tick_budget->getStageDurations())
+    {
+        latency_tracker.recordStageDuration("tick/" + stage_name, duration);
+    }
+
+    if (tick_end_time > deadline)
+    {
+        num_missed_deadlines++;
+        num_missed_deadlines_since_report++;
+        latency_tracker.recordStageDuration("tick_deadline_overrun",
+                                            toDuration(tick_end_time - deadline));
+    }
+    // Counted last, so anything waiting for the tick to finish sees all of its results
+    num_ticks++;
+
+    if (tick_end_time - time_last_reported <
+        std::chrono::seconds(Util::Constants::LATENCY_REPORT_PERIOD_SECONDS))
+    {
+        return;
+    }
+
+    if (num_missed_deadlines_since_report > 0)
+    {
+        LOG(WARNING) << "The AI missed the deadline of "
+                     << num_missed_deadlines_since_report << " of "
+                     << num_ticks_since_report << " ticks, and used old results for "
+                     << num_degraded_evaluations_since_report
+                     << " evaluations to save time" << std::endl;
+    }
+
+    time_last_reported                    = tick_end_time;
+    num_ticks_since_report                = 0;
+    num_missed_deadlines_since_report     = 0;
+    num_degraded_evaluations_since_report = 0;
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <thunderbots_msgs/FrameTrace.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "ai/tick_scheduler/tick_budget.h"
+#include "ai/world/world.h"
+#include "util/latency_tracker/latency_tracker.h"
+
+/**
+ * Runs the AI on its own thread at a fixed period, with a deadline for every tick.
+ *
+ * Ticks are aligned to the vision frames: a tick starts as soon as a new World arrives,
+ * but never sooner than one tick period after the previous tick started. If more than
+ * one World arrives in that time, only the latest one is used, so the AI never falls
+ * behind the vision data by more than one tick, no matter how long a tick takes.
+ *
+ * Every tick is given a deadline through the TickBudget, so that ANYTIME evaluations
+ * can cut their work back when the AI is running out of time. After every tick, the
+ * time spent waiting for the tick to start, the duration of every stage recorded in
+ * the TickBudget, and how far past the deadline the tick finished (if it did) are
+ * recorded in the LatencyTracker, and missed deadlines are logged every reporting
+ * period.
+ */
+class TickScheduler
+{
+   public:
+    /**
+     * Creates a new TickScheduler and starts its thread
+     *
+     * @param tick_period The shortest time between the start of two ticks. This should
+     * be the period of the vision data
+     * @param tick_deadline How long each tick is allowed to take. This should be shorter
+     * than the tick_period, so that the AI is finished before the next World arrives
+     * @param tick_budget The TickBudget to give the deadline of each tick to
+     * @param latency_tracker The LatencyTracker to record the timings of each tick to.
+     * It is only used by the thread of this scheduler
+     * @param tick_function The function that runs the AI on a World and its trace.
+     * The World is owned by this scheduler, so it is only valid for the duration of
+     * the call
+     *
+     * @throws std::invalid_argument if the tick_period or tick_deadline are not
+     * positive
+     */
+    explicit TickScheduler(
+        const Duration& tick_period, const Duration& tick_deadline,
+        std::shared_ptr<TickBudget> tick_budget, Util::LatencyTracker& latency_tracker,
+        std::function<void(const World&, const thunderbots_msgs::FrameTrace&)>
+            tick_function);
+
+    /**
+     * Stops the thread of this scheduler, after waiting for the current tick to finish
+     */
+    ~TickScheduler();
+
+    TickScheduler& operator=(const TickScheduler&) = delete;
+    TickScheduler(const TickScheduler&)            = delete;
+
+    /**
+     * Gives the scheduler a new World to run the AI on. This never waits for the AI,
+     * and can be called from any thread
+     *
+     * @param world The new World
+     * @param trace The trace of the new World
+     */
+    void updateWorld(const World& world, const thunderbots_msgs::FrameTrace& trace);
+
+    /**
+     * Returns how many ticks have been run
+     *
+     * @return how many ticks have been run
+     */
+    uint64_t getNumTicks() const;
+
+    /**
+     * Returns how many ticks have finished after their deadline
+     *
+     * @return how many ticks have finished after their deadline
+     */
+    uint64_t getNumMissedDeadlines() const;
+
+   private:
+    // A World that arrives less than this fraction of a tick period early is run right
+    // away, so that small amounts of jitter in when the vision frames arrive don't
+    // delay the tick until the period is up
+    static constexpr double TICK_PERIOD_TOLERANCE = 0.1;
+
+    /**
+     * Runs ticks until the scheduler is destroyed
+     */
+    void runTicks();
+
+    /**
+     * Records the timings of the tick that just finished, and logs a summary of the
+     * missed deadlines if a full reporting period has passed since the last one
+     *
+     * @param world_arrival_time When the World the tick was run on arrived
+     * @param tick_start_time When the tick started
+     * @param deadline When the tick had to be finished by
+     * @param tick_end_time When the tick finished
+     */
+    void recordTick(const std::chrono::steady_clock::time_point& world_arrival_time,
+                    const std::chrono::steady_clock::time_point& tick_start_time,
+                    const std::chrono::steady_clock::time_point& deadline,
+                    const std::chrono::steady_clock::time_point& tick_end_time);
+
+    const std::chrono::steady_clock::duration tick_period;
+    const std::chrono::steady_clock::duration tick_deadline;
+    std::shared_ptr<TickBudget> tick_budget;
+    Util::LatencyTracker& latency_tracker;
+    std::function<void(const World&, const thunderbots_msgs::FrameTrace&)> tick_function;
+
+    // The latest World given to the scheduler, which the next tick will be run on.
+    // Protected by the world_mutex
+    std::mutex world_mutex;
+    std::condition_variable world_updated;
+    World latest_world;
+    thunderbots_msgs::FrameTrace latest_trace;
+    std::chrono::steady_clock::time_point latest_world_arrival_time;
+    bool has_new_world;
+    bool is_running;
+
+    // The World the current tick is run on. Only used by the tick thread
+    World tick_world;
+    thunderbots_msgs::FrameTrace tick_trace;
+
+    std::atomic<uint64_t> num_ticks;
+    std::atomic<uint64_t> num_missed_deadlines;
+
+    // The number of ticks, missed deadlines and degraded evaluations since the last
+    // summary was logged. Only used by the tick thread
+    uint64_t num_ticks_since_report;
+    uint64_t num_missed_deadlines_since_report;
+    uint64_t num_degraded_evaluations_since_report;
+    std::chrono::steady_clock::time_point time_last_reported;
+
+    std::thread tick_thread;
+};
@@ -2,15 +2,12 @@
 
 #include "geom/point.h"
 #include "geom/rectangle.h"
-<<<<<<< HEAD
-=======
 
 typedef enum
 {
     EAST,  // positive X side according to vision
     WEST   // negative X side
 } FieldSide;
->>>>>>> b20161dc21a1bd66f3c4e146f1399408ab1a16f6
 
 /**
  * Exposes the dimensions of various parts of the field.
@@ -252,7 +249,7 @@ class Field
      *
      * @return true if p is within the field lines of the field, false otherwise
      */
-    bool pointInFieldLines(const Point &p);
+    bool pointInFieldLines(const Point &p) const;
 
     /**
      * Compares two fields for equality
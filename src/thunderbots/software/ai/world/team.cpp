@@ -40,6 +40,24 @@ void Team::updateRobots(const std::vector<Robot>& new_robots)
     }
 }
 
+void Team::updateRobot(const Robot& robot)
+{
+    auto it = team_robots.find(robot.id());
+    if (it != team_robots.end())
+    {
+        it->second.updateState(robot);
+    }
+    else
+    {
+        team_robots.insert(std::make_pair(robot.id(), robot));
+    }
+}
+
+void Team::removeRobot(unsigned int id)
+{
+    team_robots.erase(id);
+}
+
 void Team::updateState(const Team& new_team_data)
 {
     updateRobots(new_team_data.getAllRobots());
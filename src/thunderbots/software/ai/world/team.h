@@ -40,6 +40,25 @@ class Team
      */
     void updateRobots(const std::vector<Robot>& team_robots);
 
+    /**
+     * Updates a single robot on this team, adding it to the team if it is not already
+     * on it. Unlike updateRobots, this does not need to check the other robots, so
+     * it is cheaper when only a few robots have changed.
+     *
+     * @throws std::invalid_argument if the robot is already on the team and the new
+     * data is older than the robot's current state
+     * @param robot the new data for the robot
+     */
+    void updateRobot(const Robot& robot);
+
+    /**
+     * Removes the robot with the given id from this team. Does nothing if the team does
+     * not have that robot. Does not affect the goalie id.
+     *
+     * @param id the id of the robot to remove
+     */
+    void removeRobot(unsigned int id);
+
     /**
      * Updates this team with new data from the given team object. This is different from
      * a copy constructor because the team object is only used to store data, we don't
@@ -150,6 +169,9 @@ class Team
     /**
      * Returns a vector of all the robots on this team.
      *
+     * This builds a new vector holding a copy of every robot, so callers that need the
+     * robots more than once should store the result rather than calling this again.
+     *
      * @return a vector of all the robots on this team.
      */
     std::vector<Robot> getAllRobots() const;
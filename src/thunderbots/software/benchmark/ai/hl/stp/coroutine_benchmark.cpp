@@ -0,0 +1,238 @@
+/**
+ * Compares the cost of running the logic of Plays, Tactics and Actions with a
+ * boost::coroutines2 coroutine, which they used to use, and with a StacklessCoroutine.
+ *
+ * Both run the same logic as a MoveAction: they return a new Intent every tick until the
+ * robot gets to its destination. An int stands in for the Intent, and the robot gets
+ * closer every tick so the logic ends after a set number of ticks.
+ *
+ * - create: how long it takes to create the coroutine, like a Play does when it
+ *   creates its Tactics
+ * - tick: how long it takes to get the next value from the coroutine, which is done for
+ *   every Tactic on every tick of the AI
+ * - restart: how long it takes to start the coroutine over once it is done, like a
+ *   Tactic that loops forever does
+ *
+ * Usage: coroutine_benchmark [number of coroutines]
+ */
+
+#include <boost/bind.hpp>
+#include <boost/context/stack_traits.hpp>
+#include <boost/coroutine2/all.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ai/hl/stp/stackless_coroutine.h"
+
+namespace
+{
+    // How many ticks it takes the logic to get to its destination
+    const int TICKS_TO_DESTINATION = 20;
+
+    typedef boost::coroutines2::coroutine<std::unique_ptr<int>> StackfulCoroutine;
+
+    // The logic run by the boost::coroutines2 coroutine
+    class StackfulMove
+    {
+       public:
+        StackfulMove()
+            : distance_to_destination(TICKS_TO_DESTINATION),
+              intent_sequence(
+                  boost::bind(&StackfulMove::calculateNextIntentWrapper, this, _1))
+        {
+        }
+
+        std::unique_ptr<int> getNextIntent()
+        {
+            if (intent_sequence)
+            {
+                intent_sequence();
+                return intent_sequence.get();
+            }
+            return std::unique_ptr<int>{};
+        }
+
+        bool done() const
+        {
+            return !static_cast<bool>(intent_sequence);
+        }
+
+        void restart()
+        {
+            distance_to_destination = TICKS_TO_DESTINATION;
+            intent_sequence         = StackfulCoroutine::pull_type(
+                boost::bind(&StackfulMove::calculateNextIntentWrapper, this, _1));
+        }
+
+       private:
+        std::unique_ptr<int> calculateNextIntentWrapper(
+            StackfulCoroutine::push_type& yield)
+        {
+            // Like the coroutines used to, yield a value the first time the coroutine is
+            // entered from its constructor
+            yield(std::unique_ptr<int>{});
+            do
+            {
+                yield(std::make_unique<int>(--distance_to_destination));
+            } while (distance_to_destination > 0);
+            return std::unique_ptr<int>{};
+        }
+
+        int distance_to_destination;
+        StackfulCoroutine::pull_type intent_sequence;
+    };
+
+    // The logic run by the StacklessCoroutine
+    class StacklessMove
+    {
+       public:
+        StacklessMove() : distance_to_destination(TICKS_TO_DESTINATION), intent_sequence()
+        {
+        }
+
+        std::unique_ptr<int> getNextIntent()
+        {
+            if (!intent_sequence.done())
+            {
+                return calculateNextIntent(intent_sequence);
+            }
+            return std::unique_ptr<int>{};
+        }
+
+        bool done() const
+        {
+            return intent_sequence.done();
+        }
+
+        void restart()
+        {
+            distance_to_destination = TICKS_TO_DESTINATION;
+            intent_sequence.restart();
+        }
+
+       private:
+        std::unique_ptr<int> calculateNextIntent(StacklessCoroutine& coroutine)
+        {
+            BOOST_ASIO_CORO_REENTER(coroutine)
+            {
+                do
+                {
+                    BOOST_ASIO_CORO_YIELD return std::make_unique<int>(
+                        --distance_to_destination);
+                } while (distance_to_destination > 0);
+            }
+            return std::unique_ptr<int>{};
+        }
+
+        int distance_to_destination;
+        StacklessCoroutine intent_sequence;
+    };
+
+    struct BenchmarkResult
+    {
+        double create_time_nanoseconds;
+        double tick_time_nanoseconds;
+        double restart_time_nanoseconds;
+        // The sum of every value returned by the coroutines, which is the same for both
+        // coroutines if they run the same logic
+        long checksum;
+    };
+
+    double getNanosecondsSince(const std::chrono::steady_clock::time_point& start_time)
+    {
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() -
+                                                        start_time)
+            .count();
+    }
+
+    // Runs every coroutine until it is done, and returns the sum of the values they
+    // returned
+    template <class Move>
+    long runUntilDone(std::vector<std::unique_ptr<Move>>& moves)
+    {
+        long checksum = 0;
+        for (auto& move : moves)
+        {
+            while (!move->done())
+            {
+                auto intent = move->getNextIntent();
+                if (intent)
+                {
+                    checksum += *intent;
+                }
+            }
+        }
+        return checksum;
+    }
+
+    template <class Move>
+    BenchmarkResult benchmark(size_t num_coroutines)
+    {
+        BenchmarkResult result = {0, 0, 0, 0};
+        std::vector<std::unique_ptr<Move>> moves;
+        moves.reserve(num_coroutines);
+
+        auto start_time = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < num_coroutines; i++)
+        {
+            moves.emplace_back(std::make_unique<Move>());
+        }
+        result.create_time_nanoseconds = getNanosecondsSince(start_time) / num_coroutines;
+
+        start_time = std::chrono::steady_clock::now();
+        result.checksum += runUntilDone(moves);
+        result.tick_time_nanoseconds = getNanosecondsSince(start_time) /
+                                       (num_coroutines * (TICKS_TO_DESTINATION + 1));
+
+        start_time = std::chrono::steady_clock::now();
+        for (auto& move : moves)
+        {
+            move->restart();
+        }
+        result.restart_time_nanoseconds =
+            getNanosecondsSince(start_time) / num_coroutines;
+
+        // Make sure the restarted coroutines run the logic again
+        result.checksum += runUntilDone(moves);
+
+        return result;
+    }
+
+    void printResult(const std::string& name, const BenchmarkResult& result,
+                     size_t bytes_per_coroutine)
+    {
+        std::cout << std::left << std::setw(10) << name << std::right << std::fixed
+                  << std::setprecision(1) << " create: " << std::setw(9)
+                  << result.create_time_nanoseconds << "ns"
+                  << " tick: " << std::setw(7) << result.tick_time_nanoseconds << "ns"
+                  << " restart: " << std::setw(9) << result.restart_time_nanoseconds
+                  << "ns"
+                  << " memory: " << std::setw(7) << bytes_per_coroutine << "B"
+                  << " checksum: " << result.checksum << std::endl;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    size_t num_coroutines = 10000;
+    if (argc > 1)
+    {
+        num_coroutines = static_cast<size_t>(std::atoi(argv[1]));
+    }
+
+    std::cout << num_coroutines << " coroutines, " << TICKS_TO_DESTINATION
+              << " ticks each" << std::endl;
+    // A stackful coroutine takes up the pull_type plus the whole stack it allocates
+    printResult("stackful", benchmark<StackfulMove>(num_coroutines),
+                sizeof(StackfulCoroutine::pull_type) +
+                    boost::context::stack_traits::default_size());
+    printResult("stackless", benchmark<StacklessMove>(num_coroutines),
+                sizeof(StacklessCoroutine));
+
+    return 0;
+}
@@ -0,0 +1,280 @@
+/**
+ * Compares how long STP::getIntents takes to run a full Play when the tactics are run
+ * on the calling thread, and when they are run in parallel on STP's worker threads.
+ *
+ * The Play gives every friendly robot a tactic that picks the open spot on the field
+ * furthest from the enemy robots, like a positioning tactic would. The tactics score
+ * a grid of candidate spots when calculating the cost of each robot and when
+ * calculating their Intent, and the size of the grid controls how much work each
+ * tactic does. With a grid size of 0 the tactics only do as much work as a MoveTactic.
+ *
+ * The whole tick is timed: choosing the Play, calculating the costs, assigning the
+ * robots and calculating the Intents.
+ *
+ * Usage: parallel_tactic_benchmark [number of ticks]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ai/hl/stp/play/play.h"
+#include "ai/hl/stp/play/play_factory.h"
+#include "ai/hl/stp/stp.h"
+#include "ai/hl/stp/tactic/tactic.h"
+#include "ai/intent/move_intent.h"
+#include "ai/world/world.h"
+
+namespace
+{
+    // How many tactics the Play runs, and how many candidate spots along each side of
+    // the field every tactic scores. These are changed between benchmarks
+    size_t num_tactics              = 6;
+    size_t candidate_spots_per_side = 0;
+
+    // Scores how open a spot on the field is, by how far it is from the closest enemy
+    double scoreSpot(const Point& spot, const WorldAnalysis& world_analysis)
+    {
+        double min_distance = std::numeric_limits<double>::max();
+        for (const auto& enemy : world_analysis.getEnemyRobots())
+        {
+            min_distance = std::min(min_distance, (enemy.position() - spot).len());
+        }
+        return min_distance;
+    }
+
+    // Finds the most open spot on the field that is in the given column of the grid,
+    // so that every tactic picks a different spot
+    Point findMostOpenSpot(const WorldAnalysis& world_analysis, size_t column)
+    {
+        const Field& field = world_analysis.world().field();
+        Point best_spot(0, 0);
+        double best_score = -1;
+        for (size_t row = 0; row < candidate_spots_per_side; row++)
+        {
+            for (size_t i = 0; i < candidate_spots_per_side; i++)
+            {
+                Point spot(
+                    field.length() * ((i + column) % candidate_spots_per_side) /
+                            candidate_spots_per_side -
+                        field.length() / 2,
+                    field.width() * row / candidate_spots_per_side - field.width() / 2);
+                double score = scoreSpot(spot, world_analysis);
+                if (score > best_score)
+                {
+                    best_score = score;
+                    best_spot  = spot;
+                }
+            }
+        }
+        return best_spot;
+    }
+
+    class OpenSpotTactic : public Tactic
+    {
+       public:
+        explicit OpenSpotTactic(size_t column) : Tactic(true), column(column) {}
+
+        std::string getName() const override
+        {
+            return "Open Spot Tactic";
+        }
+
+        double calculateRobotCost(const Robot& robot, const World& world,
+                                  const WorldAnalysis& world_analysis) override
+        {
+            Point spot = findMostOpenSpot(world_analysis, column);
+            return std::clamp((robot.position() - spot).len() / 10.0, 0.0, 1.0);
+        }
+
+        // Tactics are not given the World when calculating their Intent, so the Play
+        // gives them the analysis of it, which lasts for the whole tick
+        void updateParams(const WorldAnalysis& world_analysis)
+        {
+            this->world_analysis = &world_analysis;
+        }
+
+       private:
+        std::unique_ptr<Intent> calculateNextIntent(
+            StacklessCoroutine& coroutine) override
+        {
+            BOOST_ASIO_CORO_REENTER(coroutine)
+            {
+                BOOST_ASIO_CORO_YIELD return std::make_unique<MoveIntent>(
+                    robot->id(), findMostOpenSpot(*world_analysis, column), Angle::zero(),
+                    0, 0);
+            }
+            return std::unique_ptr<Intent>{};
+        }
+
+        const WorldAnalysis* world_analysis = nullptr;
+        size_t column;
+    };
+
+    class OpenSpotPlay : public Play
+    {
+       public:
+        static const std::string name;
+
+        std::string getName() const override
+        {
+            return name;
+        }
+
+        static bool isApplicable(const World& world)
+        {
+            return true;
+        }
+
+        static bool invariantHolds(const World& world)
+        {
+            return true;
+        }
+
+       private:
+        std::vector<std::shared_ptr<Tactic>> getNextTactics(
+            StacklessCoroutine& coroutine, const World& world,
+            const WorldAnalysis& world_analysis) override
+        {
+            std::vector<std::shared_ptr<Tactic>> result;
+            BOOST_ASIO_CORO_REENTER(coroutine)
+            {
+                for (size_t i = 0; i < num_tactics; i++)
+                {
+                    tactics.emplace_back(std::make_shared<OpenSpotTactic>(i));
+                }
+
+                while (true)
+                {
+                    BOOST_ASIO_CORO_YIELD
+                    {
+                        for (const auto& tactic : tactics)
+                        {
+                            tactic->updateParams(world_analysis);
+                            result.emplace_back(tactic);
+                        }
+                        return result;
+                    }
+                }
+            }
+            return result;
+        }
+
+        std::vector<std::shared_ptr<OpenSpotTactic>> tactics;
+    };
+
+    const std::string OpenSpotPlay::name = "Open Spot Play";
+    TPlayFactory<OpenSpotPlay> factory;
+
+    World createWorld(size_t num_robots)
+    {
+        World world;
+        world.updateFieldGeometry(Field(9.0, 6.0, 1.0, 2.0, 1.0, 0.5, 1.0));
+        world.updateBallState(Ball(Point(), Vector(), Timestamp::fromSeconds(0)));
+
+        Team friendly_team(Duration::fromSeconds(1));
+        Team enemy_team(Duration::fromSeconds(1));
+        std::vector<Robot> friendly_robots;
+        std::vector<Robot> enemy_robots;
+        for (unsigned int id = 0; id < num_robots; id++)
+        {
+            friendly_robots.emplace_back(id, Point(-4.0 + 0.7 * id, -2.0 + 0.35 * id),
+                                         Vector(), Angle::zero(), AngularVelocity::zero(),
+                                         Timestamp::fromSeconds(0));
+            enemy_robots.emplace_back(id, Point(4.0 - 0.7 * id, 2.5 - 0.45 * id),
+                                      Vector(), Angle::zero(), AngularVelocity::zero(),
+                                      Timestamp::fromSeconds(0));
+        }
+        friendly_team.updateRobots(friendly_robots);
+        enemy_team.updateRobots(enemy_robots);
+        world.updateFriendlyTeamState(friendly_team);
+        world.updateEnemyTeamState(enemy_team);
+
+        return world;
+    }
+
+    struct BenchmarkResult
+    {
+        double mean_tick_time_microseconds;
+        // The sum of the destinations of every Intent, which is the same no matter how
+        // many threads are used if the results are deterministic
+        double checksum;
+    };
+
+    BenchmarkResult benchmark(const World& world, size_t num_worker_threads,
+                              size_t num_ticks)
+    {
+        BenchmarkResult result = {0, 0};
+        STP stp(0, num_worker_threads);
+
+        auto start_time = std::chrono::steady_clock::now();
+        for (size_t tick = 0; tick < num_ticks; tick++)
+        {
+            for (const auto& intent : stp.getIntents(world))
+            {
+                const auto& move_intent = std::get<MoveIntent>(intent);
+                result.checksum +=
+                    move_intent.getDestination().x() + move_intent.getDestination().y();
+            }
+        }
+        result.mean_tick_time_microseconds =
+            std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() -
+                                                      start_time)
+                .count() /
+            num_ticks;
+
+        return result;
+    }
+
+    void printResult(size_t num_worker_threads, const BenchmarkResult& result)
+    {
+        std::cout << "  " << std::setw(2) << num_worker_threads << " worker threads"
+                  << std::fixed << std::setprecision(2) << " mean: " << std::setw(9)
+                  << result.mean_tick_time_microseconds << "us"
+                  << " checksum: " << std::setprecision(4) << result.checksum
+                  << std::endl;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    size_t num_ticks = 1000;
+    if (argc > 1)
+    {
+        num_ticks = static_cast<size_t>(std::atoi(argv[1]));
+    }
+
+    // Running more worker threads than there are cores only shows the cost of waking
+    // the threads, so keep the number of cores in mind when reading the results
+    std::cout << num_ticks << " ticks, " << std::thread::hardware_concurrency()
+              << " hardware threads" << std::endl;
+    for (size_t num_robots : {6, 8, 11})
+    {
+        for (size_t spots_per_side : {0, 5, 10})
+        {
+            num_tactics              = num_robots;
+            candidate_spots_per_side = spots_per_side;
+            World world              = createWorld(num_robots);
+
+            std::cout << num_robots << " robots, " << spots_per_side * spots_per_side
+                      << " candidate spots per tactic" << std::endl;
+            // There is nothing for more worker threads than tactics to do
+            for (size_t num_worker_threads : {0, 1, 3, 5, 10})
+            {
+                if (num_worker_threads < num_robots)
+                {
+                    printResult(num_worker_threads,
+                                benchmark(world, num_worker_threads, num_ticks));
+                }
+            }
+        }
+    }
+
+    return 0;
+}
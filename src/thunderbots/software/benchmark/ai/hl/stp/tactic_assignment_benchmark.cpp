@@ -0,0 +1,201 @@
+/**
+ * Compares how long it takes to assign robots to tactics with munkres-cpp, which STP
+ * used to use, and with the Util::AssignmentSolver, both cold and warm started.
+ *
+ * - The munkres path copies the costs into a heap allocated Matrix, solves it, and
+ *   scans the solved Matrix for the 0 in every row to find the assignment
+ * - The cold path solves the same costs with an AssignmentSolver without an initial
+ *   assignment
+ * - The warm path solves the same costs with an AssignmentSolver, starting from the
+ *   assignment of the previous tick
+ *
+ * Every tick, the costs of the previous tick are changed by a small random amount, like
+ * the costs of tactics change as the robots and ball move. Only the assignment itself
+ * is timed, not the calculation of the costs.
+ *
+ * Usage: tactic_assignment_benchmark [number of ticks]
+ */
+
+#include <munkres/munkres.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "util/assignment_solver.h"
+
+namespace
+{
+    using Solver = Util::AssignmentSolver<11>;
+
+    // How much the costs change between ticks
+    const double COST_CHANGE_STDDEV = 0.02;
+
+    struct BenchmarkResult
+    {
+        double mean_solve_time_microseconds;
+        // The total cost of every assignment, which is the same for every path if they
+        // all find the optimal assignment
+        double total_cost;
+    };
+
+    double getMicrosecondsSince(const std::chrono::steady_clock::time_point& start_time)
+    {
+        return std::chrono::duration<double, std::micro>(
+                   std::chrono::steady_clock::now() - start_time)
+            .count();
+    }
+
+    // Creates the costs of every tick, so that every path solves exactly the same
+    // problems
+    std::vector<Solver::CostMatrix> createCosts(size_t num_ticks, unsigned int seed)
+    {
+        std::mt19937 random_number_generator(seed);
+        std::uniform_real_distribution<double> initial_cost_distribution(0, 1);
+        std::normal_distribution<double> cost_change_distribution(0, COST_CHANGE_STDDEV);
+
+        Solver::CostMatrix costs;
+        for (auto& row : costs)
+        {
+            for (auto& cost : row)
+            {
+                cost = initial_cost_distribution(random_number_generator);
+            }
+        }
+
+        std::vector<Solver::CostMatrix> costs_per_tick;
+        costs_per_tick.reserve(num_ticks);
+        for (size_t tick = 0; tick < num_ticks; tick++)
+        {
+            for (auto& row : costs)
+            {
+                for (auto& cost : row)
+                {
+                    cost = std::clamp(
+                        cost + cost_change_distribution(random_number_generator), 0.0,
+                        1.0);
+                }
+            }
+            costs_per_tick.emplace_back(costs);
+        }
+
+        return costs_per_tick;
+    }
+
+    BenchmarkResult benchmarkMunkres(
+        const std::vector<Solver::CostMatrix>& costs_per_tick, size_t num_rows,
+        size_t num_cols)
+    {
+        BenchmarkResult result = {0, 0};
+        for (const auto& costs : costs_per_tick)
+        {
+            auto start_time = std::chrono::steady_clock::now();
+
+            // Like STP did, the rows are the robots and the columns are the tactics
+            Matrix<double> matrix(num_cols, num_rows);
+            for (size_t robot = 0; robot < num_cols; robot++)
+            {
+                for (size_t tactic = 0; tactic < num_rows; tactic++)
+                {
+                    matrix(robot, tactic) = costs[tactic][robot];
+                }
+            }
+
+            Munkres<double> munkres;
+            munkres.solve(matrix);
+
+            Solver::Assignment assignment;
+            for (size_t robot = 0; robot < num_cols; robot++)
+            {
+                for (size_t tactic = 0; tactic < num_rows; tactic++)
+                {
+                    if (matrix(robot, tactic) == 0)
+                    {
+                        assignment[tactic] = robot;
+                        break;
+                    }
+                }
+            }
+
+            result.mean_solve_time_microseconds += getMicrosecondsSince(start_time);
+            for (size_t tactic = 0; tactic < num_rows; tactic++)
+            {
+                result.total_cost += costs[tactic][assignment[tactic]];
+            }
+        }
+
+        result.mean_solve_time_microseconds /= costs_per_tick.size();
+        return result;
+    }
+
+    BenchmarkResult benchmarkAssignmentSolver(
+        const std::vector<Solver::CostMatrix>& costs_per_tick, size_t num_rows,
+        size_t num_cols, bool warm_start)
+    {
+        BenchmarkResult result = {0, 0};
+        Solver solver;
+        Solver::Assignment previous_assignment;
+        previous_assignment.fill(Solver::UNASSIGNED);
+        for (const auto& costs : costs_per_tick)
+        {
+            auto start_time = std::chrono::steady_clock::now();
+
+            const Solver::Assignment& assignment =
+                warm_start ? solver.solve(costs, num_rows, num_cols, previous_assignment)
+                           : solver.solve(costs, num_rows, num_cols);
+
+            result.mean_solve_time_microseconds += getMicrosecondsSince(start_time);
+            for (size_t tactic = 0; tactic < num_rows; tactic++)
+            {
+                result.total_cost += costs[tactic][assignment[tactic]];
+            }
+            previous_assignment = assignment;
+        }
+
+        result.mean_solve_time_microseconds /= costs_per_tick.size();
+        return result;
+    }
+
+    void printResult(const std::string& name, const BenchmarkResult& result)
+    {
+        std::cout << std::left << std::setw(10) << name << std::right << std::fixed
+                  << std::setprecision(2) << " mean: " << std::setw(8)
+                  << result.mean_solve_time_microseconds << "us"
+                  << " total cost: " << std::setprecision(4) << result.total_cost
+                  << std::endl;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    size_t num_ticks = 10000;
+    if (argc > 1)
+    {
+        num_ticks = static_cast<size_t>(std::atoi(argv[1]));
+    }
+
+    // The number of tactics and robots in some common situations: a full Division B
+    // team, a Division B team running one tactic less than it has robots, and a full
+    // Division A team
+    for (auto [num_tactics, num_robots] :
+         {std::make_pair(6, 6), std::make_pair(5, 6), std::make_pair(11, 11)})
+    {
+        auto costs_per_tick = createCosts(num_ticks, 0);
+
+        std::cout << num_tactics << " tactics and " << num_robots << " robots, "
+                  << num_ticks << " ticks" << std::endl;
+        printResult("munkres", benchmarkMunkres(costs_per_tick, num_tactics, num_robots));
+        printResult("cold", benchmarkAssignmentSolver(costs_per_tick, num_tactics,
+                                                      num_robots, false));
+        printResult("warm", benchmarkAssignmentSolver(costs_per_tick, num_tactics,
+                                                      num_robots, true));
+    }
+
+    return 0;
+}
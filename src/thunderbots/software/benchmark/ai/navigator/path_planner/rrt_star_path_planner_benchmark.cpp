@@ -0,0 +1,213 @@
+/**
+ * Measures how long the RRTStarPathPlanner takes, and how good its paths are, on
+ * crowded 11v11 scenes.
+ *
+ * Every scene has 22 robots placed randomly on a Division B field, moving slowly in
+ * random directions. One friendly robot plans a path to a random destination on the
+ * other half of the field around the other 21 robots. Each scene runs for a number of
+ * ticks, and every tick the robots move a little and the path is planned again.
+ *
+ * - The cold runs use a new planner every tick, so every search starts from scratch
+ * - The warm runs use the same planner for every tick of a scene, so each search
+ *   starts from the tree and path of the tick before
+ *
+ * For each budget this prints the mean time per search, the fraction of searches that
+ * found a path, and the mean length of the paths found relative to the straight line
+ * from the start to the destination.
+ *
+ * Usage: rrt_star_path_planner_benchmark [number of scenes] [ticks per scene]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "ai/navigator/obstacle/obstacle.h"
+#include "ai/navigator/path_planner/rrt_star_path_planner.h"
+
+namespace
+{
+    // The playable area of a Division B field
+    const Rectangle FIELD_AREA(Point(-4.5, -3), Point(4.5, 3));
+    const unsigned int NUM_ROBOTS = 22;
+    const double TICK_SECONDS     = 1.0 / 60;
+
+    struct Scene
+    {
+        // The robot that plans is the first robot
+        std::vector<Robot> robots;
+        Point destination;
+    };
+
+    Scene createScene(std::mt19937& random_number_generator)
+    {
+        std::uniform_real_distribution<double> x_distribution(-4.3, 4.3);
+        std::uniform_real_distribution<double> y_distribution(-2.8, 2.8);
+        std::uniform_real_distribution<double> speed_distribution(-0.5, 0.5);
+
+        Scene scene;
+        for (unsigned int id = 0; id < NUM_ROBOTS; id++)
+        {
+            Point position(x_distribution(random_number_generator),
+                           y_distribution(random_number_generator));
+            // Start the planning robot on one half of the field, so its destination on
+            // the other half is always far away
+            if (id == 0)
+            {
+                position = Point(-std::abs(position.x()), position.y());
+            }
+            scene.robots.emplace_back(id, position,
+                                      Vector(speed_distribution(random_number_generator),
+                                             speed_distribution(random_number_generator)),
+                                      Angle::zero(), AngularVelocity::zero(),
+                                      Timestamp::fromSeconds(0));
+        }
+        scene.destination = Point(std::abs(x_distribution(random_number_generator)),
+                                  y_distribution(random_number_generator));
+        return scene;
+    }
+
+    // Moves every robot along its velocity for one tick
+    void advanceScene(Scene& scene)
+    {
+        for (Robot& robot : scene.robots)
+        {
+            robot.updateState(
+                robot.position() + robot.velocity() * TICK_SECONDS, robot.velocity(),
+                robot.orientation(), robot.angularVelocity(),
+                robot.lastUpdateTimestamp() + Duration::fromSeconds(TICK_SECONDS));
+        }
+    }
+
+    struct BenchmarkResult
+    {
+        double mean_search_time_microseconds;
+        double fraction_of_paths_found;
+        double mean_path_length_ratio;
+    };
+
+    BenchmarkResult benchmark(const std::vector<Scene>& scenes, size_t ticks_per_scene,
+                              const Duration& time_budget, unsigned int max_iterations,
+                              bool warm_start)
+    {
+        double total_search_time_microseconds = 0;
+        double total_path_length_ratio        = 0;
+        size_t num_searches                   = 0;
+        size_t num_paths_found                = 0;
+
+        PathPlanner::ViolationFunction no_violation = [](const Point&) { return 0.0; };
+
+        for (Scene scene : scenes)
+        {
+            auto planner = std::make_unique<RRTStarPathPlanner>(FIELD_AREA, time_budget,
+                                                                max_iterations);
+            for (size_t tick = 0; tick < ticks_per_scene; tick++)
+            {
+                std::vector<Obstacle> obstacles;
+                for (auto robot = scene.robots.begin() + 1; robot != scene.robots.end();
+                     robot++)
+                {
+                    obstacles.emplace_back(Obstacle::createRobotObstacle(*robot, 2, 0.5));
+                }
+                if (!warm_start)
+                {
+                    planner = std::make_unique<RRTStarPathPlanner>(
+                        FIELD_AREA, time_budget, max_iterations, tick);
+                }
+
+                Point start     = scene.robots.front().position();
+                auto start_time = std::chrono::steady_clock::now();
+                auto path =
+                    planner->findPath(start, scene.destination, obstacles, no_violation);
+                total_search_time_microseconds +=
+                    std::chrono::duration<double, std::micro>(
+                        std::chrono::steady_clock::now() - start_time)
+                        .count();
+
+                num_searches++;
+                if (path)
+                {
+                    num_paths_found++;
+                    double path_length = 0;
+                    for (size_t i = 0; i + 1 < path->size(); i++)
+                    {
+                        path_length += ((*path)[i + 1] - (*path)[i]).len();
+                    }
+                    total_path_length_ratio +=
+                        path_length / (scene.destination - start).len();
+                }
+
+                advanceScene(scene);
+            }
+        }
+
+        return {total_search_time_microseconds / num_searches,
+                static_cast<double>(num_paths_found) / num_searches,
+                num_paths_found > 0 ? total_path_length_ratio / num_paths_found : 0};
+    }
+
+    void printResult(const std::string& name, const BenchmarkResult& result)
+    {
+        std::cout << "  " << std::setw(6) << name << std::fixed << std::setprecision(1)
+                  << " mean: " << std::setw(8) << result.mean_search_time_microseconds
+                  << "us" << std::setprecision(3)
+                  << " paths found: " << result.fraction_of_paths_found
+                  << " path length / straight line: " << result.mean_path_length_ratio
+                  << std::endl;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    size_t num_scenes      = 50;
+    size_t ticks_per_scene = 20;
+    if (argc > 1)
+    {
+        num_scenes = static_cast<size_t>(std::atoi(argv[1]));
+    }
+    if (argc > 2)
+    {
+        ticks_per_scene = static_cast<size_t>(std::atoi(argv[2]));
+    }
+
+    std::mt19937 random_number_generator(0);
+    std::vector<Scene> scenes;
+    for (size_t i = 0; i < num_scenes; i++)
+    {
+        scenes.emplace_back(createScene(random_number_generator));
+    }
+
+    std::cout << num_scenes << " scenes, " << ticks_per_scene << " ticks per scene"
+              << std::endl;
+
+    // Budgets limited only by iterations show how the paths improve with more samples
+    for (unsigned int max_iterations : {100, 250, 500, 1000, 2000})
+    {
+        std::cout << max_iterations << " iterations" << std::endl;
+        for (bool warm_start : {false, true})
+        {
+            printResult(warm_start ? "warm" : "cold",
+                        benchmark(scenes, ticks_per_scene, Duration::fromSeconds(10),
+                                  max_iterations, warm_start));
+        }
+    }
+
+    // Budgets limited only by time are what the AI would use
+    for (double milliseconds : {0.5, 1.0, 2.0, 5.0})
+    {
+        std::cout << milliseconds << "ms" << std::endl;
+        for (bool warm_start : {false, true})
+        {
+            printResult(
+                warm_start ? "warm" : "cold",
+                benchmark(scenes, ticks_per_scene,
+                          Duration::fromMilliseconds(milliseconds), 1000000, warm_start));
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,134 @@
+/**
+ * Measures how long it takes to plan and query the shared bang-bang trajectories.
+ *
+ * The AI plans one trajectory for every robot it evaluates a pass or an intercept
+ * for, and the motion controller and firmware plan one for every robot every tick, so
+ * planning needs to take a tiny fraction of a tick.
+ *
+ * Every trajectory starts from a random velocity and moves by a random displacement
+ * on a Division B field. For each kind of trajectory this prints the mean time to plan
+ * one, and the mean time to query its position and velocity.
+ *
+ * Usage: bang_bang_trajectory_benchmark [number of trajectories]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+extern "C"
+{
+#include "shared/bang_bang_trajectory.h"
+}
+
+namespace
+{
+    const double MAX_ACCELERATION = 3.0;
+    const double MAX_VELOCITY     = 2.0;
+
+    struct Inputs
+    {
+        double displacement[2];
+        double initial_velocity[2];
+        double final_velocity[2];
+    };
+
+    std::vector<Inputs> createInputs(size_t num_trajectories)
+    {
+        std::mt19937 random_number_generator(0);
+        std::uniform_real_distribution<double> x_distribution(-9, 9);
+        std::uniform_real_distribution<double> y_distribution(-6, 6);
+        std::uniform_real_distribution<double> velocity_distribution(-2, 2);
+
+        std::vector<Inputs> inputs(num_trajectories);
+        for (Inputs& input : inputs)
+        {
+            input.displacement[0]     = x_distribution(random_number_generator);
+            input.displacement[1]     = y_distribution(random_number_generator);
+            input.initial_velocity[0] = velocity_distribution(random_number_generator);
+            input.initial_velocity[1] = velocity_distribution(random_number_generator);
+            input.final_velocity[0]   = 0;
+            input.final_velocity[1]   = 0;
+        }
+        return inputs;
+    }
+
+    // Returns the nanoseconds per call it takes to run the given function on every
+    // input. The results are summed into checksum so they can not be optimized out
+    template <typename Function>
+    double timeNanosecondsPerCall(const std::vector<Inputs>& inputs, double& checksum,
+                                  Function function)
+    {
+        auto start_time = std::chrono::steady_clock::now();
+        for (const Inputs& input : inputs)
+        {
+            checksum += function(input);
+        }
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() -
+                                                        start_time)
+                   .count() /
+               inputs.size();
+    }
+
+    void printResult(const std::string& name, double nanoseconds_per_call)
+    {
+        std::cout << "  " << std::setw(14) << name << std::fixed << std::setprecision(1)
+                  << " mean: " << std::setw(8) << nanoseconds_per_call << "ns"
+                  << std::endl;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    size_t num_trajectories = 1000000;
+    if (argc > 1)
+    {
+        num_trajectories = static_cast<size_t>(std::atoi(argv[1]));
+    }
+
+    std::vector<Inputs> inputs = createInputs(num_trajectories);
+    double checksum            = 0;
+
+    std::cout << num_trajectories << " trajectories" << std::endl;
+
+    std::cout << "1D" << std::endl;
+    printResult("plan", timeNanosecondsPerCall(inputs, checksum, [](const Inputs& input) {
+                    BangBangTrajectory1D trajectory = planBangBangTrajectory1D(
+                        input.displacement[0], input.initial_velocity[0],
+                        input.final_velocity[0], MAX_ACCELERATION, MAX_VELOCITY);
+                    return getBangBangTrajectory1DDuration(&trajectory);
+                }));
+    printResult("plan and query",
+                timeNanosecondsPerCall(inputs, checksum, [](const Inputs& input) {
+                    BangBangTrajectory1D trajectory = planBangBangTrajectory1D(
+                        input.displacement[0], input.initial_velocity[0],
+                        input.final_velocity[0], MAX_ACCELERATION, MAX_VELOCITY);
+                    return getBangBangTrajectory1DPosition(&trajectory, 0.5) +
+                           getBangBangTrajectory1DVelocity(&trajectory, 0.5);
+                }));
+
+    std::cout << "2D" << std::endl;
+    printResult("plan", timeNanosecondsPerCall(inputs, checksum, [](const Inputs& input) {
+                    BangBangTrajectory2D trajectory = planBangBangTrajectory2D(
+                        input.displacement, input.initial_velocity, input.final_velocity,
+                        MAX_ACCELERATION, MAX_VELOCITY);
+                    return getBangBangTrajectory2DDuration(&trajectory);
+                }));
+    printResult("plan and query",
+                timeNanosecondsPerCall(inputs, checksum, [](const Inputs& input) {
+                    BangBangTrajectory2D trajectory = planBangBangTrajectory2D(
+                        input.displacement, input.initial_velocity, input.final_velocity,
+                        MAX_ACCELERATION, MAX_VELOCITY);
+                    double position[2], velocity[2];
+                    getBangBangTrajectory2DPosition(&trajectory, 0.5, position);
+                    getBangBangTrajectory2DVelocity(&trajectory, 0.5, velocity);
+                    return position[0] + position[1] + velocity[0] + velocity[1];
+                }));
+
+    std::cout << "checksum: " << checksum << std::endl;
+
+    return 0;
+}
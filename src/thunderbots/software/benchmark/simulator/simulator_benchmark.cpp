@@ -0,0 +1,115 @@
+/**
+ * Measures how much faster than real time the Simulator runs with full teams.
+ *
+ * Every scene has 11 robots on each team placed randomly on a Division B field. Each
+ * robot is given a MovePrimitive to a random destination, and every simulated second
+ * the robots are given new destinations, like the AI would give them new Primitives.
+ *
+ * This prints the mean wall time per simulated second, and how many times faster than
+ * real time that is.
+ *
+ * Usage: simulator_benchmark [number of scenes] [simulated seconds per scene]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "ai/primitive/move_primitive.h"
+#include "simulator/simulator.h"
+#include "test/test_util/test_util.h"
+
+namespace
+{
+    const unsigned int NUM_ROBOTS_PER_TEAM = 11;
+    // How often the AI would give the robots new Primitives
+    const Duration AI_TICK = Duration::fromSeconds(1.0 / 60);
+
+    // Returns a random point on a Division B field
+    Point createRandomPoint(std::mt19937& random_number_generator)
+    {
+        std::uniform_real_distribution<double> x_distribution(-4.3, 4.3);
+        std::uniform_real_distribution<double> y_distribution(-2.8, 2.8);
+        return Point(x_distribution(random_number_generator),
+                     y_distribution(random_number_generator));
+    }
+
+    World createScene(std::mt19937& random_number_generator)
+    {
+        World world = ::Test::TestUtil::createBlankTestingWorld();
+        for (Team* team : {&world.mutableFriendlyTeam(), &world.mutableEnemyTeam()})
+        {
+            for (unsigned int id = 0; id < NUM_ROBOTS_PER_TEAM; id++)
+            {
+                team->updateRobots({Robot(
+                    id, createRandomPoint(random_number_generator), Vector(),
+                    Angle::zero(), AngularVelocity::zero(), Timestamp::fromSeconds(0))});
+            }
+        }
+        world.updateBallState(Ball(createRandomPoint(random_number_generator),
+                                   Vector(1, 1), Timestamp::fromSeconds(0)));
+        return world;
+    }
+
+    std::vector<PrimitiveVariant> createPrimitives(std::mt19937& random_number_generator)
+    {
+        std::vector<PrimitiveVariant> primitives;
+        for (unsigned int id = 0; id < NUM_ROBOTS_PER_TEAM; id++)
+        {
+            primitives.emplace_back(MovePrimitive(
+                id, createRandomPoint(random_number_generator), Angle::zero(), 0));
+        }
+        return primitives;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    size_t num_scenes        = 20;
+    double seconds_per_scene = 30;
+    if (argc > 1)
+    {
+        num_scenes = static_cast<size_t>(std::atoi(argv[1]));
+    }
+    if (argc > 2)
+    {
+        seconds_per_scene = std::atof(argv[2]);
+    }
+
+    std::mt19937 random_number_generator(0);
+    double total_wall_seconds = 0;
+    for (size_t scene = 0; scene < num_scenes; scene++)
+    {
+        Simulator simulator(createScene(random_number_generator), scene);
+
+        auto start_time = std::chrono::steady_clock::now();
+        for (double simulated_seconds = 0; simulated_seconds < seconds_per_scene;
+             simulated_seconds += 1)
+        {
+            simulator.setFriendlyPrimitives(createPrimitives(random_number_generator));
+            simulator.setEnemyPrimitives(createPrimitives(random_number_generator));
+            // Step in AI ticks, so the World is read as often as the AI would read it
+            for (int tick = 0; tick < 60; tick++)
+            {
+                simulator.simulate(AI_TICK);
+            }
+        }
+        total_wall_seconds +=
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time)
+                .count();
+    }
+
+    double wall_milliseconds_per_simulated_second =
+        total_wall_seconds * 1000 / (num_scenes * seconds_per_scene);
+    std::cout << num_scenes << " scenes, " << seconds_per_scene
+              << " simulated seconds per scene" << std::endl
+              << std::fixed << std::setprecision(2) << "  mean: " << std::setw(8)
+              << wall_milliseconds_per_simulated_second << "ms per simulated second, "
+              << std::setprecision(0) << 1000 / wall_milliseconds_per_simulated_second
+              << "x real time" << std::endl;
+
+    return 0;
+}
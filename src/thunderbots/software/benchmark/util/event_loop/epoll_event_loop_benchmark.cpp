@@ -0,0 +1,143 @@
+/**
+ * Compares a main loop that polls for work in a busy loop, like radio_communication
+ * used to, with one that sleeps in an EpollEventLoop until work arrives.
+ *
+ * Each loop runs on its own thread. Another thread posts tasks to it after a short
+ * pause, as the ROS callbacks of radio_communication do with the Primitives they
+ * receive. The latency of each task is measured from just before it is posted to when
+ * the loop starts running it, which is the latency the loop adds on top of the work
+ * itself. The CPU time used by the loop thread is measured both while tasks are being
+ * posted, and while the loop is idle with nothing to do.
+ *
+ * Usage: epoll_event_loop_benchmark [number of tasks to post]
+ */
+
+#include <pthread.h>
+#include <time.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+#include "util/event_loop/epoll_event_loop.h"
+#include "util/time/latency_histogram.h"
+
+namespace
+{
+    // How long the poster waits between tasks
+    const std::chrono::microseconds POST_PERIOD(1000);
+    // How long the idle CPU usage is measured for
+    const std::chrono::seconds IDLE_PERIOD(2);
+    // How long the event driven loop sleeps for at most, like radio_communication
+    const Duration EVENT_DRIVEN_MAX_WAIT = Duration::fromMilliseconds(100);
+
+    struct LoopResult
+    {
+        LatencyHistogram latencies;
+        // The fraction of a core the loop thread used while tasks were being posted
+        double active_cpu_fraction;
+        // The fraction of a core the loop thread used while nothing was posted
+        double idle_cpu_fraction;
+    };
+
+    double getCurrentTimeSeconds()
+    {
+        return std::chrono::duration<double>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    double getThreadCPUTimeSeconds(std::thread& thread)
+    {
+        clockid_t clock;
+        pthread_getcpuclockid(thread.native_handle(), &clock);
+        timespec cpu_time;
+        clock_gettime(clock, &cpu_time);
+        return cpu_time.tv_sec + cpu_time.tv_nsec * 1e-9;
+    }
+
+    LoopResult benchmarkLoop(const Duration& max_wait, unsigned int num_tasks)
+    {
+        Util::EpollEventLoop event_loop;
+        std::atomic<bool> is_running(true);
+        std::atomic<unsigned int> num_tasks_run(0);
+        LoopResult result;
+
+        std::thread loop_thread([&]() {
+            while (is_running)
+            {
+                event_loop.runOnce(max_wait);
+            }
+        });
+
+        double idle_start_cpu_seconds = getThreadCPUTimeSeconds(loop_thread);
+        double idle_start_seconds     = getCurrentTimeSeconds();
+        std::this_thread::sleep_for(IDLE_PERIOD);
+        result.idle_cpu_fraction =
+            (getThreadCPUTimeSeconds(loop_thread) - idle_start_cpu_seconds) /
+            (getCurrentTimeSeconds() - idle_start_seconds);
+
+        double active_start_cpu_seconds = getThreadCPUTimeSeconds(loop_thread);
+        double active_start_seconds     = getCurrentTimeSeconds();
+        for (unsigned int i = 0; i < num_tasks; i++)
+        {
+            std::this_thread::sleep_for(POST_PERIOD);
+
+            double post_time_seconds = getCurrentTimeSeconds();
+            event_loop.post([&result, &num_tasks_run, post_time_seconds]() {
+                result.latencies.record(
+                    Duration::fromSeconds(getCurrentTimeSeconds() - post_time_seconds));
+                num_tasks_run++;
+            });
+        }
+        // Make sure the last task has run before the loop is stopped
+        while (num_tasks_run < num_tasks)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        result.active_cpu_fraction =
+            (getThreadCPUTimeSeconds(loop_thread) - active_start_cpu_seconds) /
+            (getCurrentTimeSeconds() - active_start_seconds);
+
+        is_running = false;
+        event_loop.wakeUp();
+        loop_thread.join();
+
+        return result;
+    }
+
+    void printResult(const std::string& name, const LoopResult& result)
+    {
+        std::cout << std::left << std::setw(14) << name << std::right << std::fixed
+                  << std::setprecision(1) << " p50: " << std::setw(8)
+                  << result.latencies.getPercentile(0.5).getMilliseconds() * 1000 << "us"
+                  << " p99: " << std::setw(8)
+                  << result.latencies.getPercentile(0.99).getMilliseconds() * 1000 << "us"
+                  << " max: " << std::setw(8)
+                  << result.latencies.getMaximum().getMilliseconds() * 1000 << "us"
+                  << " active CPU: " << std::setw(5) << result.active_cpu_fraction * 100
+                  << "%"
+                  << " idle CPU: " << std::setw(5) << result.idle_cpu_fraction * 100
+                  << "%" << std::endl;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    unsigned int num_tasks = 5000;
+    if (argc > 1)
+    {
+        num_tasks = static_cast<unsigned int>(std::atoi(argv[1]));
+    }
+
+    std::cout << "Posting " << num_tasks << " tasks, one every " << POST_PERIOD.count()
+              << "us" << std::endl;
+    // Polling without ever sleeping is what the old main loop did
+    printResult("busy_polling", benchmarkLoop(Duration::fromSeconds(0), num_tasks));
+    printResult("event_driven", benchmarkLoop(EVENT_DRIVEN_MAX_WAIT, num_tasks));
+
+    return 0;
+}
@@ -0,0 +1,236 @@
+/**
+ * Compares how long it takes to get a World from one thread to another through ROS and
+ * through a SharedWorldRing.
+ *
+ * - The ROS path converts the World to a ROS message, serializes it, sends it over a
+ *   unix socket, deserializes it and converts it back to a World. This is everything
+ *   roscpp does when a message is sent between two nodes on the same machine, except
+ *   that the real TCPROS transport goes through the loopback TCP stack, so the real
+ *   ROS latency is at least this high
+ * - The shared memory path converts the World to a WorldFrame, writes it to a
+ *   SharedWorldRing, waits for it on the reader side and converts it back to a World
+ *
+ * Each World is sent after a short pause, so the receiving thread is asleep when the
+ * World is sent, as it usually is in the real nodes. The latency of each World is
+ * measured from just before it is converted on the sending side to just after the
+ * World has been recreated on the receiving side.
+ *
+ * Usage: world_transport_benchmark [number of Worlds to send]
+ */
+
+#include <ros/serialization.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "thunderbots_msgs/World.h"
+#include "util/ros_messages.h"
+#include "util/shared_memory/shared_world_ring.h"
+#include "util/shared_memory/world_frame.h"
+#include "util/time/latency_histogram.h"
+
+namespace
+{
+    // How long the sender waits between Worlds
+    const std::chrono::microseconds SEND_PERIOD(500);
+    // The number of robots on each team in the World we send
+    const unsigned int NUM_ROBOTS_PER_TEAM = 8;
+
+    double getCurrentTimeSeconds()
+    {
+        return std::chrono::duration<double>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    World createBenchmarkWorld()
+    {
+        Field field(9.0, 6.0, 1.0, 2.0, 1.0, 0.3, 0.5);
+        Ball ball(Point(1, 2), Vector(-3, 4), Timestamp::fromSeconds(5));
+
+        Team friendly_team(Duration::fromMilliseconds(1000));
+        Team enemy_team(Duration::fromMilliseconds(1000));
+        std::vector<Robot> friendly_robots;
+        std::vector<Robot> enemy_robots;
+        for (unsigned int id = 0; id < NUM_ROBOTS_PER_TEAM; id++)
+        {
+            friendly_robots.emplace_back(
+                id, Point(-1, id * 0.3), Vector(0.5, 0), Angle::ofRadians(0.1 * id),
+                AngularVelocity::ofRadians(1), Timestamp::fromSeconds(5));
+            enemy_robots.emplace_back(
+                id, Point(1, id * 0.3), Vector(-0.5, 0), Angle::ofRadians(-0.1 * id),
+                AngularVelocity::ofRadians(-1), Timestamp::fromSeconds(5));
+        }
+        friendly_team.updateRobots(friendly_robots);
+        enemy_team.updateRobots(enemy_robots);
+        friendly_team.assignGoalie(0);
+
+        return World(field, ball, friendly_team, enemy_team);
+    }
+
+    // Reads exactly the given number of bytes from the socket
+    void readFully(int socket, uint8_t* data, size_t length)
+    {
+        while (length > 0)
+        {
+            ssize_t num_bytes_read = read(socket, data, length);
+            if (num_bytes_read <= 0)
+            {
+                std::cerr << "Failed to read from the socket" << std::endl;
+                std::exit(1);
+            }
+            data += num_bytes_read;
+            length -= static_cast<size_t>(num_bytes_read);
+        }
+    }
+
+    LatencyHistogram benchmarkROSTransport(const World& world, unsigned int num_worlds)
+    {
+        int sockets[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) != 0)
+        {
+            std::cerr << "Failed to create a socket pair" << std::endl;
+            std::exit(1);
+        }
+
+        LatencyHistogram latencies;
+        std::thread receiver_thread([&]() {
+            std::vector<uint8_t> buffer;
+            for (unsigned int i = 0; i < num_worlds; i++)
+            {
+                uint32_t message_length;
+                readFully(sockets[1], reinterpret_cast<uint8_t*>(&message_length),
+                          sizeof(message_length));
+                buffer.resize(message_length);
+                readFully(sockets[1], buffer.data(), message_length);
+
+                thunderbots_msgs::World world_msg;
+                ros::serialization::IStream stream(buffer.data(), message_length);
+                ros::serialization::deserialize(stream, world_msg);
+                World received_world =
+                    Util::ROSMessages::createWorldFromROSMessage(world_msg);
+
+                latencies.record(Duration::fromSeconds(
+                    getCurrentTimeSeconds() - world_msg.trace.world_publish_timestamp));
+            }
+        });
+
+        std::vector<uint8_t> buffer;
+        for (unsigned int i = 0; i < num_worlds; i++)
+        {
+            std::this_thread::sleep_for(SEND_PERIOD);
+
+            thunderbots_msgs::World world_msg;
+            world_msg.trace.frame_id                = i + 1;
+            world_msg.trace.world_publish_timestamp = getCurrentTimeSeconds();
+            world_msg.field = Util::ROSMessages::convertFieldToROSMessage(world.field());
+            world_msg.ball  = Util::ROSMessages::convertBallToROSMessage(world.ball());
+            world_msg.friendly_team =
+                Util::ROSMessages::convertTeamToROSMessage(world.friendlyTeam());
+            world_msg.enemy_team =
+                Util::ROSMessages::convertTeamToROSMessage(world.enemyTeam());
+
+            // Like roscpp, the serialized message is prefixed by its length
+            uint32_t message_length = ros::serialization::serializationLength(world_msg);
+            buffer.resize(sizeof(message_length) + message_length);
+            std::memcpy(buffer.data(), &message_length, sizeof(message_length));
+            ros::serialization::OStream stream(buffer.data() + sizeof(message_length),
+                                               message_length);
+            ros::serialization::serialize(stream, world_msg);
+
+            if (write(sockets[0], buffer.data(), buffer.size()) !=
+                static_cast<ssize_t>(buffer.size()))
+            {
+                std::cerr << "Failed to write to the socket" << std::endl;
+                std::exit(1);
+            }
+        }
+
+        receiver_thread.join();
+        close(sockets[0]);
+        close(sockets[1]);
+
+        return latencies;
+    }
+
+    LatencyHistogram benchmarkSharedMemoryTransport(const World& world,
+                                                    unsigned int num_worlds)
+    {
+        const std::string segment_name =
+            "/thunderbots_world_benchmark_" + std::to_string(getpid());
+        shm_unlink(segment_name.c_str());
+
+        Util::SharedWorldRingWriter writer(segment_name);
+        Util::SharedWorldRingReader reader(segment_name);
+
+        LatencyHistogram latencies;
+        std::thread receiver_thread([&]() {
+            // The reader skips any World it was too slow to read before the next one
+            // was written, so we stop once the last World arrives
+            Util::WorldFrame world_frame = {};
+            while (world_frame.trace.frame_id < num_worlds)
+            {
+                reader.waitForNewFrame(std::chrono::milliseconds(100));
+                if (!reader.readLatest(world_frame))
+                {
+                    continue;
+                }
+
+                World received_world = Util::createWorldFromWorldFrame(world_frame);
+                latencies.record(Duration::fromSeconds(
+                    getCurrentTimeSeconds() - world_frame.trace.world_publish_timestamp));
+            }
+        });
+
+        for (unsigned int i = 0; i < num_worlds; i++)
+        {
+            std::this_thread::sleep_for(SEND_PERIOD);
+
+            thunderbots_msgs::FrameTrace trace;
+            trace.frame_id                = i + 1;
+            trace.world_publish_timestamp = getCurrentTimeSeconds();
+            writer.write(Util::createWorldFrame(world, trace));
+        }
+
+        receiver_thread.join();
+        shm_unlink(segment_name.c_str());
+
+        return latencies;
+    }
+
+    void printLatencies(const std::string& name, const LatencyHistogram& latencies)
+    {
+        std::cout << std::left << std::setw(16) << name << std::right << std::fixed
+                  << std::setprecision(1) << " p50: " << std::setw(8)
+                  << latencies.getPercentile(0.5).getMilliseconds() * 1000 << "us"
+                  << " p99: " << std::setw(8)
+                  << latencies.getPercentile(0.99).getMilliseconds() * 1000 << "us"
+                  << " max: " << std::setw(8)
+                  << latencies.getMaximum().getMilliseconds() * 1000 << "us" << std::endl;
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    unsigned int num_worlds = 10000;
+    if (argc > 1)
+    {
+        num_worlds = static_cast<unsigned int>(std::atoi(argv[1]));
+    }
+
+    World world = createBenchmarkWorld();
+
+    std::cout << "Sending " << num_worlds << " Worlds with " << NUM_ROBOTS_PER_TEAM
+              << " robots per team" << std::endl;
+    printLatencies("ros", benchmarkROSTransport(world, num_worlds));
+    printLatencies("shared_memory", benchmarkSharedMemoryTransport(world, num_worlds));
+
+    return 0;
+}
@@ -0,0 +1,343 @@
+#include "fused_pipeline/fused_pipeline.h"
+
+#include <thunderbots_msgs/World.h>
+
+#include <boost/bind.hpp>
+#include <cerrno>
+#include <tuple>
+
+#include "util/constants.h"
+#include "util/logger/init.h"
+#include "util/ros_messages.h"
+#include "util/visualizer_messenger/visualizer_messenger.h"
+
+FusedPipeline::FusedPipeline(ros::NodeHandle& node_handle, OutputBackend output_backend,
+                             bool mirror_to_ros)
+    : ai(),
+      num_worlds_dropped(0),
+      num_primitives_dropped(0),
+      ai_latency_tracker("fused_pipeline_ai"),
+      output_latency_tracker("fused_pipeline_output"),
+      mirror_to_ros(mirror_to_ros),
+      is_running(true)
+{
+    sem_init(&world_queue_semaphore, 0, 0);
+    sem_init(&primitives_queue_semaphore, 0, 0);
+    sem_init(&mirror_queue_semaphore, 0, 0);
+
+    switch (output_backend)
+    {
+        case OutputBackend::GRSIM:
+            grsim_backend = std::make_unique<GrSimBackend>(
+                Util::Constants::GRSIM_COMMAND_NETWORK_ADDRESS,
+                Util::Constants::GRSIM_COMMAND_NETWORK_PORT);
+            grsim_command_sender = std::make_unique<GrSimCommandSender>(
+                Duration::fromSeconds(1.0 / Util::Constants::GRSIM_COMMAND_RATE_HZ),
+                [this](const std::vector<PrimitiveVariant>& primitives,
+                       const World& world, const Duration& delta_time) {
+                    grsim_backend->sendPrimitives(primitives, world.friendlyTeam(),
+                                                  world.ball(), delta_time);
+                });
+            break;
+        case OutputBackend::RADIO:
+            radio_event_loop = std::make_unique<Util::EpollEventLoop>();
+            mrf_backend      = std::make_unique<MRFBackend>();
+            mrf_backend->watch_dongle_events(*radio_event_loop);
+            break;
+    }
+
+    ai_latency_tracker.initializePublisher(node_handle);
+    output_latency_tracker.initializePublisher(node_handle);
+
+    if (mirror_to_ros)
+    {
+        world_publisher = node_handle.advertise<thunderbots_msgs::World>(
+            Util::Constants::NETWORK_INPUT_WORLD_TOPIC, 1);
+        primitive_publisher = node_handle.advertise<thunderbots_msgs::PrimitiveArray>(
+            Util::Constants::AI_PRIMITIVES_TOPIC, 1);
+        Util::VisualizerMessenger::getInstance()->initializePublisher(node_handle);
+        ros_mirror_thread = std::thread([this]() { runROSMirror(); });
+    }
+
+    // Start the stages from the back of the pipeline to the front, so that each stage
+    // is ready before anything can be queued for it
+    output_thread  = std::thread([this]() { runOutput(); });
+    ai_thread      = std::thread([this]() { runAI(); });
+    network_client = std::make_unique<NetworkClient>(
+        node_handle, boost::bind(&FusedPipeline::queueWorld, this, _1, _2));
+}
+
+FusedPipeline::~FusedPipeline()
+{
+    // Stop receiving data first, since the NetworkClient's threads queue data for the
+    // rest of the pipeline
+    network_client.reset();
+
+    // Posting to the semaphores wakes up any thread that is waiting for data, so that it
+    // sees the pipeline has stopped
+    is_running = false;
+    sem_post(&world_queue_semaphore);
+    sem_post(&primitives_queue_semaphore);
+    sem_post(&mirror_queue_semaphore);
+    if (radio_event_loop)
+    {
+        radio_event_loop->wakeUp();
+    }
+
+    ai_thread.join();
+    output_thread.join();
+    if (ros_mirror_thread.joinable())
+    {
+        ros_mirror_thread.join();
+    }
+
+    sem_destroy(&world_queue_semaphore);
+    sem_destroy(&primitives_queue_semaphore);
+    sem_destroy(&mirror_queue_semaphore);
+}
+
+void FusedPipeline::queueWorld(const World& world,
+                               const thunderbots_msgs::FrameTrace& trace)
+{
+    WorldFrame* world_frame = world_queue.startPush();
+    if (!world_frame)
+    {
+        // The queue only fills up if the AI has stalled, in which case the World will
+        // be stale by the time the AI gets to it anyway
+        num_worlds_dropped++;
+        return;
+    }
+
+    world_frame->world = world;
+    world_frame->trace = trace;
+    world_queue.finishPush();
+    sem_post(&world_queue_semaphore);
+}
+
+void FusedPipeline::runAI()
+{
+    while (true)
+    {
+        if (sem_wait(&world_queue_semaphore) != 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (!is_running)
+        {
+            break;
+        }
+
+        // There is no point running the AI on a World that has already been replaced by
+        // a newer one, so we skip straight to the most recent World. The semaphore was
+        // still posted for every skipped World, so the next few waits return with
+        // nothing left to do
+        while (world_queue.size() > 1)
+        {
+            world_queue.pop();
+        }
+        WorldFrame* world_frame = world_queue.front();
+        if (!world_frame)
+        {
+            continue;
+        }
+
+        double ai_start_timestamp = Util::LatencyTracker::getCurrentTimestamp();
+        const std::vector<PrimitiveVariant>& primitives =
+            ai.getPrimitives(world_frame->world);
+
+        thunderbots_msgs::FrameTrace trace = world_frame->trace;
+        trace.ai_start_timestamp           = ai_start_timestamp;
+        trace.primitives_publish_timestamp = Util::LatencyTracker::getCurrentTimestamp();
+
+        if (mirror_to_ros)
+        {
+            queueMirrorFrame(world_frame->world, primitives, trace);
+            Util::VisualizerMessenger::getInstance()->publishAndClearLayers();
+        }
+        else
+        {
+            // Nothing will ever publish the layers, so clear them so they do not grow
+            // forever
+            Util::VisualizerMessenger::getInstance()->clearLayers();
+        }
+
+        PrimitivesFrame* primitives_frame = primitives_queue.startPush();
+        if (primitives_frame)
+        {
+            primitives_frame->world = world_frame->world;
+            // Copying into the vector already in the queue reuses its memory
+            primitives_frame->primitives = primitives;
+            primitives_frame->trace      = trace;
+            primitives_queue.finishPush();
+            sem_post(&primitives_queue_semaphore);
+            if (radio_event_loop)
+            {
+                radio_event_loop->wakeUp();
+            }
+        }
+        else
+        {
+            num_primitives_dropped++;
+        }
+        world_queue.pop();
+
+        ai_latency_tracker.recordStageLatency(
+            "world_transport", trace.world_publish_timestamp, ai_start_timestamp);
+        ai_latency_tracker.recordStageLatency("ai_tick", ai_start_timestamp,
+                                              trace.primitives_publish_timestamp);
+        ai_latency_tracker.publishAndLogIfReportDue();
+    }
+}
+
+void FusedPipeline::runOutput()
+{
+    while (is_running)
+    {
+        if (!waitForPrimitives() || !is_running)
+        {
+            continue;
+        }
+
+        // Only the most recent Primitives are sent, since any older ones have already
+        // been replaced
+        while (primitives_queue.size() > 1)
+        {
+            primitives_queue.pop();
+        }
+        PrimitivesFrame* primitives_frame = primitives_queue.front();
+        if (!primitives_frame)
+        {
+            continue;
+        }
+
+        sendPrimitives(*primitives_frame, Util::LatencyTracker::getCurrentTimestamp());
+        primitives_queue.pop();
+
+        uint64_t worlds_dropped     = num_worlds_dropped.exchange(0);
+        uint64_t primitives_dropped = num_primitives_dropped.exchange(0);
+        if (worlds_dropped > 0 || primitives_dropped > 0)
+        {
+            LOG(WARNING) << "fused_pipeline dropped " << worlds_dropped << " Worlds and "
+                         << primitives_dropped
+                         << " sets of Primitives because a stage of the pipeline fell "
+                            "behind"
+                         << std::endl;
+        }
+    }
+}
+
+bool FusedPipeline::waitForPrimitives()
+{
+    if (mrf_backend)
+    {
+        if (sem_trywait(&primitives_queue_semaphore) == 0)
+        {
+            return true;
+        }
+        // If Primitives are queued after we checked, the AI thread wakes up the event
+        // loop, so this returns right away
+        mrf_backend->wait_for_dongle_events(
+            *radio_event_loop,
+            Duration::fromMilliseconds(RADIO_EVENT_LOOP_MAX_WAIT_MILLISECONDS));
+        return sem_trywait(&primitives_queue_semaphore) == 0;
+    }
+
+    return sem_wait(&primitives_queue_semaphore) == 0;
+}
+
+void FusedPipeline::sendPrimitives(const PrimitivesFrame& frame, double receive_timestamp)
+{
+    if (grsim_command_sender)
+    {
+        // The sender sends the latest Primitives to grSim at its own fixed rate, so the
+        // latency is recorded on its thread once they have actually been sent
+        grsim_command_sender->updateWorld(frame.world);
+        grsim_command_sender->updatePrimitives(
+            frame.primitives, [this, trace = frame.trace, receive_timestamp]() {
+                recordPrimitivesSent(trace, receive_timestamp);
+            });
+    }
+    else if (mrf_backend)
+    {
+        std::vector<std::tuple<uint8_t, Point, Angle>> robots;
+        for (const Robot& r : frame.world.friendlyTeam().getAllRobots())
+        {
+            robots.push_back(std::make_tuple(r.id(), r.position(), r.orientation()));
+        }
+
+        mrf_backend->update_robots(robots);
+        mrf_backend->update_ball(frame.world.ball());
+        mrf_backend->send_vision_packet();
+        mrf_backend->sendPrimitives(frame.primitives);
+        recordPrimitivesSent(frame.trace, receive_timestamp);
+    }
+}
+
+void FusedPipeline::recordPrimitivesSent(const thunderbots_msgs::FrameTrace& trace,
+                                         double receive_timestamp)
+{
+    output_latency_tracker.recordPrimitivesSent(
+        trace, receive_timestamp, Util::LatencyTracker::getCurrentTimestamp());
+    output_latency_tracker.publishAndLogIfReportDue();
+}
+
+void FusedPipeline::queueMirrorFrame(const World& world,
+                                     const std::vector<PrimitiveVariant>& primitives,
+                                     const thunderbots_msgs::FrameTrace& trace)
+{
+    MirrorFrame* mirror_frame = mirror_queue.startPush();
+    if (!mirror_frame)
+    {
+        // The mirror is only used for visualization, so it can always skip a frame
+        return;
+    }
+
+    mirror_frame->world = world;
+    mirror_frame->primitive_array.primitives.clear();
+    for (const auto& primitive : primitives)
+    {
+        mirror_frame->primitive_array.primitives.emplace_back(
+            getPrimitive(primitive).createMsg());
+    }
+    mirror_frame->primitive_array.trace = trace;
+    mirror_queue.finishPush();
+    sem_post(&mirror_queue_semaphore);
+}
+
+void FusedPipeline::runROSMirror()
+{
+    thunderbots_msgs::World world_msg;
+
+    while (true)
+    {
+        if (sem_wait(&mirror_queue_semaphore) != 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (!is_running)
+        {
+            break;
+        }
+
+        MirrorFrame* mirror_frame = mirror_queue.front();
+        if (!mirror_frame)
+        {
+            continue;
+        }
+
+        // The refbox data is not mirrored, since the World only stores the game state
+        // derived from it
+        const World& world = mirror_frame->world;
+        world_msg.field    = Util::ROSMessages::convertFieldToROSMessage(world.field());
+        world_msg.ball     = Util::ROSMessages::convertBallToROSMessage(world.ball());
+        world_msg.friendly_team =
+            Util::ROSMessages::convertTeamToROSMessage(world.friendlyTeam());
+        world_msg.enemy_team =
+            Util::ROSMessages::convertTeamToROSMessage(world.enemyTeam());
+        world_msg.trace = mirror_frame->primitive_array.trace;
+
+        world_publisher.publish(world_msg);
+        primitive_publisher.publish(mirror_frame->primitive_array);
+        mirror_queue.pop();
+    }
+}
@@ -0,0 +1,239 @@
+#pragma once
+
+#include <ros/ros.h>
+#include <semaphore.h>
+#include <thunderbots_msgs/FrameTrace.h>
+#include <thunderbots_msgs/PrimitiveArray.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "ai/ai.h"
+#include "ai/primitive/primitive_variant.h"
+#include "ai/world/world.h"
+#include "grsim_communication/grsim_backend.h"
+#include "grsim_communication/grsim_command_sender.h"
+#include "network_input/networking/network_client.h"
+#include "radio_communication/mrf_backend.h"
+#include "util/event_loop/epoll_event_loop.h"
+#include "util/latency_tracker/latency_tracker.h"
+#include "util/spsc_queue.h"
+
+/**
+ * The backends the FusedPipeline can send Primitives to the robots with
+ */
+enum class OutputBackend
+{
+    // Sends Primitives to simulated robots in grSim
+    GRSIM,
+    // Sends Primitives to real robots through the radio dongle
+    RADIO
+};
+
+/**
+ * Runs network_input, the AI and one of the robot communication backends in a single
+ * process. This does the same work as running the network_input, ai_logic and
+ * grsim_communication or radio_communication nodes, but without serializing every
+ * World and set of Primitives to a ROS message and sending it to another process.
+ *
+ * Each stage runs on its own thread, and the stages are connected by lock-free queues
+ * that carry the World and Primitive objects themselves:
+ * - The NetworkClient receives and filters data from the network, and queues every
+ *   updated World for the AI
+ * - The AI thread runs the AI on the most recent World in its queue, skipping any
+ *   older Worlds it did not get to in time, and queues the resulting Primitives
+ * - The output thread sends the most recent Primitives to the robots. For grSim it
+ *   hands them to a GrSimCommandSender, which runs the motion controller and sends
+ *   commands at a fixed rate on its own thread
+ *
+ * Nothing in the pipeline waits on ROS. If mirroring to ROS is enabled, the World and
+ * Primitives are also copied to a separate thread that converts them to ROS messages
+ * and publishes them for the visualizer and other tools. That thread is fed by a queue
+ * that drops data when it falls behind, so it can never slow down the pipeline.
+ */
+class FusedPipeline
+{
+   public:
+    /**
+     * Creates a new FusedPipeline and starts running it
+     *
+     * @param node_handle The NodeHandle the pipeline uses to publish its diagnostics
+     * and mirrored messages
+     * @param output_backend The backend to send Primitives to the robots with
+     * @param mirror_to_ros Whether to publish the World and Primitives over ROS
+     */
+    explicit FusedPipeline(ros::NodeHandle& node_handle, OutputBackend output_backend,
+                           bool mirror_to_ros);
+
+    /**
+     * Stops every stage of the pipeline and joins their threads
+     */
+    ~FusedPipeline();
+
+    // Delete the copy and assignment operators because this class really shouldn't need
+    // them and we don't want to risk doing anything nasty with the internal threading
+    // this class uses
+    FusedPipeline& operator=(const FusedPipeline&) = delete;
+    FusedPipeline(const FusedPipeline&)            = delete;
+
+   private:
+    // A World waiting to be given to the AI
+    struct WorldFrame
+    {
+        World world;
+        thunderbots_msgs::FrameTrace trace;
+    };
+
+    // Primitives waiting to be sent to the robots, along with the World they were
+    // created from
+    struct PrimitivesFrame
+    {
+        World world;
+        std::vector<PrimitiveVariant> primitives;
+        thunderbots_msgs::FrameTrace trace;
+    };
+
+    // The data waiting to be published over ROS. The Primitives are converted to a
+    // message by the AI thread, since the AI only keeps them until its next tick
+    struct MirrorFrame
+    {
+        World world;
+        thunderbots_msgs::PrimitiveArray primitive_array;
+    };
+
+    // The maximum number of frames that can be waiting in each queue. The AI and output
+    // threads only ever use the most recent frame, so these only need to be big enough
+    // that a short stall does not cause data to be dropped
+    static constexpr size_t WORLD_QUEUE_CAPACITY      = 8;
+    static constexpr size_t PRIMITIVES_QUEUE_CAPACITY = 8;
+    static constexpr size_t MIRROR_QUEUE_CAPACITY     = 4;
+
+    // The longest the output thread sleeps in the radio_event_loop before checking if
+    // the pipeline has stopped
+    static constexpr double RADIO_EVENT_LOOP_MAX_WAIT_MILLISECONDS = 100;
+
+    /**
+     * Adds a World to the queue of Worlds waiting for the AI. We give this function to
+     * the NetworkClient to call from its processing thread
+     *
+     * @param world The updated World
+     * @param trace The trace of the updated World
+     */
+    void queueWorld(const World& world, const thunderbots_msgs::FrameTrace& trace);
+
+    /**
+     * Runs the AI on the most recent queued World until the pipeline is destroyed
+     */
+    void runAI();
+
+    /**
+     * Sends the most recent queued Primitives to the robots until the pipeline is
+     * destroyed
+     */
+    void runOutput();
+
+    /**
+     * Publishes the queued World and Primitives over ROS until the pipeline is
+     * destroyed
+     */
+    void runROSMirror();
+
+    /**
+     * Copies a World and the Primitives created from it to the queue of data waiting to
+     * be published over ROS. The data is dropped if the queue is full
+     *
+     * @param world The World the Primitives were created from
+     * @param primitives The Primitives created from the World
+     * @param trace The trace of the Primitives
+     */
+    void queueMirrorFrame(const World& world,
+                          const std::vector<PrimitiveVariant>& primitives,
+                          const thunderbots_msgs::FrameTrace& trace);
+
+    /**
+     * Sends Primitives to the robots with whichever backend is in use, and records the
+     * latency of sending them once they have been sent
+     *
+     * @param frame The Primitives to send, and the World they were created from
+     * @param receive_timestamp When the output thread took the Primitives from the
+     * queue
+     */
+    void sendPrimitives(const PrimitivesFrame& frame, double receive_timestamp);
+
+    /**
+     * Records the latency of Primitives that have just been sent, and logs a summary if
+     * one is due. This is called from the output thread, or from the thread of the
+     * GrSimCommandSender when sending to grSim
+     *
+     * @param trace The trace of the frame the Primitives were created from
+     * @param receive_timestamp When the output thread took the Primitives from the
+     * queue
+     */
+    void recordPrimitivesSent(const thunderbots_msgs::FrameTrace& trace,
+                              double receive_timestamp);
+
+    /**
+     * Waits until the output thread may have Primitives to send. The radio backend must
+     * keep handling the dongle's events while it waits, so it sleeps in the
+     * radio_event_loop, which the AI thread wakes up when it queues Primitives
+     *
+     * @return true if a frame was queued, and false if the wait returned without one
+     */
+    bool waitForPrimitives();
+
+    // Our instance of the AI that decides what Primitives to run. Only used by the AI
+    // thread
+    AI ai;
+
+    // The backend that sends Primitives to the robots. Only one of these exists,
+    // depending on the backend in use. The MRFBackend is only used by the output
+    // thread, and the GrSimBackend is only used by the thread of the
+    // GrSimCommandSender, which the output thread gives the latest Primitives to
+    std::unique_ptr<GrSimBackend> grsim_backend;
+    std::unique_ptr<GrSimCommandSender> grsim_command_sender;
+    // The output thread sleeps in this event loop while it waits for Primitives, so
+    // that it can handle the dongle's events as soon as they happen. It is declared
+    // before the MRFBackend so that it outlives it
+    std::unique_ptr<Util::EpollEventLoop> radio_event_loop;
+    std::unique_ptr<MRFBackend> mrf_backend;
+
+    // The queues connecting each stage of the pipeline to the next
+    Util::SPSCQueue<WorldFrame, WORLD_QUEUE_CAPACITY> world_queue;
+    Util::SPSCQueue<PrimitivesFrame, PRIMITIVES_QUEUE_CAPACITY> primitives_queue;
+    Util::SPSCQueue<MirrorFrame, MIRROR_QUEUE_CAPACITY> mirror_queue;
+
+    // Each semaphore is posted once for every frame pushed onto the matching queue, so
+    // that the consuming thread can sleep until there is work to do
+    sem_t world_queue_semaphore;
+    sem_t primitives_queue_semaphore;
+    sem_t mirror_queue_semaphore;
+
+    // How many frames have been dropped because their queue was full
+    std::atomic<uint64_t> num_worlds_dropped;
+    std::atomic<uint64_t> num_primitives_dropped;
+
+    // Measures the latency of the stages run by the AI and output threads. Each thread
+    // has its own tracker so that neither needs to be thread-safe. When sending to
+    // grSim, the output tracker is only used by the thread of the GrSimCommandSender
+    Util::LatencyTracker ai_latency_tracker;
+    Util::LatencyTracker output_latency_tracker;
+
+    // The publishers used to mirror the pipeline's data over ROS, if mirroring is
+    // enabled
+    bool mirror_to_ros;
+    ros::Publisher world_publisher;
+    ros::Publisher primitive_publisher;
+
+    // Cleared when the pipeline is destroyed to stop every thread
+    std::atomic<bool> is_running;
+
+    std::thread ai_thread;
+    std::thread output_thread;
+    std::thread ros_mirror_thread;
+
+    // Receives and filters data from the network. This is created last, once every
+    // other stage is ready for data
+    std::unique_ptr<NetworkClient> network_client;
+};
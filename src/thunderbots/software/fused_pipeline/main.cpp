@@ -0,0 +1,58 @@
+#include <ros/ros.h>
+
+#include <string>
+
+#include "fused_pipeline/fused_pipeline.h"
+#include "util/logger/init.h"
+#include "util/parameter/dynamic_parameter_utils.h"
+#include "util/parameter/dynamic_parameters.h"
+
+int main(int argc, char** argv)
+{
+    // Init ROS node
+    ros::init(argc, argv, "fused_pipeline");
+    ros::NodeHandle node_handle;
+
+    // Initialize the logger
+    Util::Logger::LoggerSingleton::initializeLogger(node_handle);
+
+    // The pipeline is configured with the following private ROS parameters:
+    // - backend: The backend to send Primitives to the robots with, either "grsim" or
+    //   "radio". Defaults to "grsim"
+    // - mirror_to_ros: Whether to publish the World and Primitives over ROS for the
+    //   visualizer. Defaults to false
+    // The NetworkClient's parameters for recording and replaying packet logs can also be
+    // given to this node
+    ros::NodeHandle private_node_handle("~");
+    std::string backend_name;
+    bool mirror_to_ros;
+    private_node_handle.param<std::string>("backend", backend_name, "grsim");
+    private_node_handle.param<bool>("mirror_to_ros", mirror_to_ros, false);
+
+    OutputBackend output_backend = OutputBackend::GRSIM;
+    if (backend_name == "radio")
+    {
+        output_backend = OutputBackend::RADIO;
+    }
+    else if (backend_name != "grsim")
+    {
+        // LOG(FATAL) will terminate the fused_pipeline process
+        LOG(FATAL) << "Unknown backend \"" << backend_name
+                   << "\". The backend must be either \"grsim\" or \"radio\""
+                   << std::endl;
+    }
+
+    // Create and start our pipeline
+    FusedPipeline pipeline(node_handle, output_backend, mirror_to_ros);
+
+    // Initialize Dynamic Parameters
+    auto update_subscribers =
+        Util::DynamicParameters::initUpdateSubscriptions(node_handle);
+
+    // Services any ROS calls in a separate thread "behind the scenes". Does not return
+    // until the node is shutdown
+    // http://wiki.ros.org/roscpp/Overview/Callbacks%20and%20Spinning
+    ros::spin();
+
+    return 0;
+}
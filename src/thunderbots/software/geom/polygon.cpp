@@ -30,24 +30,32 @@ Polygon::Polygon(const std::initializer_list<Point>& _points)
 
 bool Polygon::containsPoint(const Point& point) const
 {
-    // cast a ray from the point in the +x direction
-    Ray ray(point, point + Point(1, 0));
-    unsigned int num_intersections = 0;
+    // Count how many times a ray cast from the point in the +x direction crosses the
+    // polygon. Each segment is treated as including its lower end but not its upper
+    // end, so a ray passing exactly through a vertex is only counted once, and no
+    // floating point comparisons with a tolerance are needed
+    bool inside = false;
     for (const Segment& seg : segments)
     {
-        // one-definition rule, use anonymous namespace for
-        // intersects() in geom/util.h
-        if (::intersects(ray, seg))
+        const Point& start = seg.getSegStart();
+        const Point& end   = seg.getEnd();
+        if ((start.y() > point.y()) != (end.y() > point.y()))
         {
-            num_intersections++;
+            double crossing_x = start.x() + (point.y() - start.y()) *
+                                                (end.x() - start.x()) /
+                                                (end.y() - start.y());
+            if (point.x() < crossing_x)
+            {
+                inside = !inside;
+            }
         }
     }
 
-    // if the ray intersects the polygon an odd number of times,
+    // if the ray crosses the polygon an odd number of times,
     // it is inside the polygon, otherwise it is outside the polygon
     // see
     // https://stackoverflow.com/questions/217578/how-can-i-determine-whether-a-2d-point-is-within-a-polygon
-    return num_intersections % 2 != 0;
+    return inside;
 }
 
 bool Polygon::intersects(const Segment& segment) const
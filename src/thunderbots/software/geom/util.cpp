@@ -240,6 +240,13 @@ bool intersects(const Segment &first, const Segment &second)
     if (sign((first.getSegStart() - first.getEnd())
                  .cross(second.getSegStart() - second.getEnd())) == 0)
     {
+        // parallel segments that are not on the same line never intersect
+        if (sign((first.getEnd() - first.getSegStart())
+                     .cross(second.getSegStart() - first.getSegStart())) != 0)
+        {
+            return false;
+        }
+
         // find distance of two endpoints on segments furthest away from each
         // other
         double mx_len = std::sqrt(
@@ -1,9 +1,8 @@
 #include "grsim_communication/grsim_backend.h"
 
-#include <chrono>
 #include <optional>
 
-#include "ai/primitive/primitive.h"
+#include "ai/primitive/primitive_variant.h"
 #include "ai/world/team.h"
 #include "grsim_backend.h"
 #include "grsim_command_primitive_visitor.h"
@@ -31,7 +30,13 @@ template <class... Ts>
 overload(Ts...)->overload<Ts...>;
 
 GrSimBackend::GrSimBackend(std::string network_address, unsigned short port)
-    : network_address(network_address), port(port), socket(io_service)
+    : motion_controller(ROBOT_MAX_SPEED_METERS_PER_SECOND,
+                        ROBOT_MAX_ANG_SPEED_RAD_PER_SECOND,
+                        ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED,
+                        ROBOT_MAX_ANG_ACCELERATION_RAD_PER_SECOND_SQUARED),
+      network_address(network_address),
+      port(port),
+      socket(io_service)
 {
     socket.open(ip::udp::v4());
     remote_endpoint = ip::udp::endpoint(ip::address::from_string(network_address), port);
@@ -42,35 +47,32 @@ GrSimBackend::~GrSimBackend()
     socket.close();
 }
 
-void GrSimBackend::sendPrimitives(
-    const std::vector<std::unique_ptr<Primitive>>& primitives, const Team& friendly_team,
-    const Ball& ball)
+void GrSimBackend::sendPrimitives(const std::vector<PrimitiveVariant>& primitives,
+                                  const Team& friendly_team, const Ball& ball,
+                                  const Duration& delta_time)
 {
-    // TODO: Can't replace this timestamp as part of issue #228 because the Timestamp
-    // class doesn't support absolute "wall time". This function will need to be
-    // changed to make use of the timestamps stored with the robots
-    // https://github.com/UBC-Thunderbots/Software/issues/279
-    //
-    // initial timestamp for bang-bang set as current time
-    static auto bangbang_timestamp = std::chrono::steady_clock::now();
-
-    std::chrono::duration<double> delta_time =
-        std::chrono::steady_clock::now() - bangbang_timestamp;
-
-    MotionController motionController(ROBOT_MAX_SPEED_METERS_PER_SECOND,
-                                      ROBOT_MAX_ANG_SPEED_RAD_PER_SECOND,
-                                      ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED,
-                                      ROBOT_MAX_ANG_ACCELERATION_RAD_PER_SECOND_SQUARED);
+    sendGrSimPacket(
+        createGrSimPacketWithPrimitives(primitives, friendly_team, ball, delta_time));
+}
+
+grSim_Packet GrSimBackend::createGrSimPacketWithPrimitives(
+    const std::vector<PrimitiveVariant>& primitives, const Team& friendly_team,
+    const Ball& ball, const Duration& delta_time)
+{
+    grSim_Packet packet;
+    packet.mutable_commands()->set_isteamyellow(true);
+    packet.mutable_commands()->set_timestamp(0.0);
 
     for (auto& prim : primitives)
     {
-        if (friendly_team.getRobotById(prim->getRobotId()))
+        unsigned int robot_id = getPrimitive(prim).getRobotId();
+        if (friendly_team.getRobotById(robot_id))
         {
-            Robot robot = *friendly_team.getRobotById(prim->getRobotId());
+            Robot robot = *friendly_team.getRobotById(robot_id);
 
             GrsimCommandPrimitiveVisitor grsim_command_primitive_visitor =
                 GrsimCommandPrimitiveVisitor(robot, ball);
-            prim->accept(grsim_command_primitive_visitor);
+            visitPrimitive(prim, grsim_command_primitive_visitor);
 
             std::variant<MotionController::PositionCommand,
                          MotionController::VelocityCommand>
@@ -78,8 +80,8 @@ void GrSimBackend::sendPrimitives(
                     grsim_command_primitive_visitor.getMotionControllerCommand();
 
             MotionController::Velocity robot_velocities =
-                motionController.bangBangVelocityController(robot, delta_time.count(),
-                                                            motion_controller_command);
+                motion_controller.bangBangVelocityController(
+                    robot, delta_time.getSeconds(), motion_controller_command);
 
             double kick_speed_meters_per_second;
             bool chip_instead_of_kick;
@@ -103,19 +105,14 @@ void GrSimBackend::sendPrimitives(
                          }},
                 motion_controller_command);
 
-            // send the velocity data via grsim_packet
-            grSim_Packet grsim_packet = createGrSimPacketWithRobotVelocity(
-                prim->getRobotId(), YELLOW, robot_velocities.linear_velocity,
-                robot_velocities.angular_velocity, kick_speed_meters_per_second,
-                chip_instead_of_kick, dribbler_on);
-
-            sendGrSimPacket(grsim_packet);
+            addGrSimRobotCommand(packet, robot_id, robot_velocities.linear_velocity,
+                                 robot_velocities.angular_velocity,
+                                 kick_speed_meters_per_second, chip_instead_of_kick,
+                                 dribbler_on);
         }
     }
 
-    // timestamp of when the motion controller was last run (to be used for calculating
-    // delta_time in the future)
-    bangbang_timestamp = std::chrono::steady_clock::now();
+    return packet;
 }
 
 grSim_Packet GrSimBackend::createGrSimPacketWithRobotVelocity(
@@ -127,6 +124,18 @@ grSim_Packet GrSimBackend::createGrSimPacketWithRobotVelocity(
 
     packet.mutable_commands()->set_isteamyellow(team_colour == YELLOW);
     packet.mutable_commands()->set_timestamp(0.0);
+    addGrSimRobotCommand(packet, robot_id, robot_velocity, angular_velocity,
+                         kick_speed_meters_per_second, chip, dribbler_on);
+
+    return packet;
+}
+
+void GrSimBackend::addGrSimRobotCommand(grSim_Packet& packet, unsigned int robot_id,
+                                        Vector robot_velocity,
+                                        AngularVelocity angular_velocity,
+                                        double kick_speed_meters_per_second, bool chip,
+                                        bool dribbler_on)
+{
     grSim_Robot_Command* robot_command = packet.mutable_commands()->add_robot_commands();
 
     robot_command->set_id(robot_id);
@@ -146,8 +155,6 @@ grSim_Packet GrSimBackend::createGrSimPacketWithRobotVelocity(
     robot_command->set_kickspeedz(
         static_cast<float>(chip ? kick_speed_meters_per_second : 0.0));
     robot_command->set_spinner(dribbler_on);
-
-    return packet;
 }
 
 void GrSimBackend::setBallState(Point destination, Vector velocity)
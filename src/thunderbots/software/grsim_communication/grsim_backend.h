@@ -5,11 +5,13 @@
 #include <boost/asio.hpp>
 #include <string>
 
-#include "ai/primitive/primitive.h"
+#include "ai/primitive/primitive_variant.h"
 #include "ai/world/team.h"
 #include "geom/angle.h"
 #include "geom/point.h"
+#include "grsim_communication/motion_controller.h"
 #include "proto/grSim_Packet.pb.h"
+#include "util/time/duration.h"
 
 
 class GrSimBackend
@@ -26,13 +28,36 @@ class GrSimBackend
     ~GrSimBackend();
 
     /**
-     * Sends the given primitives to be simulated in grSim
+     * Sends the given primitives to be simulated in grSim. The commands for every robot
+     * are sent together in a single packet
      *
      * @param primitives the list of primitives to send
      * @param friendly_team A Team object containing the latest data for the friendly team
+     * @param ball The latest data for the ball
+     * @param delta_time How long it has been since the commands for the robots were
+     * last sent, which the motion controller uses to limit the acceleration of the
+     * robots
      */
-    void sendPrimitives(const std::vector<std::unique_ptr<Primitive>>& primitives,
-                        const Team& friendly_team, const Ball& ball);
+    void sendPrimitives(const std::vector<PrimitiveVariant>& primitives,
+                        const Team& friendly_team, const Ball& ball,
+                        const Duration& delta_time);
+
+    /**
+     * Creates a single grSim Packet protobuf message with a command for every robot
+     * that has a primitive. Primitives for robots that are not on the friendly team are
+     * ignored. This function is left public so it is easy to test.
+     *
+     * @param primitives the list of primitives to create commands from
+     * @param friendly_team A Team object containing the latest data for the friendly team
+     * @param ball The latest data for the ball
+     * @param delta_time How long it has been since the commands for the robots were
+     * last sent
+     *
+     * @return A grSim Packet with a command for every robot that has a primitive
+     */
+    grSim_Packet createGrSimPacketWithPrimitives(
+        const std::vector<PrimitiveVariant>& primitives, const Team& friendly_team,
+        const Ball& ball, const Duration& delta_time);
 
     /**
      * Creates a grSim Packet protobuf message given velocity information for a robot.
@@ -90,6 +115,18 @@ class GrSimBackend
     grSim_Packet createGrSimReplacementWithBallState(Point destination, Vector velocity);
 
    private:
+    /**
+     * Adds a command with the given velocity information for a robot to a grSim
+     * Packet. See createGrSimPacketWithRobotVelocity for the meaning of the parameters
+     *
+     * @param packet The packet to add the command to
+     */
+    static void addGrSimRobotCommand(grSim_Packet& packet, unsigned int robot_id,
+                                     Vector robot_velocity,
+                                     AngularVelocity angular_velocity,
+                                     double kick_speed_meters_per_second, bool chip,
+                                     bool dribbler_on);
+
     /**
      * Sends a grSim packet to grSim via UDP
      *
@@ -97,6 +134,8 @@ class GrSimBackend
      */
     void sendGrSimPacket(const grSim_Packet& packet);
 
+    MotionController motion_controller;
+
     // Variables for networking
     std::string network_address;
     unsigned short port;
@@ -0,0 +1,200 @@
+#include "grsim_communication/grsim_command_sender.h"
+
+#include <iomanip>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#include "util/constants.h"
+#include "util/logger/init.h"
+
+namespace
+{
+    Duration toDuration(const std::chrono::steady_clock::duration& duration)
+    {
+        return Duration::fromSeconds(std::chrono::duration<double>(duration).count());
+    }
+}  // namespace
+
+GrSimCommandSender::GrSimCommandSender(const Duration& send_period,
+                                       SendFunction send_function)
+    : send_period(std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+          std::chrono::duration<double>(send_period.getSeconds()))),
+      send_function(send_function),
+      latest_primitives(),
+      latest_primitives_sent_callback(),
+      latest_world(),
+      has_new_primitives(false),
+      has_new_world(false),
+      is_running(true),
+      cycle_primitives(),
+      cycle_primitives_sent_callback(),
+      cycle_world(),
+      statistics(),
+      num_packets_since_report(0),
+      num_missed_cycles_since_report(0),
+      jitter_since_report(),
+      time_last_reported(std::chrono::steady_clock::now())
+{
+    if (this->send_period <= std::chrono::steady_clock::duration::zero())
+    {
+        throw std::invalid_argument(
+            "Error: The send period of a GrSimCommandSender must be positive");
+    }
+
+    sender_thread = std::thread([this]() { runCycles(); });
+}
+
+GrSimCommandSender::~GrSimCommandSender()
+{
+    {
+        std::lock_guard<std::mutex> update_lock(update_mutex);
+        is_running = false;
+    }
+    stopped.notify_one();
+    sender_thread.join();
+}
+
+void GrSimCommandSender::updatePrimitives(const std::vector<PrimitiveVariant>& primitives,
+                                          PrimitivesSentCallback primitives_sent_callback)
+{
+    std::lock_guard<std::mutex> update_lock(update_mutex);
+    latest_primitives               = primitives;
+    latest_primitives_sent_callback = std::move(primitives_sent_callback);
+    has_new_primitives              = true;
+}
+
+void GrSimCommandSender::updateWorld(const World& world)
+{
+    std::lock_guard<std::mutex> update_lock(update_mutex);
+    latest_world  = world;
+    has_new_world = true;
+}
+
+GrSimCommandSender::Statistics GrSimCommandSender::getStatistics() const
+{
+    std::lock_guard<std::mutex> statistics_lock(statistics_mutex);
+    return statistics;
+}
+
+void GrSimCommandSender::runCycles()
+{
+    std::chrono::steady_clock::time_point scheduled_time =
+        std::chrono::steady_clock::now();
+    std::optional<std::chrono::steady_clock::time_point> previous_send_time;
+    bool has_primitives = false;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> update_lock(update_mutex);
+            if (stopped.wait_until(update_lock, scheduled_time,
+                                   [this]() { return !is_running; }))
+            {
+                break;
+            }
+
+            // Swapping avoids copying the Primitives and World while we hold the lock
+            if (has_new_primitives)
+            {
+                std::swap(cycle_primitives, latest_primitives);
+                std::swap(cycle_primitives_sent_callback,
+                          latest_primitives_sent_callback);
+                has_new_primitives = false;
+                has_primitives     = true;
+            }
+            if (has_new_world)
+            {
+                std::swap(cycle_world, latest_world);
+                has_new_world = false;
+            }
+        }
+
+        auto cycle_start_time = std::chrono::steady_clock::now();
+        auto jitter           = cycle_start_time - scheduled_time;
+
+        // Skip any cycles that should already have started, rather than trying to
+        // catch up on them
+        scheduled_time += send_period;
+        unsigned long num_missed_cycles = 0;
+        if (scheduled_time <= cycle_start_time)
+        {
+            num_missed_cycles = (cycle_start_time - scheduled_time) / send_period + 1;
+            scheduled_time += send_period * num_missed_cycles;
+        }
+
+        if (!has_primitives)
+        {
+            continue;
+        }
+
+        std::chrono::steady_clock::duration delta_time =
+            previous_send_time ? cycle_start_time - *previous_send_time : send_period;
+        previous_send_time = cycle_start_time;
+        send_function(cycle_primitives, cycle_world, toDuration(delta_time));
+        if (cycle_primitives_sent_callback)
+        {
+            cycle_primitives_sent_callback();
+            cycle_primitives_sent_callback = nullptr;
+        }
+
+        recordCycle(jitter, num_missed_cycles, cycle_start_time);
+    }
+}
+
+void GrSimCommandSender::recordCycle(
+    const std::chrono::steady_clock::duration& jitter, unsigned long num_missed_cycles,
+    const std::chrono::steady_clock::time_point& cycle_start_time)
+{
+    {
+        std::lock_guard<std::mutex> statistics_lock(statistics_mutex);
+        if (statistics.num_packets_sent == 0)
+        {
+            first_packet_time = cycle_start_time;
+        }
+        statistics.num_packets_sent++;
+        statistics.num_missed_cycles += num_missed_cycles;
+        statistics.jitter.record(toDuration(jitter));
+
+        double seconds_since_first_packet =
+            std::chrono::duration<double>(cycle_start_time - first_packet_time).count();
+        if (seconds_since_first_packet > 0)
+        {
+            statistics.packets_per_second =
+                (statistics.num_packets_sent - 1) / seconds_since_first_packet;
+        }
+    }
+
+    num_packets_since_report++;
+    num_missed_cycles_since_report += num_missed_cycles;
+    jitter_since_report.record(toDuration(jitter));
+
+    std::chrono::duration<double> time_since_report =
+        cycle_start_time - time_last_reported;
+    if (time_since_report <
+        std::chrono::seconds(Util::Constants::LATENCY_REPORT_PERIOD_SECONDS))
+    {
+        return;
+    }
+
+    std::stringstream summary;
+    summary << std::fixed << std::setprecision(3) << "Sent " << num_packets_since_report
+            << " grSim packets at "
+            << num_packets_since_report / time_since_report.count()
+            << " Hz, with a jitter of "
+            << jitter_since_report.getPercentile(0.5).getMilliseconds() << " / "
+            << jitter_since_report.getPercentile(0.99).getMilliseconds() << " / "
+            << jitter_since_report.getMaximum().getMilliseconds()
+            << " ms (p50 / p99 / max)";
+    if (num_missed_cycles_since_report > 0)
+    {
+        summary << " and " << num_missed_cycles_since_report << " missed cycles";
+    }
+    LOG(INFO) << summary.str() << std::endl;
+
+    time_last_reported             = cycle_start_time;
+    num_packets_since_report       = 0;
+    num_missed_cycles_since_report = 0;
+    jitter_since_report.reset();
+}
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ai/primitive/primitive_variant.h"
+#include "ai/world/world.h"
+#include "util/time/duration.h"
+#include "util/time/latency_histogram.h"
+
+/**
+ * Sends commands to grSim on its own thread at a fixed rate, independent of how often
+ * the AI publishes Primitives or the World is updated.
+ *
+ * Every cycle the latest Primitives are sent with the latest World, so the motion
+ * controller runs at the same rate no matter where the Primitives come from, and is
+ * always given the real time since the previous cycle. Nothing is sent until the first
+ * Primitives arrive.
+ *
+ * Every cycle starts at a fixed time after the previous one was scheduled, so that the
+ * rate doesn't drift. How late each cycle starts (its jitter) and how many packets
+ * have been sent are recorded in the Statistics of the sender, and a summary is logged
+ * every reporting period. If the sender falls more than a whole period behind, the
+ * cycles it missed are skipped and counted rather than sent in a burst.
+ */
+class GrSimCommandSender
+{
+   public:
+    // Sends the given Primitives for the robots in the World to grSim, given the time
+    // since the previous cycle, like GrSimBackend::sendPrimitives does
+    using SendFunction = std::function<void(const std::vector<PrimitiveVariant>&,
+                                            const World&, const Duration&)>;
+
+    // Called from the thread of the sender right after a set of Primitives is sent for
+    // the first time
+    using PrimitivesSentCallback = std::function<void()>;
+
+    /**
+     * The statistics of every cycle since the sender was created
+     */
+    struct Statistics
+    {
+        // How many cycles have sent a packet
+        unsigned long num_packets_sent = 0;
+        // How many cycles were skipped because the sender fell behind
+        unsigned long num_missed_cycles = 0;
+        // The average number of packets sent per second since the first one
+        double packets_per_second = 0;
+        // How late each cycle that sent a packet started
+        LatencyHistogram jitter;
+    };
+
+    /**
+     * Creates a new GrSimCommandSender and starts its thread
+     *
+     * @param send_period The time between the start of two cycles
+     * @param send_function The function that sends the commands for each cycle. It is
+     * only called from the thread of this sender
+     *
+     * @throws std::invalid_argument if the send_period is not positive
+     */
+    explicit GrSimCommandSender(const Duration& send_period, SendFunction send_function);
+
+    /**
+     * Stops the thread of this sender, after waiting for the current cycle to finish
+     */
+    ~GrSimCommandSender();
+
+    GrSimCommandSender& operator=(const GrSimCommandSender&) = delete;
+    GrSimCommandSender(const GrSimCommandSender&)            = delete;
+
+    /**
+     * Gives the sender new Primitives to send, replacing the previous ones. This never
+     * waits for a cycle to finish, and can be called from any thread
+     *
+     * @param primitives The new Primitives
+     * @param primitives_sent_callback Called once these Primitives have been sent for
+     * the first time, for example to measure the latency of sending them. It is not
+     * called if they are replaced before they are sent
+     */
+    void updatePrimitives(const std::vector<PrimitiveVariant>& primitives,
+                          PrimitivesSentCallback primitives_sent_callback = nullptr);
+
+    /**
+     * Gives the sender a new World to send the Primitives with. This never waits for a
+     * cycle to finish, and can be called from any thread
+     *
+     * @param world The new World
+     */
+    void updateWorld(const World& world);
+
+    /**
+     * Returns the statistics of every cycle since the sender was created
+     *
+     * @return the statistics of every cycle since the sender was created
+     */
+    Statistics getStatistics() const;
+
+   private:
+    /**
+     * Runs cycles until the sender is destroyed
+     */
+    void runCycles();
+
+    /**
+     * Records the statistics of a cycle that sent a packet, and logs a summary of the
+     * cycles since the last summary if a full reporting period has passed
+     *
+     * @param jitter How late the cycle started
+     * @param num_missed_cycles How many cycles were skipped before this one
+     * @param cycle_start_time When the cycle started
+     */
+    void recordCycle(const std::chrono::steady_clock::duration& jitter,
+                     unsigned long num_missed_cycles,
+                     const std::chrono::steady_clock::time_point& cycle_start_time);
+
+    const std::chrono::steady_clock::duration send_period;
+    SendFunction send_function;
+
+    // The latest Primitives and World given to the sender. Protected by the
+    // update_mutex
+    std::mutex update_mutex;
+    std::condition_variable stopped;
+    std::vector<PrimitiveVariant> latest_primitives;
+    PrimitivesSentCallback latest_primitives_sent_callback;
+    World latest_world;
+    bool has_new_primitives;
+    bool has_new_world;
+    bool is_running;
+
+    // The Primitives and World each cycle sends. Only used by the sender thread
+    std::vector<PrimitiveVariant> cycle_primitives;
+    PrimitivesSentCallback cycle_primitives_sent_callback;
+    World cycle_world;
+
+    // Protects the statistics, which are read from other threads
+    mutable std::mutex statistics_mutex;
+    Statistics statistics;
+    std::chrono::steady_clock::time_point first_packet_time;
+
+    // The statistics since the last summary was logged. Only used by the sender thread
+    unsigned long num_packets_since_report;
+    unsigned long num_missed_cycles_since_report;
+    LatencyHistogram jitter_since_report;
+    std::chrono::steady_clock::time_point time_last_reported;
+
+    std::thread sender_thread;
+};
@@ -1,55 +1,89 @@
 #include <ros/ros.h>
 #include <thunderbots_msgs/Primitive.h>
 #include <thunderbots_msgs/PrimitiveArray.h>
-#include <thunderbots_msgs/World.h>
-
-<<<<<<< HEAD
-<<<<<<< HEAD
-#include "ai/primitive/move_primitive.h"
-#include "ai/primitive/chip_primitive.h"
-#include "ai/primitive/kick_primitive.h"
-=======
->>>>>>> b20161dc21a1bd66f3c4e146f1399408ab1a16f6
-=======
-#include "ai/primitive/chip_primitive.h"
->>>>>>> 2e64dafe0f472a05db6aefebd9d16952abd142b8
-#include "ai/primitive/primitive.h"
+#include <thunderbots_msgs/WorldDelta.h>
+
+#include <memory>
+
 #include "ai/primitive/primitive_factory.h"
+#include "ai/primitive/primitive_variant.h"
 #include "grsim_communication/grsim_backend.h"
+#include "grsim_communication/grsim_command_sender.h"
 #include "util/constants.h"
+#include "util/latency_tracker/latency_tracker.h"
 #include "util/logger/init.h"
 #include "util/parameter/dynamic_parameter_utils.h"
 #include "util/parameter/dynamic_parameters.h"
-#include "util/ros_messages.h"
+#include "util/shared_memory/shared_world_subscriber.h"
+#include "util/world_delta/world_delta_decoder.h"
 
 // Member variables we need to maintain state
 // They are kept in an anonymous namespace so they are not accessible outside this
 // file and are not created as global static variables.
 namespace
 {
-    // The GrSimBackend responsible for handling communication with grSim
+    // The GrSimBackend responsible for handling communication with grSim. It is only
+    // used by the thread of the grsim_command_sender
     GrSimBackend grsim_backend(Util::Constants::GRSIM_COMMAND_NETWORK_ADDRESS,
                                Util::Constants::GRSIM_COMMAND_NETWORK_PORT);
-    // The current state of the world
-    World world;
+    // Sends the latest Primitives and World to grSim at a fixed rate. The World can be
+    // updated from shared memory on a different thread than the ROS callbacks, which
+    // the sender handles
+    std::unique_ptr<GrSimCommandSender> grsim_command_sender;
+    // Receives the World from network_input through shared memory, if enabled
+    std::unique_ptr<Util::SharedWorldSubscriber> shared_world_subscriber;
+    // Rebuilds the World from the changes network_input publishes over ROS
+    Util::WorldDeltaDecoder world_delta_decoder;
+    // Measures how long it takes for Primitives to reach this node and be sent to grSim.
+    // It is only used by the thread of the grsim_command_sender
+    Util::LatencyTracker latency_tracker("grsim_communication");
+    // The Primitives received in the most recent message. It is cleared rather than
+    // created again for each message, so its memory is reused
+    std::vector<PrimitiveVariant> primitives;
 }  // namespace
 
 void primitiveUpdateCallback(const thunderbots_msgs::PrimitiveArray::ConstPtr& msg)
 {
-    std::vector<std::unique_ptr<Primitive>> primitives;
+    double receive_timestamp = Util::LatencyTracker::getCurrentTimestamp();
+
+    primitives.clear();
     thunderbots_msgs::PrimitiveArray prim_array_msg = *msg;
     for (const thunderbots_msgs::Primitive& prim_msg : prim_array_msg.primitives)
     {
-        primitives.emplace_back(AI::Primitive::createPrimitiveFromROSMessage(prim_msg));
+        primitives.emplace_back(
+            AI::Primitive::createPrimitiveVariantFromROSMessage(prim_msg));
     }
 
-    grsim_backend.sendPrimitives(primitives, world.friendlyTeam(), world.ball());
+    // The Primitives are sent on the next cycle of the sender, which can be up to one
+    // send period later, so the latency is recorded once they have actually been sent
+    grsim_command_sender->updatePrimitives(
+        primitives, [trace = prim_array_msg.trace, receive_timestamp]() {
+            latency_tracker.recordPrimitivesSent(
+                trace, receive_timestamp, Util::LatencyTracker::getCurrentTimestamp());
+            latency_tracker.publishAndLogIfReportDue();
+        });
 }
 
-void worldUpdateCallback(const thunderbots_msgs::World::ConstPtr& msg)
+void updateWorld(const World& new_world, const thunderbots_msgs::FrameTrace& trace)
 {
-    thunderbots_msgs::World world_msg = *msg;
-    world = Util::ROSMessages::createWorldFromROSMessage(world_msg);
+    grsim_command_sender->updateWorld(new_world);
+}
+
+void worldDeltaCallback(const thunderbots_msgs::WorldDelta::ConstPtr& msg)
+{
+    // Every change is applied even while we are using the World from shared memory, so
+    // the World from ROS is ready to use as soon as shared memory stops working
+    bool world_valid = world_delta_decoder.apply(*msg);
+
+    // The World from shared memory is newer, so we only use the World from ROS if we
+    // aren't getting it through shared memory
+    if (!world_valid ||
+        (shared_world_subscriber && shared_world_subscriber->isReceiving()))
+    {
+        return;
+    }
+
+    updateWorld(world_delta_decoder.world(), msg->trace);
 }
 
 int main(int argc, char** argv)
@@ -58,53 +92,63 @@ int main(int argc, char** argv)
     ros::init(argc, argv, "grsim_communication");
     ros::NodeHandle node_handle;
 
-    // Create subscribers to topics we care about
-    ros::Subscriber primitive_subscriber = node_handle.subscribe(
-        Util::Constants::AI_PRIMITIVES_TOPIC, 1, primitiveUpdateCallback);
-    ros::Subscriber world_subscriber = node_handle.subscribe(
-        Util::Constants::NETWORK_INPUT_WORLD_TOPIC, 1, worldUpdateCallback);
-
     // Initialize the logger
     Util::Logger::LoggerSingleton::initializeLogger(node_handle);
 
-<<<<<<< HEAD
-<<<<<<< HEAD
-    // Initialize variables
-    primitives                 = std::vector<std::unique_ptr<Primitive>>();
-    GrSimBackend grsim_backend = GrSimBackend(NETWORK_ADDRESS, NETWORK_PORT);
-
-    // We loop at a set rate so that we don't overload the network with too many packets
-    ros::Rate tick_rate(TICK_RATE);
-
-    // Main loop
-    while (ros::ok())
+    // Send commands to grSim at a fixed rate, given by the command_rate_hz private
+    // parameter
+    double command_rate_hz;
+    ros::NodeHandle("~").param<double>("command_rate_hz", command_rate_hz,
+                                       Util::Constants::GRSIM_COMMAND_RATE_HZ);
+    if (!(command_rate_hz > 0))
     {
-        // Clear all primitives each tick
-        primitives.clear();
-
-        // Spin once to let all necessary callbacks run
-        // The callbacks will populate the primitives vector
-        ros::spinOnce();
-
-        primitives.emplace_back(new ChipPrimitive(0, Point(0, 0), Angle::zero(), 3));
-        primitives.emplace_back(new KickPrimitive(0, Point(0, 0), Angle::zero(), 1));
-
-        grsim_backend.sendPrimitives(primitives, friendly_team);
+        LOG(WARNING) << "The command_rate_hz parameter must be positive, but it is "
+                     << command_rate_hz << ". Using the default of "
+                     << Util::Constants::GRSIM_COMMAND_RATE_HZ << "Hz instead";
+        command_rate_hz = Util::Constants::GRSIM_COMMAND_RATE_HZ;
+    }
+    grsim_command_sender = std::make_unique<GrSimCommandSender>(
+        Duration::fromSeconds(1.0 / command_rate_hz),
+        [](const std::vector<PrimitiveVariant>& primitives, const World& world,
+           const Duration& delta_time) {
+            grsim_backend.sendPrimitives(primitives, world.friendlyTeam(), world.ball(),
+                                         delta_time);
+        });
 
-        tick_rate.sleep();
+    // Create subscribers to topics we care about
+    ros::Subscriber primitive_subscriber = node_handle.subscribe(
+        Util::Constants::AI_PRIMITIVES_TOPIC, 1, primitiveUpdateCallback);
+    ros::Subscriber world_delta_subscriber = node_handle.subscribe(
+        Util::Constants::NETWORK_INPUT_WORLD_DELTA_TOPIC,
+        Util::Constants::NETWORK_INPUT_WORLD_DELTA_QUEUE_SIZE, worldDeltaCallback);
+
+    // Initialize the latency diagnostics publisher
+    latency_tracker.initializePublisher(node_handle);
+
+    // Receive the World through shared memory when network_input is on the same machine,
+    // falling back to the ROS topic otherwise
+    bool use_shared_memory_world;
+    ros::NodeHandle("~").param<bool>("shared_memory_world", use_shared_memory_world,
+                                     true);
+    if (use_shared_memory_world)
+    {
+        shared_world_subscriber = std::make_unique<Util::SharedWorldSubscriber>(
+            Util::SharedWorldRing::NETWORK_INPUT_WORLD_SEGMENT, updateWorld);
+        shared_world_subscriber->startBackgroundThread();
     }
-=======
-=======
+
     // Initialize Dynamic Parameters
     auto update_subscribers =
         Util::DynamicParameters::initUpdateSubscriptions(node_handle);
 
->>>>>>> 2e64dafe0f472a05db6aefebd9d16952abd142b8
     // Services any ROS calls in a separate thread "behind the scenes". Does not return
     // until the node is shutdown
     // http://wiki.ros.org/roscpp/Overview/Callbacks%20and%20Spinning
     ros::spin();
->>>>>>> b20161dc21a1bd66f3c4e146f1399408ab1a16f6
+
+    // Stop receiving the World before anything it uses is destroyed
+    shared_world_subscriber.reset();
+    grsim_command_sender.reset();
 
     return 0;
 }
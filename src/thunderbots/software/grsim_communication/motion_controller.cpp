@@ -5,8 +5,10 @@
  *
  * It assumed the robot max acceleration is constant.
  *
- * Uses constant acceleration kinematics equations to
- * calculate changes in speed.
+ * Position commands follow the same time-optimal bang-bang trajectories as the
+ * firmware and the AI's travel time estimates, from shared/bang_bang_trajectory.h.
+ * Velocity commands use constant acceleration kinematics equations to calculate
+ * changes in speed.
  *
  * See https://en.wikipedia.org/wiki/Bang%E2%80%93bang_control for more info
  */
@@ -15,6 +17,7 @@
 
 #include <algorithm>
 
+#include "shared/bang_bang_trajectory.h"
 #include "util/logger/init.h"
 
 // Creates a struct which inherits all lambda function given to it and uses their
@@ -38,20 +41,12 @@ MotionController::Velocity MotionController::bangBangVelocityController(
 {
     MotionController::Velocity robot_velocities;
 
-<<<<<<< HEAD
-    // if the change in time is somehow negative or zero, just return the current robot
-    // velocity
-    // TODO: Implement exception handling for negative time case
-    // See issue #123
-    if (delta_time <= 0)
-=======
     if (delta_time < 0)
     {
         throw std::invalid_argument(
             "GrSim Motion controller received a negative delta time");
     }
     else if (delta_time == 0)
->>>>>>> 2e64dafe0f472a05db6aefebd9d16952abd142b8
     {
         robot_velocities.linear_velocity  = robot.velocity();
         robot_velocities.angular_velocity = robot.angularVelocity();
@@ -67,7 +62,7 @@ MotionController::Velocity MotionController::bangBangVelocityController(
                             robot, command.global_destination,
                             command.final_speed_at_destination, delta_time,
                             this->max_speed_meters_per_second,
-                            this->max_angular_speed_radians_per_second);
+                            this->max_acceleration_meters_per_second_squared);
                     robot_velocities.angular_velocity =
                         MotionController::determineAngularVelocityFromPosition(
                             robot, command.final_orientation, delta_time,
@@ -107,30 +102,15 @@ AngularVelocity MotionController::determineAngularVelocityFromPosition(
     // Calculate the angular difference between us and a goal
     Angle angle_difference = (desired_final_orientation - robot.orientation()).angleMod();
 
-    // Calculate our desired additional turn rate based on a sqrt-esque profile
-    // This allows us to rapidly bring the velocity to zero when we're near the
-    // target angle
-    double new_robot_angular_velocity_magnitude =
-        std::sqrt(std::max<double>(
-            (angle_difference.abs() - Angle::ofDegrees(0.2)).toRadians(), 0)) *
-        3;
-    // Cap our angular velocity at the robot's physical limit
-    new_robot_angular_velocity_magnitude = std::min<double>(
-        new_robot_angular_velocity_magnitude, max_angular_speed_radians_per_second);
-    // Figure out the maximum acceleration the robot is physically capable of
-    double max_additional_angular_velocity =
-        max_angular_acceleration_radians_per_second_squared * delta_time;
+    // Follow the fastest trajectory that stops at the final orientation, and use the
+    // angular velocity it has at the end of this time step
+    BangBangTrajectory1D trajectory = planBangBangTrajectory1D(
+        angle_difference.toRadians(), robot.angularVelocity().toRadians(), 0,
+        max_angular_acceleration_radians_per_second_squared,
+        max_angular_speed_radians_per_second);
 
-    // Compute the final velocity by taking the minimum of the physical max additional
-    // turn rate and our desired additional turn rate
-    double new_angular_velocity =
-        robot.angularVelocity().toRadians() +
-        std::copysign(max_additional_angular_velocity, angle_difference.toRadians());
-    new_angular_velocity =
-        std::clamp<double>(new_angular_velocity, -new_robot_angular_velocity_magnitude,
-                           new_robot_angular_velocity_magnitude);
-
-    return AngularVelocity::ofRadians(new_angular_velocity);
+    return AngularVelocity::ofRadians(
+        getBangBangTrajectory1DVelocity(&trajectory, delta_time));
 }
 
 Vector MotionController::determineLinearVelocityFromPosition(
@@ -138,59 +118,33 @@ Vector MotionController::determineLinearVelocityFromPosition(
     const double delta_time, const double max_speed_meters_per_second,
     const double max_acceleration_meters_per_second_squared)
 {
-    // Figure out the maximum (physically possible) velocity we can add to the robot
-    double max_magnitude_of_velocity_to_apply =
-        max_acceleration_meters_per_second_squared * delta_time;
-
-    // Calculate a unit vector from the robot to the destination
-    Vector unit_vector_to_dest = (dest - robot.position()).norm();
-
-    // Calculate the vector of our velocity perpendicular to the vector toward the
-    // destination
-    Vector robot_velocity_perpendicular_to_dest =
-        robot.velocity().dot(unit_vector_to_dest.perp()) * unit_vector_to_dest.perp();
-
-    // Use the "remaining" velocity (based on physical limits) to move us along the vector
-    // towards the destination
-    double magnitude_additional_velocity_towards_dest =
-        std::max<double>(0, max_magnitude_of_velocity_to_apply -
-                                robot_velocity_perpendicular_to_dest.len());
-    Vector additional_velocity_towards_dest =
-        magnitude_additional_velocity_towards_dest * unit_vector_to_dest;
-
-    // The resulting additional velocity to apply to the robot is the velocity required to
-    // counteract our movement perpendicular to the vector towards the destination, with
-    // the "remaining" velocity pushing us along the vector to the destination
-    Vector additional_velocity =
-        -robot_velocity_perpendicular_to_dest + additional_velocity_towards_dest;
-
-    // Clamp the new robot velocity to the minimum of the physical maximum velocity and
-    // a square root-esque function of the distance to the destination. This allows us to
-    // bring the robot velocity to zero as we approach the destination
-    double new_robot_velocity_magnitude =
-        std::sqrt(std::max<double>((dest - robot.position()).len() - 0.01, 0)) * 2 +
-        desired_final_speed;
-
-    // https://github.com/UBC-Thunderbots/Software/issues/270
-    // Check for the case where we are moving away from the target AND the additional
-    // velocity is greater in magnitude than the current velocity, as the above
-    // function will increase in magnitude as the distance to the destination increases
-
-    bool moving_away_from_dest =
-        (robot.velocity().orientation() - unit_vector_to_dest.orientation())
-            .angleMod()
-            .abs() > Angle::quarter();
-
-    if (moving_away_from_dest && additional_velocity.len() < robot.velocity().len())
+    // We plan the trajectory along and perpendicular to the vector towards the
+    // destination, so that moving straight towards the destination can use the full
+    // acceleration and speed of the robot, while any velocity perpendicular to it is
+    // brought to zero on the way
+    Vector displacement = dest - robot.position();
+    Vector direction    = displacement.norm();
+    if (direction.len() == 0)
     {
-        new_robot_velocity_magnitude *= -1;
+        // Any direction works when the robot is already at the destination
+        direction = Vector(1, 0);
     }
-    new_robot_velocity_magnitude =
-        std::clamp<double>(new_robot_velocity_magnitude, -max_speed_meters_per_second,
-                           max_speed_meters_per_second);
 
-    Vector new_robot_velocity =
-        new_robot_velocity_magnitude * (robot.velocity() + additional_velocity).norm();
+    double displacement_in_direction[2]     = {displacement.len(), 0};
+    double initial_velocity_in_direction[2] = {robot.velocity().dot(direction),
+                                               robot.velocity().dot(direction.perp())};
+    double final_velocity_in_direction[2]   = {desired_final_speed, 0};
+
+    BangBangTrajectory2D trajectory = planBangBangTrajectory2D(
+        displacement_in_direction, initial_velocity_in_direction,
+        final_velocity_in_direction, max_acceleration_meters_per_second_squared,
+        max_speed_meters_per_second);
+
+    // Follow the trajectory by using the velocity it has at the end of this time step
+    double new_velocity_in_direction[2];
+    getBangBangTrajectory2DVelocity(&trajectory, delta_time, new_velocity_in_direction);
+    Vector new_robot_velocity = new_velocity_in_direction[0] * direction +
+                                new_velocity_in_direction[1] * direction.perp();
 
     // Translate velocities into robot coordinates
     Vector new_robot_velocity_in_robot_coordinates =
@@ -11,6 +11,7 @@
 Backend::Backend()
     : field_state(0, 0, 0, 0, 0, 0, 0),
       ball_state(Point(), Vector(), Timestamp::fromSeconds(0)),
+      received_field_geometry(false),
       friendly_team_state(Duration::fromMilliseconds(
           Util::Constants::ROBOT_DEBOUNCE_DURATION_MILLISECONDS)),
       enemy_team_state(Duration::fromMilliseconds(
@@ -21,38 +22,114 @@ Backend::Backend()
 {
 }
 
-Field Backend::getFieldData(const SSL_GeometryData &geometry_packet)
+std::optional<Field> Backend::getFieldData(const SSL_GeometryData &geometry_packet)
 {
-    if (geometry_packet.has_field())
+    if (!geometry_packet.has_field())
     {
-        SSL_GeometryFieldSize field_data = geometry_packet.field();
-        Field field                      = createFieldFromPacketGeometry(field_data);
+        return std::nullopt;
+    }
 
-        field_state = field;
+    // SSL Vision sends the same geometry over and over again, so we only rebuild the
+    // field when the geometry actually changes
+    const SSL_GeometryFieldSize &field_geometry = geometry_packet.field();
+    if (received_field_geometry &&
+        isSameFieldGeometry(field_geometry, latest_field_geometry))
+    {
+        return std::nullopt;
     }
 
+    latest_field_geometry.CopyFrom(field_geometry);
+    received_field_geometry = true;
+    field_state             = createFieldFromPacketGeometry(field_geometry);
+
+    return field_state;
+}
+
+Field Backend::getField() const
+{
     return field_state;
 }
 
+bool Backend::isSameFieldGeometry(const SSL_GeometryFieldSize &geometry1,
+                                  const SSL_GeometryFieldSize &geometry2)
+{
+    auto is_same_vector = [](const Vector2f &v1, const Vector2f &v2) {
+        return v1.x() == v2.x() && v1.y() == v2.y();
+    };
+
+    if (geometry1.field_length() != geometry2.field_length() ||
+        geometry1.field_width() != geometry2.field_width() ||
+        geometry1.goalwidth() != geometry2.goalwidth() ||
+        geometry1.goal_depth() != geometry2.goal_depth() ||
+        geometry1.boundary_width() != geometry2.boundary_width() ||
+        geometry1.field_lines_size() != geometry2.field_lines_size() ||
+        geometry1.field_arcs_size() != geometry2.field_arcs_size())
+    {
+        return false;
+    }
+
+    for (int i = 0; i < geometry1.field_lines_size(); i++)
+    {
+        const SSL_FieldLineSegment &line1 = geometry1.field_lines(i);
+        const SSL_FieldLineSegment &line2 = geometry2.field_lines(i);
+        if (line1.name() != line2.name() || !is_same_vector(line1.p1(), line2.p1()) ||
+            !is_same_vector(line1.p2(), line2.p2()) ||
+            line1.thickness() != line2.thickness())
+        {
+            return false;
+        }
+    }
+
+    for (int i = 0; i < geometry1.field_arcs_size(); i++)
+    {
+        const SSL_FieldCicularArc &arc1 = geometry1.field_arcs(i);
+        const SSL_FieldCicularArc &arc2 = geometry2.field_arcs(i);
+        if (arc1.name() != arc2.name() || !is_same_vector(arc1.center(), arc2.center()) ||
+            arc1.radius() != arc2.radius() || arc1.a1() != arc2.a1() ||
+            arc1.a2() != arc2.a2() || arc1.thickness() != arc2.thickness())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 Field Backend::createFieldFromPacketGeometry(
     const SSL_GeometryFieldSize &packet_geometry) const
 {
     // We can't guarantee the order that any geometry elements are passed to us in, so
-    // We map the name of each line/arc to the actual object so we can refer to them
-    // consistantly
-    std::map<std::string, SSL_FieldCicularArc> ssl_circular_arcs;
-    std::map<std::string, SSL_FieldLineSegment> ssl_field_lines;
+    // we look up each line/arc by name so we can refer to them consistantly. There are
+    // only a handful of them, so searching is cheaper than building a map. If a line or
+    // arc is missing we use the default (all zero) one, like a map would
+    auto find_arc =
+        [&packet_geometry](const std::string &name) -> const SSL_FieldCicularArc & {
+        for (const SSL_FieldCicularArc &arc : packet_geometry.field_arcs())
+        {
+            if (arc.name() == name)
+            {
+                return arc;
+            }
+        }
+        return SSL_FieldCicularArc::default_instance();
+    };
+    auto find_line =
+        [&packet_geometry](const std::string &name) -> const SSL_FieldLineSegment & {
+        for (const SSL_FieldLineSegment &line : packet_geometry.field_lines())
+        {
+            if (line.name() == name)
+            {
+                return line;
+            }
+        }
+        return SSL_FieldLineSegment::default_instance();
+    };
 
     // Circular arcs
     //
     // Arc names:
     // CenterCircle
-    for (int i = 0; i < packet_geometry.field_arcs_size(); i++)
-    {
-        const SSL_FieldCicularArc &arc = packet_geometry.field_arcs(i);
-        std::string arc_name           = arc.name();
-        ssl_circular_arcs[arc_name]    = arc;
-    }
+    const SSL_FieldCicularArc &center_circle = find_arc("CenterCircle");
 
     // Field Lines
     //
@@ -75,38 +152,30 @@ Field Backend::createFieldFromPacketGeometry(
     // LeftFieldRightPenaltyStretch
     // RightFieldLeftPenaltyStretch
     // RightFieldRightPenaltyStretch
-    for (int i = 0; i < packet_geometry.field_lines_size(); i++)
-    {
-        const SSL_FieldLineSegment &line = packet_geometry.field_lines(i);
-        std::string line_name            = line.name();
-        ssl_field_lines[line_name]       = line;
-    }
-
-    thunderbots_msgs::Field field_msg;
+    //
+    // We arbitraily use the left side here since the left and right sides are identical
+    const SSL_FieldLineSegment &left_field_left_penalty_stretch =
+        find_line("LeftFieldLeftPenaltyStretch");
+    const SSL_FieldLineSegment &left_penalty_stretch = find_line("LeftPenaltyStretch");
 
     // Extract the data we care about and convert all units to meters
     double field_length   = packet_geometry.field_length() * METERS_PER_MILLIMETER;
     double field_width    = packet_geometry.field_width() * METERS_PER_MILLIMETER;
     double goal_width     = packet_geometry.goalwidth() * METERS_PER_MILLIMETER;
     double boundary_width = packet_geometry.boundary_width() * METERS_PER_MILLIMETER;
-    double center_circle_radius =
-        ssl_circular_arcs["CenterCircle"].radius() * METERS_PER_MILLIMETER;
+    double center_circle_radius = center_circle.radius() * METERS_PER_MILLIMETER;
 
-    // We arbitraily use the left side here since the left and right sides are identical
-    Point defense_length_p1 =
-        Point(ssl_field_lines["LeftFieldLeftPenaltyStretch"].p1().x(),
-              ssl_field_lines["LeftFieldLeftPenaltyStretch"].p1().y());
-    Point defense_length_p2 =
-        Point(ssl_field_lines["LeftFieldLeftPenaltyStretch"].p2().x(),
-              ssl_field_lines["LeftFieldLeftPenaltyStretch"].p2().y());
+    Point defense_length_p1 = Point(left_field_left_penalty_stretch.p1().x(),
+                                    left_field_left_penalty_stretch.p1().y());
+    Point defense_length_p2 = Point(left_field_left_penalty_stretch.p2().x(),
+                                    left_field_left_penalty_stretch.p2().y());
     double defense_length =
         (defense_length_p2 - defense_length_p1).len() * METERS_PER_MILLIMETER;
 
-    // We arbitraily use the left side here since the left and right sides are identical
-    Point defense_width_p1 = Point(ssl_field_lines["LeftPenaltyStretch"].p1().x(),
-                                   ssl_field_lines["LeftPenaltyStretch"].p1().y());
-    Point defense_width_p2 = Point(ssl_field_lines["LeftPenaltyStretch"].p2().x(),
-                                   ssl_field_lines["LeftPenaltyStretch"].p2().y());
+    Point defense_width_p1 =
+        Point(left_penalty_stretch.p1().x(), left_penalty_stretch.p1().y());
+    Point defense_width_p2 =
+        Point(left_penalty_stretch.p2().x(), left_penalty_stretch.p2().y());
     double defense_width =
         (defense_width_p1 - defense_width_p2).len() * METERS_PER_MILLIMETER;
 
@@ -117,7 +186,8 @@ Field Backend::createFieldFromPacketGeometry(
 
 Ball Backend::getFilteredBallData(const std::vector<SSL_DetectionFrame> &detections)
 {
-    auto ball_detections = std::vector<SSLBallDetection>();
+    // Clearing keeps the capacity of the vector, so we don't reallocate every packet
+    ball_detections.clear();
 
     for (const auto &detection : detections)
     {
@@ -139,18 +209,17 @@ Ball Backend::getFilteredBallData(const std::vector<SSL_DetectionFrame> &detecti
     return ball_state;
 }
 
-Team Backend::getFilteredFriendlyTeamData(std::vector<SSL_DetectionFrame> detections)
+Team Backend::getFilteredFriendlyTeamData(
+    const std::vector<SSL_DetectionFrame> &detections)
 {
-    auto friendly_robot_detections = std::vector<SSLRobotDetection>();
+    friendly_robot_detections.clear();
 
     // Collect all the visible robots from all camera frames
     for (const auto &detection : detections)
     {
-        auto ssl_robots = detection.robots_yellow();
-        if (Util::Constants::FRIENDLY_TEAM_COLOUR == BLUE)
-        {
-            ssl_robots = detection.robots_blue();
-        }
+        const auto &ssl_robots = Util::Constants::FRIENDLY_TEAM_COLOUR == BLUE
+                                     ? detection.robots_blue()
+                                     : detection.robots_yellow();
 
         for (const auto &friendly_robot_detection : ssl_robots)
         {
@@ -178,16 +247,14 @@ Team Backend::getFilteredFriendlyTeamData(std::vector<SSL_DetectionFrame> detect
 
 Team Backend::getFilteredEnemyTeamData(const std::vector<SSL_DetectionFrame> &detections)
 {
-    auto enemy_robot_detections = std::vector<SSLRobotDetection>();
+    enemy_robot_detections.clear();
 
     // Collect all the visible robots from all camera frames
     for (const auto &detection : detections)
     {
-        auto ssl_robots = detection.robots_blue();
-        if (Util::Constants::FRIENDLY_TEAM_COLOUR == BLUE)
-        {
-            ssl_robots = detection.robots_yellow();
-        }
+        const auto &ssl_robots = Util::Constants::FRIENDLY_TEAM_COLOUR == BLUE
+                                     ? detection.robots_yellow()
+                                     : detection.robots_blue();
 
         for (const auto &enemy_robot_detection : ssl_robots)
         {
@@ -38,15 +38,25 @@ class Backend
     Ball getFilteredBallData(const std::vector<SSL_DetectionFrame> &detections);
 
     /**
-     * Returns a new Field object containing the most up to date state of the field given
-     * the new GeometryData information
+     * Updates the state of the field with the new GeometryData information. SSL Vision
+     * repeats the same geometry constantly, so the field is only rebuilt when the
+     * geometry is different from the last geometry we received. The returned value acts
+     * as a "field changed" event, so anything that depends on the field only needs to be
+     * updated when this returns a Field
      *
      * @param geometry_packet The SSL_GeometryData packet containing new field data
      *
-     * @return a Field object containing the most up to date state of the field given the
-     * new GeometryData information
+     * @return a Field object containing the new state of the field if the geometry has
+     * changed, and std::nullopt if the geometry is the same as before
      */
-    Field getFieldData(const SSL_GeometryData &geometry_packet);
+    std::optional<Field> getFieldData(const SSL_GeometryData &geometry_packet);
+
+    /**
+     * Returns the most up to date state of the field
+     *
+     * @return the most up to date state of the field
+     */
+    Field getField() const;
 
     /**
      * Filters the robot data for the friendly team contained in the list of
@@ -57,7 +67,7 @@ class Backend
      * @return The most up to date state of the friendly team given the new DetectionFrame
      * information
      */
-    Team getFilteredFriendlyTeamData(std::vector<SSL_DetectionFrame> detections);
+    Team getFilteredFriendlyTeamData(const std::vector<SSL_DetectionFrame> &detections);
 
     /**
      * Filters the robot data for the enemy team contained in the list of DetectionFrames
@@ -85,6 +95,17 @@ class Backend
     Field createFieldFromPacketGeometry(
         const SSL_GeometryFieldSize &packet_geometry) const;
 
+    /**
+     * Checks if two sets of field geometry describe exactly the same field
+     *
+     * @param geometry1 The first set of field geometry
+     * @param geometry2 The second set of field geometry
+     * @return true if every value in the two sets of geometry is the same, and false
+     * otherwise
+     */
+    static bool isSameFieldGeometry(const SSL_GeometryFieldSize &geometry1,
+                                    const SSL_GeometryFieldSize &geometry2);
+
     BallFilter ball_filter;
     RobotTeamFilter friendly_team_filter;
     RobotTeamFilter enemy_team_filter;
@@ -97,6 +118,17 @@ class Backend
     Team enemy_team_state;
     Ball ball_state;
 
+    // The last field geometry we received, used to tell when the geometry changes
+    SSL_GeometryFieldSize latest_field_geometry;
+    bool received_field_geometry;
+
+    // Scratch space used to collect the detections from every camera before they are
+    // given to the filters. These are kept as members so their memory is reused between
+    // packets instead of being reallocated every time
+    std::vector<SSLBallDetection> ball_detections;
+    std::vector<SSLRobotDetection> friendly_robot_detections;
+    std::vector<SSLRobotDetection> enemy_robot_detections;
+
     // backend *should* be the only part of the system that is aware of Refbox/Vision
     // global coordinates. To AI, +x will always be enemy and -x will always be friendly.
     FieldSide our_field_side;
@@ -0,0 +1,51 @@
+#include "network_input/networking/kernel_receive_timestamps.h"
+
+#include <cstring>
+
+#include "util/logger/init.h"
+
+namespace KernelReceiveTimestamps
+{
+    void enableOnSocket(int socket_fd)
+    {
+        int enable = 1;
+        if (setsockopt(socket_fd, SOL_SOCKET, SO_TIMESTAMPNS, &enable, sizeof(enable)) !=
+            0)
+        {
+            LOG(WARNING) << "Failed to enable kernel receive timestamps on a socket. "
+                            "Latency measurements will not include the time packets "
+                            "spend queued on the socket"
+                         << std::endl;
+        }
+    }
+
+    double getReceiveTimestamp(const msghdr& message_header)
+    {
+        timespec receive_time = {};
+
+        bool found_timestamp = false;
+        // CMSG_NXTHDR takes a non-const header even though it doesn't modify it
+        msghdr& header = const_cast<msghdr&>(message_header);
+        for (cmsghdr* control_message = CMSG_FIRSTHDR(&header);
+             control_message != nullptr;
+             control_message = CMSG_NXTHDR(&header, control_message))
+        {
+            if (control_message->cmsg_level == SOL_SOCKET &&
+                control_message->cmsg_type == SCM_TIMESTAMPNS)
+            {
+                std::memcpy(&receive_time, CMSG_DATA(control_message),
+                            sizeof(receive_time));
+                found_timestamp = true;
+                break;
+            }
+        }
+
+        if (!found_timestamp)
+        {
+            clock_gettime(CLOCK_REALTIME, &receive_time);
+        }
+
+        return static_cast<double>(receive_time.tv_sec) +
+               static_cast<double>(receive_time.tv_nsec) * 1e-9;
+    }
+}  // namespace KernelReceiveTimestamps
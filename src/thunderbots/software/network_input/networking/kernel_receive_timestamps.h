@@ -0,0 +1,36 @@
+#pragma once
+
+#include <sys/socket.h>
+#include <time.h>
+
+/**
+ * Functions to get the time at which the kernel received a datagram on a socket, rather
+ * than the time our code got around to reading it. This lets us measure the full
+ * latency of the pipeline, including any time a packet spends queued on the socket.
+ */
+namespace KernelReceiveTimestamps
+{
+    // How much space must be reserved in the control buffer of each message header so
+    // the kernel can give us the receive timestamp
+    static constexpr size_t CONTROL_BUFFER_LENGTH = CMSG_SPACE(sizeof(timespec));
+
+    /**
+     * Asks the kernel to record the time every datagram is received on the given socket.
+     * If this fails a warning is logged and getReceiveTimestamp will fall back to the
+     * time the datagram is read
+     *
+     * @param socket_fd The native handle of the socket
+     */
+    void enableOnSocket(int socket_fd);
+
+    /**
+     * Returns the time the kernel received the datagram read into the given message
+     * header. The header must have been given a control buffer of at least
+     * CONTROL_BUFFER_LENGTH bytes when it was read
+     *
+     * @param message_header The header of the message read from the socket
+     * @return the wall clock time the datagram was received, in seconds since the unix
+     * epoch. If the kernel did not provide a timestamp, the current time is returned
+     */
+    double getReceiveTimestamp(const msghdr& message_header);
+}  // namespace KernelReceiveTimestamps
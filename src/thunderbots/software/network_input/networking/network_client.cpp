@@ -1,26 +1,141 @@
 #include "network_input/networking/network_client.h"
 
+#include <algorithm>
 #include <boost/bind.hpp>
+#include <cerrno>
+#include <limits>
 
+#include "thunderbots_msgs/PacketQueueStatus.h"
 #include "util/constants.h"
 #include "util/logger/init.h"
 #include "util/ros_messages.h"
+#include "util/shared_memory/world_frame.h"
 
-NetworkClient::NetworkClient(ros::NodeHandle& node_handle) : backend(), io_service()
+NetworkClient::NetworkClient(
+    ros::NodeHandle& node_handle,
+    std::function<void(const World&, const thunderbots_msgs::FrameTrace&)> world_handler)
+    : backend(),
+      world(),
+      world_handler(world_handler),
+      world_delta_encoder(WORLD_DELTA_KEYFRAME_PERIOD),
+      refbox_data_updated(false),
+      latency_tracker("network_input"),
+      num_vision_packets_dropped(0),
+      num_gamecontroller_packets_dropped(0),
+      max_vision_queue_depth(0),
+      max_gamecontroller_queue_depth(0),
+      time_queue_status_last_reported(std::chrono::steady_clock::now()),
+      wait_for_room_in_queues(false),
+      is_processing(true),
+      vision_io_service(),
+      gamecontroller_io_service()
 {
-    // Set up publishers
-    world_publisher = node_handle.advertise<thunderbots_msgs::World>(
-        Util::Constants::NETWORK_INPUT_WORLD_TOPIC, 1);
+    latest_detection_data.reserve(Util::Constants::NUMBER_OF_SSL_VISION_CAMERAS);
+    sem_init(&queued_packets_semaphore, 0, 0);
+
+    // Set up publishers. The World is only published if nothing in this process is
+    // handling it
+    if (!world_handler)
+    {
+        world_publisher = node_handle.advertise<thunderbots_msgs::World>(
+            Util::Constants::NETWORK_INPUT_WORLD_TOPIC, 1);
+        world_delta_publisher = node_handle.advertise<thunderbots_msgs::WorldDelta>(
+            Util::Constants::NETWORK_INPUT_WORLD_DELTA_TOPIC,
+            Util::Constants::NETWORK_INPUT_WORLD_DELTA_QUEUE_SIZE);
+    }
     gamecontroller_publisher = node_handle.advertise<thunderbots_msgs::RefboxData>(
         Util::Constants::NETWORK_INPUT_GAMECONTROLLER_TOPIC, 1);
+    // The field topic is latched so that nodes that start later still get the field
+    field_publisher = node_handle.advertise<thunderbots_msgs::Field>(
+        Util::Constants::NETWORK_INPUT_FIELD_TOPIC, 1, true);
+    queue_status_publisher = node_handle.advertise<thunderbots_msgs::PacketQueueStatus>(
+        Util::Constants::NETWORK_INPUT_QUEUE_STATUS_TOPIC, 8);
+    latency_tracker.initializePublisher(node_handle);
+
+    ros::NodeHandle private_node_handle("~");
+    bool use_shared_memory_world;
+    private_node_handle.param<bool>("shared_memory_world", use_shared_memory_world, true);
+    if (use_shared_memory_world && !world_handler)
+    {
+        try
+        {
+            shared_world_writer = std::make_unique<Util::SharedWorldRingWriter>(
+                Util::SharedWorldRing::NETWORK_INPUT_WORLD_SEGMENT);
+        }
+        catch (const std::runtime_error& ex)
+        {
+            // The World is still published over ROS, so the other nodes can still get it
+            LOG(WARNING) << "Could not share the World through shared memory, so it will "
+                            "only be published over ROS: "
+                         << ex.what() << std::endl;
+        }
+    }
+
+    // Start processing before any data can arrive
+    processing_thread = std::thread([this]() { processQueuedPackets(); });
 
+    std::string record_log_path;
+    std::string replay_log_path;
+    double replay_speed;
+    private_node_handle.param<std::string>("record_packet_log", record_log_path, "");
+    private_node_handle.param<std::string>("replay_packet_log", replay_log_path, "");
+    private_node_handle.param<double>("replay_speed", replay_speed, 1.0);
+
+    if (!replay_log_path.empty())
+    {
+        try
+        {
+            wait_for_room_in_queues = true;
+            packet_replay_client    = std::make_unique<PacketReplayClient>(
+                replay_log_path, replay_speed,
+                boost::bind(&NetworkClient::queueVisionPacket, this, _1, _2),
+                boost::bind(&NetworkClient::queueGameControllerPacket, this, _1, _2));
+        }
+        catch (const std::runtime_error& ex)
+        {
+            // LOG(FATAL) will terminate the network_input process
+            LOG(FATAL) << "An error occured while opening the packet log to replay: "
+                       << ex.what() << std::endl;
+        }
+    }
+    else
+    {
+        std::shared_ptr<PacketLogWriter> packet_log_writer;
+        if (!record_log_path.empty())
+        {
+            try
+            {
+                packet_log_writer = std::make_shared<PacketLogWriter>(record_log_path);
+            }
+            catch (const std::runtime_error& ex)
+            {
+                // LOG(FATAL) will terminate the network_input process
+                LOG(FATAL) << "An error occured while opening the packet log to record "
+                              "to: "
+                           << ex.what() << std::endl;
+            }
+        }
+
+        setupNetworkClients(packet_log_writer);
+    }
+
+    // Start the threads to run the io_services in the background
+    vision_io_service_thread = std::thread([this]() { vision_io_service.run(); });
+    gamecontroller_io_service_thread =
+        std::thread([this]() { gamecontroller_io_service.run(); });
+}
+
+void NetworkClient::setupNetworkClients(
+    std::shared_ptr<PacketLogWriter> packet_log_writer)
+{
     // Set up our connection over udp to receive vision packets
     try
     {
         ssl_vision_client = std::make_unique<SSLVisionClient>(
-            io_service, Util::Constants::SSL_VISION_MULTICAST_ADDRESS,
+            vision_io_service, Util::Constants::SSL_VISION_MULTICAST_ADDRESS,
             Util::Constants::SSL_VISION_MULTICAST_PORT,
-            boost::bind(&NetworkClient::filterAndPublishVisionData, this, _1));
+            boost::bind(&NetworkClient::queueVisionPacket, this, _1, _2),
+            packet_log_writer);
     }
     catch (const boost::exception& ex)
     {
@@ -35,9 +150,11 @@ NetworkClient::NetworkClient(ros::NodeHandle& node_handle) : backend(), io_servi
     try
     {
         ssl_gamecontroller_client = std::make_unique<SSLGameControllerClient>(
-            io_service, Util::Constants::SSL_GAMECONTROLLER_MULTICAST_ADDRESS,
+            gamecontroller_io_service,
+            Util::Constants::SSL_GAMECONTROLLER_MULTICAST_ADDRESS,
             Util::Constants::SSL_GAMECONTROLLER_MULTICAST_PORT,
-            boost::bind(&NetworkClient::filterAndPublishGameControllerData, this, _1));
+            boost::bind(&NetworkClient::queueGameControllerPacket, this, _1, _2),
+            packet_log_writer);
     }
     catch (const boost::exception& ex)
     {
@@ -46,80 +163,285 @@ NetworkClient::NetworkClient(ros::NodeHandle& node_handle) : backend(), io_servi
                    << std::endl
                    << boost::diagnostic_information(ex) << std::endl;
     }
-
-    // Start the thread to run the io_service in the background
-    io_service_thread = std::thread([this]() { io_service.run(); });
 }
 
 NetworkClient::~NetworkClient()
 {
-    // Stop the io_service. This is safe to call from another thread.
+    // Stop replaying data first, since the replay thread uses the other members of
+    // this class
+    packet_replay_client.reset();
+
+    // Stop the io_services. This is safe to call from another thread.
     // https://stackoverflow.com/questions/4808848/boost-asio-stopping-io-service
-    // This MUST be done before attempting to join the thread because otherwise the
-    // io_service will not stop and the thread will not join
-    io_service.stop();
-
-    // Join the io_service_thread so that we wait for it to exit before destructing the
-    // thread object. If we do not wait for the thread to finish executing, it will call
-    // `std::terminate` when we deallocate the thread object and kill our whole program
-    io_service_thread.join();
+    // This MUST be done before attempting to join the threads because otherwise the
+    // io_services will not stop and the threads will not join
+    vision_io_service.stop();
+    gamecontroller_io_service.stop();
+
+    // Join the io_service threads so that we wait for them to exit before destructing
+    // the thread objects. If we do not wait for the threads to finish executing, they
+    // will call `std::terminate` when we deallocate the thread objects and kill our
+    // whole program
+    vision_io_service_thread.join();
+    gamecontroller_io_service_thread.join();
+
+    // Now that nothing else will be queued, stop the processing thread. Posting to the
+    // semaphore wakes the thread up if it is waiting for packets
+    is_processing = false;
+    sem_post(&queued_packets_semaphore);
+    processing_thread.join();
+
+    sem_destroy(&queued_packets_semaphore);
 }
 
+void NetworkClient::queueVisionPacket(const SSL_WrapperPacket& packet,
+                                      double receive_timestamp)
+{
+    QueuedPacket<SSL_WrapperPacket>* queued_packet = vision_packet_queue.startPush();
+    while (!queued_packet && wait_for_room_in_queues && is_processing)
+    {
+        std::this_thread::yield();
+        queued_packet = vision_packet_queue.startPush();
+    }
+
+    if (!queued_packet)
+    {
+        num_vision_packets_dropped++;
+        return;
+    }
 
-void NetworkClient::filterAndPublishVisionData(SSL_WrapperPacket packet)
+    // Copying into the existing message in the slot reuses the memory it allocated for
+    // the last packet it held
+    queued_packet->packet.CopyFrom(packet);
+    queued_packet->receive_timestamp = receive_timestamp;
+    vision_packet_queue.finishPush();
+    sem_post(&queued_packets_semaphore);
+}
+
+void NetworkClient::queueGameControllerPacket(const Referee& packet,
+                                              double receive_timestamp)
 {
-    if (packet.has_geometry())
+    QueuedPacket<Referee>* queued_packet = gamecontroller_packet_queue.startPush();
+    while (!queued_packet && wait_for_room_in_queues && is_processing)
     {
-        const auto& latest_geometry_data = packet.geometry();
-        Field field                      = backend.getFieldData(latest_geometry_data);
-        thunderbots_msgs::Field field_msg =
-            Util::ROSMessages::convertFieldToROSMessage(field);
-        world_msg.field = field_msg;
+        std::this_thread::yield();
+        queued_packet = gamecontroller_packet_queue.startPush();
     }
 
-    if (packet.has_detection())
+    if (!queued_packet)
     {
-        auto detection = packet.detection();
-        // add the detection to the map, replacing any existing values
-        auto ret = latest_detection_data.insert(
-            std::make_pair(detection.camera_id(), detection));
-        // check if we inserted successfully. if not, modify the existing
-        // entry to be our new value
-        if (!ret.second)
+        num_gamecontroller_packets_dropped++;
+        return;
+    }
+
+    queued_packet->packet.CopyFrom(packet);
+    queued_packet->receive_timestamp = receive_timestamp;
+    gamecontroller_packet_queue.finishPush();
+    sem_post(&queued_packets_semaphore);
+}
+
+void NetworkClient::processQueuedPackets()
+{
+    while (true)
+    {
+        // Sleep until at least one packet has been queued. The semaphore is posted once
+        // for every queued packet, but we handle every waiting packet at once, so some
+        // waits return immediately with nothing left to do
+        if (sem_wait(&queued_packets_semaphore) != 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (!is_processing)
+        {
+            break;
+        }
+
+        max_vision_queue_depth =
+            std::max(max_vision_queue_depth, vision_packet_queue.size());
+        max_gamecontroller_queue_depth =
+            std::max(max_gamecontroller_queue_depth, gamecontroller_packet_queue.size());
+
+        // Merge every packet that is waiting into the World. The World is published
+        // with the receive time of the oldest packet, so the latency we measure includes
+        // the time every packet spent waiting in the queues
+        bool world_updated              = false;
+        bool received_detection_data    = false;
+        double oldest_receive_timestamp = std::numeric_limits<double>::max();
+
+        while (QueuedPacket<Referee>* queued_packet = gamecontroller_packet_queue.front())
         {
-            ret.first->second = detection;
+            mergeGameControllerData(queued_packet->packet);
+            oldest_receive_timestamp =
+                std::min(oldest_receive_timestamp, queued_packet->receive_timestamp);
+            world_updated = true;
+            gamecontroller_packet_queue.pop();
         }
 
-        // Create a vector of the latest detection data for each camera
-        std::vector<SSL_DetectionFrame> latest_detections;
-        for (auto it = latest_detection_data.begin(); it != latest_detection_data.end();
-             it++)
+        while (QueuedPacket<SSL_WrapperPacket>* queued_packet =
+                   vision_packet_queue.front())
         {
-            latest_detections.push_back(it->second);
+            received_detection_data |= mergeVisionData(queued_packet->packet);
+            oldest_receive_timestamp =
+                std::min(oldest_receive_timestamp, queued_packet->receive_timestamp);
+            world_updated = true;
+            vision_packet_queue.pop();
         }
 
-        Ball ball = backend.getFilteredBallData(latest_detections);
-        thunderbots_msgs::Ball ball_msg =
-            Util::ROSMessages::convertBallToROSMessage(ball);
-        world_msg.ball = ball_msg;
+        if (received_detection_data)
+        {
+            filterDetectionData();
+        }
 
-        Team friendly_team = backend.getFilteredFriendlyTeamData(latest_detections);
-        thunderbots_msgs::Team friendly_team_msg =
-            Util::ROSMessages::convertTeamToROSMessage(friendly_team);
-        world_msg.friendly_team = friendly_team_msg;
+        if (world_updated)
+        {
+            publishWorld(oldest_receive_timestamp);
+        }
 
-        Team enemy_team = backend.getFilteredEnemyTeamData(latest_detections);
-        thunderbots_msgs::Team enemy_team_msg =
-            Util::ROSMessages::convertTeamToROSMessage(enemy_team);
-        world_msg.enemy_team = enemy_team_msg;
+        publishQueueStatusIfDue();
     }
+}
+
+bool NetworkClient::mergeVisionData(const SSL_WrapperPacket& packet)
+{
+    if (packet.has_geometry())
+    {
+        const auto& latest_geometry_data = packet.geometry();
+        std::optional<Field> new_field   = backend.getFieldData(latest_geometry_data);
+        if (new_field)
+        {
+            world.updateFieldGeometry(*new_field);
+            thunderbots_msgs::Field field_msg =
+                Util::ROSMessages::convertFieldToROSMessage(*new_field);
+            world_msg.field = field_msg;
+
+            // Let anything that caches data derived from the field know that it needs
+            // to be rebuilt
+            field_publisher.publish(field_msg);
+            LOG(INFO) << "The field geometry has changed" << std::endl;
+        }
+    }
+
+    if (packet.has_detection())
+    {
+        const auto& detection = packet.detection();
+
+        // Replace the existing data for this camera, or add a new entry if this is
+        // the first time we have seen this camera
+        auto existing_detection =
+            std::find_if(latest_detection_data.begin(), latest_detection_data.end(),
+                         [&detection](const SSL_DetectionFrame& frame) {
+                             return frame.camera_id() == detection.camera_id();
+                         });
+        if (existing_detection != latest_detection_data.end())
+        {
+            existing_detection->CopyFrom(detection);
+        }
+        else
+        {
+            latest_detection_data.emplace_back(detection);
+        }
+
+        return true;
+    }
+
+    return false;
+}
 
-    world_publisher.publish(world_msg);
+void NetworkClient::filterDetectionData()
+{
+    world.updateBallState(backend.getFilteredBallData(latest_detection_data));
+    world.updateFriendlyTeamState(
+        backend.getFilteredFriendlyTeamData(latest_detection_data));
+    world.updateEnemyTeamState(backend.getFilteredEnemyTeamData(latest_detection_data));
 }
 
-void NetworkClient::filterAndPublishGameControllerData(Referee packet)
+void NetworkClient::mergeGameControllerData(const Referee& packet)
 {
     auto gamecontroller_data_msg = backend.getRefboxDataMsg(packet);
     world_msg.refbox_data        = gamecontroller_data_msg;
-    world_publisher.publish(world_msg);
+    refbox_data_updated          = true;
+    world.updateRefboxGameState(Util::ROSMessages::createGameStateFromROSMessage(
+        gamecontroller_data_msg.command));
+}
+
+void NetworkClient::publishWorld(double receive_timestamp)
+{
+    // Start a new trace for this frame, discarding the timestamps of the previous one
+    world_msg.trace                         = thunderbots_msgs::FrameTrace();
+    world_msg.trace.frame_id                = ++frame_id;
+    world_msg.trace.receive_timestamp       = receive_timestamp;
+    world_msg.trace.world_publish_timestamp = Util::LatencyTracker::getCurrentTimestamp();
+    if (world_handler)
+    {
+        world_handler(world, world_msg.trace);
+    }
+    else
+    {
+        // Shared memory readers get the World first, since they don't have to wait for
+        // it to be serialized
+        if (shared_world_writer)
+        {
+            shared_world_writer->write(Util::createWorldFrame(world, world_msg.trace));
+        }
+
+        world_delta_publisher.publish(world_delta_encoder.encode(
+            world, world_msg.refbox_data, refbox_data_updated, world_msg.trace));
+        refbox_data_updated = false;
+
+        // The full World is only needed by nodes that don't keep their own copy of it,
+        // such as the visualizer, so we don't convert it unless someone is listening
+        if (world_publisher.getNumSubscribers() > 0)
+        {
+            world_msg.ball = Util::ROSMessages::convertBallToROSMessage(world.ball());
+            world_msg.friendly_team =
+                Util::ROSMessages::convertTeamToROSMessage(world.friendlyTeam());
+            world_msg.enemy_team =
+                Util::ROSMessages::convertTeamToROSMessage(world.enemyTeam());
+            world_publisher.publish(world_msg);
+        }
+    }
+
+    latency_tracker.recordStageLatency("receive_to_world_publish", receive_timestamp,
+                                       world_msg.trace.world_publish_timestamp);
+    latency_tracker.publishAndLogIfReportDue();
+}
+
+void NetworkClient::publishQueueStatusIfDue()
+{
+    auto now = std::chrono::steady_clock::now();
+    if (now - time_queue_status_last_reported <
+        std::chrono::seconds(Util::Constants::LATENCY_REPORT_PERIOD_SECONDS))
+    {
+        return;
+    }
+    time_queue_status_last_reported = now;
+
+    thunderbots_msgs::PacketQueueStatus vision_queue_status;
+    vision_queue_status.queue_name  = "vision";
+    vision_queue_status.capacity    = vision_packet_queue.capacity();
+    vision_queue_status.depth       = vision_packet_queue.size();
+    vision_queue_status.max_depth   = max_vision_queue_depth;
+    vision_queue_status.num_dropped = num_vision_packets_dropped;
+    queue_status_publisher.publish(vision_queue_status);
+
+    thunderbots_msgs::PacketQueueStatus gamecontroller_queue_status;
+    gamecontroller_queue_status.queue_name  = "gamecontroller";
+    gamecontroller_queue_status.capacity    = gamecontroller_packet_queue.capacity();
+    gamecontroller_queue_status.depth       = gamecontroller_packet_queue.size();
+    gamecontroller_queue_status.max_depth   = max_gamecontroller_queue_depth;
+    gamecontroller_queue_status.num_dropped = num_gamecontroller_packets_dropped;
+    queue_status_publisher.publish(gamecontroller_queue_status);
+
+    if (vision_queue_status.num_dropped > 0 ||
+        gamecontroller_queue_status.num_dropped > 0)
+    {
+        LOG(WARNING) << "network_input has dropped " << vision_queue_status.num_dropped
+                     << " vision packets and " << gamecontroller_queue_status.num_dropped
+                     << " gamecontroller packets because it could not process them "
+                        "fast enough"
+                     << std::endl;
+    }
+
+    max_vision_queue_depth         = 0;
+    max_gamecontroller_queue_depth = 0;
 }
@@ -1,23 +1,44 @@
 #pragma once
 
 #include <ros/ros.h>
+#include <semaphore.h>
+#include <thunderbots_msgs/FrameTrace.h>
 #include <thunderbots_msgs/World.h>
 
+#include <atomic>
 #include <boost/asio.hpp>
 #include <boost/exception/diagnostic_information.hpp>
+#include <chrono>
+#include <functional>
 #include <thread>
 
+#include "ai/world/world.h"
 #include "network_input/backend.h"
+#include "network_input/networking/packet_log.h"
+#include "network_input/networking/packet_replay_client.h"
 #include "network_input/networking/ssl_gamecontroller_client.h"
 #include "network_input/networking/ssl_vision_client.h"
 #include "proto/messages_robocup_ssl_wrapper.pb.h"
 #include "proto/ssl_referee.pb.h"
+#include "util/latency_tracker/latency_tracker.h"
+#include "util/shared_memory/shared_world_ring.h"
+#include "util/spsc_queue.h"
+#include "util/world_delta/world_delta_encoder.h"
 
 /**
  * This class encapsulates our SSLVisionClient and SSLGameController clients to abstract
  * all networking operations behind a single interface. This also allows us to keep the
  * "handle" functions we give to the clients as member functions rather than large lambda
  * functions. Overall, this helps keep our main.cpp file shorter and more readable.
+ *
+ * The work is split into a pipeline so that filtering never delays reading data from the
+ * network. Each client receives data on its own thread, and hands every packet it
+ * receives to a lock-free queue. A separate thread takes the packets out of both queues,
+ * merges them into the World, filters the vision data and publishes the result. If the
+ * filtering thread falls behind, every packet that is waiting is merged before the data
+ * is filtered, so the filter only runs once no matter how many packets arrived. If a
+ * queue fills up anyway, new packets are dropped rather than blocking the receive
+ * thread.
  */
 class NetworkClient
 {
@@ -26,9 +47,29 @@ class NetworkClient
      * Creates a new NetworkClient for the given NodeHandle. This allows this class to
      * create and own its own publishers
      *
+     * By default the client receives live data from the network. This can be changed
+     * with the following private ROS parameters:
+     * - record_packet_log: The path of a packet log to record every received datagram
+     *   to. The log is appended to if it already exists
+     * - replay_packet_log: The path of a packet log to replay instead of receiving data
+     *   from the network
+     * - replay_speed: How fast to replay the packet log relative to real time. Values
+     *   <= 0 replay the log as fast as possible. Defaults to 1
+     * - shared_memory_world: Whether to also write every World to shared memory, so
+     *   that nodes on the same machine can read it without going through ROS. Defaults
+     *   to true
+     *
      * @param node_handle The NodeHandle this class should use to publish its messages
+     * @param world_handler If given, every updated World is given to this function on
+     * the processing thread instead of being published over ROS, so that the World can
+     * be used by other parts of the same process without being converted to a ROS
+     * message. The World and trace given to the world_handler are owned by this client,
+     * so they are only valid for the duration of the call
      */
-    explicit NetworkClient(ros::NodeHandle& node_handle);
+    explicit NetworkClient(
+        ros::NodeHandle& node_handle,
+        std::function<void(const World&, const thunderbots_msgs::FrameTrace&)>
+            world_handler = nullptr);
 
     /**
      * Safely destructs this NetworkClient object. Stops any running IO services and
@@ -43,31 +84,106 @@ class NetworkClient
     NetworkClient(const NetworkClient&)            = delete;
 
    private:
+    // A packet waiting to be processed, along with the time it was received
+    template <typename PacketType>
+    struct QueuedPacket
+    {
+        PacketType packet;
+        double receive_timestamp;
+    };
+
+    // The maximum number of packets that can be waiting to be processed. Vision data
+    // arrives at about 60Hz from each of the 4 cameras, so this is enough to let the
+    // filtering thread fall behind by a quarter of a second before we drop anything
+    static constexpr size_t VISION_QUEUE_CAPACITY         = 64;
+    static constexpr size_t GAMECONTROLLER_QUEUE_CAPACITY = 16;
+
+    // How many WorldDeltas are published for every keyframe. The World is published
+    // at about 60Hz, so nodes that start late or miss an update recover within a second
+    static constexpr unsigned int WORLD_DELTA_KEYFRAME_PERIOD = 60;
+
     /**
-     * Filters and publishes the new vision data
+     * Sets up the SSLVisionClient and SSLGameControllerClient to receive live data from
+     * the network
      *
-     * This function contains all the work that is performed every time a new vision
-     * packet is received from the network. We give this function to the SSLVisionClient
-     * to call
+     * @param packet_log_writer If given, every datagram received is recorded to this
+     * packet log
+     */
+    void setupNetworkClients(std::shared_ptr<PacketLogWriter> packet_log_writer);
+
+    /**
+     * Adds a vision packet to the queue of packets waiting to be processed. We give this
+     * function to the SSLVisionClient to call from its receive thread
      *
      * @param packet The newly received vision packet
+     * @param receive_timestamp When the kernel received the packet, in seconds since
+     * the unix epoch
      */
-    void filterAndPublishVisionData(SSL_WrapperPacket packet);
+    void queueVisionPacket(const SSL_WrapperPacket& packet, double receive_timestamp);
 
     /**
-     * Filters and publishes the new GameController data
-     *
-     * This function contains all the work that is performed every time a new
-     * GameController packet is received from the network. We give this function to the
-     * GameControllerClient to call
+     * Adds a GameController packet to the queue of packets waiting to be processed. We
+     * give this function to the SSLGameControllerClient to call from its receive thread
      *
      * @param packet The newly received GameController packet
+     * @param receive_timestamp When the kernel received the packet, in seconds since
+     * the unix epoch
+     */
+    void queueGameControllerPacket(const Referee& packet, double receive_timestamp);
+
+    /**
+     * Processes the queued packets until the client is destroyed. This runs on the
+     * processing thread, and is the only function that uses the Backend and publishers
+     */
+    void processQueuedPackets();
+
+    /**
+     * Merges a vision packet into the World. The geometry data is used immediately, and
+     * the detection data is saved to be filtered once all the queued packets have been
+     * merged
+     *
+     * @param packet The vision packet
+     *
+     * @return true if the packet contained new detection data, and false otherwise
      */
-    void filterAndPublishGameControllerData(Referee packet);
+    bool mergeVisionData(const SSL_WrapperPacket& packet);
+
+    /**
+     * Filters the latest detection data from each camera, and updates the ball and teams
+     * in the World with the result
+     */
+    void filterDetectionData();
+
+    /**
+     * Merges a GameController packet into the World
+     *
+     * @param packet The GameController packet
+     */
+    void mergeGameControllerData(const Referee& packet);
+
+    /**
+     * Stamps the World with a new frame id and the given receive time, then publishes it
+     * or gives it to the world_handler. The World is published as a WorldDelta with only
+     * what has changed, and also as a full World message if anything subscribes to it
+     *
+     * @param receive_timestamp When the kernel received the oldest packet merged into
+     * the World since it was last published, in seconds since the unix epoch
+     */
+    void publishWorld(double receive_timestamp);
+
+    /**
+     * Publishes and logs the status of the packet queues, if a full reporting period has
+     * passed since they were last reported
+     */
+    void publishQueueStatusIfDue();
 
     // The publishers used to send data after it has been received and processed
     ros::Publisher gamecontroller_publisher;
     ros::Publisher world_publisher;
+    ros::Publisher world_delta_publisher;
+    // Only publishes when the field geometry changes
+    ros::Publisher field_publisher;
+    ros::Publisher queue_status_publisher;
 
     // The backend that handles data filtering and processing
     Backend backend;
@@ -77,17 +193,76 @@ class NetworkClient
     // The client that handles data reception, filtering , and publishing for
     // gamecontroller data
     std::unique_ptr<SSLGameControllerClient> ssl_gamecontroller_client;
+    // Replays recorded data in place of the vision and gamecontroller clients, if we
+    // are replaying a packet log
+    std::unique_ptr<PacketReplayClient> packet_replay_client;
 
-    // The most up-to-date state of the world
+    // The most up-to-date state of the world. The ball and teams in the ROS message are
+    // only converted when we publish it to a subscriber, since converting the World to
+    // a message is not free
+    World world;
     thunderbots_msgs::World world_msg;
 
-    // A map used to store the latest detection data for each camera
-    std::map<unsigned int, SSL_DetectionFrame> latest_detection_data;
+    // Encodes the changes to the World that are published to the world delta topic
+    Util::WorldDeltaEncoder world_delta_encoder;
+    // Whether the refbox data has changed since the World was last published
+    bool refbox_data_updated;
+
+    // The function that is given every updated World, if the World is not published
+    std::function<void(const World&, const thunderbots_msgs::FrameTrace&)> world_handler;
+
+    // Shares every published World with the other nodes on this machine, if enabled
+    std::unique_ptr<Util::SharedWorldRingWriter> shared_world_writer;
+
+    // The id of the most recently published frame
+    uint64_t frame_id = 0;
+
+    // Measures how long it takes to filter and publish the data we receive
+    Util::LatencyTracker latency_tracker;
+
+    // The latest detection data for each camera, with one entry per camera. Entries are
+    // overwritten in place when new data arrives so that the memory protobuf has
+    // already allocated for each camera's frame gets reused
+    std::vector<SSL_DetectionFrame> latest_detection_data;
+
+    // The packets waiting to be processed. Each queue is filled by the receive thread
+    // of one client, and emptied by the processing thread
+    Util::SPSCQueue<QueuedPacket<SSL_WrapperPacket>, VISION_QUEUE_CAPACITY>
+        vision_packet_queue;
+    Util::SPSCQueue<QueuedPacket<Referee>, GAMECONTROLLER_QUEUE_CAPACITY>
+        gamecontroller_packet_queue;
+    // How many packets have been dropped because their queue was full
+    std::atomic<uint64_t> num_vision_packets_dropped;
+    std::atomic<uint64_t> num_gamecontroller_packets_dropped;
+    // The largest number of packets seen in each queue since the status of the queues
+    // was last reported. Only used by the processing thread
+    size_t max_vision_queue_depth;
+    size_t max_gamecontroller_queue_depth;
+    std::chrono::steady_clock::time_point time_queue_status_last_reported;
+
+    // When replaying a packet log, the receive threads wait for room in the queues
+    // rather than dropping packets, so that every recorded packet is processed even if
+    // the log is replayed faster than we can process it
+    bool wait_for_room_in_queues;
+
+    // Counts the packets that have been pushed onto either queue, so that the
+    // processing thread can sleep until there is work to do. Posting to a semaphore
+    // never blocks, so this does not slow down the receive threads
+    sem_t queued_packets_semaphore;
+    // Cleared when the client is destroyed to stop the processing thread
+    std::atomic<bool> is_processing;
+
+    // The io_services that will be used to service the vision and gamecontroller
+    // sockets. Each one is run by its own thread, so data is read from one socket even
+    // if the handler for the other one is busy
+    boost::asio::io_service vision_io_service;
+    boost::asio::io_service gamecontroller_io_service;
 
-    // The io_service that will be used to serivce all network requests
-    boost::asio::io_service io_service;
+    // The threads running the io_services in the background. These threads will run for
+    // the entire lifetime of the class
+    std::thread vision_io_service_thread;
+    std::thread gamecontroller_io_service_thread;
 
-    // The thread running the io_service in the background. This thread will run for the
-    // entire lifetime of the class
-    std::thread io_service_thread;
+    // The thread that merges, filters and publishes the received data
+    std::thread processing_thread;
 };
@@ -0,0 +1,255 @@
+#include "network_input/networking/packet_log.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include "util/logger/init.h"
+
+namespace
+{
+    /**
+     * Checks that the given data starts with a valid packet log file header
+     *
+     * @param data The data to check
+     * @param length The number of bytes of data
+     * @param log_file_path The path of the file the data came from, used in errors
+     * @throws std::runtime_error if the data does not start with a valid header
+     */
+    void checkFileHeader(const char* data, size_t length,
+                         const std::string& log_file_path)
+    {
+        PacketLogFileHeader header;
+        if (length < sizeof(header))
+        {
+            throw std::runtime_error(log_file_path + " is too short to be a packet log");
+        }
+        std::memcpy(&header, data, sizeof(header));
+
+        if (std::memcmp(header.magic, PacketLog::MAGIC, sizeof(header.magic)) != 0)
+        {
+            throw std::runtime_error(log_file_path + " is not a packet log");
+        }
+        if (header.version != PacketLog::VERSION)
+        {
+            throw std::runtime_error(log_file_path +
+                                     " was written with an unsupported version (" +
+                                     std::to_string(header.version) + ")");
+        }
+    }
+
+    /**
+     * Finds where the last complete record in a packet log ends, by following the
+     * length of each record from the start of the log
+     *
+     * @param file_descriptor The open packet log, which must start with a valid header
+     * @param log_length The number of bytes in the packet log
+     * @return The offset just past the last complete record in the log
+     */
+    size_t findEndOfLastCompleteRecord(int file_descriptor, size_t log_length)
+    {
+        size_t record_offset = sizeof(PacketLogFileHeader);
+        while (record_offset + sizeof(PacketLogRecordHeader) <= log_length)
+        {
+            PacketLogRecordHeader header;
+            if (pread(file_descriptor, &header, sizeof(header),
+                      static_cast<off_t>(record_offset)) !=
+                static_cast<ssize_t>(sizeof(header)))
+            {
+                break;
+            }
+
+            size_t next_record_offset =
+                record_offset + sizeof(header) + header.packet_length;
+            if (next_record_offset > log_length)
+            {
+                break;
+            }
+            record_offset = next_record_offset;
+        }
+        return record_offset;
+    }
+}  // namespace
+
+PacketLogWriter::PacketLogWriter(const std::string& log_file_path)
+{
+    file_descriptor = open(log_file_path.c_str(), O_RDWR | O_CREAT | O_APPEND, 0644);
+    if (file_descriptor < 0)
+    {
+        throw std::runtime_error("Failed to open packet log " + log_file_path + ": " +
+                                 std::strerror(errno));
+    }
+
+    struct stat file_status;
+    fstat(file_descriptor, &file_status);
+    if (file_status.st_size == 0)
+    {
+        PacketLogFileHeader header = {};
+        std::memcpy(header.magic, PacketLog::MAGIC, sizeof(header.magic));
+        header.version = PacketLog::VERSION;
+        if (write(file_descriptor, &header, sizeof(header)) !=
+            static_cast<ssize_t>(sizeof(header)))
+        {
+            close(file_descriptor);
+            throw std::runtime_error("Failed to write the header of packet log " +
+                                     log_file_path);
+        }
+    }
+    else
+    {
+        // Make sure we don't append our packets to some unrelated file
+        char existing_header[sizeof(PacketLogFileHeader)];
+        ssize_t header_length =
+            pread(file_descriptor, existing_header, sizeof(existing_header), 0);
+        try
+        {
+            checkFileHeader(existing_header,
+                            static_cast<size_t>(std::max<ssize_t>(header_length, 0)),
+                            log_file_path);
+        }
+        catch (const std::runtime_error&)
+        {
+            close(file_descriptor);
+            throw;
+        }
+
+        // If the process recording the log was killed in the middle of a write, the log
+        // ends with part of a record. Our records would be appended after it, and
+        // readers would stop at the partial record without ever reaching them
+        size_t log_length      = static_cast<size_t>(file_status.st_size);
+        size_t complete_length = findEndOfLastCompleteRecord(file_descriptor, log_length);
+        if (complete_length < log_length)
+        {
+            LOG(WARNING) << "Discarding the incomplete record at the end of packet log "
+                         << log_file_path << std::endl;
+            if (ftruncate(file_descriptor, static_cast<off_t>(complete_length)) != 0)
+            {
+                int truncate_error = errno;
+                close(file_descriptor);
+                throw std::runtime_error("Failed to truncate packet log " +
+                                         log_file_path + ": " +
+                                         std::strerror(truncate_error));
+            }
+        }
+    }
+}
+
+PacketLogWriter::~PacketLogWriter()
+{
+    close(file_descriptor);
+}
+
+void PacketLogWriter::writePacket(SSLPacketType packet_type, const char* packet_data,
+                                  size_t packet_length, double receive_timestamp)
+{
+    PacketLogRecordHeader header;
+    header.packet_length     = static_cast<uint32_t>(packet_length);
+    header.packet_type       = packet_type;
+    header.receive_timestamp = receive_timestamp;
+
+    // Write the header and packet together so the record is appended in one piece
+    iovec record[2];
+    record[0].iov_base = &header;
+    record[0].iov_len  = sizeof(header);
+    record[1].iov_base = const_cast<char*>(packet_data);
+    record[1].iov_len  = packet_length;
+
+    ssize_t bytes_written = writev(file_descriptor, record, 2);
+    if (bytes_written != static_cast<ssize_t>(sizeof(header) + packet_length))
+    {
+        LOG(WARNING) << "Failed to write a packet to the packet log: "
+                     << std::strerror(errno) << std::endl;
+    }
+}
+
+PacketLogReader::PacketLogReader(const std::string& log_file_path)
+    : log_data(nullptr), log_length(0)
+{
+    file_descriptor = open(log_file_path.c_str(), O_RDONLY);
+    if (file_descriptor < 0)
+    {
+        throw std::runtime_error("Failed to open packet log " + log_file_path + ": " +
+                                 std::strerror(errno));
+    }
+
+    struct stat file_status;
+    fstat(file_descriptor, &file_status);
+    log_length = static_cast<size_t>(file_status.st_size);
+
+    if (log_length > 0)
+    {
+        void* mapping =
+            mmap(nullptr, log_length, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+        if (mapping == MAP_FAILED)
+        {
+            close(file_descriptor);
+            throw std::runtime_error("Failed to map packet log " + log_file_path +
+                                     " into memory: " + std::strerror(errno));
+        }
+        log_data = static_cast<const char*>(mapping);
+
+        // We read the log from start to finish, so let the kernel read ahead
+        madvise(mapping, log_length, MADV_SEQUENTIAL);
+    }
+
+    try
+    {
+        checkFileHeader(log_data, log_length, log_file_path);
+    }
+    catch (const std::runtime_error&)
+    {
+        if (log_data)
+        {
+            munmap(const_cast<char*>(log_data), log_length);
+        }
+        close(file_descriptor);
+        throw;
+    }
+
+    rewind();
+}
+
+PacketLogReader::~PacketLogReader()
+{
+    munmap(const_cast<char*>(log_data), log_length);
+    close(file_descriptor);
+}
+
+std::optional<PacketLogEntry> PacketLogReader::getNextPacket()
+{
+    if (read_offset + sizeof(PacketLogRecordHeader) > log_length)
+    {
+        if (read_offset != log_length)
+        {
+            LOG(WARNING) << "The packet log ends with an incomplete record" << std::endl;
+            read_offset = log_length;
+        }
+        return std::nullopt;
+    }
+
+    PacketLogRecordHeader header;
+    std::memcpy(&header, log_data + read_offset, sizeof(header));
+    size_t packet_offset = read_offset + sizeof(header);
+
+    if (packet_offset + header.packet_length > log_length)
+    {
+        LOG(WARNING) << "The packet log ends with an incomplete record" << std::endl;
+        read_offset = log_length;
+        return std::nullopt;
+    }
+
+    read_offset = packet_offset + header.packet_length;
+    return PacketLogEntry{header.packet_type, header.receive_timestamp,
+                          log_data + packet_offset, header.packet_length};
+}
+
+void PacketLogReader::rewind()
+{
+    read_offset = sizeof(PacketLogFileHeader);
+}
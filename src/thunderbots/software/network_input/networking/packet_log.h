@@ -0,0 +1,152 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+/**
+ * A packet log is an append-only file of every raw SSL Vision and GameController
+ * datagram we received, along with the time each datagram arrived. It lets us replay
+ * the data from a real match through network_input offline.
+ *
+ * The file starts with a PacketLogFileHeader, followed by one record per datagram. Each
+ * record is a PacketLogRecordHeader followed immediately by the raw bytes of the
+ * datagram. Since records are only ever appended and every record is prefixed by its
+ * length, a log that was cut short (for example because the recording process crashed)
+ * can still be read up to the last complete record. All values are stored in the byte
+ * order of the machine that wrote the log.
+ */
+
+namespace PacketLog
+{
+    // The magic bytes at the start of every packet log
+    static constexpr char MAGIC[8] = {'T', 'B', 'O', 'T', 'S', 'S', 'S', 'L'};
+    // The version of the format written by PacketLogWriter
+    static constexpr uint32_t VERSION = 1;
+}  // namespace PacketLog
+
+// The type of packet stored in a record of a packet log
+enum class SSLPacketType : uint32_t
+{
+    VISION         = 0,
+    GAMECONTROLLER = 1
+};
+
+struct PacketLogFileHeader
+{
+    // Identifies the file as a packet log
+    char magic[8];
+    // The version of the format the log was written with
+    uint32_t version;
+    uint32_t reserved;
+};
+
+struct PacketLogRecordHeader
+{
+    // The number of bytes of packet data that follow this header
+    uint32_t packet_length;
+    SSLPacketType packet_type;
+    // When the datagram was received, in seconds since the unix epoch
+    double receive_timestamp;
+};
+
+// A single packet read from a packet log
+struct PacketLogEntry
+{
+    SSLPacketType packet_type;
+    double receive_timestamp;
+    // The raw bytes of the packet. These point into the log file, and are only valid
+    // for as long as the PacketLogReader that returned them exists
+    const char* packet_data;
+    size_t packet_length;
+};
+
+/**
+ * Appends packets to a packet log file. Each packet is written with a single system
+ * call to a file opened in append mode, so records are never interleaved or partially
+ * written unless the process is killed in the middle of the write. This means packets
+ * can safely be written from several threads at once.
+ */
+class PacketLogWriter
+{
+   public:
+    /**
+     * Opens the packet log at the given path for appending, creating it if it does not
+     * exist yet. If the existing log ends with an incomplete record, it is truncated
+     * to the end of the last complete record so new records can still be read
+     *
+     * @param log_file_path The path of the log file
+     * @throws std::runtime_error if the file could not be opened or truncated, or if it
+     * exists but is not a packet log
+     */
+    explicit PacketLogWriter(const std::string& log_file_path);
+
+    /**
+     * Closes the log file
+     */
+    ~PacketLogWriter();
+
+    PacketLogWriter& operator=(const PacketLogWriter&) = delete;
+    PacketLogWriter(const PacketLogWriter&)            = delete;
+
+    /**
+     * Appends a packet to the end of the log
+     *
+     * @param packet_type The type of the packet
+     * @param packet_data The raw bytes of the packet
+     * @param packet_length The number of bytes in the packet
+     * @param receive_timestamp When the packet was received, in seconds since the unix
+     * epoch
+     */
+    void writePacket(SSLPacketType packet_type, const char* packet_data,
+                     size_t packet_length, double receive_timestamp);
+
+   private:
+    int file_descriptor;
+};
+
+/**
+ * Reads the packets in a packet log in the order they were recorded. The log file is
+ * memory-mapped rather than read, so reading a packet never copies its data.
+ */
+class PacketLogReader
+{
+   public:
+    /**
+     * Opens the packet log at the given path for reading
+     *
+     * @param log_file_path The path of the log file
+     * @throws std::runtime_error if the file could not be opened or is not a packet log
+     */
+    explicit PacketLogReader(const std::string& log_file_path);
+
+    /**
+     * Unmaps and closes the log file
+     */
+    ~PacketLogReader();
+
+    PacketLogReader& operator=(const PacketLogReader&) = delete;
+    PacketLogReader(const PacketLogReader&)            = delete;
+
+    /**
+     * Returns the next packet in the log
+     *
+     * @return The next packet in the log, or std::nullopt if there are no complete
+     * packets left
+     */
+    std::optional<PacketLogEntry> getNextPacket();
+
+    /**
+     * Goes back to the first packet in the log
+     */
+    void rewind();
+
+   private:
+    int file_descriptor;
+    // The contents of the log file, mapped into memory
+    const char* log_data;
+    size_t log_length;
+    // The offset of the next record to read
+    size_t read_offset;
+};
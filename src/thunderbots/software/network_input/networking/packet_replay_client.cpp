@@ -0,0 +1,106 @@
+#include "network_input/networking/packet_replay_client.h"
+
+#include <chrono>
+
+#include "util/latency_tracker/latency_tracker.h"
+#include "util/logger/init.h"
+
+PacketReplayClient::PacketReplayClient(
+    const std::string& log_file_path, double replay_speed,
+    std::function<void(const SSL_WrapperPacket&, double)> vision_handle_function,
+    std::function<void(const Referee&, double)> gamecontroller_handle_function)
+    : log_reader(log_file_path),
+      replay_speed(replay_speed),
+      vision_handle_function(vision_handle_function),
+      gamecontroller_handle_function(gamecontroller_handle_function),
+      stop_replay(false)
+{
+    replay_thread = std::thread([this]() { replayPackets(); });
+}
+
+PacketReplayClient::~PacketReplayClient()
+{
+    stop_replay = true;
+    replay_thread.join();
+}
+
+void PacketReplayClient::replayPackets()
+{
+    using Clock = std::chrono::steady_clock;
+
+    // The time the first packet was recorded and replayed. Every other packet is
+    // replayed at the same offset from the first packet as when it was recorded,
+    // scaled by the replay speed
+    double first_receive_timestamp = 0.0;
+    Clock::time_point replay_start_time;
+    bool replayed_first_packet = false;
+
+    unsigned long num_packets_replayed = 0;
+    while (!stop_replay)
+    {
+        std::optional<PacketLogEntry> packet = log_reader.getNextPacket();
+        if (!packet)
+        {
+            break;
+        }
+
+        if (!replayed_first_packet)
+        {
+            first_receive_timestamp = packet->receive_timestamp;
+            replay_start_time       = Clock::now();
+            replayed_first_packet   = true;
+        }
+        else if (replay_speed > 0)
+        {
+            auto replay_offset = std::chrono::duration<double>(
+                (packet->receive_timestamp - first_receive_timestamp) / replay_speed);
+            std::this_thread::sleep_until(
+                replay_start_time +
+                std::chrono::duration_cast<Clock::duration>(replay_offset));
+        }
+
+        handlePacket(*packet);
+        num_packets_replayed++;
+    }
+
+    LOG(INFO) << "Finished replaying " << num_packets_replayed
+              << " packets from the packet log" << std::endl;
+}
+
+void PacketReplayClient::handlePacket(const PacketLogEntry& packet)
+{
+    // The packets are handled as if they had just been received, so that latency
+    // measurements reflect how long the replayed data takes to process
+    double replay_timestamp = Util::LatencyTracker::getCurrentTimestamp();
+
+    switch (packet.packet_type)
+    {
+        case SSLPacketType::VISION:
+            if (vision_packet.ParseFromArray(packet.packet_data,
+                                             static_cast<int>(packet.packet_length)))
+            {
+                vision_handle_function(vision_packet, replay_timestamp);
+            }
+            else
+            {
+                LOG(WARNING) << "Failed to parse a replayed SSL Vision packet"
+                             << std::endl;
+            }
+            break;
+        case SSLPacketType::GAMECONTROLLER:
+            if (gamecontroller_packet.ParseFromArray(
+                    packet.packet_data, static_cast<int>(packet.packet_length)))
+            {
+                gamecontroller_handle_function(gamecontroller_packet, replay_timestamp);
+            }
+            else
+            {
+                LOG(WARNING) << "Failed to parse a replayed SSL GameController packet"
+                             << std::endl;
+            }
+            break;
+        default:
+            LOG(WARNING) << "Skipping a packet of unknown type in the packet log"
+                         << std::endl;
+    }
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <string>
+#include <thread>
+
+#include "network_input/networking/packet_log.h"
+#include "proto/messages_robocup_ssl_wrapper.pb.h"
+#include "proto/ssl_referee.pb.h"
+
+/**
+ * Replays the packets recorded in a packet log, in place of the SSLVisionClient and
+ * SSLGameControllerClient. The packets are given to the same handle functions the
+ * network clients would give them to, so the rest of network_input can't tell the
+ * difference between replayed and live data. No network connection is used.
+ */
+class PacketReplayClient
+{
+   public:
+    /**
+     * Creates a PacketReplayClient and starts replaying the given log in a background
+     * thread. The log is replayed once, from start to finish
+     *
+     * @param log_file_path The path of the packet log to replay
+     * @param replay_speed How fast to replay the log relative to the speed it was
+     * recorded at. For example 1 replays the log in real time and 2 replays it twice as
+     * fast. If this is <= 0 the packets are replayed as fast as they can be handled
+     * @param vision_handle_function The function to run for every vision packet in the
+     * log. It is given the packet and the time it was replayed, in seconds since the
+     * unix epoch. The packet is only valid for the duration of the call
+     * @param gamecontroller_handle_function The function to run for every
+     * GameController packet in the log. It is given the packet and the time it was
+     * replayed, in seconds since the unix epoch. The packet is only valid for the
+     * duration of the call
+     *
+     * @throws std::runtime_error if the log could not be opened
+     */
+    PacketReplayClient(
+        const std::string& log_file_path, double replay_speed,
+        std::function<void(const SSL_WrapperPacket&, double)> vision_handle_function,
+        std::function<void(const Referee&, double)> gamecontroller_handle_function);
+
+    /**
+     * Stops replaying the log and waits for the replay thread to exit
+     */
+    ~PacketReplayClient();
+
+    PacketReplayClient& operator=(const PacketReplayClient&) = delete;
+    PacketReplayClient(const PacketReplayClient&)            = delete;
+
+   private:
+    /**
+     * Replays every packet in the log, waiting between packets to match the replay
+     * speed. Returns once every packet has been replayed, or the client is destroyed
+     */
+    void replayPackets();
+
+    /**
+     * Parses the given packet and gives it to the matching handle function
+     *
+     * @param packet The packet to handle
+     */
+    void handlePacket(const PacketLogEntry& packet);
+
+    PacketLogReader log_reader;
+    double replay_speed;
+
+    // The packets every replayed packet is parsed into. These are reused for every
+    // packet so that protobuf can reuse the memory it has already allocated
+    SSL_WrapperPacket vision_packet;
+    Referee gamecontroller_packet;
+
+    std::function<void(const SSL_WrapperPacket&, double)> vision_handle_function;
+    std::function<void(const Referee&, double)> gamecontroller_handle_function;
+
+    // Set when the client is destroyed to stop the replay early
+    std::atomic<bool> stop_replay;
+    std::thread replay_thread;
+};
@@ -3,9 +3,13 @@
 #include "util/logger/init.h"
 
 SSLGameControllerClient::SSLGameControllerClient(
-    boost::asio::io_service& io_service, std::string ip_address, unsigned short port,
-    std::function<void(Referee)> handle_function)
-    : socket_(io_service), handle_function(handle_function)
+    boost::asio::io_service& io_service, const std::string ip_address,
+    const unsigned short port,
+    std::function<void(const Referee&, double)> handle_function,
+    std::shared_ptr<PacketLogWriter> packet_log_writer)
+    : socket_(io_service),
+      packet_log_writer(packet_log_writer),
+      handle_function(handle_function)
 {
     boost::asio::ip::udp::endpoint listen_endpoint(
         boost::asio::ip::address::from_string(ip_address), port);
@@ -30,39 +34,94 @@ SSLGameControllerClient::SSLGameControllerClient(
     socket_.set_option(boost::asio::ip::multicast::join_group(
         boost::asio::ip::address::from_string(ip_address)));
 
+    // Have the kernel record when each datagram arrives, so our latency measurements
+    // include any time the datagram spends waiting to be read
+    KernelReceiveTimestamps::enableOnSocket(socket_.native_handle());
+
+    // Point each message header at its own receive buffer. These only need to be set up
+    // once, since recvmmsg only writes to the buffers and the length fields
+    for (unsigned int i = 0; i < max_packets_per_batch; i++)
+    {
+        received_data_iovecs_[i].iov_base = raw_received_data_[i].data();
+        received_data_iovecs_[i].iov_len  = max_buffer_length;
+
+        received_message_headers_[i]                    = {};
+        received_message_headers_[i].msg_hdr.msg_iov    = &received_data_iovecs_[i];
+        received_message_headers_[i].msg_hdr.msg_iovlen = 1;
+    }
+
     // Start listening for data
-    socket_.async_receive_from(boost::asio::buffer(raw_received_data_, max_buffer_length),
-                               sender_endpoint_,
-                               boost::bind(&SSLGameControllerClient::handleDataReception,
-                                           this, boost::asio::placeholders::error,
-                                           boost::asio::placeholders::bytes_transferred));
+    startListening();
+}
+
+void SSLGameControllerClient::startListening()
+{
+    // Using null_buffers only waits for the socket to become readable without reading
+    // anything, which lets us read all the queued datagrams ourselves in a single batch
+    socket_.async_receive(boost::asio::null_buffers(),
+                          boost::bind(&SSLGameControllerClient::handleDataReception, this,
+                                      boost::asio::placeholders::error));
 }
 
-void SSLGameControllerClient::handleDataReception(const boost::system::error_code& error,
-                                                  size_t num_bytes_received)
+void SSLGameControllerClient::handleDataReception(const boost::system::error_code& error)
 {
     if (!error)
     {
-        auto packet_data = Referee();
-        packet_data.ParseFromArray(raw_received_data_.data(),
-                                   static_cast<int>(num_bytes_received));
-        handle_function(packet_data);
+        // Read every datagram that is currently queued on the socket. If we fill up
+        // every buffer in a batch there may be more data waiting, so we keep reading
+        // until the socket has been drained
+        int num_packets_received = 0;
+        do
+        {
+            // The kernel overwrites the control buffer length with the amount of
+            // control data it wrote, so it must be reset before every read
+            for (unsigned int i = 0; i < max_packets_per_batch; i++)
+            {
+                received_message_headers_[i].msg_hdr.msg_control =
+                    received_control_data_[i].data();
+                received_message_headers_[i].msg_hdr.msg_controllen =
+                    received_control_data_[i].size();
+            }
+
+            num_packets_received =
+                recvmmsg(socket_.native_handle(), received_message_headers_.data(),
+                         max_packets_per_batch, MSG_DONTWAIT, nullptr);
+
+            for (int i = 0; i < num_packets_received; i++)
+            {
+                double receive_timestamp = KernelReceiveTimestamps::getReceiveTimestamp(
+                    received_message_headers_[i].msg_hdr);
+
+                if (packet_log_writer)
+                {
+                    packet_log_writer->writePacket(
+                        SSLPacketType::GAMECONTROLLER, raw_received_data_[i].data(),
+                        received_message_headers_[i].msg_len, receive_timestamp);
+                }
+
+                // ParseFromArray clears the message first, but keeps any memory that
+                // was allocated for previous packets so it can be reused
+                if (packet_data_.ParseFromArray(
+                        raw_received_data_[i].data(),
+                        static_cast<int>(received_message_headers_[i].msg_len)))
+                {
+                    handle_function(packet_data_, receive_timestamp);
+                }
+                else
+                {
+                    LOG(WARNING)
+                        << "Failed to parse an SSL GameController packet" << std::endl;
+                }
+            }
+        } while (num_packets_received == static_cast<int>(max_packets_per_batch));
 
         // Once we've handled the data, start listening again
-        socket_.async_receive_from(
-            boost::asio::buffer(raw_received_data_, max_buffer_length), sender_endpoint_,
-            boost::bind(&SSLGameControllerClient::handleDataReception, this,
-                        boost::asio::placeholders::error,
-                        boost::asio::placeholders::bytes_transferred));
+        startListening();
     }
     else
     {
         // Start listening again to receive the next data
-        socket_.async_receive_from(
-            boost::asio::buffer(raw_received_data_, max_buffer_length), sender_endpoint_,
-            boost::bind(&SSLGameControllerClient::handleDataReception, this,
-                        boost::asio::placeholders::error,
-                        boost::asio::placeholders::bytes_transferred));
+        startListening();
 
         LOG(WARNING)
             << "An unknown network error occurred when attempting to receive SSL GameController data. The boost system error code is "
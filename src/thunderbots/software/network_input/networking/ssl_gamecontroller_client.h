@@ -1,9 +1,15 @@
 #pragma once
 
+#include <sys/socket.h>
+
+#include <array>
 #include <boost/asio.hpp>
 #include <boost/bind.hpp>
+#include <memory>
 #include <string>
 
+#include "network_input/networking/kernel_receive_timestamps.h"
+#include "network_input/networking/packet_log.h"
 #include "proto/ssl_referee.pb.h"
 
 class SSLGameControllerClient
@@ -12,44 +18,70 @@ class SSLGameControllerClient
     /**
      * Creates an SSLGameControllerClient that will listen for data packets from the SSL
      * Game Controller on the given address and port. For every controller packet
-     * received, the handle_function will be cald to perform any operations desired by the
-     * caller
+     * received, the handle_function will be called to perform any operations desired by
+     * the caller
      *
      * @param io_service The io_service to use to service incoming GameController data
      * @param ip_address The ip address of the multicast group on which to listen for
      * GameController packets
      * @param port The port on which to listen for GameController packets
      * @param handle_function The function to run for every GameController packet received
-     * from the network
+     * from the network. The packet given to the handle_function is owned by this client
+     * and is reused for the next packet, so it is only valid for the duration of the
+     * call. The handle_function is also given the wall clock time (in seconds since the
+     * unix epoch) at which the kernel received the packet
+     * @param packet_log_writer If given, every datagram received is recorded to this
+     * packet log before it is handled
      */
     SSLGameControllerClient(boost::asio::io_service& io_service, std::string ip_address,
                             unsigned short port,
-                            std::function<void(Referee)> handle_function);
+                            std::function<void(const Referee&, double)> handle_function,
+                            std::shared_ptr<PacketLogWriter> packet_log_writer = nullptr);
 
    private:
+    /**
+     * Asynchronously waits until there is data available to be read on the socket,
+     * and calls handleDataReception once there is
+     */
+    void startListening();
+
     /**
      * The function that is called to process any data received by the io_service. This
-     * function gets automatically called by the io_service for EVERY packet received by
-     * the network. These functions are handled synchronously, so we DO NOT need to worry
-     * about concurrency or thread-safety in this function. Because this function also
-     * calls the provided handle_function, this means the handle_function also does not
-     * need to be thread-safe
+     * function gets automatically called by the io_service whenever there is data
+     * available on the socket, and reads every datagram that is currently queued. These
+     * functions are handled synchronously, so we DO NOT need to worry about concurrency
+     * or thread-safety in this function. Because this function also calls the provided
+     * handle_function, this means the handle_function also does not need to be
+     * thread-safe
      *
-     * @param error The error code obtained when receiving the incoming data
-     * @param num_bytes_received How many bytes of data were received
+     * @param error The error code obtained when waiting for the incoming data
      */
-    void handleDataReception(const boost::system::error_code& error,
-                             size_t num_bytes_received);
+    void handleDataReception(const boost::system::error_code& error);
 
     // A UDP socket that we listen on for protobuf messages from SSL Game Controller
     boost::asio::ip::udp::socket socket_;
-    // The endpoint for the sender, in this case SSL Game Controller
-    boost::asio::ip::udp::endpoint sender_endpoint_;
 
     // The maximum length of the buffer we use to receive data packets from the network
     static constexpr unsigned int max_buffer_length = 4096;
-    // Acts as a buffer to store the raw received data from the network
-    std::array<char, max_buffer_length> raw_received_data_;
-    // The function to call on every received packet of vision data
-    std::function<void(Referee)> handle_function;
+    // The maximum number of datagrams we read from the socket with a single system call
+    static constexpr unsigned int max_packets_per_batch = 16;
+    // Acts as a set of buffers to store the raw received data from the network. There is
+    // one buffer for each datagram that can be read in a single batch
+    std::array<std::array<char, max_buffer_length>, max_packets_per_batch>
+        raw_received_data_;
+    // The scatter/gather descriptors that point recvmmsg at the buffers above
+    std::array<iovec, max_packets_per_batch> received_data_iovecs_;
+    std::array<mmsghdr, max_packets_per_batch> received_message_headers_;
+    // Buffers the kernel writes the receive timestamp of each datagram into
+    std::array<std::array<char, KernelReceiveTimestamps::CONTROL_BUFFER_LENGTH>,
+               max_packets_per_batch>
+        received_control_data_;
+    // The packet every received datagram is parsed into. The same message is reused for
+    // every datagram so that protobuf can reuse the memory it has already allocated
+    // rather than allocating a new message for each packet
+    Referee packet_data_;
+    // Records every received datagram, if recording is enabled
+    std::shared_ptr<PacketLogWriter> packet_log_writer;
+    // The function to call on every received packet of GameController data
+    std::function<void(const Referee&, double)> handle_function;
 };
@@ -2,52 +2,68 @@
 #include <ros/time.h>
 #include <thunderbots_msgs/Primitive.h>
 #include <thunderbots_msgs/PrimitiveArray.h>
-#include <thunderbots_msgs/World.h>
+#include <thunderbots_msgs/WorldDelta.h>
 
-#include "ai/primitive/primitive.h"
 #include "ai/primitive/primitive_factory.h"
+#include "ai/primitive/primitive_variant.h"
 #include "geom/point.h"
 #include "mrf_backend.h"
 #include "util/constants.h"
+#include "util/event_loop/epoll_event_loop.h"
+#include "util/latency_tracker/latency_tracker.h"
 #include "util/logger/init.h"
 #include "util/parameter/dynamic_parameter_utils.h"
 #include "util/parameter/dynamic_parameters.h"
-#include "util/ros_messages.h"
+#include "util/shared_memory/shared_world_subscriber.h"
+#include "util/world_delta/world_delta_decoder.h"
 
 
 namespace
 {
-    // A vector of primitives. It is cleared each tick, populated by the callbacks
-    // that receive primitive commands, and is processed by the backend to send primitives
-    // to the robots over radio.
-    std::vector<std::unique_ptr<Primitive>> primitives;
+    // Runs everything that uses the backend on the main thread, sleeping until the
+    // dongle has events or a ROS callback gives it work. It is declared before the
+    // backend so that it outlives it
+    Util::EpollEventLoop event_loop;
 
-    // The MRFBackend instance that connects to the dongle
+    // The MRFBackend instance that connects to the dongle. It is only used by the main
+    // thread
     MRFBackend backend = MRFBackend();
+
+    // Measures how long it takes for Primitives to reach this node and be sent to the
+    // dongle. It is only used by the main thread
+    Util::LatencyTracker latency_tracker("radio_communication");
+
+    // Receives the World from network_input through shared memory, if enabled
+    std::unique_ptr<Util::SharedWorldSubscriber> shared_world_subscriber;
+
+    // Rebuilds the World from the changes network_input publishes over ROS
+    Util::WorldDeltaDecoder world_delta_decoder;
+
+    // The longest the main thread sleeps for before checking if the node has been shut
+    // down
+    const Duration MAX_EVENT_LOOP_WAIT = Duration::fromMilliseconds(100);
 }  // namespace
 
-// Callbacks
-void primitiveUpdateCallback(const thunderbots_msgs::PrimitiveArray::ConstPtr& msg)
+// Runs on the main thread
+void sendPrimitives(const std::vector<PrimitiveVariant>& primitives,
+                    const thunderbots_msgs::FrameTrace& trace, double receive_timestamp,
+                    double post_timestamp)
 {
-    thunderbots_msgs::PrimitiveArray prim_array_msg = *msg;
-    for (const thunderbots_msgs::Primitive& prim_msg : prim_array_msg.primitives)
-    {
-        primitives.emplace_back(AI::Primitive::createPrimitiveFromROSMessage(prim_msg));
-    }
+    // How long the Primitives waited for the main thread to wake up is the latency
+    // added by handing them over from the ROS callback
+    latency_tracker.recordStageLatency("event_loop_wake_up", post_timestamp,
+                                       Util::LatencyTracker::getCurrentTimestamp());
 
-    // Send primitives
     backend.sendPrimitives(primitives);
+
+    latency_tracker.recordPrimitivesSent(trace, receive_timestamp,
+                                         Util::LatencyTracker::getCurrentTimestamp());
+    latency_tracker.publishAndLogIfReportDue();
 }
 
-void worldUpdateCallback(const thunderbots_msgs::World::ConstPtr& msg)
+// Runs on the main thread
+void updateWorld(const Team& friendly_team, const Ball& ball)
 {
-    thunderbots_msgs::World world_msg = *msg;
-
-    // Extract team and ball data
-    Team friendly_team =
-        Util::ROSMessages::createTeamFromROSMessage(world_msg.friendly_team);
-    Ball ball = Util::ROSMessages::createBallFromROSMessage(world_msg.ball);
-
     std::vector<std::tuple<uint8_t, Point, Angle>> robots;
     for (const Robot& r : friendly_team.getAllRobots())
     {
@@ -62,6 +78,51 @@ void worldUpdateCallback(const thunderbots_msgs::World::ConstPtr& msg)
     backend.send_vision_packet();
 }
 
+// Gives the World to the main thread. This can be called from any thread
+void postWorld(const World& world)
+{
+    event_loop.post([friendly_team = world.friendlyTeam(), ball = world.ball()]() {
+        updateWorld(friendly_team, ball);
+    });
+}
+
+// Callbacks, which run on the AsyncSpinner thread
+void primitiveUpdateCallback(const thunderbots_msgs::PrimitiveArray::ConstPtr& msg)
+{
+    double receive_timestamp = Util::LatencyTracker::getCurrentTimestamp();
+
+    std::vector<PrimitiveVariant> primitives;
+    for (const thunderbots_msgs::Primitive& prim_msg : msg->primitives)
+    {
+        primitives.emplace_back(
+            AI::Primitive::createPrimitiveVariantFromROSMessage(prim_msg));
+    }
+
+    // Send the primitives from the main thread
+    double post_timestamp = Util::LatencyTracker::getCurrentTimestamp();
+    event_loop.post([primitives = std::move(primitives), trace = msg->trace,
+                     receive_timestamp, post_timestamp]() {
+        sendPrimitives(primitives, trace, receive_timestamp, post_timestamp);
+    });
+}
+
+void worldDeltaCallback(const thunderbots_msgs::WorldDelta::ConstPtr& msg)
+{
+    // Every change is applied even while we are using the World from shared memory, so
+    // the World from ROS is ready to use as soon as shared memory stops working
+    bool world_valid = world_delta_decoder.apply(*msg);
+
+    // The World from shared memory is newer, so we only use the World from ROS if we
+    // aren't getting it through shared memory
+    if (!world_valid ||
+        (shared_world_subscriber && shared_world_subscriber->isReceiving()))
+    {
+        return;
+    }
+
+    postWorld(world_delta_decoder.world());
+}
+
 int main(int argc, char** argv)
 {
     // Init ROS node
@@ -71,32 +132,54 @@ int main(int argc, char** argv)
     // Create subscribers to topics we care about
     ros::Subscriber prim_array_sub = node_handle.subscribe(
         Util::Constants::AI_PRIMITIVES_TOPIC, 1, primitiveUpdateCallback);
-    ros::Subscriber world_sub = node_handle.subscribe(
-        Util::Constants::NETWORK_INPUT_WORLD_TOPIC, 1, worldUpdateCallback);
+    ros::Subscriber world_delta_sub = node_handle.subscribe(
+        Util::Constants::NETWORK_INPUT_WORLD_DELTA_TOPIC,
+        Util::Constants::NETWORK_INPUT_WORLD_DELTA_QUEUE_SIZE, worldDeltaCallback);
 
     // Initialize the logger
     Util::Logger::LoggerSingleton::initializeLogger(node_handle);
 
-    // Initialize variables
-    primitives = std::vector<std::unique_ptr<Primitive>>();
+    // Initialize the latency diagnostics publisher
+    latency_tracker.initializePublisher(node_handle);
+
+    // Handle the dongle's events whenever it has any, rather than polling it
+    backend.watch_dongle_events(event_loop);
+
+    // Receive the World through shared memory when network_input is on the same machine,
+    // falling back to the ROS topic otherwise
+    bool use_shared_memory_world;
+    ros::NodeHandle("~").param<bool>("shared_memory_world", use_shared_memory_world,
+                                     true);
+    if (use_shared_memory_world)
+    {
+        shared_world_subscriber = std::make_unique<Util::SharedWorldSubscriber>(
+            Util::SharedWorldRing::NETWORK_INPUT_WORLD_SEGMENT,
+            [](const World& world, const thunderbots_msgs::FrameTrace& trace) {
+                postWorld(world);
+            });
+        shared_world_subscriber->startBackgroundThread();
+    }
 
     // Initialize Dynamic Parameters
     auto update_subscribers =
         Util::DynamicParameters::initUpdateSubscriptions(node_handle);
 
-    // Main loop
+    // Service ROS callbacks on their own thread. They hand their work to the main
+    // thread through the event loop, since the backend is not thread safe
+    ros::AsyncSpinner spinner(1);
+    spinner.start();
+
+    // Main loop. This sleeps until the dongle has events or a callback gives us work,
+    // instead of spinning
     while (ros::ok())
     {
-        // Clear all primitives each tick
-        primitives.clear();
-
-        // Handle libusb events for the dongle
-        backend.update_dongle_events();
-
-        // Spin once to let all necessary callbacks run
-        // The callbacks will populate the primitives vector
-        ros::spinOnce();
+        backend.wait_for_dongle_events(event_loop, MAX_EVENT_LOOP_WAIT);
     }
 
+    // Stop everything that posts to the event loop before anything it uses is
+    // destroyed
+    spinner.stop();
+    shared_world_subscriber.reset();
+
     return 0;
 }
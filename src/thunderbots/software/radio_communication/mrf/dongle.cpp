@@ -1,8 +1,10 @@
 #include "dongle.h"
 
+#include <poll.h>
 #include <sigc++/bind.h>
 #include <sigc++/functors/mem_fun.h>
 #include <sigc++/reference_wrapper.h>
+#include <sys/epoll.h>
 #include <unistd.h>
 
 #include <algorithm>
@@ -47,10 +49,15 @@ namespace
 
 MRFDongle::MRFDongle()
     : context(),
+      event_loop(nullptr),
+      watched_fds(),
       device(context, MRF::VENDOR_ID, MRF::PRODUCT_ID, std::getenv("MRF_SERIAL")),
       radio_interface(-1),
       configuration_altsetting(-1),
       normal_altsetting(-1),
+      drive_packet_pipeline([this](const uint8_t *packet, std::size_t length) {
+          submit_drive_transfer(packet, length);
+      }),
       status_transfer(device, 3, 1, true, 0),
       pending_beep_length(0),
       estop_state(EStopState::STOP)
@@ -234,10 +241,59 @@ void MRFDongle::handle_libusb_events()
     context.handle_usb_events();
 }
 
+void MRFDongle::watch_libusb_events(Util::EpollEventLoop &event_loop)
+{
+    this->event_loop = &event_loop;
+    for (const auto &[fd, events] : context.get_pollfds())
+    {
+        watch_fd(fd, events);
+    }
+    context.set_pollfd_notifiers([this](int fd, short events) { watch_fd(fd, events); },
+                                 [this](int fd) { unwatch_fd(fd); });
+}
+
+std::optional<Duration> MRFDongle::get_libusb_timeout() const
+{
+    std::optional<std::chrono::microseconds> timeout = context.get_next_timeout();
+    if (!timeout)
+    {
+        return std::nullopt;
+    }
+    return Duration::fromSeconds(std::chrono::duration<double>(*timeout).count());
+}
+
+void MRFDongle::watch_fd(int fd, short events)
+{
+    uint32_t epoll_events = 0;
+    if (events & POLLIN)
+    {
+        epoll_events |= EPOLLIN;
+    }
+    if (events & POLLOUT)
+    {
+        epoll_events |= EPOLLOUT;
+    }
+    event_loop->addFd(fd, epoll_events, [this]() { handle_libusb_events(); });
+    watched_fds.insert(fd);
+}
+
+void MRFDongle::unwatch_fd(int fd)
+{
+    event_loop->removeFd(fd);
+    watched_fds.erase(fd);
+}
+
 MRFDongle::~MRFDongle()
 {
     // Mark USB device as shutting down to squelch cancelled transfer warnings.
     device.mark_shutting_down();
+
+    // The event loop outlives the dongle, so it must stop calling into it
+    context.set_pollfd_notifiers(nullptr, nullptr);
+    for (int fd : watched_fds)
+    {
+        event_loop->removeFd(fd);
+    }
 }
 
 void MRFDongle::beep(unsigned int length)
@@ -416,7 +472,7 @@ void MRFDongle::send_camera_packet(std::vector<std::tuple<uint8_t, Point, Angle>
                << std::endl;
 };
 
-void MRFDongle::send_drive_packet(const std::vector<std::unique_ptr<Primitive>> &prims)
+void MRFDongle::send_drive_packet(const std::vector<PrimitiveVariant> &prims)
 {
     // More than 1 prim.
     if (!prims.empty())
@@ -427,6 +483,10 @@ void MRFDongle::send_drive_packet(const std::vector<std::unique_ptr<Primitive>>
             throw std::invalid_argument("Too many primitives in vector.");
         }
 
+        // Encode into the pipeline's spare buffer, so the packet waiting to be sent is
+        // untouched until this one is finished
+        uint8_t *drive_packet           = drive_packet_pipeline.get_encode_buffer();
+        std::size_t drive_packet_length = 0;
         if (num_prims == MAX_ROBOTS_OVER_RADIO)
         {
             // All robots are present. Build a full-size packet with all the
@@ -441,42 +501,42 @@ void MRFDongle::send_drive_packet(const std::vector<std::unique_ptr<Primitive>>
         {
             // Only some robots are present. Build a reduced-size packet
             // with robot indices prefixed.
-            drive_packet_length = 0;
             for (std::size_t i = 0; i != num_prims; ++i)
             {
                 drive_packet[drive_packet_length++] =
-                    static_cast<uint8_t>(prims[i]->getRobotId());
+                    static_cast<uint8_t>(getPrimitive(prims[i]).getRobotId());
                 encode_primitive(prims[i], &drive_packet[drive_packet_length]);
                 drive_packet_length += 8;
             }
         }
 
-        submit_drive_transfer();
+        // Sent right away if no drive transfer is in flight, and otherwise as soon as it
+        // completes, unless a newer packet replaces it first
+        drive_packet_pipeline.finish_encoding(drive_packet_length);
     }
 }
 
-bool MRFDongle::submit_drive_transfer()
+const DrivePacketPipeline::Statistics &MRFDongle::get_drive_packet_statistics() const
 {
-    // Submit drive_packet when possible.
-    if (!drive_transfer)
-    {
-        drive_transfer.reset(new USB::BulkOutTransfer(device, 1, drive_packet,
-                                                      drive_packet_length, 64, 0));
-        drive_transfer->signal_done.connect(
-            sigc::mem_fun(this, &MRFDongle::handle_drive_transfer_done));
-        drive_transfer->submit();
-    }
+    return drive_packet_pipeline.get_statistics();
+}
 
-    return false;
+void MRFDongle::submit_drive_transfer(const uint8_t *packet, std::size_t length)
+{
+    // The transfer copies the packet, so the pipeline can reuse its buffer
+    drive_transfer.reset(new USB::BulkOutTransfer(device, 1, packet, length, 64, 0));
+    drive_transfer->signal_done.connect(
+        sigc::mem_fun(this, &MRFDongle::handle_drive_transfer_done));
+    drive_transfer->submit();
 }
 
-void MRFDongle::encode_primitive(const std::unique_ptr<Primitive> &prim, void *out)
+void MRFDongle::encode_primitive(const PrimitiveVariant &prim, void *out)
 {
     uint16_t words[4];
     MRFPrimitiveVisitor visitor = MRFPrimitiveVisitor();
 
     // Visit the primitive.
-    prim->accept(visitor);
+    visitPrimitive(prim, visitor);
     RadioPrimitive r_prim = visitor.getSerializedRadioPacket();
 
     // Encode the parameter words.
@@ -562,8 +622,12 @@ void MRFDongle::encode_primitive(const std::unique_ptr<Primitive> &prim, void *o
 
 void MRFDongle::handle_drive_transfer_done(AsyncOperation<void> &op)
 {
+    // Keep the finished transfer alive until its result has been checked, and submit
+    // the newest pending packet first so a failed transfer doesn't stop newer commands
+    // from being sent
+    std::unique_ptr<USB::BulkOutTransfer> done_transfer = std::move(drive_transfer);
+    drive_packet_pipeline.handle_transfer_done();
     op.result();
-    drive_transfer.reset();
 }
 
 void MRFDongle::handle_camera_transfer_done(
@@ -14,20 +14,25 @@
 #include <cstdint>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <queue>
+#include <set>
 #include <tuple>
 #include <utility>
 #include <vector>
 
-#include "ai/primitive/primitive.h"
+#include "ai/primitive/primitive_variant.h"
+#include "drive_packet_pipeline.h"
 #include "geom/angle.h"
 #include "geom/point.h"
 #include "send_reliable_message_operation.h"
 #include "shared/constants.h"
 #include "usb/libusb.h"
 #include "util/async_operation.h"
+#include "util/event_loop/epoll_event_loop.h"
 #include "util/noncopyable.h"
 #include "util/property.h"
+#include "util/time/duration.h"
 
 /**
  * An operation to send a reliable message.
@@ -56,7 +61,15 @@ class MRFDongle final
      *
      * @param prims vector of primatives from HL
      */
-    void send_drive_packet(const std::vector<std::unique_ptr<Primitive>> &prims);
+    void send_drive_packet(const std::vector<PrimitiveVariant> &prims);
+
+    /**
+     * Returns how many drive packets have been sent or superseded, and how long they
+     * waited to be submitted and to complete.
+     *
+     * @return the statistics of the drive packets sent since the dongle was created
+     */
+    const DrivePacketPipeline::Statistics &get_drive_packet_statistics() const;
 
     /**
      * Sends a camera packet over radio to all robots, including vision coordinates of
@@ -70,10 +83,33 @@ class MRFDongle final
 
     /**
      * Handles libusb callbacks.
-     * IMPORTANT: MUST BE CALLED ON EACH LOOP
+     * IMPORTANT: MUST BE CALLED ON EACH LOOP, unless the libusb events are watched by
+     * an event loop
      */
     void handle_libusb_events();
 
+    /**
+     * Watches the file descriptors libusb uses in the given event loop, so that
+     * handle_libusb_events is called whenever there are events to handle instead of
+     * on each loop. handle_libusb_events must still be called once the time returned
+     * by get_libusb_timeout has passed.
+     *
+     * This must be called before the event loop is run, or from the thread that runs
+     * it, and the event loop must outlive the dongle.
+     *
+     * @param event_loop the event loop to watch the file descriptors in
+     */
+    void watch_libusb_events(Util::EpollEventLoop &event_loop);
+
+    /**
+     * Returns how long until handle_libusb_events must be called to handle a libusb
+     * timeout, even if there are no events.
+     *
+     * @return the time until the next timeout, or std::nullopt if there are no
+     * pending timeouts
+     */
+    std::optional<Duration> get_libusb_timeout() const;
+
     /**
      * Generates an audible beep on the dongle.
      *
@@ -133,6 +169,12 @@ class MRFDongle final
 
     /* libusb objects for the dongle */
     USB::Context context;
+    /* The event loop watching the libusb file descriptors, if there is one */
+    Util::EpollEventLoop *event_loop;
+    std::set<int> watched_fds;
+    void watch_fd(int fd, short events);
+    void unwatch_fd(int fd);
+
     USB::DeviceHandle device;
     int radio_interface, configuration_altsetting, normal_altsetting;
     std::unique_ptr<USB::InterfaceClaimer> interface_claimer;
@@ -140,12 +182,10 @@ class MRFDongle final
     uint16_t pan_;
 
     /* Functions that handle encoding and sending drive packets. */
-    void encode_primitive(const std::unique_ptr<Primitive> &prim, void *out);
-    bool submit_drive_transfer();
+    void encode_primitive(const PrimitiveVariant &prim, void *out);
+    void submit_drive_transfer(const uint8_t *packet, std::size_t length);
     void handle_drive_transfer_done(AsyncOperation<void> &);
-    sigc::connection drive_submit_connection;
-    uint8_t drive_packet[64];
-    std::size_t drive_packet_length;
+    DrivePacketPipeline drive_packet_pipeline;
     std::unique_ptr<USB::BulkOutTransfer> drive_transfer;
 
     /* Camera (vision) packet stuff */
@@ -0,0 +1,154 @@
+#include "drive_packet_pipeline.h"
+
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#include "util/constants.h"
+#include "util/logger/init.h"
+
+namespace
+{
+    Duration toDuration(const std::chrono::steady_clock::duration &duration)
+    {
+        return Duration::fromSeconds(std::chrono::duration<double>(duration).count());
+    }
+}  // namespace
+
+DrivePacketPipeline::DrivePacketPipeline(SubmitFunction submit_function)
+    : submit_function(submit_function),
+      packets(),
+      encode_index(0),
+      pending_index(1),
+      packet_pending(false),
+      transfer_in_flight(false),
+      submit_time(),
+      statistics(),
+      num_packets_completed_since_report(0),
+      num_packets_superseded_since_report(0),
+      encode_to_submit_since_report(),
+      submit_to_complete_since_report(),
+      time_last_reported(std::chrono::steady_clock::now())
+{
+}
+
+uint8_t *DrivePacketPipeline::get_encode_buffer()
+{
+    return packets[encode_index].data.data();
+}
+
+void DrivePacketPipeline::finish_encoding(std::size_t length)
+{
+    if (length > MAX_DRIVE_PACKET_LENGTH)
+    {
+        throw std::invalid_argument("Drive packet is too long.");
+    }
+
+    packets[encode_index].length      = length;
+    packets[encode_index].encode_time = std::chrono::steady_clock::now();
+    statistics.num_packets_encoded++;
+
+    // The newest packet always wins, so a packet that is still pending is dropped
+    if (packet_pending)
+    {
+        statistics.num_packets_superseded++;
+        num_packets_superseded_since_report++;
+    }
+    std::swap(encode_index, pending_index);
+    packet_pending = true;
+
+    if (!transfer_in_flight)
+    {
+        submit_pending_packet();
+    }
+}
+
+void DrivePacketPipeline::handle_transfer_done()
+{
+    if (!transfer_in_flight)
+    {
+        return;
+    }
+
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    transfer_in_flight                        = false;
+    statistics.num_packets_completed++;
+    statistics.submit_to_complete.record(toDuration(now - submit_time));
+    num_packets_completed_since_report++;
+    submit_to_complete_since_report.record(toDuration(now - submit_time));
+
+    if (packet_pending)
+    {
+        submit_pending_packet();
+    }
+
+    log_summary_if_due(now);
+}
+
+bool DrivePacketPipeline::is_transfer_in_flight() const
+{
+    return transfer_in_flight;
+}
+
+bool DrivePacketPipeline::has_pending_packet() const
+{
+    return packet_pending;
+}
+
+const DrivePacketPipeline::Statistics &DrivePacketPipeline::get_statistics() const
+{
+    return statistics;
+}
+
+void DrivePacketPipeline::submit_pending_packet()
+{
+    const DrivePacket &packet                 = packets[pending_index];
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+    // If the submission throws, the packet stays pending so the next one replaces it
+    submit_function(packet.data.data(), packet.length);
+
+    packet_pending     = false;
+    transfer_in_flight = true;
+    submit_time        = now;
+    statistics.num_packets_submitted++;
+    statistics.encode_to_submit.record(toDuration(now - packet.encode_time));
+    encode_to_submit_since_report.record(toDuration(now - packet.encode_time));
+}
+
+void DrivePacketPipeline::log_summary_if_due(
+    const std::chrono::steady_clock::time_point &now)
+{
+    std::chrono::duration<double> time_since_report = now - time_last_reported;
+    if (time_since_report <
+        std::chrono::seconds(Util::Constants::LATENCY_REPORT_PERIOD_SECONDS))
+    {
+        return;
+    }
+
+    std::stringstream summary;
+    summary << std::fixed << std::setprecision(3) << "Sent "
+            << num_packets_completed_since_report << " drive packets, waiting "
+            << encode_to_submit_since_report.getPercentile(0.5).getMilliseconds() << " / "
+            << encode_to_submit_since_report.getPercentile(0.99).getMilliseconds()
+            << " / " << encode_to_submit_since_report.getMaximum().getMilliseconds()
+            << " ms to be submitted and taking "
+            << submit_to_complete_since_report.getPercentile(0.5).getMilliseconds()
+            << " / "
+            << submit_to_complete_since_report.getPercentile(0.99).getMilliseconds()
+            << " / " << submit_to_complete_since_report.getMaximum().getMilliseconds()
+            << " ms to complete (p50 / p99 / max)";
+    if (num_packets_superseded_since_report > 0)
+    {
+        summary << ", and " << num_packets_superseded_since_report
+                << " were superseded by newer packets";
+    }
+    LOG(INFO) << summary.str() << std::endl;
+
+    time_last_reported                  = now;
+    num_packets_completed_since_report  = 0;
+    num_packets_superseded_since_report = 0;
+    encode_to_submit_since_report.reset();
+    submit_to_complete_since_report.reset();
+}
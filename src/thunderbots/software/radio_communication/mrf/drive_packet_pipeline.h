@@ -0,0 +1,151 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "util/time/latency_histogram.h"
+
+/**
+ * Queues the drive packets sent to the dongle so that only one transfer is in flight at a
+ * time, and the newest packet is always the next one sent.
+ *
+ * Packets are encoded into a back buffer, which is swapped with the pending packet once
+ * encoding finishes, so a pending packet is never partly overwritten. If a packet is
+ * already pending when a newer one is finished, the older one is superseded and never
+ * sent. The pending packet is submitted as soon as the transfer in flight completes.
+ *
+ * How long each packet waited between being encoded and submitted, and between being
+ * submitted and completing, is recorded in the Statistics of the pipeline, and a
+ * summary is logged every Util::Constants::LATENCY_REPORT_PERIOD_SECONDS.
+ *
+ * This class is not thread safe, and must only be used from the thread that handles the
+ * dongle's libusb events.
+ */
+class DrivePacketPipeline final
+{
+   public:
+    // The largest drive packet that can be sent to the dongle
+    static constexpr std::size_t MAX_DRIVE_PACKET_LENGTH = 64;
+
+    /**
+     * Submits a drive packet to the dongle. The packet is only valid until the function
+     * returns, so it must be copied if it is needed after that.
+     */
+    using SubmitFunction = std::function<void(const uint8_t *packet, std::size_t length)>;
+
+    /**
+     * The statistics of every packet since the pipeline was created
+     */
+    struct Statistics
+    {
+        // How many packets have finished being encoded
+        unsigned long num_packets_encoded = 0;
+        // How many packets have been submitted to the dongle
+        unsigned long num_packets_submitted = 0;
+        // How many packets were replaced by a newer one before they could be submitted
+        unsigned long num_packets_superseded = 0;
+        // How many submitted packets have finished being transferred
+        unsigned long num_packets_completed = 0;
+        // How long each submitted packet waited between being encoded and submitted
+        LatencyHistogram encode_to_submit;
+        // How long each transfer took between being submitted and completing
+        LatencyHistogram submit_to_complete;
+    };
+
+    /**
+     * Creates a new DrivePacketPipeline with no packets pending or in flight
+     *
+     * @param[in] submit_function called to submit each packet that is sent
+     */
+    explicit DrivePacketPipeline(SubmitFunction submit_function);
+
+    /**
+     * Returns the buffer the next packet should be encoded into. It has space for
+     * MAX_DRIVE_PACKET_LENGTH bytes, and is never the packet that is pending.
+     *
+     * @return the buffer to encode the next packet into
+     */
+    uint8_t *get_encode_buffer();
+
+    /**
+     * Makes the packet in the encode buffer the pending packet, replacing any packet
+     * that was pending, and submits it right away if no transfer is in flight.
+     *
+     * @param[in] length the number of bytes encoded into the encode buffer
+     *
+     * @throws std::invalid_argument if the length is longer than
+     * MAX_DRIVE_PACKET_LENGTH
+     */
+    void finish_encoding(std::size_t length);
+
+    /**
+     * Records that the transfer in flight has completed, whether or not it succeeded,
+     * and submits the pending packet if there is one.
+     */
+    void handle_transfer_done();
+
+    /**
+     * Returns whether a submitted packet has not finished being transferred yet
+     *
+     * @return true if a transfer is in flight, and false otherwise
+     */
+    bool is_transfer_in_flight() const;
+
+    /**
+     * Returns whether a packet is waiting to be submitted
+     *
+     * @return true if a packet is pending, and false otherwise
+     */
+    bool has_pending_packet() const;
+
+    /**
+     * Returns the statistics of every packet since the pipeline was created
+     *
+     * @return the statistics of the pipeline
+     */
+    const Statistics &get_statistics() const;
+
+   private:
+    struct DrivePacket
+    {
+        std::array<uint8_t, MAX_DRIVE_PACKET_LENGTH> data;
+        std::size_t length;
+        std::chrono::steady_clock::time_point encode_time;
+    };
+
+    /**
+     * Submits the pending packet, and records how long it waited
+     */
+    void submit_pending_packet();
+
+    /**
+     * Logs a summary of the packets sent since the last summary, if one is due
+     *
+     * @param[in] now the current time
+     */
+    void log_summary_if_due(const std::chrono::steady_clock::time_point &now);
+
+    SubmitFunction submit_function;
+
+    // The packet being encoded and the packet waiting to be submitted. They are swapped
+    // when encoding finishes
+    std::array<DrivePacket, 2> packets;
+    std::size_t encode_index;
+    std::size_t pending_index;
+    bool packet_pending;
+
+    bool transfer_in_flight;
+    std::chrono::steady_clock::time_point submit_time;
+
+    Statistics statistics;
+
+    // The statistics since the last summary was logged
+    unsigned long num_packets_completed_since_report;
+    unsigned long num_packets_superseded_since_report;
+    LatencyHistogram encode_to_submit_since_report;
+    LatencyHistogram submit_to_complete_since_report;
+    std::chrono::steady_clock::time_point time_last_reported;
+};
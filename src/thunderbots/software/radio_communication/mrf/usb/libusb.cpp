@@ -23,6 +23,8 @@ USB::Context::Context()
 
 USB::Context::~Context()
 {
+    // Nothing should be notified about the file descriptors closed on exit
+    libusb_set_pollfd_notifiers(context, nullptr, nullptr, nullptr);
     libusb_exit(context);
     context = nullptr;
 }
@@ -34,6 +36,61 @@ void USB::Context::handle_usb_events()
              0);
 }
 
+std::vector<std::pair<int, short>> USB::Context::get_pollfds() const
+{
+    const libusb_pollfd **libusb_pollfds = libusb_get_pollfds(context);
+    if (!libusb_pollfds)
+    {
+        throw std::runtime_error("libusb_get_pollfds failed");
+    }
+
+    std::vector<std::pair<int, short>> pollfds;
+    for (const libusb_pollfd **pollfd = libusb_pollfds; *pollfd; ++pollfd)
+    {
+        pollfds.emplace_back((*pollfd)->fd, (*pollfd)->events);
+    }
+    libusb_free_pollfds(libusb_pollfds);
+
+    return pollfds;
+}
+
+void USB::Context::set_pollfd_notifiers(std::function<void(int, short)> added,
+                                        std::function<void(int)> removed)
+{
+    pollfd_added   = added;
+    pollfd_removed = removed;
+    libusb_set_pollfd_notifiers(context, &Context::handle_pollfd_added,
+                                &Context::handle_pollfd_removed, this);
+}
+
+std::optional<std::chrono::microseconds> USB::Context::get_next_timeout() const
+{
+    timeval tv;
+    if (!check_fn("libusb_get_next_timeout", libusb_get_next_timeout(context, &tv), 0))
+    {
+        return std::nullopt;
+    }
+    return std::chrono::seconds(tv.tv_sec) + std::chrono::microseconds(tv.tv_usec);
+}
+
+void LIBUSB_CALL USB::Context::handle_pollfd_added(int fd, short events, void *user_data)
+{
+    Context *context = static_cast<Context *>(user_data);
+    if (context->pollfd_added)
+    {
+        context->pollfd_added(fd, events);
+    }
+}
+
+void LIBUSB_CALL USB::Context::handle_pollfd_removed(int fd, void *user_data)
+{
+    Context *context = static_cast<Context *>(user_data);
+    if (context->pollfd_removed)
+    {
+        context->pollfd_removed(fd);
+    }
+}
+
 USB::ConfigurationSetter::ConfigurationSetter(DeviceHandle &device, int configuration)
     : device(device)
 {
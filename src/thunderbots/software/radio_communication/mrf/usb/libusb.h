@@ -5,13 +5,17 @@
 #include <sigc++/connection.h>
 
 #include <cassert>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <list>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "bulktransfer.h"
@@ -43,6 +47,38 @@ namespace USB
          */
         void handle_usb_events();
 
+        /**
+         * Returns the file descriptors libusb needs to have polled. If the caller
+         * waits on these file descriptors and for the next timeout, it only needs to
+         * call handle_usb_events when one of them is ready or the timeout expires.
+         *
+         * @return pairs of a file descriptor and the poll() events (such as POLLIN) to
+         * wait for on it
+         */
+        std::vector<std::pair<int, short>> get_pollfds() const;
+
+        /**
+         * Sets the functions that are called when libusb starts or stops using a file
+         * descriptor that needs to be polled, replacing any set before.
+         *
+         * @param[in] added called with a new file descriptor and the poll() events to
+         * wait for on it, or empty to not be notified
+         *
+         * @param[in] removed called with a file descriptor that no longer needs to be
+         * polled, or empty to not be notified
+         */
+        void set_pollfd_notifiers(std::function<void(int, short)> added,
+                                  std::function<void(int)> removed);
+
+        /**
+         * Returns how long until handle_usb_events must be called to handle a timeout,
+         * even if none of the file descriptors are ready.
+         *
+         * @return the time until the next timeout, which is 0 if it has already
+         * expired, or std::nullopt if there are no pending timeouts
+         */
+        std::optional<std::chrono::microseconds> get_next_timeout() const;
+
         /**
          * Deinitializes the library and destroys the context.
          *
@@ -55,7 +91,13 @@ namespace USB
         friend class DeviceList;
         friend class DeviceHandle;
 
+        static void LIBUSB_CALL handle_pollfd_added(int fd, short events,
+                                                    void *user_data);
+        static void LIBUSB_CALL handle_pollfd_removed(int fd, void *user_data);
+
         libusb_context *context;
+        std::function<void(int, short)> pollfd_added;
+        std::function<void(int)> pollfd_removed;
     };
 
     /**
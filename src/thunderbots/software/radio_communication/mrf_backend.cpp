@@ -1,6 +1,7 @@
 #include "mrf_backend.h"
 
 #include <chrono>
+#include <optional>
 
 #include "util/logger/init.h"
 
@@ -12,7 +13,7 @@ MRFBackend::MRFBackend()
 
 MRFBackend::~MRFBackend() {}
 
-void MRFBackend::sendPrimitives(const std::vector<std::unique_ptr<Primitive>>& primitives)
+void MRFBackend::sendPrimitives(const std::vector<PrimitiveVariant>& primitives)
 {
     dongle.send_drive_packet(primitives);
 }
@@ -50,3 +51,25 @@ void MRFBackend::update_dongle_events()
 {
     dongle.handle_libusb_events();
 }
+
+void MRFBackend::watch_dongle_events(Util::EpollEventLoop& event_loop)
+{
+    dongle.watch_libusb_events(event_loop);
+}
+
+void MRFBackend::wait_for_dongle_events(Util::EpollEventLoop& event_loop,
+                                        const Duration& max_wait)
+{
+    Duration timeout                       = max_wait;
+    std::optional<Duration> libusb_timeout = dongle.get_libusb_timeout();
+    if (libusb_timeout && *libusb_timeout < timeout)
+    {
+        timeout = *libusb_timeout;
+    }
+
+    // If nothing woke the loop up, libusb may have a timeout to handle
+    if (!event_loop.runOnce(timeout))
+    {
+        dongle.handle_libusb_events();
+    }
+}
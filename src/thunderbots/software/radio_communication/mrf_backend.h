@@ -5,6 +5,8 @@
 #include "ai/world/ball.h"
 #include "ai/world/team.h"
 #include "mrf/dongle.h"
+#include "util/event_loop/epoll_event_loop.h"
+#include "util/time/duration.h"
 
 class MRFBackend
 {
@@ -18,17 +20,42 @@ class MRFBackend
     ~MRFBackend();
 
     /**
-     * IMPORTANT: Must be called in the main loop
+     * IMPORTANT: Must be called in the main loop, unless the dongle's events are
+     * watched by an event loop
      * Allows libusb events on the dongle to complete.
      */
     void update_dongle_events();
 
+    /**
+     * Handles the dongle's libusb events from the given event loop whenever there are
+     * any, so that update_dongle_events doesn't need to be called in a busy loop. The
+     * event loop must then be run with wait_for_dongle_events, and must outlive this
+     * backend.
+     *
+     * This must be called before the event loop is run, or from the thread that runs
+     * it, and the backend must only be used from that thread.
+     *
+     * @param event_loop The event loop to watch the dongle's events in
+     */
+    void watch_dongle_events(Util::EpollEventLoop& event_loop);
+
+    /**
+     * Runs the event loop once, sleeping until the dongle has events, a task is posted
+     * to the loop or it is woken up, libusb has a timeout to handle, or max_wait
+     * passes, and handles whatever woke it up.
+     *
+     * @param event_loop The event loop watching the dongle's events
+     * @param max_wait The longest time to sleep for
+     */
+    void wait_for_dongle_events(Util::EpollEventLoop& event_loop,
+                                const Duration& max_wait);
+
     /**
      * Sends the given primitives to the backend to control the robots
      *
      * @param primitives the list of primitives to send
      */
-    void sendPrimitives(const std::vector<std::unique_ptr<Primitive>>& primitives);
+    void sendPrimitives(const std::vector<PrimitiveVariant>& primitives);
 
     /**
      * Updates the detected robots from vision.
@@ -0,0 +1,175 @@
+/**
+ * Plays the AI through a batch of simulated Scenarios, sharded across threads, and
+ * reports the outcomes (goals, possession and passes), the AI tick latency, and the CPU
+ * time used.
+ *
+ * Every Scenario runs its own AI against the headless Simulator, so Scenarios don't
+ * share any state and give the same outcomes however many threads they are run on.
+ *
+ * Usage: scenario_runner [--threads <number of threads>]
+ *                        [--variations <number of variations of each Scenario>]
+ *                        [--baseline <baseline file>]
+ *                        [--write-baseline <baseline file>]
+ *                        [--write-latency-baseline <baseline file>]
+ *
+ * With --baseline the results are compared against the baseline, and the runner exits
+ * with a non-zero status if any of them regressed. With --write-baseline the outcomes
+ * are saved as a new baseline. The runner also exits with a non-zero status if any
+ * Scenario fails.
+ *
+ * scenario_runner/baseline.txt is the baseline for the default variations. It only
+ * holds the outcomes, which are the same on any machine. The AI tick latency is not, so
+ * to check it for regressions, first write a baseline with --write-latency-baseline on
+ * the same machine (for example from the commit being compared against), and then
+ * pass that baseline to --baseline.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "ai/ai.h"
+#include "scenario_runner/scenario_report.h"
+#include "scenario_runner/scenario_runner.h"
+#include "scenario_runner/scenarios.h"
+
+namespace
+{
+    const unsigned int DEFAULT_NUM_VARIATIONS = 50;
+
+    // Creates an AI to run a Scenario. Scenarios are already run on every core, so the
+    // AI doesn't plan paths on any extra threads, and each AI has its own TickBudget
+    ScenarioRunner::PrimitiveFunction createAI(unsigned int seed)
+    {
+        auto ai = std::make_shared<AI>(seed, 0, std::make_shared<TickBudget>());
+        return [ai](const World& world) { return ai->getPrimitives(world); };
+    }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    size_t num_threads          = std::max(1u, std::thread::hardware_concurrency());
+    unsigned int num_variations = DEFAULT_NUM_VARIATIONS;
+    std::string baseline_path;
+    std::string write_baseline_path;
+    std::string write_latency_baseline_path;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string argument = argv[i];
+        if (i + 1 >= argc)
+        {
+            std::cerr << "Missing value for " << argument << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        std::string value = argv[++i];
+        if (argument == "--threads")
+        {
+            num_threads = static_cast<size_t>(std::atoi(value.c_str()));
+        }
+        else if (argument == "--variations")
+        {
+            num_variations = static_cast<unsigned int>(std::atoi(value.c_str()));
+        }
+        else if (argument == "--baseline")
+        {
+            baseline_path = value;
+        }
+        else if (argument == "--write-baseline")
+        {
+            write_baseline_path = value;
+        }
+        else if (argument == "--write-latency-baseline")
+        {
+            write_latency_baseline_path = value;
+        }
+        else
+        {
+            std::cerr << "Unknown argument " << argument << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (num_threads == 0)
+    {
+        std::cerr << "At least one thread is needed to run the scenarios" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::vector<Scenario> scenarios = Scenarios::createStandardScenarios(num_variations);
+    ScenarioRunner runner(createAI, num_threads);
+
+    auto start_time                     = std::chrono::steady_clock::now();
+    std::clock_t start_cpu_time         = std::clock();
+    std::vector<ScenarioResult> results = runner.runScenarios(scenarios);
+    double wall_seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time)
+            .count();
+    double process_cpu_seconds =
+        static_cast<double>(std::clock() - start_cpu_time) / CLOCKS_PER_SEC;
+
+    ScenarioReport report(results);
+    std::cout << "Ran " << scenarios.size() << " scenarios on " << num_threads
+              << " threads in " << std::fixed << std::setprecision(2) << wall_seconds
+              << "s, using " << process_cpu_seconds << "s of CPU time" << std::endl;
+    report.print(std::cout);
+
+    bool passed = true;
+    for (const ScenarioResult& result : results)
+    {
+        passed = passed && !result.error;
+    }
+
+    if (!baseline_path.empty())
+    {
+        std::ifstream baseline_file(baseline_path);
+        if (!baseline_file)
+        {
+            std::cerr << "Could not open baseline " << baseline_path << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        std::vector<std::string> regressions;
+        try
+        {
+            regressions =
+                report.findRegressions(ScenarioReport::readBaseline(baseline_file));
+        }
+        catch (const std::invalid_argument& ex)
+        {
+            std::cerr << "Could not read baseline " << baseline_path << ": " << ex.what()
+                      << std::endl;
+            return EXIT_FAILURE;
+        }
+        for (const std::string& regression : regressions)
+        {
+            std::cout << "REGRESSION: " << regression << std::endl;
+        }
+        std::cout << regressions.size() << " regressions from " << baseline_path
+                  << std::endl;
+        passed = passed && regressions.empty();
+    }
+
+    if (!write_baseline_path.empty())
+    {
+        std::ofstream baseline_file(write_baseline_path);
+        report.writeBaseline(baseline_file);
+        std::cout << "Wrote baseline to " << write_baseline_path << std::endl;
+    }
+
+    if (!write_latency_baseline_path.empty())
+    {
+        std::ofstream baseline_file(write_latency_baseline_path);
+        report.writeBaseline(baseline_file, true);
+        std::cout << "Wrote baseline with latency to " << write_latency_baseline_path
+                  << std::endl;
+    }
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "ai/primitive/primitive_variant.h"
+#include "ai/world/world.h"
+#include "util/refbox_constants.h"
+#include "util/time/duration.h"
+#include "util/time/latency_histogram.h"
+
+/**
+ * A referee command given part way through a Scenario
+ */
+struct RefereeCommand
+{
+    // How long after the start of the Scenario the command is given
+    Duration time;
+    RefboxGameState game_state;
+};
+
+/**
+ * A situation to test the AI in. The AI plays the friendly team against a scripted
+ * enemy team in a Simulator, starting from the given World, until a goal is scored or
+ * the Scenario runs out of time
+ */
+struct Scenario
+{
+    // A name that is unique among the Scenarios run together, used to compare the
+    // results of the Scenario against a baseline
+    std::string name;
+    World world;
+    // The Primitives the enemy robots run for the whole Scenario. Enemy robots without
+    // a Primitive stand still
+    std::vector<PrimitiveVariant> enemy_primitives;
+    // The referee commands, in the order they are given. The game state of the World is
+    // used until the first command is given
+    std::vector<RefereeCommand> referee_commands;
+    Duration duration;
+    // The seed for the random decisions of the AI and the noise in the simulation
+    unsigned int seed;
+};
+
+/**
+ * The outcome of running a Scenario
+ */
+struct ScenarioResult
+{
+    std::string scenario_name;
+    unsigned int goals_for     = 0;
+    unsigned int goals_against = 0;
+    // How long each team was the last to touch the ball for
+    Duration friendly_possession_time;
+    Duration enemy_possession_time;
+    // A pass is a kick by a friendly robot that is not a shot at the enemy goal. It is
+    // completed if a different friendly robot is the next robot to touch the ball
+    unsigned int passes_attempted = 0;
+    unsigned int passes_completed = 0;
+    // How long the AI took to calculate the Primitives on each tick
+    LatencyHistogram ai_tick_latency;
+    // The CPU time used to run the Scenario, including the simulation
+    Duration cpu_time;
+    // What went wrong if the AI or the simulation threw an exception, which stops the
+    // Scenario
+    std::optional<std::string> error;
+};
@@ -0,0 +1,306 @@
+#include "scenario_runner/scenario_report.h"
+
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+    // Returns the name of the group of Scenarios the named Scenario belongs to, which is
+    // its name without any number at the end
+    std::string getScenarioGroup(const std::string& scenario_name)
+    {
+        size_t group_end = scenario_name.find_last_not_of("0123456789");
+        if (group_end == std::string::npos)
+        {
+            return scenario_name;
+        }
+        if (group_end + 1 < scenario_name.size() && scenario_name[group_end] == '_')
+        {
+            return scenario_name.substr(0, group_end);
+        }
+        return scenario_name.substr(0, group_end + 1);
+    }
+}  // namespace
+
+ScenarioReport::ScenarioReport(const std::vector<ScenarioResult>& results)
+{
+    LatencyHistogram ai_tick_latency;
+    for (const ScenarioResult& result : results)
+    {
+        ScenarioSummary summary{result.goals_for,
+                                result.goals_against,
+                                result.friendly_possession_time.getSeconds(),
+                                result.enemy_possession_time.getSeconds(),
+                                result.passes_attempted,
+                                result.passes_completed,
+                                result.error};
+        if (!scenario_summaries.emplace(result.scenario_name, summary).second)
+        {
+            throw std::invalid_argument("More than one result for scenario " +
+                                        result.scenario_name);
+        }
+
+        ai_tick_latency.merge(result.ai_tick_latency);
+        cpu_time = cpu_time + result.cpu_time;
+    }
+
+    ai_tick_latencies.emplace();
+    for (size_t i = 0; i < LATENCY_PERCENTILES.size(); i++)
+    {
+        (*ai_tick_latencies)[i] = ai_tick_latency.getPercentile(LATENCY_PERCENTILES[i]);
+    }
+}
+
+ScenarioReport ScenarioReport::readBaseline(std::istream& baseline)
+{
+    ScenarioReport report;
+    std::string line;
+    while (std::getline(baseline, line))
+    {
+        std::istringstream line_stream(line);
+        std::string line_type;
+        if (!(line_stream >> line_type) || line_type[0] == '#')
+        {
+            continue;
+        }
+
+        if (line_type == "ai_tick_latency_ms")
+        {
+            report.ai_tick_latencies.emplace();
+            for (Duration& latency : *report.ai_tick_latencies)
+            {
+                double latency_milliseconds;
+                if (!(line_stream >> latency_milliseconds))
+                {
+                    throw std::invalid_argument("Malformed baseline line: " + line);
+                }
+                latency = Duration::fromMilliseconds(latency_milliseconds);
+            }
+        }
+        else if (line_type == "scenario")
+        {
+            std::string name;
+            ScenarioSummary summary;
+            if (!(line_stream >> name >> summary.goals_for >> summary.goals_against >>
+                  summary.friendly_possession_seconds >>
+                  summary.enemy_possession_seconds >> summary.passes_attempted >>
+                  summary.passes_completed))
+            {
+                throw std::invalid_argument("Malformed baseline line: " + line);
+            }
+            report.scenario_summaries[name] = summary;
+        }
+        else
+        {
+            throw std::invalid_argument("Unknown baseline line: " + line);
+        }
+    }
+
+    return report;
+}
+
+void ScenarioReport::writeBaseline(std::ostream& baseline, bool include_latency) const
+{
+    baseline << "# Generated by scenario_runner "
+             << (include_latency ? "--write-latency-baseline" : "--write-baseline")
+             << std::endl;
+    for (const auto& [name, summary] : scenario_summaries)
+    {
+        // Failed scenarios have no outcome to compare against, so they are left out
+        if (summary.error)
+        {
+            continue;
+        }
+        baseline << "scenario " << name << " " << summary.goals_for << " "
+                 << summary.goals_against << " " << summary.friendly_possession_seconds
+                 << " " << summary.enemy_possession_seconds << " "
+                 << summary.passes_attempted << " " << summary.passes_completed
+                 << std::endl;
+    }
+
+    if (include_latency && ai_tick_latencies)
+    {
+        baseline << "ai_tick_latency_ms";
+        for (const Duration& latency : *ai_tick_latencies)
+        {
+            baseline << " " << latency.getMilliseconds();
+        }
+        baseline << std::endl;
+    }
+}
+
+void ScenarioReport::print(std::ostream& output) const
+{
+    std::map<std::string, OutcomeTotals> group_totals;
+    OutcomeTotals totals;
+    for (const auto& [name, summary] : scenario_summaries)
+    {
+        group_totals[getScenarioGroup(name)].add(summary);
+        totals.add(summary);
+    }
+
+    output << std::left << std::setw(24) << "Scenarios" << std::right << std::setw(6)
+           << "Runs" << std::setw(11) << "Goals for" << std::setw(15) << "Goals against"
+           << std::setw(12) << "Possession" << std::setw(18) << "Passes completed"
+           << std::endl;
+    auto print_totals = [&output](const std::string& name, const OutcomeTotals& totals) {
+        std::ostringstream passes;
+        passes << totals.passes_completed << "/" << totals.passes_attempted;
+        output << std::left << std::setw(24) << name << std::right << std::setw(6)
+               << totals.num_scenarios << std::setw(11) << totals.goals_for
+               << std::setw(15) << totals.goals_against << std::setw(11) << std::fixed
+               << std::setprecision(1) << totals.getPossessionFraction() * 100 << "%"
+               << std::setw(18) << passes.str() << std::endl;
+    };
+    for (const auto& [group, group_total] : group_totals)
+    {
+        print_totals(group, group_total);
+    }
+    print_totals("total", totals);
+
+    for (const auto& [name, summary] : scenario_summaries)
+    {
+        if (summary.error)
+        {
+            output << "Scenario " << name << " failed: " << *summary.error << std::endl;
+        }
+    }
+
+    if (ai_tick_latencies)
+    {
+        output << "AI tick latency:";
+        for (size_t i = 0; i < LATENCY_PERCENTILES.size(); i++)
+        {
+            output << " p" << std::defaultfloat << std::setprecision(3)
+                   << LATENCY_PERCENTILES[i] * 100 << " " << std::fixed
+                   << std::setprecision(3) << (*ai_tick_latencies)[i].getMilliseconds()
+                   << "ms";
+        }
+        output << std::endl;
+    }
+    output << "CPU time: " << std::fixed << std::setprecision(2) << cpu_time.getSeconds()
+           << "s" << std::endl;
+}
+
+std::vector<std::string> ScenarioReport::findRegressions(
+    const ScenarioReport& baseline, const RegressionTolerances& tolerances) const
+{
+    std::vector<std::string> regressions;
+
+    // Only the Scenarios in both reports are compared, so that the totals are over the
+    // same Scenarios
+    OutcomeTotals totals;
+    OutcomeTotals baseline_totals;
+    for (const auto& [name, baseline_summary] : baseline.scenario_summaries)
+    {
+        auto summary = scenario_summaries.find(name);
+        if (summary == scenario_summaries.end())
+        {
+            regressions.emplace_back("Scenario " + name + " was not run");
+            continue;
+        }
+        if (summary->second.error)
+        {
+            continue;
+        }
+
+        if (summary->second.goals_for < baseline_summary.goals_for)
+        {
+            regressions.emplace_back("Scenario " + name + " scored " +
+                                     std::to_string(summary->second.goals_for) +
+                                     " goals, but the baseline " + "scored " +
+                                     std::to_string(baseline_summary.goals_for));
+        }
+        if (summary->second.goals_against > baseline_summary.goals_against)
+        {
+            regressions.emplace_back("Scenario " + name + " conceded " +
+                                     std::to_string(summary->second.goals_against) +
+                                     " goals, but the baseline conceded " +
+                                     std::to_string(baseline_summary.goals_against));
+        }
+
+        totals.add(summary->second);
+        baseline_totals.add(baseline_summary);
+    }
+
+    for (const auto& [name, summary] : scenario_summaries)
+    {
+        if (summary.error)
+        {
+            regressions.emplace_back("Scenario " + name + " failed: " + *summary.error);
+        }
+    }
+
+    auto to_percent = [](double fraction) {
+        std::ostringstream percent;
+        percent << std::fixed << std::setprecision(1) << fraction * 100 << "%";
+        return percent.str();
+    };
+    if (totals.getPossessionFraction() <
+        baseline_totals.getPossessionFraction() - tolerances.possession_fraction)
+    {
+        regressions.emplace_back("Possession dropped from " +
+                                 to_percent(baseline_totals.getPossessionFraction()) +
+                                 " to " + to_percent(totals.getPossessionFraction()));
+    }
+    if (totals.getPassCompletionFraction() <
+        baseline_totals.getPassCompletionFraction() - tolerances.pass_completion_fraction)
+    {
+        regressions.emplace_back("Pass completion dropped from " +
+                                 to_percent(baseline_totals.getPassCompletionFraction()) +
+                                 " to " + to_percent(totals.getPassCompletionFraction()));
+    }
+
+    // Latency depends on the machine, so it is only written to, and compared against,
+    // baselines that are generated on the machine running the comparison
+    if (!baseline.ai_tick_latencies || !ai_tick_latencies)
+    {
+        return regressions;
+    }
+    for (size_t i = 0; i < LATENCY_PERCENTILES.size(); i++)
+    {
+        double max_latency_milliseconds =
+            (*baseline.ai_tick_latencies)[i].getMilliseconds() *
+                (1 + tolerances.latency_fraction) +
+            tolerances.latency_allowance.getMilliseconds();
+        if ((*ai_tick_latencies)[i].getMilliseconds() > max_latency_milliseconds)
+        {
+            std::ostringstream regression;
+            regression << "AI tick latency p" << std::setprecision(3)
+                       << LATENCY_PERCENTILES[i] * 100 << std::fixed
+                       << std::setprecision(3) << " rose from "
+                       << (*baseline.ai_tick_latencies)[i].getMilliseconds() << "ms to "
+                       << (*ai_tick_latencies)[i].getMilliseconds() << "ms";
+            regressions.emplace_back(regression.str());
+        }
+    }
+
+    return regressions;
+}
+
+void ScenarioReport::OutcomeTotals::add(const ScenarioSummary& summary)
+{
+    num_scenarios++;
+    goals_for += summary.goals_for;
+    goals_against += summary.goals_against;
+    friendly_possession_seconds += summary.friendly_possession_seconds;
+    enemy_possession_seconds += summary.enemy_possession_seconds;
+    passes_attempted += summary.passes_attempted;
+    passes_completed += summary.passes_completed;
+}
+
+double ScenarioReport::OutcomeTotals::getPossessionFraction() const
+{
+    double total_possession_seconds =
+        friendly_possession_seconds + enemy_possession_seconds;
+    return total_possession_seconds > 0
+               ? friendly_possession_seconds / total_possession_seconds
+               : 0;
+}
+
+double ScenarioReport::OutcomeTotals::getPassCompletionFraction() const
+{
+    return passes_attempted > 0 ? static_cast<double>(passes_completed) / passes_attempted
+                                : 0;
+}
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <array>
+#include <istream>
+#include <map>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "scenario_runner/scenario.h"
+#include "util/time/duration.h"
+
+/**
+ * How much worse the results of a batch of Scenarios may be than the baseline before
+ * they are reported as regressions
+ */
+struct RegressionTolerances
+{
+    // How much the fraction of the time we had possession of the ball, and the fraction
+    // of passes that were completed, may drop
+    double possession_fraction      = 0.05;
+    double pass_completion_fraction = 0.05;
+    // How much slower each AI tick latency percentile may be, as a fraction of the
+    // baseline, plus a fixed allowance because very short latencies are noisy
+    double latency_fraction    = 0.25;
+    Duration latency_allowance = Duration::fromMilliseconds(0.5);
+};
+
+/**
+ * A summary of the results of a batch of Scenarios, that can be printed, saved as a
+ * baseline, and compared against a baseline to find regressions.
+ *
+ * A baseline is a plain text file with one line for each Scenario, and optionally one
+ * line for the AI tick latency:
+ *
+ *   scenario <name> <goals for> <goals against> <friendly possession seconds>
+ *       <enemy possession seconds> <passes attempted> <passes completed>
+ *   ai_tick_latency_ms <p50> <p90> <p99>
+ *
+ * Empty lines and lines starting with '#' are ignored. The outcomes of the Scenarios
+ * are the same on any machine, but the latency is not, so it is only written to
+ * baselines that are compared on the machine that generated them.
+ */
+class ScenarioReport
+{
+   public:
+    /**
+     * Creates a report summarizing the given results
+     *
+     * @param results The results of the Scenarios
+     *
+     * @throws std::invalid_argument if two results are for Scenarios with the same name
+     */
+    explicit ScenarioReport(const std::vector<ScenarioResult>& results);
+
+    /**
+     * Reads a report from a baseline written by writeBaseline
+     *
+     * @param baseline The stream to read the baseline from
+     *
+     * @throws std::invalid_argument if the baseline is malformed
+     * @return The report stored in the baseline
+     */
+    static ScenarioReport readBaseline(std::istream& baseline);
+
+    /**
+     * Writes this report as a baseline that can be read by readBaseline
+     *
+     * @param baseline The stream to write the baseline to
+     * @param include_latency Whether to write the AI tick latency. This should only be
+     * true for baselines that are compared on the machine they were generated on
+     */
+    void writeBaseline(std::ostream& baseline, bool include_latency = false) const;
+
+    /**
+     * Prints a human readable summary of this report. Scenarios whose names only differ
+     * by a number at the end, like "kickoff_0" and "kickoff_1", are summarized together
+     *
+     * @param output The stream to print the summary to
+     */
+    void print(std::ostream& output) const;
+
+    /**
+     * Compares this report against a baseline. Goals are compared for every Scenario,
+     * while possession, passes and latency are compared over all the Scenarios
+     * together, since they vary more from one Scenario to the next. Latency is only
+     * compared if the baseline includes it
+     *
+     * @param baseline The report to compare against
+     * @param tolerances How much worse than the baseline this report may be
+     *
+     * @return A description of every regression from the baseline, including every
+     * Scenario that failed or is missing from this report. This is empty if there are
+     * no regressions
+     */
+    std::vector<std::string> findRegressions(
+        const ScenarioReport& baseline,
+        const RegressionTolerances& tolerances = RegressionTolerances()) const;
+
+   private:
+    // The outcome of a single Scenario
+    struct ScenarioSummary
+    {
+        unsigned int goals_for;
+        unsigned int goals_against;
+        double friendly_possession_seconds;
+        double enemy_possession_seconds;
+        unsigned int passes_attempted;
+        unsigned int passes_completed;
+        std::optional<std::string> error;
+    };
+
+    // The outcomes of a group of Scenarios added together
+    struct OutcomeTotals
+    {
+        unsigned int num_scenarios         = 0;
+        unsigned int goals_for             = 0;
+        unsigned int goals_against         = 0;
+        double friendly_possession_seconds = 0;
+        double enemy_possession_seconds    = 0;
+        unsigned int passes_attempted      = 0;
+        unsigned int passes_completed      = 0;
+
+        /**
+         * Adds the outcome of a Scenario to the totals
+         *
+         * @param summary The outcome of the Scenario
+         */
+        void add(const ScenarioSummary& summary);
+
+        /**
+         * Returns the fraction of the time either team had possession that we had it
+         *
+         * @return the fraction of possession we had, or 0 if neither team had it
+         */
+        double getPossessionFraction() const;
+
+        /**
+         * Returns the fraction of the attempted passes that were completed
+         *
+         * @return the fraction of passes completed, or 0 if no passes were attempted
+         */
+        double getPassCompletionFraction() const;
+    };
+
+    /**
+     * Creates an empty report
+     */
+    ScenarioReport() = default;
+
+    // The AI tick latency percentiles in the report, in the range [0, 1]
+    static constexpr std::array<double, 3> LATENCY_PERCENTILES = {0.5, 0.9, 0.99};
+
+    // The AI tick latency at each of the LATENCY_PERCENTILES, over every tick of every
+    // Scenario. This is std::nullopt for baselines written without the latency
+    std::optional<std::array<Duration, LATENCY_PERCENTILES.size()>> ai_tick_latencies;
+    std::map<std::string, ScenarioSummary> scenario_summaries;
+    // The CPU time used to run all the Scenarios. This is not stored in baselines
+    Duration cpu_time;
+};
@@ -0,0 +1,189 @@
+#include "scenario_runner/scenario_runner.h"
+
+#include <time.h>
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+    // Returns the CPU time used by the calling thread so far
+    Duration getThreadCpuTime()
+    {
+        timespec cpu_time;
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_time);
+        return Duration::fromSeconds(static_cast<double>(cpu_time.tv_sec) +
+                                     static_cast<double>(cpu_time.tv_nsec) / 1e9);
+    }
+}  // namespace
+
+ScenarioRunner::ScenarioRunner(AIFactory ai_factory, size_t num_threads,
+                               const Duration& ai_tick_period)
+    : ai_factory(ai_factory), num_threads(num_threads), ai_tick_period(ai_tick_period)
+{
+    if (num_threads == 0)
+    {
+        throw std::invalid_argument("ScenarioRunner needs at least one thread");
+    }
+    if (ai_tick_period <= Duration::fromSeconds(0))
+    {
+        throw std::invalid_argument("ScenarioRunner AI tick period must be positive");
+    }
+}
+
+std::vector<ScenarioResult> ScenarioRunner::runScenarios(
+    const std::vector<Scenario>& scenarios) const
+{
+    std::vector<ScenarioResult> results(scenarios.size());
+
+    // Every thread takes the next Scenario that hasn't been started until there are
+    // none left, so threads that get short Scenarios run more of them. Each thread
+    // writes to different results, so the results don't need a lock
+    std::atomic<size_t> next_scenario_index(0);
+    auto run_scenarios = [&]() {
+        size_t i;
+        while ((i = next_scenario_index++) < scenarios.size())
+        {
+            results[i] = runScenario(scenarios[i]);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < std::min(num_threads, scenarios.size()); i++)
+    {
+        threads.emplace_back(run_scenarios);
+    }
+    run_scenarios();
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    return results;
+}
+
+ScenarioResult ScenarioRunner::runScenario(const Scenario& scenario) const
+{
+    ScenarioResult result;
+    result.scenario_name = scenario.name;
+
+    Duration start_cpu_time = getThreadCpuTime();
+    try
+    {
+        simulateScenario(scenario, result);
+    }
+    catch (const std::exception& ex)
+    {
+        result.error = ex.what();
+    }
+    result.cpu_time = getThreadCpuTime() - start_cpu_time;
+
+    return result;
+}
+
+void ScenarioRunner::simulateScenario(const Scenario& scenario,
+                                      ScenarioResult& result) const
+{
+    Simulator simulator(scenario.world, scenario.seed);
+    simulator.setEnemyPrimitives(scenario.enemy_primitives);
+    PrimitiveFunction get_primitives = ai_factory(scenario.seed);
+
+    const Field& field        = scenario.world.field();
+    auto next_referee_command = scenario.referee_commands.begin();
+    std::optional<Simulator::BallContact> last_ball_contact;
+    // The kick that started the pass that is in progress, if there is one
+    std::optional<Simulator::BallContact> pass_kick;
+
+    // Count whole ticks, so that adding up the tick periods can't add an extra tick
+    auto num_ticks = static_cast<long>(
+        std::round(scenario.duration.getSeconds() / ai_tick_period.getSeconds()));
+    for (long tick = 0; tick < num_ticks; tick++)
+    {
+        Duration time_since_start =
+            Duration::fromSeconds(ai_tick_period.getSeconds() * tick);
+        while (next_referee_command != scenario.referee_commands.end() &&
+               next_referee_command->time <= time_since_start)
+        {
+            simulator.updateRefboxGameState(next_referee_command->game_state);
+            next_referee_command++;
+        }
+
+        auto tick_start_time                     = std::chrono::steady_clock::now();
+        std::vector<PrimitiveVariant> primitives = get_primitives(simulator.getWorld());
+        result.ai_tick_latency.record(
+            Duration::fromSeconds(std::chrono::duration<double>(
+                                      std::chrono::steady_clock::now() - tick_start_time)
+                                      .count()));
+
+        simulator.setFriendlyPrimitives(primitives);
+        simulator.simulate(ai_tick_period);
+
+        // The team that last touched the ball has possession of it
+        std::optional<Simulator::BallContact> ball_contact =
+            simulator.getLastBallContact();
+        if (ball_contact && ball_contact->friendly)
+        {
+            result.friendly_possession_time =
+                result.friendly_possession_time + ai_tick_period;
+        }
+        else if (ball_contact)
+        {
+            result.enemy_possession_time = result.enemy_possession_time + ai_tick_period;
+        }
+
+        bool new_ball_contact =
+            ball_contact && (!last_ball_contact ||
+                             ball_contact->timestamp != last_ball_contact->timestamp);
+        if (new_ball_contact)
+        {
+            if (pass_kick && (ball_contact->friendly != pass_kick->friendly ||
+                              ball_contact->robot_id != pass_kick->robot_id))
+            {
+                // Another robot touched the ball first, so the pass is over
+                if (ball_contact->friendly)
+                {
+                    result.passes_completed++;
+                }
+                pass_kick.reset();
+            }
+            if (ball_contact->friendly && ball_contact->kicked &&
+                !isShotOnEnemyGoal(simulator.getWorld().ball(), field))
+            {
+                result.passes_attempted++;
+                pass_kick = ball_contact;
+            }
+        }
+        last_ball_contact = ball_contact;
+
+        Point ball_position = simulator.getWorld().ball().position();
+        if (std::abs(ball_position.y()) < field.goalWidth() / 2)
+        {
+            if (ball_position.x() > field.length() / 2)
+            {
+                result.goals_for++;
+                break;
+            }
+            if (ball_position.x() < -field.length() / 2)
+            {
+                result.goals_against++;
+                break;
+            }
+        }
+    }
+}
+
+bool ScenarioRunner::isShotOnEnemyGoal(const Ball& ball, const Field& field)
+{
+    if (ball.velocity().x() <= 0)
+    {
+        return false;
+    }
+
+    double time_to_goal_line =
+        (field.enemyGoal().x() - ball.position().x()) / ball.velocity().x();
+    double y_at_goal_line = ball.position().y() + ball.velocity().y() * time_to_goal_line;
+    return std::abs(y_at_goal_line) < field.goalWidth() / 2;
+}
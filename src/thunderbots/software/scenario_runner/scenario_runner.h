@@ -0,0 +1,93 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "ai/primitive/primitive_variant.h"
+#include "ai/world/world.h"
+#include "scenario_runner/scenario.h"
+#include "simulator/simulator.h"
+#include "util/time/duration.h"
+
+/**
+ * Runs batches of Scenarios against a headless Simulator, sharded across threads.
+ *
+ * Every Scenario is run with a new AI created for it, seeded with the seed of the
+ * Scenario, so the result of a Scenario only depends on the Scenario itself and not on
+ * which thread ran it or what that thread ran before. On every AI tick the AI is given
+ * the simulated World, and the robots are simulated running the Primitives it returns
+ * until the next tick. The time the AI takes is measured on every tick, but the
+ * simulation does not wait for it, so the outcome of a Scenario does not depend on how
+ * fast the machine running it is.
+ */
+class ScenarioRunner
+{
+   public:
+    // Calculates the Primitives for the friendly robots from the World, like
+    // AI::getPrimitives does
+    using PrimitiveFunction = std::function<std::vector<PrimitiveVariant>(const World&)>;
+    // Creates a new PrimitiveFunction, with its own state, to run a Scenario with the
+    // given seed
+    using AIFactory = std::function<PrimitiveFunction(unsigned int seed)>;
+
+    /**
+     * Creates a new ScenarioRunner
+     *
+     * @param ai_factory Creates the AI that runs each Scenario
+     * @param num_threads The number of threads to run Scenarios on. Each thread runs
+     * one Scenario at a time
+     * @param ai_tick_period How much simulated time passes between AI ticks. Scenarios
+     * are run for a whole number of ticks
+     *
+     * @throws std::invalid_argument if there are no threads, or the AI tick period is
+     * not positive
+     */
+    explicit ScenarioRunner(AIFactory ai_factory, size_t num_threads,
+                            const Duration& ai_tick_period = Duration::fromSeconds(1.0 /
+                                                                                   60));
+
+    /**
+     * Runs the given Scenarios, spread across the threads of this runner, and waits for
+     * all of them to finish
+     *
+     * @param scenarios The Scenarios to run
+     *
+     * @return The result of each Scenario, in the same order as the Scenarios
+     */
+    std::vector<ScenarioResult> runScenarios(
+        const std::vector<Scenario>& scenarios) const;
+
+    /**
+     * Runs a single Scenario on the calling thread
+     *
+     * @param scenario The Scenario to run
+     *
+     * @return The result of the Scenario
+     */
+    ScenarioResult runScenario(const Scenario& scenario) const;
+
+   private:
+    /**
+     * Plays out the Scenario in a Simulator, recording its outcome in the given result.
+     * Exceptions thrown by the AI or the Simulator are passed on to the caller
+     *
+     * @param scenario The Scenario to run
+     * @param result The result to record the outcome of the Scenario in
+     */
+    void simulateScenario(const Scenario& scenario, ScenarioResult& result) const;
+
+    /**
+     * Returns whether the ball is moving towards the enemy goal, between the goal posts
+     *
+     * @param ball The ball
+     * @param field The field
+     *
+     * @return whether the ball would cross the enemy goal line between the posts if it
+     * kept moving in a straight line
+     */
+    static bool isShotOnEnemyGoal(const Ball& ball, const Field& field);
+
+    AIFactory ai_factory;
+    size_t num_threads;
+    Duration ai_tick_period;
+};
@@ -0,0 +1,185 @@
+#include "scenario_runner/scenarios.h"
+
+#include <random>
+#include <string>
+
+#include "ai/primitive/kick_primitive.h"
+
+namespace Scenarios
+{
+    namespace
+    {
+        // The number of robots on each team, as in Division B
+        const unsigned int NUM_ROBOTS_PER_TEAM = 6;
+        // The id of the goalie on each team
+        const unsigned int GOALIE_ID = 0;
+
+        const Duration SET_PIECE_DURATION   = Duration::fromSeconds(15);
+        const Duration OPEN_PLAY_DURATION   = Duration::fromSeconds(15);
+        const Duration DEFEND_SHOT_DURATION = Duration::fromSeconds(5);
+        // How long our robots have to get into position before a kickoff is started
+        const Duration KICKOFF_SETUP_DURATION = Duration::fromSeconds(2);
+
+        // Returns a random point in the rectangle with the given corners
+        Point createRandomPoint(std::mt19937& random_number_generator, const Point& min,
+                                const Point& max)
+        {
+            std::uniform_real_distribution<double> x_distribution(min.x(), max.x());
+            std::uniform_real_distribution<double> y_distribution(min.y(), max.y());
+            return Point(x_distribution(random_number_generator),
+                         y_distribution(random_number_generator));
+        }
+
+        /**
+         * Creates a World on a Division B field with the ball at the given position,
+         * and both teams' goalies in their goals. The other robots of each team are
+         * placed randomly in the given rectangles
+         *
+         * @param random_number_generator The generator to place the robots with
+         * @param ball_position Where the ball is
+         * @param friendly_min, friendly_max The corners of the rectangle the friendly
+         * robots are placed in
+         * @param enemy_min, enemy_max The corners of the rectangle the enemy robots are
+         * placed in
+         *
+         * @return The World
+         */
+        World createWorld(std::mt19937& random_number_generator,
+                          const Point& ball_position, const Point& friendly_min,
+                          const Point& friendly_max, const Point& enemy_min,
+                          const Point& enemy_max)
+        {
+            World world(Field(9.0, 6.0, 1.0, 2.0, 1.0, 0.3, 0.5),
+                        Ball(ball_position, Vector(), Timestamp::fromSeconds(0)),
+                        Team(Duration::fromMilliseconds(1000)),
+                        Team(Duration::fromMilliseconds(1000)));
+
+            auto add_robots = [&](Team& team, const Point& goal, const Angle& orientation,
+                                  const Point& min, const Point& max) {
+                std::vector<Robot> robots;
+                robots.emplace_back(GOALIE_ID, goal, Vector(), orientation,
+                                    AngularVelocity::zero(), Timestamp::fromSeconds(0));
+                for (unsigned int id = GOALIE_ID + 1; id < NUM_ROBOTS_PER_TEAM; id++)
+                {
+                    robots.emplace_back(
+                        id, createRandomPoint(random_number_generator, min, max),
+                        Vector(), orientation, AngularVelocity::zero(),
+                        Timestamp::fromSeconds(0));
+                }
+                team.updateRobots(robots);
+                team.assignGoalie(GOALIE_ID);
+            };
+            add_robots(world.mutableFriendlyTeam(),
+                       world.field().friendlyGoal() + Vector(0.2, 0), Angle::zero(),
+                       friendly_min, friendly_max);
+            add_robots(world.mutableEnemyTeam(),
+                       world.field().enemyGoal() - Vector(0.2, 0), Angle::half(),
+                       enemy_min, enemy_max);
+
+            return world;
+        }
+
+        Scenario createKickoffScenario(std::mt19937& random_number_generator)
+        {
+            Scenario scenario;
+            // Both teams start in their own halves, outside the centre circle
+            scenario.world =
+                createWorld(random_number_generator, Point(0, 0), Point(-4.0, -2.8),
+                            Point(-0.7, 2.8), Point(0.7, -2.8), Point(4.0, 2.8));
+            scenario.referee_commands = {
+                {Duration::fromSeconds(0), RefboxGameState::PREPARE_KICKOFF_US},
+                {KICKOFF_SETUP_DURATION, RefboxGameState::NORMAL_START}};
+            scenario.duration = SET_PIECE_DURATION;
+            return scenario;
+        }
+
+        Scenario createDirectFreeKickScenario(std::mt19937& random_number_generator)
+        {
+            Scenario scenario;
+            Point ball_position = createRandomPoint(random_number_generator,
+                                                    Point(0.5, -2.5), Point(3.5, 2.5));
+            scenario.world =
+                createWorld(random_number_generator, ball_position, Point(-4.0, -2.8),
+                            Point(4.0, 2.8), Point(-4.0, -2.8), Point(4.0, 2.8));
+            scenario.referee_commands = {
+                {Duration::fromSeconds(0), RefboxGameState::DIRECT_FREE_US}};
+            scenario.duration = SET_PIECE_DURATION;
+            return scenario;
+        }
+
+        Scenario createDefendShotScenario(std::mt19937& random_number_generator)
+        {
+            Scenario scenario;
+            Point ball_position = createRandomPoint(random_number_generator,
+                                                    Point(-3.0, -2.0), Point(-0.5, 2.0));
+            // The enemy robots other than the shooter wait in their own half, so that
+            // only our robots can get in the way of the shot
+            scenario.world =
+                createWorld(random_number_generator, ball_position, Point(-4.0, -2.8),
+                            Point(0, 2.8), Point(0.5, -2.8), Point(4.0, 2.8));
+
+            // The shooter starts behind the ball and kicks it at a random point in our
+            // goal
+            std::uniform_real_distribution<double> kick_speed_distribution(4.0, 6.0);
+            Point target = createRandomPoint(
+                random_number_generator,
+                scenario.world.field().friendlyGoalpostNeg() + Vector(0, 0.1),
+                scenario.world.field().friendlyGoalpostPos() - Vector(0, 0.1));
+            Vector shot_direction   = (target - ball_position).norm();
+            unsigned int shooter_id = GOALIE_ID + 1;
+            scenario.world.mutableEnemyTeam().updateRobots(
+                {Robot(shooter_id, ball_position - shot_direction * 0.3, Vector(),
+                       shot_direction.orientation(), AngularVelocity::zero(),
+                       Timestamp::fromSeconds(0))});
+            scenario.enemy_primitives = {
+                KickPrimitive(shooter_id, ball_position, shot_direction.orientation(),
+                              kick_speed_distribution(random_number_generator))};
+
+            scenario.referee_commands = {
+                {Duration::fromSeconds(0), RefboxGameState::FORCE_START}};
+            scenario.duration = DEFEND_SHOT_DURATION;
+            return scenario;
+        }
+
+        Scenario createOpenPlayScenario(std::mt19937& random_number_generator)
+        {
+            Scenario scenario;
+            Point ball_position = createRandomPoint(random_number_generator,
+                                                    Point(-4.0, -2.8), Point(4.0, 2.8));
+            scenario.world =
+                createWorld(random_number_generator, ball_position, Point(-4.0, -2.8),
+                            Point(4.0, 2.8), Point(-4.0, -2.8), Point(4.0, 2.8));
+            scenario.referee_commands = {
+                {Duration::fromSeconds(0), RefboxGameState::FORCE_START}};
+            scenario.duration = OPEN_PLAY_DURATION;
+            return scenario;
+        }
+    }  // namespace
+
+    std::vector<Scenario> createStandardScenarios(unsigned int num_variations)
+    {
+        const std::vector<std::pair<std::string, Scenario (*)(std::mt19937&)>>
+            scenario_kinds = {{"kickoff", createKickoffScenario},
+                              {"direct_free_kick", createDirectFreeKickScenario},
+                              {"defend_shot", createDefendShotScenario},
+                              {"open_play", createOpenPlayScenario}};
+
+        std::vector<Scenario> scenarios;
+        for (unsigned int variation = 0; variation < num_variations; variation++)
+        {
+            for (const auto& [kind_name, create_scenario] : scenario_kinds)
+            {
+                // Every Scenario gets its own seed, so each variation is the same no
+                // matter how many variations are created
+                auto seed = static_cast<unsigned int>(scenarios.size());
+                std::mt19937 random_number_generator(seed);
+                Scenario scenario = create_scenario(random_number_generator);
+                scenario.name     = kind_name + "_" + std::to_string(variation);
+                scenario.seed     = seed;
+                scenarios.emplace_back(scenario);
+            }
+        }
+
+        return scenarios;
+    }
+}  // namespace Scenarios
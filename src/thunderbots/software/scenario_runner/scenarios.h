@@ -0,0 +1,26 @@
+#pragma once
+
+#include <vector>
+
+#include "scenario_runner/scenario.h"
+
+namespace Scenarios
+{
+    /**
+     * Creates the standard batch of Scenarios the AI is tested on. There are several
+     * kinds of Scenario, and every kind is created with the given number of variations,
+     * which place the robots and the ball differently:
+     * - kickoff: Our kickoff, with both teams in their own halves
+     * - direct_free_kick: Our direct free kick from somewhere in the enemy half
+     * - defend_shot: An enemy robot shoots at our goal from somewhere in our half
+     * - open_play: Normal play with the robots and the ball anywhere on the field
+     *
+     * The Scenarios are named after their kind and variation, like "kickoff_3", and the
+     * same number of variations always creates the same Scenarios.
+     *
+     * @param num_variations The number of variations of each kind of Scenario
+     *
+     * @return The Scenarios
+     */
+    std::vector<Scenario> createStandardScenarios(unsigned int num_variations);
+}  // namespace Scenarios
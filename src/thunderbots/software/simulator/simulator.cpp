@@ -0,0 +1,446 @@
+#include "simulator/simulator.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "grsim_communication/grsim_command_primitive_visitor.h"
+#include "shared/constants.h"
+
+Simulator::Simulator(const World& world, unsigned int seed,
+                     const Duration& physics_time_step)
+    : world(world),
+      physics_time_step(physics_time_step),
+      current_time(world.ball().lastUpdateTimestamp()),
+      random_number_generator(seed),
+      friendly_motion_controller(ROBOT_MAX_SPEED_METERS_PER_SECOND,
+                                 ROBOT_MAX_ANG_SPEED_RAD_PER_SECOND,
+                                 ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED,
+                                 ROBOT_MAX_ANG_ACCELERATION_RAD_PER_SECOND_SQUARED),
+      enemy_motion_controller(ENEMY_ROBOT_MAX_SPEED_METERS_PER_SECOND,
+                              ROBOT_MAX_ANG_SPEED_RAD_PER_SECOND,
+                              ENEMY_ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED,
+                              ROBOT_MAX_ANG_ACCELERATION_RAD_PER_SECOND_SQUARED),
+      ball_position(world.ball().position()),
+      ball_velocity(world.ball().velocity()),
+      ball_height(0),
+      ball_vertical_velocity(0)
+{
+    if (physics_time_step <= Duration::fromSeconds(0))
+    {
+        throw std::invalid_argument("Simulator physics time step must be positive");
+    }
+
+    auto add_robots = [this](const Team& team,
+                             std::map<unsigned int, SimulatedRobot>& robots) {
+        for (const Robot& robot : team.getAllRobots())
+        {
+            SimulatedRobot simulated_robot;
+            simulated_robot.position         = robot.position();
+            simulated_robot.velocity         = robot.velocity();
+            simulated_robot.orientation      = robot.orientation();
+            simulated_robot.angular_velocity = robot.angularVelocity();
+            robots.emplace(robot.id(), simulated_robot);
+
+            // Start from the most recent timestamp in the World, so the World can be
+            // updated with the simulated state
+            current_time = std::max(current_time, robot.lastUpdateTimestamp());
+        }
+    };
+    add_robots(world.friendlyTeam(), friendly_robots);
+    add_robots(world.enemyTeam(), enemy_robots);
+
+    updateWorld();
+}
+
+void Simulator::setFriendlyPrimitives(const std::vector<PrimitiveVariant>& primitives)
+{
+    setPrimitives(friendly_robots, primitives);
+}
+
+void Simulator::setEnemyPrimitives(const std::vector<PrimitiveVariant>& primitives)
+{
+    setPrimitives(enemy_robots, primitives);
+}
+
+void Simulator::setPrimitives(std::map<unsigned int, SimulatedRobot>& robots,
+                              const std::vector<PrimitiveVariant>& primitives)
+{
+    for (auto& [id, robot] : robots)
+    {
+        robot.primitive.reset();
+    }
+
+    for (const PrimitiveVariant& primitive : primitives)
+    {
+        auto robot = robots.find(getPrimitive(primitive).getRobotId());
+        if (robot != robots.end())
+        {
+            robot->second.primitive = primitive;
+        }
+    }
+}
+
+void Simulator::setBallState(const Point& position, const Vector& velocity)
+{
+    ball_position          = position;
+    ball_velocity          = velocity;
+    ball_height            = 0;
+    ball_vertical_velocity = 0;
+    updateWorld();
+}
+
+void Simulator::simulate(const Duration& duration)
+{
+    auto num_steps = static_cast<long>(
+        std::round(duration.getSeconds() / physics_time_step.getSeconds()));
+    for (long step = 0; step < num_steps; step++)
+    {
+        stepPhysics();
+    }
+    updateWorld();
+}
+
+const World& Simulator::getWorld() const
+{
+    return world;
+}
+
+Timestamp Simulator::getTimestamp() const
+{
+    return current_time;
+}
+
+std::optional<Simulator::BallContact> Simulator::getLastBallContact() const
+{
+    return last_ball_contact;
+}
+
+void Simulator::updateRefboxGameState(const RefboxGameState& game_state)
+{
+    world.updateRefboxGameState(game_state);
+}
+
+void Simulator::stepPhysics()
+{
+    stepRobots(friendly_robots, friendly_motion_controller,
+               ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED);
+    stepRobots(enemy_robots, enemy_motion_controller,
+               ENEMY_ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED);
+    stepBall();
+
+    resolveRobotCollisions();
+    resolveBallCollisions();
+
+    current_time = current_time + physics_time_step;
+}
+
+void Simulator::stepRobots(std::map<unsigned int, SimulatedRobot>& robots,
+                           MotionController& motion_controller,
+                           double max_acceleration_meters_per_second_squared)
+{
+    double delta_time = physics_time_step.getSeconds();
+    Ball ball(ball_position, ball_velocity, current_time);
+
+    for (auto& [id, robot] : robots)
+    {
+        // Robots without a Primitive come to a stop
+        Vector commanded_velocity;
+        AngularVelocity commanded_angular_velocity = AngularVelocity::zero();
+        robot.kick_speed_meters_per_second         = 0;
+        robot.chip                                 = false;
+        robot.dribbler_on                          = false;
+
+        if (robot.primitive)
+        {
+            Robot robot_state(id, robot.position, robot.velocity, robot.orientation,
+                              robot.angular_velocity, current_time);
+
+            // Turn the Primitive into velocities the same way the grSim backend does
+            GrsimCommandPrimitiveVisitor visitor(robot_state, ball);
+            visitPrimitive(*robot.primitive, visitor);
+            MotionControllerCommand command = visitor.getMotionControllerCommand();
+            MotionController::Velocity velocities =
+                motion_controller.bangBangVelocityController(robot_state, delta_time,
+                                                             command);
+
+            // The MotionController gives the linear velocity in robot coordinates
+            commanded_velocity = velocities.linear_velocity.rotate(robot.orientation);
+            commanded_angular_velocity = velocities.angular_velocity;
+
+            std::visit(
+                [&robot](const auto& command) {
+                    robot.kick_speed_meters_per_second =
+                        command.kick_speed_meters_per_second;
+                    robot.chip        = command.chip_instead_of_kick;
+                    robot.dribbler_on = command.dribbler_on;
+                },
+                command);
+        }
+
+        // The robot can only change its velocity as fast as its acceleration limits
+        // allow
+        Vector velocity_change = commanded_velocity - robot.velocity;
+        double max_velocity_change =
+            max_acceleration_meters_per_second_squared * delta_time;
+        if (velocity_change.len() > max_velocity_change)
+        {
+            velocity_change = velocity_change.norm(max_velocity_change);
+        }
+        robot.velocity = robot.velocity + velocity_change;
+
+        double max_angular_velocity_change =
+            ROBOT_MAX_ANG_ACCELERATION_RAD_PER_SECOND_SQUARED * delta_time;
+        double angular_velocity_change =
+            std::clamp((commanded_angular_velocity - robot.angular_velocity).toRadians(),
+                       -max_angular_velocity_change, max_angular_velocity_change);
+        robot.angular_velocity =
+            robot.angular_velocity + AngularVelocity::ofRadians(angular_velocity_change);
+
+        robot.position = robot.position + robot.velocity * delta_time;
+        robot.orientation =
+            (robot.orientation + robot.angular_velocity * delta_time).angleMod();
+    }
+}
+
+void Simulator::stepBall()
+{
+    double delta_time = physics_time_step.getSeconds();
+
+    if (ball_height > 0 || ball_vertical_velocity > 0)
+    {
+        // The ball is in the air, so it flies under gravity and bounces when it lands
+        ball_vertical_velocity -= GRAVITY_METERS_PER_SECOND_SQUARED * delta_time;
+        ball_height += ball_vertical_velocity * delta_time;
+        if (ball_height <= 0)
+        {
+            ball_height         = 0;
+            double bounce_speed = -ball_vertical_velocity * BALL_GROUND_RESTITUTION;
+            ball_vertical_velocity =
+                bounce_speed > BALL_MIN_BOUNCE_SPEED_METERS_PER_SECOND ? bounce_speed : 0;
+        }
+    }
+    else
+    {
+        // The ball rolls along the ground, and slows down with rolling friction
+        double speed = std::max(
+            0.0, ball_velocity.len() -
+                     BALL_ROLLING_FRICTION_DECELERATION_METERS_PER_SECOND_SQUARED *
+                         delta_time);
+        ball_velocity = ball_velocity.norm(speed);
+    }
+
+    ball_position = ball_position + ball_velocity * delta_time;
+}
+
+void Simulator::resolveRobotCollisions()
+{
+    std::vector<SimulatedRobot*> robots;
+    for (auto& [id, robot] : friendly_robots)
+    {
+        robots.emplace_back(&robot);
+    }
+    for (auto& [id, robot] : enemy_robots)
+    {
+        robots.emplace_back(&robot);
+    }
+
+    // Keep the robots inside the walls around the field, stopping them from moving
+    // into the walls
+    double max_x = world.field().totalLength() / 2 - ROBOT_MAX_RADIUS_METERS;
+    double max_y = world.field().totalWidth() / 2 - ROBOT_MAX_RADIUS_METERS;
+    for (SimulatedRobot* robot : robots)
+    {
+        if (std::abs(robot->position.x()) > max_x)
+        {
+            robot->position.set(std::copysign(max_x, robot->position.x()),
+                                robot->position.y());
+            robot->velocity.set(0, robot->velocity.y());
+        }
+        if (std::abs(robot->position.y()) > max_y)
+        {
+            robot->position.set(robot->position.x(),
+                                std::copysign(max_y, robot->position.y()));
+            robot->velocity.set(robot->velocity.x(), 0);
+        }
+    }
+
+    // Robots that overlap are pushed apart equally, and stop moving towards each other
+    for (size_t i = 0; i < robots.size(); i++)
+    {
+        for (size_t j = i + 1; j < robots.size(); j++)
+        {
+            Vector offset  = robots[j]->position - robots[i]->position;
+            double overlap = 2 * ROBOT_MAX_RADIUS_METERS - offset.len();
+            if (overlap <= 0)
+            {
+                continue;
+            }
+
+            Vector normal       = offset.len() > 0 ? offset.norm() : Vector(1, 0);
+            robots[i]->position = robots[i]->position - normal * (overlap / 2);
+            robots[j]->position = robots[j]->position + normal * (overlap / 2);
+
+            double approach_speed =
+                (robots[j]->velocity - robots[i]->velocity).dot(normal);
+            if (approach_speed < 0)
+            {
+                robots[i]->velocity = robots[i]->velocity + normal * (approach_speed / 2);
+                robots[j]->velocity = robots[j]->velocity - normal * (approach_speed / 2);
+            }
+        }
+    }
+}
+
+void Simulator::resolveBallCollisions()
+{
+    // A ball in the air flies over the robots
+    if (ball_height == 0)
+    {
+        for (auto* robots : {&friendly_robots, &enemy_robots})
+        {
+            bool friendly = robots == &friendly_robots;
+            for (auto& [id, robot] : *robots)
+            {
+                // The robot is a circle with a flat front, where its dribbler is
+                Vector offset = ball_position - robot.position;
+                if (offset.len() >= ROBOT_MAX_RADIUS_METERS + BALL_MAX_RADIUS_METERS)
+                {
+                    continue;
+                }
+
+                Vector offset_in_robot_coordinates = offset.rotate(-robot.orientation);
+                Vector normal;
+                double penetration;
+                if (offset_in_robot_coordinates.x() > 0 &&
+                    std::abs(offset_in_robot_coordinates.y()) <= DRIBBLER_WIDTH / 2)
+                {
+                    normal      = Vector::createFromAngle(robot.orientation);
+                    penetration = DIST_TO_FRONT_OF_ROBOT_METERS + BALL_MAX_RADIUS_METERS -
+                                  offset_in_robot_coordinates.x();
+                }
+                else
+                {
+                    normal = offset.len() > 0 ? offset.norm() : Vector(1, 0);
+                    penetration =
+                        ROBOT_MAX_RADIUS_METERS + BALL_MAX_RADIUS_METERS - offset.len();
+                }
+
+                if (penetration > 0)
+                {
+                    ball_position         = ball_position + normal * penetration;
+                    double approach_speed = (ball_velocity - robot.velocity).dot(normal);
+                    if (approach_speed < 0)
+                    {
+                        ball_velocity =
+                            ball_velocity -
+                            normal * ((1 + BALL_ROBOT_RESTITUTION) * approach_speed);
+                    }
+                }
+
+                // The contact is timestamped at the end of the current time step
+                bool on_dribbler = ballIsOnDribbler(robot);
+                if (penetration > 0 || on_dribbler)
+                {
+                    last_ball_contact = BallContact{friendly, id, false,
+                                                    current_time + physics_time_step};
+                }
+
+                if (on_dribbler)
+                {
+                    if (robot.kick_speed_meters_per_second > 0)
+                    {
+                        kickBall(robot);
+                        last_ball_contact->kicked = true;
+                    }
+                    else if (robot.dribbler_on)
+                    {
+                        // The dribbler holds the ball against the front of the robot
+                        Vector dribbler_offset =
+                            Vector::createFromAngle(robot.orientation)
+                                .norm(DIST_TO_FRONT_OF_ROBOT_METERS +
+                                      BALL_MAX_RADIUS_METERS);
+                        ball_position = robot.position + dribbler_offset;
+                        ball_velocity =
+                            robot.velocity +
+                            dribbler_offset.perp() * robot.angular_velocity.toRadians();
+                    }
+                }
+            }
+        }
+    }
+
+    // The ball bounces off of the walls around the field
+    double max_x = world.field().totalLength() / 2 - BALL_MAX_RADIUS_METERS;
+    double max_y = world.field().totalWidth() / 2 - BALL_MAX_RADIUS_METERS;
+    if (std::abs(ball_position.x()) > max_x)
+    {
+        ball_position.set(std::copysign(max_x, ball_position.x()), ball_position.y());
+        if (ball_velocity.x() * ball_position.x() > 0)
+        {
+            ball_velocity.set(-ball_velocity.x() * BALL_WALL_RESTITUTION,
+                              ball_velocity.y());
+        }
+    }
+    if (std::abs(ball_position.y()) > max_y)
+    {
+        ball_position.set(ball_position.x(), std::copysign(max_y, ball_position.y()));
+        if (ball_velocity.y() * ball_position.y() > 0)
+        {
+            ball_velocity.set(ball_velocity.x(),
+                              -ball_velocity.y() * BALL_WALL_RESTITUTION);
+        }
+    }
+}
+
+bool Simulator::ballIsOnDribbler(const SimulatedRobot& robot) const
+{
+    if (ball_height > 0 || ball_vertical_velocity > 0)
+    {
+        return false;
+    }
+
+    Vector offset_in_robot_coordinates =
+        (ball_position - robot.position).rotate(-robot.orientation);
+    double distance_from_front = offset_in_robot_coordinates.x() -
+                                 DIST_TO_FRONT_OF_ROBOT_METERS - BALL_MAX_RADIUS_METERS;
+    return distance_from_front > -DRIBBLER_CONTACT_TOLERANCE_METERS &&
+           distance_from_front < DRIBBLER_CONTACT_TOLERANCE_METERS &&
+           std::abs(offset_in_robot_coordinates.y()) <= DRIBBLER_WIDTH / 2;
+}
+
+void Simulator::kickBall(const SimulatedRobot& robot)
+{
+    std::normal_distribution<double> speed_noise(0, KICK_SPEED_NOISE_FRACTION);
+    std::normal_distribution<double> direction_noise(0, KICK_DIRECTION_NOISE_DEGREES);
+
+    double kick_speed =
+        robot.kick_speed_meters_per_second * (1 + speed_noise(random_number_generator));
+    Angle kick_direction =
+        robot.orientation + Angle::ofDegrees(direction_noise(random_number_generator));
+
+    ball_velocity = robot.velocity + Vector::createFromAngle(kick_direction) * kick_speed;
+    if (robot.chip)
+    {
+        // Like the grSim backend, chips have the same vertical speed as horizontal
+        // speed, so the ball leaves the robot at about 45 degrees
+        ball_vertical_velocity = kick_speed;
+    }
+}
+
+void Simulator::updateWorld()
+{
+    auto update_team = [this](Team& team,
+                              const std::map<unsigned int, SimulatedRobot>& robots) {
+        std::vector<Robot> team_robots;
+        for (const auto& [id, robot] : robots)
+        {
+            team_robots.emplace_back(id, robot.position, robot.velocity,
+                                     robot.orientation, robot.angular_velocity,
+                                     current_time);
+        }
+        team.updateRobots(team_robots);
+    };
+    update_team(world.mutableFriendlyTeam(), friendly_robots);
+    update_team(world.mutableEnemyTeam(), enemy_robots);
+    world.updateBallState(Ball(ball_position, ball_velocity, current_time));
+}
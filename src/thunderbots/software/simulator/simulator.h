@@ -0,0 +1,240 @@
+#pragma once
+
+#include <map>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include "ai/primitive/primitive_variant.h"
+#include "ai/world/world.h"
+#include "grsim_communication/motion_controller.h"
+#include "util/time/duration.h"
+#include "util/time/timestamp.h"
+
+/**
+ * A headless, deterministic 2D simulator of the robots and the ball, that runs in the
+ * same process as the AI.
+ *
+ * The Simulator is given the Primitives for each team, and turns them into robot
+ * velocities the same way the grSim backend does, with a GrsimCommandPrimitiveVisitor
+ * and a MotionController. It then steps a simple rigid body simulation forwards in
+ * fixed time steps:
+ * - Robots follow their commanded velocities within their acceleration and speed
+ *   limits, and collide with each other and the walls around the field
+ * - The ball slows down with rolling friction on the ground, flies under gravity and
+ *   bounces when chipped, and collides with the robots and the walls
+ * - Robots kick or chip the ball when it touches their dribbler and their Primitive
+ *   asks for a kick, and hold on to it while their dribbler is on
+ *
+ * Nothing runs in real time, and no network or GUI is needed, so simulating a few
+ * seconds of play takes a few milliseconds. All the randomness in the simulation (the
+ * noise on kicks) comes from a generator seeded on construction, so the same seed,
+ * starting World and Primitives always produce the same result.
+ */
+class Simulator
+{
+   public:
+    // A robot touching the ball
+    struct BallContact
+    {
+        // Whether the robot is on the friendly team
+        bool friendly;
+        unsigned int robot_id;
+        // Whether the robot kicked or chipped the ball, rather than just touching it
+        bool kicked;
+        Timestamp timestamp;
+    };
+
+    /**
+     * Creates a new Simulator
+     *
+     * @param world The World to start simulating from. The simulation starts at the
+     * most recent timestamp in this World, and keeps its field and game state
+     * @param seed The seed for the random noise in the simulation
+     * @param physics_time_step How far the simulation is stepped forwards at a time
+     *
+     * @throws std::invalid_argument if the physics time step is not positive
+     */
+    explicit Simulator(const World& world, unsigned int seed = 0,
+                       const Duration& physics_time_step = Duration::fromSeconds(1.0 /
+                                                                                 200));
+
+    /**
+     * Sets the Primitives the friendly robots run, replacing any Primitives they were
+     * running before. Friendly robots without a Primitive come to a stop
+     *
+     * @param primitives The Primitives for the friendly robots
+     */
+    void setFriendlyPrimitives(const std::vector<PrimitiveVariant>& primitives);
+
+    /**
+     * Sets the Primitives the enemy robots run, replacing any Primitives they were
+     * running before. Enemy robots without a Primitive come to a stop
+     *
+     * @param primitives The Primitives for the enemy robots
+     */
+    void setEnemyPrimitives(const std::vector<PrimitiveVariant>& primitives);
+
+    /**
+     * Moves the ball, for example to set up a scenario or to restart play
+     *
+     * @param position The new position of the ball
+     * @param velocity The new velocity of the ball, along the ground
+     */
+    void setBallState(const Point& position, const Vector& velocity);
+
+    /**
+     * Runs the simulation forwards by the given duration. The duration is rounded to a
+     * whole number of physics time steps
+     *
+     * @param duration How long to simulate for
+     */
+    void simulate(const Duration& duration);
+
+    /**
+     * Returns the current state of the simulation
+     *
+     * @return the World as it is at the current simulation time
+     */
+    const World& getWorld() const;
+
+    /**
+     * Returns how far the simulation has been run
+     *
+     * @return the current simulation time
+     */
+    Timestamp getTimestamp() const;
+
+    /**
+     * Returns the last time a robot touched the ball. A robot dribbling the ball touches
+     * it on every physics time step
+     *
+     * @return the last time a robot touched the ball, or std::nullopt if no robot has
+     * touched the ball yet
+     */
+    std::optional<BallContact> getLastBallContact() const;
+
+    /**
+     * Updates the game state of the simulated World, as if it came from the referee
+     *
+     * @param game_state The new game state
+     */
+    void updateRefboxGameState(const RefboxGameState& game_state);
+
+    // How quickly the ball slows down when rolling on the ground
+    static constexpr double BALL_ROLLING_FRICTION_DECELERATION_METERS_PER_SECOND_SQUARED =
+        0.5;
+    static constexpr double GRAVITY_METERS_PER_SECOND_SQUARED = 9.81;
+    // The fraction of the speed into a surface the ball keeps when it bounces off of it
+    static constexpr double BALL_ROBOT_RESTITUTION  = 0.5;
+    static constexpr double BALL_WALL_RESTITUTION   = 0.5;
+    static constexpr double BALL_GROUND_RESTITUTION = 0.5;
+    // A chipped ball stops bouncing once it bounces slower than this
+    static constexpr double BALL_MIN_BOUNCE_SPEED_METERS_PER_SECOND = 0.1;
+    // How far the ball can be from the front of a robot and still touch its dribbler
+    static constexpr double DRIBBLER_CONTACT_TOLERANCE_METERS = 0.005;
+    // The standard deviations of the noise on the speed and direction of kicks
+    static constexpr double KICK_SPEED_NOISE_FRACTION    = 0.02;
+    static constexpr double KICK_DIRECTION_NOISE_DEGREES = 0.5;
+
+   private:
+    // The state of a simulated robot
+    struct SimulatedRobot
+    {
+        Point position;
+        Vector velocity;
+        Angle orientation;
+        AngularVelocity angular_velocity;
+        // The Primitive the robot is running, if it has one
+        std::optional<PrimitiveVariant> primitive;
+        // The kick and dribbler settings of the robot's current command
+        double kick_speed_meters_per_second = 0;
+        bool chip                           = false;
+        bool dribbler_on                    = false;
+    };
+
+    /**
+     * Sets the Primitives of the given robots
+     *
+     * @param robots The robots to set the Primitives of
+     * @param primitives The Primitives for the robots
+     */
+    static void setPrimitives(std::map<unsigned int, SimulatedRobot>& robots,
+                              const std::vector<PrimitiveVariant>& primitives);
+
+    /**
+     * Steps the whole simulation forwards by one physics time step
+     */
+    void stepPhysics();
+
+    /**
+     * Updates the commanded velocities and kick settings of a team's robots from their
+     * Primitives, and moves the robots by one physics time step
+     *
+     * @param robots The robots of the team
+     * @param motion_controller The MotionController for the robots of the team
+     * @param max_acceleration_meters_per_second_squared The acceleration limit of the
+     * robots of the team
+     */
+    void stepRobots(std::map<unsigned int, SimulatedRobot>& robots,
+                    MotionController& motion_controller,
+                    double max_acceleration_meters_per_second_squared);
+
+    /**
+     * Moves the ball by one physics time step
+     */
+    void stepBall();
+
+    /**
+     * Resolves the collisions between the robots and the walls, and between pairs of
+     * robots
+     */
+    void resolveRobotCollisions();
+
+    /**
+     * Resolves the collisions between the ball and the robots and walls, and lets the
+     * robots kick and dribble the ball
+     */
+    void resolveBallCollisions();
+
+    /**
+     * Returns whether the ball is touching the dribbler of the given robot
+     *
+     * @param robot The robot to check
+     *
+     * @return whether the ball is on the ground and touching the dribbler of the robot
+     */
+    bool ballIsOnDribbler(const SimulatedRobot& robot) const;
+
+    /**
+     * Kicks or chips the ball from the dribbler of the given robot, with noise on the
+     * speed and direction of the kick
+     *
+     * @param robot The robot that kicks the ball
+     */
+    void kickBall(const SimulatedRobot& robot);
+
+    /**
+     * Copies the simulated state into the World
+     */
+    void updateWorld();
+
+    World world;
+    Duration physics_time_step;
+    Timestamp current_time;
+    std::mt19937 random_number_generator;
+
+    // The robots of each team, ordered by id so that every step processes them in the
+    // same order
+    std::map<unsigned int, SimulatedRobot> friendly_robots;
+    std::map<unsigned int, SimulatedRobot> enemy_robots;
+    MotionController friendly_motion_controller;
+    MotionController enemy_motion_controller;
+
+    Point ball_position;
+    Vector ball_velocity;
+    std::optional<BallContact> last_ball_contact;
+    // The height of the bottom of the ball above the ground, and its vertical velocity
+    double ball_height;
+    double ball_vertical_velocity;
+};
@@ -82,6 +82,59 @@ TEST(PassingEvaluationTest, getTimeToPositionForRobot_reaches_max_velocity)
 
     double travel_time = 2 * acceleration_time + time_at_max_vel;
 
-    EXPECT_EQ(Duration::fromSeconds(travel_time),
-              getTimeToPositionForRobot(robot, dest, 2.0, 3.0));
+    EXPECT_NEAR(travel_time,
+                getTimeToPositionForRobot(robot, dest, 2.0, 3.0).getSeconds(), 1e-9);
+}
+
+TEST(PassingEvaluationTest, getTimeToPositionForRobot_moving_towards_dest)
+{
+    Point dest(1, 1);
+    Robot still_robot(0, Point(-1, 1), Vector(0, 0), Angle::ofDegrees(0),
+                      AngularVelocity::ofDegrees(0), Timestamp::fromSeconds(0));
+    Robot moving_robot(0, Point(-1, 1), Vector(1, 0), Angle::ofDegrees(0),
+                       AngularVelocity::ofDegrees(0), Timestamp::fromSeconds(0));
+
+    EXPECT_LT(getTimeToPositionForRobot(moving_robot, dest, 2.0, 3.0),
+              getTimeToPositionForRobot(still_robot, dest, 2.0, 3.0));
+}
+
+TEST(PassingEvaluationTest, getTimeToPositionForRobot_moving_away_from_dest)
+{
+    // The robot has to stop 1/6m further away and come back, which takes 1/3s to stop
+    // and then the time to go 2 + 1/6m from rest. That is long enough to reach the max
+    // velocity, so it is 2/3s to accelerate, 2/3s to decelerate, and the rest of the
+    // distance at the max velocity
+    Point dest(1, 1);
+    Robot robot(0, Point(-1, 1), Vector(-1, 0), Angle::ofDegrees(0),
+                AngularVelocity::ofDegrees(0), Timestamp::fromSeconds(0));
+
+    double expected_travel_time =
+        1.0 / 3 + 2.0 / 3 + (2 + 1.0 / 6 - 4.0 / 3) / 2 + 2.0 / 3;
+
+    EXPECT_NEAR(expected_travel_time,
+                getTimeToPositionForRobot(robot, dest, 2.0, 3.0).getSeconds(), 1e-9);
+}
+
+TEST(PassingEvaluationTest, getTimeToPositionForRobot_moving_sideways)
+{
+    // The robot has to cancel its sideways velocity on the way, so it takes longer than
+    // if it were still
+    Point dest(1, 1);
+    Robot still_robot(0, Point(-1, 1), Vector(0, 0), Angle::ofDegrees(0),
+                      AngularVelocity::ofDegrees(0), Timestamp::fromSeconds(0));
+    Robot moving_robot(0, Point(-1, 1), Vector(0, 1.5), Angle::ofDegrees(0),
+                       AngularVelocity::ofDegrees(0), Timestamp::fromSeconds(0));
+
+    EXPECT_GT(getTimeToPositionForRobot(moving_robot, dest, 2.0, 3.0),
+              getTimeToPositionForRobot(still_robot, dest, 2.0, 3.0));
+}
+
+TEST(PassingEvaluationTest, getTimeToPositionForRobot_moving_at_dest)
+{
+    // A robot passing through the destination still has to stop and come back
+    Point dest(1, 1);
+    Robot robot(0, dest, Vector(1, 0), Angle::ofDegrees(0), AngularVelocity::ofDegrees(0),
+                Timestamp::fromSeconds(0));
+
+    EXPECT_GT(getTimeToPositionForRobot(robot, dest, 2.0, 3.0), Duration::fromSeconds(0));
 }
@@ -0,0 +1,176 @@
+/**
+ * This file contains the unit tests for the WorldAnalysis class
+ */
+
+#include "ai/hl/stp/evaluation/world_analysis.h"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <thread>
+
+#include "shared/constants.h"
+#include "test/test_util/test_util.h"
+
+class WorldAnalysisTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        current_time = Timestamp::fromSeconds(123);
+        world        = ::Test::TestUtil::createBlankTestingWorld();
+        world = ::Test::TestUtil::setBallPosition(world, Point(0, 0), current_time);
+        world = ::Test::TestUtil::setFriendlyRobotPositions(
+            world, {Point(-3, 0), Point(-1, 0), Point(-2, 2)}, current_time);
+        world = ::Test::TestUtil::setEnemyRobotPositions(
+            world, {Point(2, 0), Point(0, 1)}, current_time);
+    }
+
+    Timestamp current_time;
+    World world;
+};
+
+TEST_F(WorldAnalysisTest, robots_are_in_same_order_as_teams)
+{
+    WorldAnalysis world_analysis(world);
+
+    EXPECT_EQ(world.friendlyTeam().getAllRobots(), world_analysis.getFriendlyRobots());
+    EXPECT_EQ(world.enemyTeam().getAllRobots(), world_analysis.getEnemyRobots());
+}
+
+TEST_F(WorldAnalysisTest, distances_to_ball)
+{
+    WorldAnalysis world_analysis(world);
+
+    std::vector<double> friendly_distances = world_analysis.getFriendlyDistancesToBall();
+    ASSERT_EQ(3, friendly_distances.size());
+    EXPECT_DOUBLE_EQ(3, friendly_distances[0]);
+    EXPECT_DOUBLE_EQ(1, friendly_distances[1]);
+    EXPECT_DOUBLE_EQ(std::sqrt(8), friendly_distances[2]);
+
+    std::vector<double> enemy_distances = world_analysis.getEnemyDistancesToBall();
+    ASSERT_EQ(2, enemy_distances.size());
+    EXPECT_DOUBLE_EQ(2, enemy_distances[0]);
+    EXPECT_DOUBLE_EQ(1, enemy_distances[1]);
+}
+
+TEST_F(WorldAnalysisTest, robots_sorted_by_distance_to_ball)
+{
+    WorldAnalysis world_analysis(world);
+
+    std::vector<Robot> friendly_robots =
+        world_analysis.getFriendlyRobotsByDistanceToBall();
+    ASSERT_EQ(3, friendly_robots.size());
+    EXPECT_EQ(1, friendly_robots[0].id());
+    EXPECT_EQ(2, friendly_robots[1].id());
+    EXPECT_EQ(0, friendly_robots[2].id());
+
+    std::vector<Robot> enemy_robots = world_analysis.getEnemyRobotsByDistanceToBall();
+    ASSERT_EQ(2, enemy_robots.size());
+    EXPECT_EQ(1, enemy_robots[0].id());
+    EXPECT_EQ(0, enemy_robots[1].id());
+}
+
+TEST_F(WorldAnalysisTest, robots_the_same_distance_from_ball_keep_their_order)
+{
+    world = ::Test::TestUtil::setFriendlyRobotPositions(
+        world, {Point(1, 0), Point(0, 1), Point(-1, 0)}, current_time);
+    WorldAnalysis world_analysis(world);
+
+    std::vector<Robot> friendly_robots =
+        world_analysis.getFriendlyRobotsByDistanceToBall();
+    ASSERT_EQ(3, friendly_robots.size());
+    EXPECT_EQ(0, friendly_robots[0].id());
+    EXPECT_EQ(1, friendly_robots[1].id());
+    EXPECT_EQ(2, friendly_robots[2].id());
+}
+
+TEST_F(WorldAnalysisTest, distances_between_robots)
+{
+    WorldAnalysis world_analysis(world);
+
+    EXPECT_DOUBLE_EQ(0, world_analysis.getDistanceBetweenFriendlyRobots(1, 1));
+    EXPECT_DOUBLE_EQ(2, world_analysis.getDistanceBetweenFriendlyRobots(0, 1));
+    EXPECT_DOUBLE_EQ(2, world_analysis.getDistanceBetweenFriendlyRobots(1, 0));
+    EXPECT_DOUBLE_EQ(std::sqrt(5), world_analysis.getDistanceBetweenFriendlyRobots(0, 2));
+    EXPECT_DOUBLE_EQ(std::sqrt(5), world_analysis.getDistanceBetweenEnemyRobots(0, 1));
+    EXPECT_DOUBLE_EQ(5, world_analysis.getDistanceBetweenFriendlyAndEnemyRobots(0, 0));
+    EXPECT_DOUBLE_EQ(std::sqrt(5),
+                     world_analysis.getDistanceBetweenFriendlyAndEnemyRobots(2, 1));
+}
+
+TEST_F(WorldAnalysisTest, distances_between_robots_that_do_not_exist)
+{
+    WorldAnalysis world_analysis(world);
+
+    EXPECT_THROW(world_analysis.getDistanceBetweenFriendlyRobots(0, 3),
+                 std::out_of_range);
+    EXPECT_THROW(world_analysis.getDistanceBetweenEnemyRobots(2, 0), std::out_of_range);
+    EXPECT_THROW(world_analysis.getDistanceBetweenFriendlyAndEnemyRobots(0, 2),
+                 std::out_of_range);
+}
+
+TEST_F(WorldAnalysisTest, obstacle_points)
+{
+    WorldAnalysis world_analysis(world);
+
+    std::vector<Point> expected_obstacle_points = {
+        Point(-3, 0), Point(-1, 0), Point(-2, 2), Point(2, 0), Point(0, 1)};
+    EXPECT_EQ(expected_obstacle_points, world_analysis.getObstaclePoints());
+}
+
+TEST_F(WorldAnalysisTest, no_robot_has_possession)
+{
+    WorldAnalysis world_analysis(world);
+
+    EXPECT_FALSE(world_analysis.getFriendlyRobotWithPossession());
+    EXPECT_FALSE(world_analysis.getEnemyRobotWithPossession());
+}
+
+TEST_F(WorldAnalysisTest, friendly_robot_has_possession)
+{
+    // Robots face along the x axis, so this puts the ball right at robot 1's dribbler
+    world = ::Test::TestUtil::setBallPosition(
+        world, Point(-1 + DIST_TO_FRONT_OF_ROBOT_METERS, 0), current_time);
+    WorldAnalysis world_analysis(world);
+
+    ASSERT_TRUE(world_analysis.getFriendlyRobotWithPossession());
+    EXPECT_EQ(1, world_analysis.getFriendlyRobotWithPossession()->id());
+    EXPECT_FALSE(world_analysis.getEnemyRobotWithPossession());
+
+    ASSERT_TRUE(world_analysis.getFriendlyRobotWithEffectiveBallPossession());
+    EXPECT_EQ(1, world_analysis.getFriendlyRobotWithEffectiveBallPossession()->id());
+}
+
+TEST_F(WorldAnalysisTest, effective_possession_with_no_robots)
+{
+    world = ::Test::TestUtil::setEnemyRobotPositions(world, {}, current_time);
+    WorldAnalysis world_analysis(world);
+
+    EXPECT_FALSE(world_analysis.getEnemyRobotWithEffectiveBallPossession());
+    EXPECT_TRUE(world_analysis.getFriendlyRobotWithEffectiveBallPossession());
+}
+
+TEST_F(WorldAnalysisTest, facts_asked_for_from_several_threads_are_the_same)
+{
+    WorldAnalysis world_analysis(world);
+    std::vector<const std::vector<Robot>*> results(4);
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        threads.emplace_back([&world_analysis, &results, i]() {
+            results[i] = &world_analysis.getEnemyRobotsByDistanceToBall();
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (const auto& result : results)
+    {
+        EXPECT_EQ(results[0], result);
+    }
+    EXPECT_EQ(1, results[0]->at(0).id());
+}
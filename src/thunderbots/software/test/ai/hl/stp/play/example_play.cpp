@@ -9,16 +9,14 @@ TEST(ExamplePlayTest, test_example_play_always_applicable)
 {
     World world = ::Test::TestUtil::createBlankTestingWorld();
 
-    ExamplePlay example_play;
-    EXPECT_TRUE(example_play.isApplicable(world));
+    EXPECT_TRUE(ExamplePlay::isApplicable(world));
 }
 
 TEST(ExamplePlayTest, test_example_play_invariant_always_holds)
 {
     World world = ::Test::TestUtil::createBlankTestingWorld();
 
-    ExamplePlay example_play;
-    EXPECT_TRUE(example_play.invariantHolds(world));
+    EXPECT_TRUE(ExamplePlay::invariantHolds(world));
 }
 
 TEST(ExamplePlayTest, test_example_play_returns_correct_tactics)
@@ -26,7 +24,7 @@ TEST(ExamplePlayTest, test_example_play_returns_correct_tactics)
     World world = ::Test::TestUtil::createBlankTestingWorld();
 
     ExamplePlay example_play;
-    auto tactics = example_play.getTactics(world);
+    auto tactics = example_play.getTactics(world, WorldAnalysis(world));
 
     // Make sure something was returned
     EXPECT_TRUE(tactics);
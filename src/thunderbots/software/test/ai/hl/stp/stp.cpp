@@ -167,3 +167,34 @@ TEST_F(STPTest, test_fallback_play_assigned_when_no_new_plays_are_applicable)
     stp.getIntents(world);
     EXPECT_EQ(*(stp.getCurrentPlayName()), StopTestPlay::name);
 }
+
+TEST_F(STPTest, test_intents_with_worker_threads_match_intents_without_worker_threads)
+{
+    // Only the MoveTestPlay should be applicable
+    world =
+        ::Test::TestUtil::setBallPosition(world, Point(1, -1), Timestamp::fromSeconds(0));
+    Team friendly_team(Duration::fromSeconds(0));
+    std::vector<Robot> robots;
+    for (unsigned int id = 0; id < 6; id++)
+    {
+        robots.emplace_back(id, Point(-2.5 + id, 0.5 * id - 1), Point(), Angle::zero(),
+                            AngularVelocity::zero(), Timestamp::fromSeconds(0));
+    }
+    friendly_team.updateRobots(robots);
+    world.updateFriendlyTeamState(friendly_team);
+
+    STP parallel_stp(0, 3);
+    for (int tick = 0; tick < 5; tick++)
+    {
+        auto intents          = stp.getIntents(world);
+        auto parallel_intents = parallel_stp.getIntents(world);
+
+        ASSERT_EQ(intents.size(), 3);
+        ASSERT_EQ(intents.size(), parallel_intents.size());
+        for (size_t i = 0; i < intents.size(); i++)
+        {
+            EXPECT_EQ(std::get<MoveIntent>(intents[i]),
+                      std::get<MoveIntent>(parallel_intents[i]));
+        }
+    }
+}
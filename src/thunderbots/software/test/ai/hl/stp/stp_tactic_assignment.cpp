@@ -343,10 +343,85 @@ TEST_F(STPTacticAssignmentTest,
     std::vector<std::shared_ptr<Tactic>> tactics = {stop_tactic_1, move_tactic_1,
                                                     stop_tactic_2};
 
+    // The stop_tactics have the same cost for every robot, so the remaining robots are
+    // paired with them in order
     auto assigned_tactics = stp.assignRobotsToTactics(world, tactics);
 
     EXPECT_EQ(assigned_tactics.size(), 3);
-    EXPECT_EQ(assigned_tactics.at(0)->getAssignedRobot(), robot_2);
+    EXPECT_EQ(assigned_tactics.at(0)->getAssignedRobot(), robot_1);
+    EXPECT_EQ(assigned_tactics.at(1)->getAssignedRobot(), robot_0);
+    EXPECT_EQ(assigned_tactics.at(2)->getAssignedRobot(), robot_2);
+}
+
+// Test that robots don't swap tactics when the costs of swapping are almost the same,
+// as happens when robots are the same distance from two destinations
+//
+//                     robot0     robot1
+//
+//                     dest1      dest2
+TEST_F(STPTacticAssignmentTest,
+       test_robots_keep_tactics_when_swapping_costs_almost_the_same)
+{
+    Team friendly_team(Duration::fromSeconds(0));
+    Robot robot_0(0, Point(-1, 1), Point(), Angle::zero(), AngularVelocity::zero(),
+                  Timestamp::fromSeconds(0));
+    Robot robot_1(1, Point(1, 1), Point(), Angle::zero(), AngularVelocity::zero(),
+                  Timestamp::fromSeconds(0));
+    friendly_team.updateRobots({robot_0, robot_1});
+    world.updateFriendlyTeamState(friendly_team);
+
+    auto move_tactic_1 = std::make_shared<MoveTestTactic>();
+    auto move_tactic_2 = std::make_shared<MoveTestTactic>();
+
+    move_tactic_1->updateParams(Point(-1, 0));
+    move_tactic_2->updateParams(Point(1, 0));
+
+    std::vector<std::shared_ptr<Tactic>> tactics = {move_tactic_1, move_tactic_2};
+
+    auto assigned_tactics = stp.assignRobotsToTactics(world, tactics);
+
+    EXPECT_EQ(assigned_tactics.at(0)->getAssignedRobot(), robot_0);
+    EXPECT_EQ(assigned_tactics.at(1)->getAssignedRobot(), robot_1);
+
+    // Move the destinations so that swapping robots would be very slightly cheaper
+    move_tactic_1->updateParams(Point(0.01, 0));
+    move_tactic_2->updateParams(Point(-0.01, 0));
+
+    assigned_tactics = stp.assignRobotsToTactics(world, tactics);
+
+    EXPECT_EQ(assigned_tactics.at(0)->getAssignedRobot(), robot_0);
+    EXPECT_EQ(assigned_tactics.at(1)->getAssignedRobot(), robot_1);
+}
+
+TEST_F(STPTacticAssignmentTest, test_robots_swap_tactics_when_swapping_is_much_cheaper)
+{
+    Team friendly_team(Duration::fromSeconds(0));
+    Robot robot_0(0, Point(-1, 1), Point(), Angle::zero(), AngularVelocity::zero(),
+                  Timestamp::fromSeconds(0));
+    Robot robot_1(1, Point(1, 1), Point(), Angle::zero(), AngularVelocity::zero(),
+                  Timestamp::fromSeconds(0));
+    friendly_team.updateRobots({robot_0, robot_1});
+    world.updateFriendlyTeamState(friendly_team);
+
+    auto move_tactic_1 = std::make_shared<MoveTestTactic>();
+    auto move_tactic_2 = std::make_shared<MoveTestTactic>();
+
+    move_tactic_1->updateParams(Point(-1, 0));
+    move_tactic_2->updateParams(Point(1, 0));
+
+    std::vector<std::shared_ptr<Tactic>> tactics = {move_tactic_1, move_tactic_2};
+
+    auto assigned_tactics = stp.assignRobotsToTactics(world, tactics);
+
+    EXPECT_EQ(assigned_tactics.at(0)->getAssignedRobot(), robot_0);
+    EXPECT_EQ(assigned_tactics.at(1)->getAssignedRobot(), robot_1);
+
+    // Swap the destinations, so each robot is now far from its tactic's destination
+    move_tactic_1->updateParams(Point(1, 0));
+    move_tactic_2->updateParams(Point(-1, 0));
+
+    assigned_tactics = stp.assignRobotsToTactics(world, tactics);
+
+    EXPECT_EQ(assigned_tactics.at(0)->getAssignedRobot(), robot_1);
     EXPECT_EQ(assigned_tactics.at(1)->getAssignedRobot(), robot_0);
-    EXPECT_EQ(assigned_tactics.at(2)->getAssignedRobot(), robot_1);
 }
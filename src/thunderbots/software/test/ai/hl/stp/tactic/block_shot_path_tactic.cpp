@@ -78,7 +78,7 @@ TEST(BlockShotPathTacticTest, test_calculate_robot_cost)
 
     // The robot is a little over 2 meters away from where we expect it to block, so the
     // cost should be relatively low
-    double cost = tactic.calculateRobotCost(robot, world);
+    double cost = tactic.calculateRobotCost(robot, world, WorldAnalysis(world));
 
     EXPECT_NEAR(0.2, cost, 0.1);
 }
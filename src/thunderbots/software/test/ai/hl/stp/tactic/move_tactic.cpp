@@ -54,5 +54,6 @@ TEST(MoveTacticTest, test_calculate_robot_cost)
     MoveTactic tactic = MoveTactic();
     tactic.updateParams(Point(3, -4), Angle::zero(), 0.0);
 
-    EXPECT_EQ(5 / world.field().totalLength(), tactic.calculateRobotCost(robot, world));
+    EXPECT_EQ(5 / world.field().totalLength(),
+              tactic.calculateRobotCost(robot, world, WorldAnalysis(world)));
 }
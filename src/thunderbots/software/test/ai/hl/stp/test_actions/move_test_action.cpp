@@ -17,17 +17,20 @@ std::unique_ptr<Intent> MoveTestAction::updateStateAndGetNextIntent(const Robot&
     return getNextIntent();
 }
 
-std::unique_ptr<Intent> MoveTestAction::calculateNextIntent(
-    intent_coroutine::push_type& yield)
+std::unique_ptr<Intent> MoveTestAction::calculateNextIntent(StacklessCoroutine& coroutine)
 {
-    // We use a do-while loop so that we return the Intent at least once. If the robot was
-    // already moving somewhere else, but was told to run the MoveTestAction to a
-    // destination while it happened to be crossing that point, we want to make sure we
-    // send the Intent so we don't report the Action as done while still moving to a
-    // different location
-    do
+    BOOST_ASIO_CORO_REENTER(coroutine)
     {
-        yield(std::make_unique<MoveIntent>(robot->id(), destination, Angle::zero(), 0.0,
-                                           0));
-    } while ((robot->position() - destination).len() > close_to_dest_threshold);
+        // We use a do-while loop so that we return the Intent at least once. If the robot
+        // was already moving somewhere else, but was told to run the MoveTestAction to a
+        // destination while it happened to be crossing that point, we want to make sure
+        // we send the Intent so we don't report the Action as done while still moving to
+        // a different location
+        do
+        {
+            BOOST_ASIO_CORO_YIELD return std::make_unique<MoveIntent>(
+                robot->id(), destination, Angle::zero(), 0.0, 0);
+        } while ((robot->position() - destination).len() > close_to_dest_threshold);
+    }
+    return std::unique_ptr<Intent>{};
 }
@@ -34,8 +34,7 @@ class MoveTestAction : public Action
                                                         Point destination);
 
    private:
-    std::unique_ptr<Intent> calculateNextIntent(
-        intent_coroutine::push_type& yield) override;
+    std::unique_ptr<Intent> calculateNextIntent(StacklessCoroutine& coroutine) override;
 
     // Action parameters
     Point destination;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ai/hl/stp/play/play.h"
+#include "test/ai/hl/stp/test_tactics/move_test_tactic.h"
 
 /**
  * A test Play that moves a robot to the friendly goal, a robot to the enemy goal, and
@@ -23,10 +24,18 @@ class MoveTestPlay : public Play
 
     std::string getName() const override;
 
-    bool isApplicable(const World &world) const override;
+    static bool isApplicable(const World &world);
 
-    bool invariantHolds(const World &world) const override;
+    static bool invariantHolds(const World &world);
 
-    std::vector<std::shared_ptr<Tactic>> getNextTactics(TacticCoroutine::push_type &yield,
-                                                        const World &world) override;
+    std::vector<std::shared_ptr<Tactic>> getNextTactics(
+        StacklessCoroutine &coroutine, const World &world,
+        const WorldAnalysis &world_analysis) override;
+
+   private:
+    // The Tactics this Play runs. They are kept here rather than in getNextTactics so
+    // that they live between calls
+    std::shared_ptr<MoveTestTactic> move_test_tactic_friendly_goal;
+    std::shared_ptr<MoveTestTactic> move_test_tactic_enemy_goal;
+    std::shared_ptr<MoveTestTactic> move_test_tactic_center_field;
 };
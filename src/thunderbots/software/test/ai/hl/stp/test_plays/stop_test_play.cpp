@@ -2,7 +2,6 @@
 
 #include "ai/hl/stp/play/play_factory.h"
 #include "geom/util.h"
-#include "test/ai/hl/stp/test_tactics/stop_test_tactic.h"
 
 const std::string StopTestPlay::name = "Stop Test Play";
 
@@ -11,12 +10,12 @@ std::string StopTestPlay::getName() const
     return StopTestPlay::name;
 }
 
-bool StopTestPlay::isApplicable(const World &world) const
+bool StopTestPlay::isApplicable(const World &world)
 {
     return world.ball().position().y() >= 0;
 }
 
-bool StopTestPlay::invariantHolds(const World &world) const
+bool StopTestPlay::invariantHolds(const World &world)
 {
     return contains(
         Rectangle(world.field().enemyCornerNeg(), world.field().friendlyCornerPos()),
@@ -24,20 +23,28 @@ bool StopTestPlay::invariantHolds(const World &world) const
 }
 
 std::vector<std::shared_ptr<Tactic>> StopTestPlay::getNextTactics(
-    TacticCoroutine::push_type &yield, const World &world)
+    StacklessCoroutine &coroutine, const World &world,
+    const WorldAnalysis &world_analysis)
 {
-    auto stop_test_tactic_1 = std::make_shared<StopTestTactic>();
-    auto stop_test_tactic_2 = std::make_shared<StopTestTactic>();
-    auto stop_test_tactic_3 = std::make_shared<StopTestTactic>();
-
-    do
+    BOOST_ASIO_CORO_REENTER(coroutine)
     {
-        stop_test_tactic_1->updateParams();
-        stop_test_tactic_2->updateParams();
-        stop_test_tactic_3->updateParams();
-
-        yield({stop_test_tactic_1, stop_test_tactic_2, stop_test_tactic_3});
-    } while (true);
+        stop_test_tactic_1 = std::make_shared<StopTestTactic>();
+        stop_test_tactic_2 = std::make_shared<StopTestTactic>();
+        stop_test_tactic_3 = std::make_shared<StopTestTactic>();
+
+        do
+        {
+            BOOST_ASIO_CORO_YIELD
+            {
+                stop_test_tactic_1->updateParams();
+                stop_test_tactic_2->updateParams();
+                stop_test_tactic_3->updateParams();
+
+                return {stop_test_tactic_1, stop_test_tactic_2, stop_test_tactic_3};
+            }
+        } while (true);
+    }
+    return {};
 }
 
 // Register this play in the PlayFactory
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ai/hl/stp/play/play.h"
+#include "test/ai/hl/stp/test_tactics/stop_test_tactic.h"
 
 /**
  * A test Play that stops 3 robots.
@@ -22,10 +23,18 @@ class StopTestPlay : public Play
 
     std::string getName() const override;
 
-    bool isApplicable(const World &world) const override;
+    static bool isApplicable(const World &world);
 
-    bool invariantHolds(const World &world) const override;
+    static bool invariantHolds(const World &world);
 
-    std::vector<std::shared_ptr<Tactic>> getNextTactics(TacticCoroutine::push_type &yield,
-                                                        const World &world) override;
+    std::vector<std::shared_ptr<Tactic>> getNextTactics(
+        StacklessCoroutine &coroutine, const World &world,
+        const WorldAnalysis &world_analysis) override;
+
+   private:
+    // The Tactics this Play runs. They are kept here rather than in getNextTactics so
+    // that they live between calls
+    std::shared_ptr<StopTestTactic> stop_test_tactic_1;
+    std::shared_ptr<StopTestTactic> stop_test_tactic_2;
+    std::shared_ptr<StopTestTactic> stop_test_tactic_3;
 };
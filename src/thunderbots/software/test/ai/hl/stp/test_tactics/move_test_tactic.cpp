@@ -17,7 +17,8 @@ void MoveTestTactic::updateParams(Point destination)
     this->destination = destination;
 }
 
-double MoveTestTactic::calculateRobotCost(const Robot &robot, const World &world)
+double MoveTestTactic::calculateRobotCost(const Robot &robot, const World &world,
+                                          const WorldAnalysis &world_analysis)
 {
     // Prefer robots closer to the destination
     // We normalize with a constant factor so test results to not change based on any
@@ -26,12 +27,15 @@ double MoveTestTactic::calculateRobotCost(const Robot &robot, const World &world
     return std::clamp<double>(cost, 0, 1);
 }
 
-std::unique_ptr<Intent> MoveTestTactic::calculateNextIntent(
-    intent_coroutine::push_type &yield)
+std::unique_ptr<Intent> MoveTestTactic::calculateNextIntent(StacklessCoroutine &coroutine)
 {
-    do
+    BOOST_ASIO_CORO_REENTER(coroutine)
     {
-        yield(std::make_unique<MoveIntent>(this->robot->id(), this->destination,
-                                           Angle::zero(), 0.0, 0));
-    } while ((this->robot->position() - this->destination).len() > 0.01);
+        do
+        {
+            BOOST_ASIO_CORO_YIELD return std::make_unique<MoveIntent>(
+                this->robot->id(), this->destination, Angle::zero(), 0.0, 0);
+        } while ((this->robot->position() - this->destination).len() > 0.01);
+    }
+    return std::unique_ptr<Intent>{};
 }
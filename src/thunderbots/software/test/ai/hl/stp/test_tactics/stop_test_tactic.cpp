@@ -13,17 +13,22 @@ std::string StopTestTactic::getName() const
 
 void StopTestTactic::updateParams() {}
 
-double StopTestTactic::calculateRobotCost(const Robot &robot, const World &world)
+double StopTestTactic::calculateRobotCost(const Robot &robot, const World &world,
+                                          const WorldAnalysis &world_analysis)
 {
     // Prefer all robots equally with a cost of 0.5
     return 0.5;
 }
 
-std::unique_ptr<Intent> StopTestTactic::calculateNextIntent(
-    intent_coroutine::push_type &yield)
+std::unique_ptr<Intent> StopTestTactic::calculateNextIntent(StacklessCoroutine &coroutine)
 {
-    do
+    BOOST_ASIO_CORO_REENTER(coroutine)
     {
-        yield(std::make_unique<StopIntent>(this->robot->id(), false, 0));
-    } while (this->robot->velocity().len() > 0.05);
+        do
+        {
+            BOOST_ASIO_CORO_YIELD return std::make_unique<StopIntent>(this->robot->id(),
+                                                                      false, 0);
+        } while (this->robot->velocity().len() > 0.05);
+    }
+    return std::unique_ptr<Intent>{};
 }
@@ -0,0 +1,28 @@
+/**
+ * This file contains unit tests for IntentVariant
+ */
+
+#include "ai/intent/intent_variant.h"
+
+#include <gtest/gtest.h>
+
+TEST(IntentVariantTest, create_intent_variant_holds_copy_of_intent)
+{
+    MoveIntent move_intent = MoveIntent(2, Point(1, -1), Angle::half(), 0.5, 3);
+    const Intent& intent   = move_intent;
+
+    IntentVariant intent_variant = createIntentVariant(intent);
+
+    ASSERT_TRUE(std::holds_alternative<MoveIntent>(intent_variant));
+    EXPECT_EQ(move_intent, std::get<MoveIntent>(intent_variant));
+}
+
+TEST(IntentVariantTest, get_intent_returns_intent_held_by_variant)
+{
+    IntentVariant intent_variant = StopIntent(4, true, 2);
+
+    const Intent& intent = getIntent(intent_variant);
+
+    EXPECT_EQ("Stop Intent", intent.getIntentName());
+    EXPECT_EQ(2, intent.getPriority());
+}
@@ -0,0 +1,119 @@
+#include "ai/navigator/obstacle/clearance_grid.h"
+
+#include <gtest/gtest.h>
+
+class ClearanceGridTest : public ::testing::Test
+{
+   protected:
+    Rectangle area               = Rectangle(Point(-3, -2), Point(3, 2));
+    double resolution            = 0.02;
+    Util::ThreadPool thread_pool = Util::ThreadPool(0);
+};
+
+TEST_F(ClearanceGridTest, clearance_without_obstacles_is_distance_to_area_edge)
+{
+    ClearanceGrid grid(area, resolution);
+    grid.build(thread_pool);
+
+    EXPECT_NEAR(2, grid.getClearance(Point(0, 0)), resolution);
+    EXPECT_NEAR(0.5, grid.getClearance(Point(2.5, 0.3)), resolution);
+    EXPECT_NEAR(0.25, grid.getClearance(Point(-1, -1.75)), resolution);
+}
+
+TEST_F(ClearanceGridTest, clearance_outside_area_is_negative_distance_to_area)
+{
+    ClearanceGrid grid(area, resolution);
+    grid.build(thread_pool);
+
+    EXPECT_DOUBLE_EQ(-0.5, grid.getClearance(Point(3.5, 0)));
+    EXPECT_DOUBLE_EQ(-5, grid.getClearance(Point(6, 6)));
+}
+
+TEST_F(ClearanceGridTest, clearance_around_circle)
+{
+    ClearanceGrid grid(area, resolution);
+    grid.addCircle(Circle(Point(1, 0), 0.5));
+    grid.build(thread_pool);
+
+    EXPECT_NEAR(0.5, grid.getClearance(Point(0, 0)), resolution);
+    EXPECT_NEAR(0.2, grid.getClearance(Point(1, 0.7)), resolution);
+    EXPECT_NEAR(-0.25, grid.getClearance(Point(1, 0.25)), resolution);
+    EXPECT_NEAR(-0.1, grid.getClearance(Point(1.4, 0)), resolution);
+}
+
+TEST_F(ClearanceGridTest, clearance_around_capsule)
+{
+    ClearanceGrid grid(area, resolution);
+    grid.addCapsule(Segment(Point(-1, 0), Point(1, 0)), 0.2);
+    grid.build(thread_pool);
+
+    EXPECT_NEAR(0.8, grid.getClearance(Point(0, 1)), resolution);
+    EXPECT_NEAR(0.3, grid.getClearance(Point(1.5, 0)), resolution);
+    EXPECT_NEAR(-0.2, grid.getClearance(Point(0.5, 0)), resolution);
+}
+
+TEST_F(ClearanceGridTest, clearance_around_rectangle)
+{
+    ClearanceGrid grid(area, resolution);
+    grid.addRectangle(Rectangle(Point(2, -1), Point(3, 1)));
+    grid.build(thread_pool);
+
+    EXPECT_NEAR(1, grid.getClearance(Point(1, 0)), resolution);
+    EXPECT_NEAR(-0.3, grid.getClearance(Point(2.3, 0)), resolution);
+    EXPECT_NEAR(-0.2, grid.getClearance(Point(2.5, 0.8)), resolution);
+}
+
+TEST_F(ClearanceGridTest, clearance_is_distance_to_nearest_obstacle)
+{
+    ClearanceGrid grid(area, resolution);
+    grid.addCircle(Circle(Point(-1, 0), 0.1));
+    grid.addCircle(Circle(Point(1, 0), 0.1));
+    grid.build(thread_pool);
+
+    EXPECT_NEAR(0.9, grid.getClearance(Point(0, 0)), resolution);
+    EXPECT_NEAR(0.4, grid.getClearance(Point(0.5, 0)), resolution);
+    EXPECT_NEAR(0.4, grid.getClearance(Point(-1.5, 0)), resolution);
+}
+
+TEST_F(ClearanceGridTest, gradient_points_away_from_nearest_obstacle)
+{
+    ClearanceGrid grid(area, resolution);
+    grid.addCircle(Circle(Point(0, 0), 0.5));
+    grid.build(thread_pool);
+
+    Vector gradient = grid.getGradient(Point(1, 1));
+
+    EXPECT_NEAR(1, gradient.len(), 0.05);
+    EXPECT_LT(gradient.norm().orientation().minDiff(Vector(1, 1).orientation()),
+              Angle::ofDegrees(3));
+}
+
+TEST_F(ClearanceGridTest, build_on_several_threads_matches_build_on_one_thread)
+{
+    ClearanceGrid serial_grid(area, resolution);
+    ClearanceGrid parallel_grid(area, resolution);
+    for (ClearanceGrid *grid : {&serial_grid, &parallel_grid})
+    {
+        grid->addCircle(Circle(Point(0.3, 0.4), 0.3));
+        grid->addCapsule(Segment(Point(-2, -1), Point(-1, 1.5)), 0.1);
+        grid->addRectangle(Rectangle(Point(2, -0.5), Point(3, 0.5)));
+    }
+    Util::ThreadPool parallel_thread_pool(3);
+
+    serial_grid.build(thread_pool);
+    parallel_grid.build(parallel_thread_pool);
+
+    for (double x = -3; x <= 3; x += 0.13)
+    {
+        for (double y = -2; y <= 2; y += 0.11)
+        {
+            EXPECT_EQ(serial_grid.getClearance(Point(x, y)),
+                      parallel_grid.getClearance(Point(x, y)));
+        }
+    }
+}
+
+TEST_F(ClearanceGridTest, non_positive_resolution_is_rejected)
+{
+    EXPECT_THROW(ClearanceGrid(area, 0), std::invalid_argument);
+}
@@ -0,0 +1,45 @@
+#include "ai/navigator/obstacle/obstacle.h"
+
+#include <gtest/gtest.h>
+
+#include "shared/constants.h"
+
+TEST(NavigatorObstacleTest, stationary_robot_obstacle_surrounds_robot)
+{
+    Robot robot = Robot(3, Point(1, 1), Vector(), Angle::zero(), AngularVelocity::zero(),
+                        Timestamp::fromSeconds(0));
+
+    Obstacle obstacle = Obstacle::createRobotObstacle(robot, 1.0, 1.0);
+
+    EXPECT_EQ(6, obstacle.getBoundary().getPoints().size());
+    EXPECT_TRUE(obstacle.getBoundary().containsPoint(Point(1, 1)));
+    EXPECT_TRUE(obstacle.getBoundary().containsPoint(
+        Point(1, 1) + Point(0, ROBOT_MAX_RADIUS_METERS * 0.8)));
+    EXPECT_FALSE(obstacle.getBoundary().containsPoint(
+        Point(1, 1) + Point(ROBOT_MAX_RADIUS_METERS * 1.1, 0)));
+}
+
+TEST(NavigatorObstacleTest, robot_obstacle_scaled_by_radius_scaling)
+{
+    Robot robot = Robot(3, Point(1, 1), Vector(), Angle::zero(), AngularVelocity::zero(),
+                        Timestamp::fromSeconds(0));
+
+    Obstacle obstacle = Obstacle::createRobotObstacle(robot, 2.0, 1.0);
+
+    EXPECT_TRUE(obstacle.getBoundary().containsPoint(
+        Point(1, 1) + Point(ROBOT_MAX_RADIUS_METERS * 1.5, 0)));
+    EXPECT_FALSE(obstacle.getBoundary().containsPoint(
+        Point(1, 1) + Point(ROBOT_MAX_RADIUS_METERS * 2.1, 0)));
+}
+
+TEST(NavigatorObstacleTest, moving_robot_obstacle_extends_along_velocity)
+{
+    Robot robot = Robot(3, Point(1, 1), Vector(1, 0), Angle::zero(),
+                        AngularVelocity::zero(), Timestamp::fromSeconds(0));
+
+    Obstacle obstacle = Obstacle::createRobotObstacle(robot, 1.0, 0.5);
+
+    // The obstacle covers where the robot will be, but not where it has been
+    EXPECT_TRUE(obstacle.getBoundary().containsPoint(Point(1.4, 1)));
+    EXPECT_FALSE(obstacle.getBoundary().containsPoint(Point(0.6, 1)));
+}
@@ -0,0 +1,245 @@
+#include "ai/navigator/path_planner/d_star_lite_path_planner.h"
+
+#include <gtest/gtest.h>
+
+#include "geom/util.h"
+
+class TestDStarLitePathPlanner : public ::testing::Test
+{
+   protected:
+    // Checks that the path goes from start to dest without entering any obstacle
+    void checkPathIsValid(const std::vector<Point>& path_points, const Point& start,
+                          const Point& dest, const std::vector<Obstacle>& obstacles)
+    {
+        ASSERT_GE(path_points.size(), 2);
+        EXPECT_EQ(start, path_points.front());
+        EXPECT_EQ(dest, path_points.back());
+        for (size_t i = 0; i + 1 < path_points.size(); i++)
+        {
+            Segment segment(path_points[i], path_points[i + 1]);
+            for (const Obstacle& obstacle : obstacles)
+            {
+                EXPECT_FALSE(obstacle.getBoundary().intersects(segment))
+                    << "Segment from " << path_points[i] << " to " << path_points[i + 1]
+                    << " enters an obstacle";
+            }
+        }
+    }
+
+    // Returns the length of the path
+    double getPathLength(const std::vector<Point>& path_points)
+    {
+        double length = 0;
+        for (size_t i = 0; i + 1 < path_points.size(); i++)
+        {
+            length += (path_points[i + 1] - path_points[i]).len();
+        }
+        return length;
+    }
+
+    // A square obstacle with the given centre and half width
+    Obstacle createSquareObstacle(const Point& centre, double half_width)
+    {
+        return Obstacle(Polygon({centre + Point(-half_width, -half_width),
+                                 centre + Point(half_width, -half_width),
+                                 centre + Point(half_width, half_width),
+                                 centre + Point(-half_width, half_width)}));
+    }
+
+    Rectangle navigable_area = Rectangle(Point(-4.5, -3), Point(4.5, 3));
+    PathPlanner::ViolationFunction no_violation = [](const Point& point) { return 0.0; };
+};
+
+TEST_F(TestDStarLitePathPlanner, test_straight_line_when_nothing_is_in_the_way)
+{
+    Point start{-2, -1}, dest{3, 2};
+    DStarLitePathPlanner planner(navigable_area, 0.1);
+
+    auto path_points = planner.findPath(start, dest, {}, no_violation);
+
+    ASSERT_TRUE(path_points);
+    EXPECT_EQ(std::vector<Point>({start, dest}), *path_points);
+}
+
+TEST_F(TestDStarLitePathPlanner, test_path_goes_around_obstacle)
+{
+    Point start{-2, 0}, dest{2, 0};
+    DStarLitePathPlanner planner(navigable_area, 0.1);
+    std::vector<Obstacle> obstacles = {createSquareObstacle(Point(0, 0), 0.5)};
+
+    auto path_points = planner.findPath(start, dest, obstacles, no_violation);
+
+    ASSERT_TRUE(path_points);
+    checkPathIsValid(*path_points, start, dest, obstacles);
+    // The lattice keeps the path away from the corners of the obstacle, so it is a
+    // little longer than the shortest path
+    double shortest_length = 2 * (Point(1.5, 0.5).len() + 0.5);
+    EXPECT_LT(getPathLength(*path_points), shortest_length * 1.1);
+}
+
+TEST_F(TestDStarLitePathPlanner, test_no_path_when_destination_is_in_obstacle)
+{
+    Point start{-2, 0}, dest{2, 0};
+    DStarLitePathPlanner planner(navigable_area, 0.1);
+    std::vector<Obstacle> obstacles = {createSquareObstacle(dest, 0.5)};
+
+    EXPECT_FALSE(planner.findPath(start, dest, obstacles, no_violation));
+}
+
+TEST_F(TestDStarLitePathPlanner, test_no_path_when_destination_is_walled_off)
+{
+    Point start{-2, 0}, dest{2, 0};
+    DStarLitePathPlanner planner(navigable_area, 0.1);
+    std::vector<Obstacle> obstacles = {Obstacle(
+        Polygon({Point(0, -10), Point(0.5, -10), Point(0.5, 10), Point(0, 10)}))};
+
+    EXPECT_FALSE(planner.findPath(start, dest, obstacles, no_violation));
+}
+
+TEST_F(TestDStarLitePathPlanner, test_path_leaves_obstacle_that_contains_start)
+{
+    Point start{0, 0}, dest{2, 0};
+    DStarLitePathPlanner planner(navigable_area, 0.1);
+    std::vector<Obstacle> obstacles = {createSquareObstacle(start, 0.5)};
+
+    auto path_points = planner.findPath(start, dest, obstacles, no_violation);
+
+    ASSERT_TRUE(path_points);
+    EXPECT_EQ(std::vector<Point>({start, dest}), *path_points);
+}
+
+TEST_F(TestDStarLitePathPlanner, test_path_avoids_violating_area)
+{
+    Point start{-2, 0}, dest{2, 0};
+    DStarLitePathPlanner planner(navigable_area, 0.1);
+    PathPlanner::ViolationFunction violation = [](const Point& point) {
+        return std::abs(point.x()) < 0.5 && std::abs(point.y()) < 0.5 ? 0.1 : 0.0;
+    };
+
+    auto path_points = planner.findPath(start, dest, {}, violation);
+
+    ASSERT_TRUE(path_points);
+    for (size_t i = 0; i + 1 < path_points->size(); i++)
+    {
+        Point start_point = (*path_points)[i];
+        Vector piece      = ((*path_points)[i + 1] - start_point) / 100;
+        for (int j = 0; j <= 100; j++)
+        {
+            EXPECT_EQ(0, violation(start_point + piece * j));
+        }
+    }
+}
+
+TEST_F(TestDStarLitePathPlanner, test_replanning_after_small_change_expands_fewer_cells)
+{
+    Point start{-3, 0}, dest{3, 0};
+    DStarLitePathPlanner planner(navigable_area, 0.1);
+    std::vector<Obstacle> obstacles = {createSquareObstacle(Point(0, 0), 0.5)};
+
+    planner.findPath(start, dest, obstacles, no_violation);
+    unsigned int num_initial_expansions = planner.getNumExpansionsOfLastSearch();
+
+    // Move the obstacle a little and the start along the path
+    obstacles = {createSquareObstacle(Point(0, 0.1), 0.5)};
+    Point new_start{-2.8, 0};
+    auto path_points = planner.findPath(new_start, dest, obstacles, no_violation);
+
+    ASSERT_TRUE(path_points);
+    checkPathIsValid(*path_points, new_start, dest, obstacles);
+    EXPECT_LT(planner.getNumExpansionsOfLastSearch(), num_initial_expansions / 2);
+}
+
+TEST_F(TestDStarLitePathPlanner, test_replanned_path_matches_path_planned_from_scratch)
+{
+    Point start{-3, 0}, dest{3, 0.3};
+    DStarLitePathPlanner incremental_planner(navigable_area, 0.1);
+    DStarLitePathPlanner scratch_planner(navigable_area, 0.1);
+
+    incremental_planner.findPath(start, dest, {createSquareObstacle(Point(0, 0), 0.5)},
+                                 no_violation);
+
+    // A new obstacle blocks the way the first path went
+    std::vector<Obstacle> obstacles = {createSquareObstacle(Point(0, 0), 0.5),
+                                       createSquareObstacle(Point(0, 1), 0.5)};
+    auto incremental_path =
+        incremental_planner.findPath(start, dest, obstacles, no_violation);
+    auto scratch_path = scratch_planner.findPath(start, dest, obstacles, no_violation);
+
+    ASSERT_TRUE(incremental_path);
+    ASSERT_TRUE(scratch_path);
+    checkPathIsValid(*incremental_path, start, dest, obstacles);
+    EXPECT_NEAR(getPathLength(*scratch_path), getPathLength(*incremental_path), 1e-9);
+}
+
+TEST_F(TestDStarLitePathPlanner, test_replanned_paths_match_paths_planned_from_scratch)
+{
+    Point start{-3.5, 0.2}, dest{3.5, -0.1};
+    DStarLitePathPlanner incremental_planner(navigable_area, 0.1);
+
+    // Robots drift across the field while the start moves towards the destination
+    for (int i = 0; i < 40; i++)
+    {
+        std::vector<Obstacle> obstacles = {
+            createSquareObstacle(Point(-1, 0.3 - 0.02 * i), 0.25),
+            createSquareObstacle(Point(0.5, -0.5 + 0.03 * i), 0.25),
+            createSquareObstacle(Point(1.5 - 0.02 * i, 0), 0.25)};
+        start = start + Vector(0.02, 0);
+
+        DStarLitePathPlanner scratch_planner(navigable_area, 0.1);
+        auto incremental_path =
+            incremental_planner.findPath(start, dest, obstacles, no_violation);
+        auto scratch_path =
+            scratch_planner.findPath(start, dest, obstacles, no_violation);
+
+        ASSERT_TRUE(incremental_path);
+        ASSERT_TRUE(scratch_path);
+        EXPECT_NEAR(getPathLength(*scratch_path), getPathLength(*incremental_path), 1e-9);
+    }
+}
+
+TEST_F(TestDStarLitePathPlanner, test_path_is_straight_again_after_obstacle_is_removed)
+{
+    Point start{-3, 0}, dest{3, 0};
+    DStarLitePathPlanner planner(navigable_area, 0.1);
+
+    auto detour = planner.findPath(start, dest, {createSquareObstacle(Point(0, 0), 0.5)},
+                                   no_violation);
+    auto path_points = planner.findPath(start, dest, {}, no_violation);
+
+    ASSERT_TRUE(detour);
+    EXPECT_GT(detour->size(), 2);
+    ASSERT_TRUE(path_points);
+    EXPECT_EQ(std::vector<Point>({start, dest}), *path_points);
+}
+
+TEST_F(TestDStarLitePathPlanner, test_new_violation_function_is_used_after_invalidating)
+{
+    Point start{-2, 0}, dest{2, 0};
+    DStarLitePathPlanner planner(navigable_area, 0.1);
+    PathPlanner::ViolationFunction violation = [](const Point& point) {
+        return std::abs(point.x()) < 0.5 && std::abs(point.y()) < 0.5 ? 0.1 : 0.0;
+    };
+
+    planner.findPath(start, dest, {}, no_violation);
+    planner.invalidateViolationCosts();
+    auto path_points = planner.findPath(start, dest, {}, violation);
+
+    ASSERT_TRUE(path_points);
+    EXPECT_GT(path_points->size(), 2);
+    for (const Point& point : *path_points)
+    {
+        EXPECT_EQ(0, violation(point));
+    }
+}
+
+TEST_F(TestDStarLitePathPlanner, test_non_positive_resolution_is_rejected)
+{
+    EXPECT_THROW(DStarLitePathPlanner(navigable_area, 0), std::invalid_argument);
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << argv[0] << std::endl;
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
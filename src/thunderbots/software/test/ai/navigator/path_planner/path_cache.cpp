@@ -0,0 +1,234 @@
+#include "ai/navigator/path_planner/path_cache.h"
+
+#include <gtest/gtest.h>
+
+// A path planner that returns a fixed path and counts how often it is used
+class FixedPathPlanner : public PathPlanner
+{
+   public:
+    explicit FixedPathPlanner(std::vector<Point> path_points)
+        : path_points(std::move(path_points))
+    {
+    }
+
+    std::optional<std::vector<Point>> findPath(
+        const Point& start, const Point& dest, const std::vector<Obstacle>& obstacles,
+        const ViolationFunction& violation_function) override
+    {
+        num_calls++;
+        return path_points;
+    }
+
+    std::vector<Point> path_points;
+    unsigned int num_calls = 0;
+};
+
+class TestPathCache : public ::testing::Test
+{
+   protected:
+    // A square obstacle with the given centre and half width
+    Obstacle createSquareObstacle(const Point& centre, double half_width)
+    {
+        return Obstacle(Polygon({centre + Point(-half_width, -half_width),
+                                 centre + Point(half_width, -half_width),
+                                 centre + Point(half_width, half_width),
+                                 centre + Point(-half_width, half_width)}));
+    }
+
+    // Blocks the direct path between the start and destination used by most tests, so
+    // the cache keeps the detour returned by the path planner
+    std::vector<Obstacle> direct_path_obstacles = {
+        createSquareObstacle(Point(0, 0), 0.2)};
+    Rectangle navigable_area = Rectangle(Point(-4.5, -3), Point(4.5, 3));
+    PathPlanner::ViolationFunction no_violation = [](const Point& point) { return 0.0; };
+    PathCache path_cache                        = PathCache(navigable_area, 0.1);
+    FixedPathPlanner path_planner =
+        FixedPathPlanner({Point(-2, 0), Point(0, 1), Point(2, 0)});
+};
+
+TEST_F(TestPathCache, test_first_path_is_planned)
+{
+    auto path_points = path_cache.findPath(
+        Point(-2, 0), Point(2, 0), direct_path_obstacles, no_violation, path_planner);
+
+    ASSERT_TRUE(path_points);
+    EXPECT_EQ(path_planner.path_points, *path_points);
+    EXPECT_EQ(1, path_planner.num_calls);
+    EXPECT_EQ(1, path_cache.getStatistics().num_lookups);
+    EXPECT_EQ(0, path_cache.getStatistics().num_hits);
+}
+
+TEST_F(TestPathCache, test_valid_cached_path_is_reused_from_current_position)
+{
+    path_cache.findPath(Point(-2, 0), Point(2, 0), direct_path_obstacles, no_violation,
+                        path_planner);
+
+    // The robot has moved past the first corner of the path
+    auto path_points = path_cache.findPath(
+        Point(0.2, 0.9), Point(2, 0), direct_path_obstacles, no_violation, path_planner);
+
+    ASSERT_TRUE(path_points);
+    EXPECT_EQ(std::vector<Point>({Point(0.2, 0.9), Point(2, 0)}), *path_points);
+    EXPECT_EQ(1, path_planner.num_calls);
+    EXPECT_EQ(2, path_cache.getStatistics().num_lookups);
+    EXPECT_EQ(1, path_cache.getStatistics().num_hits);
+    EXPECT_DOUBLE_EQ(0.5, path_cache.getStatistics().getHitRate());
+}
+
+TEST_F(TestPathCache, test_small_destination_change_reuses_cached_path)
+{
+    path_cache.findPath(Point(-2, 0), Point(2, 0), direct_path_obstacles, no_violation,
+                        path_planner);
+
+    auto path_points = path_cache.findPath(
+        Point(-2, 0), Point(2, 0.03), direct_path_obstacles, no_violation, path_planner);
+
+    ASSERT_TRUE(path_points);
+    EXPECT_EQ(std::vector<Point>({Point(-2, 0), Point(0, 1), Point(2, 0.03)}),
+              *path_points);
+    EXPECT_EQ(1, path_planner.num_calls);
+}
+
+TEST_F(TestPathCache, test_new_destination_is_planned)
+{
+    path_cache.findPath(Point(-2, 0), Point(2, 0), direct_path_obstacles, no_violation,
+                        path_planner);
+
+    path_cache.findPath(Point(-2, 0), Point(2, 2), direct_path_obstacles, no_violation,
+                        path_planner);
+
+    EXPECT_EQ(2, path_planner.num_calls);
+    EXPECT_EQ(0, path_cache.getStatistics().num_hits);
+}
+
+TEST_F(TestPathCache, test_invalid_segment_is_repaired_and_valid_prefix_is_kept)
+{
+    path_cache.findPath(Point(-2, 0), Point(2, 0), direct_path_obstacles, no_violation,
+                        path_planner);
+
+    // An obstacle appears on the second segment of the path
+    std::vector<Obstacle> obstacles = direct_path_obstacles;
+    obstacles.emplace_back(createSquareObstacle(Point(1, 0.5), 0.2));
+    auto path_points = path_cache.findPath(Point(-2, 0), Point(2, 0), obstacles,
+                                           no_violation, path_planner);
+
+    ASSERT_TRUE(path_points);
+    ASSERT_GE(path_points->size(), 3);
+    EXPECT_EQ(Point(-2, 0), (*path_points)[0]);
+    EXPECT_EQ(Point(0, 1), (*path_points)[1]);
+    EXPECT_EQ(Point(2, 0), path_points->back());
+    for (size_t i = 0; i + 1 < path_points->size(); i++)
+    {
+        EXPECT_FALSE(obstacles[1].getBoundary().intersects(
+            Segment((*path_points)[i], (*path_points)[i + 1])));
+    }
+    EXPECT_EQ(1, path_planner.num_calls);
+    EXPECT_EQ(1, path_cache.getStatistics().num_repairs);
+    EXPECT_GT(path_cache.getStatistics().total_repair_duration, Duration::fromSeconds(0));
+}
+
+TEST_F(TestPathCache, test_path_is_planned_when_repair_fails)
+{
+    path_cache.findPath(Point(-2, 0), Point(2, 0), direct_path_obstacles, no_violation,
+                        path_planner);
+
+    // A wall between the robot and its destination
+    std::vector<Obstacle> obstacles = {Obstacle(
+        Polygon({Point(1, -10), Point(1.2, -10), Point(1.2, 10), Point(1, 10)}))};
+    path_cache.findPath(Point(-2, 0), Point(2, 0), obstacles, no_violation, path_planner);
+
+    EXPECT_EQ(2, path_planner.num_calls);
+    EXPECT_EQ(0, path_cache.getStatistics().num_repairs);
+}
+
+TEST_F(TestPathCache, test_obstacle_containing_start_does_not_invalidate_path)
+{
+    path_cache.findPath(Point(-2, 0), Point(2, 0), direct_path_obstacles, no_violation,
+                        path_planner);
+
+    std::vector<Obstacle> obstacles = direct_path_obstacles;
+    obstacles.emplace_back(createSquareObstacle(Point(-2, 0), 0.2));
+    path_cache.findPath(Point(-2, 0), Point(2, 0), obstacles, no_violation, path_planner);
+
+    EXPECT_EQ(1, path_cache.getStatistics().num_hits);
+}
+
+TEST_F(TestPathCache, test_cached_detour_is_planned_again_when_direct_path_is_clear)
+{
+    path_cache.findPath(Point(-2, 0), Point(2, 0), direct_path_obstacles, no_violation,
+                        path_planner);
+
+    // The obstacle the path went around has moved out of the way
+    path_planner.path_points = {Point(-2, 0), Point(2, 0)};
+    auto path_points =
+        path_cache.findPath(Point(-2, 0), Point(2, 0), {}, no_violation, path_planner);
+
+    ASSERT_TRUE(path_points);
+    EXPECT_EQ(std::vector<Point>({Point(-2, 0), Point(2, 0)}), *path_points);
+    EXPECT_EQ(2, path_planner.num_calls);
+    EXPECT_EQ(0, path_cache.getStatistics().num_hits);
+}
+
+TEST_F(TestPathCache, test_segment_violating_boundary_is_repaired)
+{
+    // The second segment of the planned path goes through a boundary
+    PathPlanner::ViolationFunction violation_function = [](const Point& point) {
+        return std::max(0.0, 0.2 - (point - Point(1, 0.5)).len());
+    };
+    path_cache.findPath(Point(-2, 0), Point(2, 0), direct_path_obstacles,
+                        violation_function, path_planner);
+
+    auto path_points =
+        path_cache.findPath(Point(-2, 0), Point(2, 0), direct_path_obstacles,
+                            violation_function, path_planner);
+
+    ASSERT_TRUE(path_points);
+    EXPECT_EQ(Point(0, 1), (*path_points)[1]);
+    EXPECT_EQ(Point(2, 0), path_points->back());
+    for (const Point& point : *path_points)
+    {
+        EXPECT_DOUBLE_EQ(0, violation_function(point));
+    }
+    EXPECT_EQ(1, path_planner.num_calls);
+    EXPECT_EQ(0, path_cache.getStatistics().num_hits);
+    EXPECT_EQ(1, path_cache.getStatistics().num_repairs);
+}
+
+TEST_F(TestPathCache, test_leaving_violated_boundary_does_not_invalidate_path)
+{
+    // The robot starts inside a boundary, and the path leads out of it
+    PathPlanner::ViolationFunction violation_function = [](const Point& point) {
+        return std::max(0.0, 0.5 - (point - Point(-2, 0)).len());
+    };
+    path_cache.findPath(Point(-2, 0), Point(2, 0), direct_path_obstacles,
+                        violation_function, path_planner);
+    path_cache.findPath(Point(-2, 0), Point(2, 0), direct_path_obstacles,
+                        violation_function, path_planner);
+
+    EXPECT_EQ(1, path_planner.num_calls);
+    EXPECT_EQ(1, path_cache.getStatistics().num_hits);
+}
+
+TEST_F(TestPathCache, test_statistics_are_cleared)
+{
+    path_cache.findPath(Point(-2, 0), Point(2, 0), direct_path_obstacles, no_violation,
+                        path_planner);
+    path_cache.findPath(Point(-2, 0), Point(2, 0), direct_path_obstacles, no_violation,
+                        path_planner);
+
+    path_cache.clearStatistics();
+
+    EXPECT_EQ(0, path_cache.getStatistics().num_lookups);
+    EXPECT_EQ(0, path_cache.getStatistics().num_hits);
+    // The cached path is kept
+    path_cache.findPath(Point(-2, 0), Point(2, 0), direct_path_obstacles, no_violation,
+                        path_planner);
+    EXPECT_EQ(1, path_cache.getStatistics().num_hits);
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << argv[0] << std::endl;
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,214 @@
+#include "ai/navigator/path_planner/rrt_star_path_planner.h"
+
+#include <gtest/gtest.h>
+
+#include "geom/point.h"
+#include "geom/util.h"
+
+class TestRRTStarPathPlanner : public ::testing::Test
+{
+   protected:
+    // Checks that the path goes from start to dest without entering any obstacle
+    void checkPathIsValid(const std::vector<Point>& path_points, const Point& start,
+                          const Point& dest, const std::vector<Obstacle>& obstacles)
+    {
+        ASSERT_GE(path_points.size(), 2);
+        EXPECT_EQ(start, path_points.front());
+        EXPECT_EQ(dest, path_points.back());
+        for (size_t i = 0; i + 1 < path_points.size(); i++)
+        {
+            Segment segment(path_points[i], path_points[i + 1]);
+            for (const Obstacle& obstacle : obstacles)
+            {
+                EXPECT_FALSE(obstacle.getBoundary().intersects(segment))
+                    << "Segment from " << path_points[i] << " to " << path_points[i + 1]
+                    << " enters an obstacle";
+            }
+        }
+    }
+
+    // Returns the length of the path
+    double getPathLength(const std::vector<Point>& path_points)
+    {
+        double length = 0;
+        for (size_t i = 0; i + 1 < path_points.size(); i++)
+        {
+            length += (path_points[i + 1] - path_points[i]).len();
+        }
+        return length;
+    }
+
+    // A square obstacle with the given centre and half width
+    Obstacle createSquareObstacle(const Point& centre, double half_width)
+    {
+        return Obstacle(Polygon({centre + Point(-half_width, -half_width),
+                                 centre + Point(half_width, -half_width),
+                                 centre + Point(half_width, half_width),
+                                 centre + Point(-half_width, half_width)}));
+    }
+
+    Rectangle navigable_area = Rectangle(Point(-4.5, -3), Point(4.5, 3));
+    PathPlanner::ViolationFunction no_violation = [](const Point& point) { return 0.0; };
+};
+
+TEST_F(TestRRTStarPathPlanner, test_straight_line_when_nothing_is_in_the_way)
+{
+    Point start{-2, -1}, dest{3, 2};
+    RRTStarPathPlanner planner(navigable_area, Duration::fromSeconds(10), 1000);
+    std::vector<Obstacle> obstacles = {createSquareObstacle(Point(0, 2), 0.5)};
+
+    auto path_points = planner.findPath(start, dest, obstacles, no_violation);
+
+    ASSERT_TRUE(path_points);
+    EXPECT_EQ(std::vector<Point>({start, dest}), *path_points);
+    // The straight line is the best path, so there is no reason to search
+    EXPECT_EQ(0, planner.getNumIterationsOfLastSearch());
+}
+
+TEST_F(TestRRTStarPathPlanner, test_path_goes_around_obstacle)
+{
+    Point start{-2, 0}, dest{2, 0};
+    RRTStarPathPlanner planner(navigable_area, Duration::fromSeconds(10), 2000);
+    std::vector<Obstacle> obstacles = {createSquareObstacle(Point(0, 0), 0.5)};
+
+    auto path_points = planner.findPath(start, dest, obstacles, no_violation);
+
+    ASSERT_TRUE(path_points);
+    checkPathIsValid(*path_points, start, dest, obstacles);
+    // The shortest path around the obstacle touches two of its corners. The path
+    // should be close to it
+    double shortest_length = 2 * (Point(1.5, 0.5).len() + 0.5);
+    EXPECT_GE(getPathLength(*path_points), shortest_length - 1e-6);
+    EXPECT_LT(getPathLength(*path_points), shortest_length * 1.1);
+}
+
+TEST_F(TestRRTStarPathPlanner, test_path_through_gap_between_robots)
+{
+    Point start{-3, 0}, dest{3, 0};
+    RRTStarPathPlanner planner(navigable_area, Duration::fromSeconds(10), 3000);
+    // A wall of robots across the field, with a gap at y = 1
+    std::vector<Obstacle> obstacles;
+    for (double y = -3; y <= 3; y += 0.2)
+    {
+        if (std::abs(y - 1) > 0.3)
+        {
+            Robot robot(0, Point(0, y), Vector(), Angle::zero(), AngularVelocity::zero(),
+                        Timestamp::fromSeconds(0));
+            obstacles.emplace_back(Obstacle::createRobotObstacle(robot, 1.2, 1));
+        }
+    }
+
+    auto path_points = planner.findPath(start, dest, obstacles, no_violation);
+
+    ASSERT_TRUE(path_points);
+    checkPathIsValid(*path_points, start, dest, obstacles);
+}
+
+TEST_F(TestRRTStarPathPlanner, test_no_path_when_destination_is_in_obstacle)
+{
+    Point start{-2, 0}, dest{2, 0};
+    RRTStarPathPlanner planner(navigable_area, Duration::fromSeconds(10), 1000);
+    std::vector<Obstacle> obstacles = {createSquareObstacle(dest, 0.5)};
+
+    EXPECT_FALSE(planner.findPath(start, dest, obstacles, no_violation));
+}
+
+TEST_F(TestRRTStarPathPlanner, test_no_path_when_destination_is_walled_off)
+{
+    Point start{-2, 0}, dest{2, 0};
+    RRTStarPathPlanner planner(navigable_area, Duration::fromSeconds(10), 500);
+    // A wall across the whole navigable area
+    std::vector<Obstacle> obstacles = {Obstacle(
+        Polygon({Point(0, -10), Point(0.5, -10), Point(0.5, 10), Point(0, 10)}))};
+
+    EXPECT_FALSE(planner.findPath(start, dest, obstacles, no_violation));
+    EXPECT_EQ(500, planner.getNumIterationsOfLastSearch());
+}
+
+TEST_F(TestRRTStarPathPlanner, test_path_leaves_obstacle_that_contains_start)
+{
+    Point start{0, 0}, dest{2, 0};
+    RRTStarPathPlanner planner(navigable_area, Duration::fromSeconds(10), 1000);
+    std::vector<Obstacle> obstacles = {createSquareObstacle(start, 0.5)};
+
+    auto path_points = planner.findPath(start, dest, obstacles, no_violation);
+
+    ASSERT_TRUE(path_points);
+    EXPECT_EQ(std::vector<Point>({start, dest}), *path_points);
+}
+
+TEST_F(TestRRTStarPathPlanner, test_path_avoids_violating_area)
+{
+    Point start{-2, 0}, dest{2, 0};
+    RRTStarPathPlanner planner(navigable_area, Duration::fromSeconds(10), 2000);
+    // An area in the middle of the straight line that should be avoided, but isn't
+    // an obstacle
+    PathPlanner::ViolationFunction violation = [](const Point& point) {
+        return std::abs(point.x()) < 0.5 && std::abs(point.y()) < 0.5 ? 0.1 : 0.0;
+    };
+
+    auto path_points = planner.findPath(start, dest, {}, violation);
+
+    ASSERT_TRUE(path_points);
+    EXPECT_GT(path_points->size(), 2);
+    double violating_length = 0;
+    for (size_t i = 0; i + 1 < path_points->size(); i++)
+    {
+        Point start_point = (*path_points)[i];
+        Vector piece      = ((*path_points)[i + 1] - start_point) / 100;
+        for (int j = 0; j < 100; j++)
+        {
+            if (violation(start_point + piece * (j + 0.5)) > 0)
+            {
+                violating_length += piece.len();
+            }
+        }
+    }
+    // The straight line would travel 1m through the area
+    EXPECT_LT(violating_length, 0.1);
+}
+
+TEST_F(TestRRTStarPathPlanner, test_iteration_budget_is_respected)
+{
+    Point start{-2, 0}, dest{2, 0};
+    RRTStarPathPlanner planner(navigable_area, Duration::fromSeconds(10), 50);
+    std::vector<Obstacle> obstacles = {createSquareObstacle(Point(0, 0), 0.5)};
+
+    planner.findPath(start, dest, obstacles, no_violation);
+
+    EXPECT_EQ(50, planner.getNumIterationsOfLastSearch());
+}
+
+TEST_F(TestRRTStarPathPlanner, test_time_budget_is_respected)
+{
+    Point start{-2, 0}, dest{2, 0};
+    RRTStarPathPlanner planner(navigable_area, Duration::fromSeconds(0), 1000000);
+    std::vector<Obstacle> obstacles = {createSquareObstacle(Point(0, 0), 0.5)};
+
+    planner.findPath(start, dest, obstacles, no_violation);
+
+    EXPECT_EQ(0, planner.getNumIterationsOfLastSearch());
+}
+
+TEST_F(TestRRTStarPathPlanner, test_warm_start_does_not_make_path_worse)
+{
+    Point start{-2, 0}, dest{2, 0};
+    RRTStarPathPlanner planner(navigable_area, Duration::fromSeconds(10), 300);
+    std::vector<Obstacle> obstacles = {createSquareObstacle(Point(0, 0), 0.5)};
+
+    auto first_path_points  = planner.findPath(start, dest, obstacles, no_violation);
+    auto second_path_points = planner.findPath(start, dest, obstacles, no_violation);
+
+    ASSERT_TRUE(first_path_points);
+    ASSERT_TRUE(second_path_points);
+    checkPathIsValid(*second_path_points, start, dest, obstacles);
+    EXPECT_LE(getPathLength(*second_path_points),
+              getPathLength(*first_path_points) + 1e-6);
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << argv[0] << std::endl;
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
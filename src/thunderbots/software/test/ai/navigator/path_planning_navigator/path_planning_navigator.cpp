@@ -0,0 +1,130 @@
+#include "ai/navigator/path_planning_navigator/path_planning_navigator.h"
+
+#include <gtest/gtest.h>
+
+#include "geom/util.h"
+#include "shared/constants.h"
+#include "test/test_util/test_util.h"
+
+class PathPlanningNavigatorTest : public ::testing::Test
+{
+   protected:
+    PathPlanningNavigator navigator = PathPlanningNavigator(Duration::fromSeconds(1), 1);
+};
+
+TEST_F(PathPlanningNavigatorTest, robot_moves_straight_to_destination_when_path_is_clear)
+{
+    World world = ::Test::TestUtil::createBlankTestingWorld();
+    world       = ::Test::TestUtil::setFriendlyRobotPositions(world, {Point(-2, 0)},
+                                                        Timestamp::fromSeconds(0));
+
+    std::vector<IntentVariant> intents;
+    intents.emplace_back(MoveIntent(0, Point(2, 1), Angle::quarter(), 0.5, 1));
+
+    const std::vector<PrimitiveVariant> &primitives =
+        navigator.getAssignedPrimitives(world, intents);
+
+    ASSERT_EQ(1, primitives.size());
+    EXPECT_EQ(MovePrimitive(0, Point(2, 1), Angle::quarter(), 0.5),
+              std::get<MovePrimitive>(primitives.at(0)));
+}
+
+TEST_F(PathPlanningNavigatorTest, robot_moves_around_robot_in_the_way)
+{
+    World world = ::Test::TestUtil::createBlankTestingWorld();
+    world       = ::Test::TestUtil::setFriendlyRobotPositions(world, {Point(-2, 0)},
+                                                        Timestamp::fromSeconds(0));
+    world       = ::Test::TestUtil::setEnemyRobotPositions(world, {Point(0, 0)},
+                                                     Timestamp::fromSeconds(0));
+
+    std::vector<IntentVariant> intents;
+    intents.emplace_back(MoveIntent(0, Point(2, 0), Angle::zero(), 0, 1));
+
+    const std::vector<PrimitiveVariant> &primitives =
+        navigator.getAssignedPrimitives(world, intents);
+
+    ASSERT_EQ(1, primitives.size());
+    MovePrimitive primitive = std::get<MovePrimitive>(primitives.at(0));
+    EXPECT_NE(Point(2, 0), primitive.getDestination());
+    EXPECT_GT(dist(Segment(Point(-2, 0), primitive.getDestination()), Point(0, 0)),
+              2 * ROBOT_MAX_RADIUS_METERS);
+}
+
+TEST_F(PathPlanningNavigatorTest, robot_stops_when_destination_cannot_be_reached)
+{
+    World world = ::Test::TestUtil::createBlankTestingWorld();
+    world       = ::Test::TestUtil::setFriendlyRobotPositions(world, {Point(-2, 0)},
+                                                        Timestamp::fromSeconds(0));
+    world       = ::Test::TestUtil::setEnemyRobotPositions(world, {Point(2, 0)},
+                                                     Timestamp::fromSeconds(0));
+
+    std::vector<IntentVariant> intents;
+    intents.emplace_back(MoveIntent(0, Point(2, 0), Angle::zero(), 1, 1));
+
+    const std::vector<PrimitiveVariant> &primitives =
+        navigator.getAssignedPrimitives(world, intents);
+
+    ASSERT_EQ(1, primitives.size());
+    EXPECT_EQ(MovePrimitive(0, Point(-2, 0), Angle::zero(), 0),
+              std::get<MovePrimitive>(primitives.at(0)));
+}
+
+TEST_F(PathPlanningNavigatorTest, lower_priority_robot_stops_short_of_crossing_robot)
+{
+    World world = ::Test::TestUtil::createBlankTestingWorld();
+    world       = ::Test::TestUtil::setFriendlyRobotPositions(
+        world, {Point(-1, 0), Point(0, -1)}, Timestamp::fromSeconds(0));
+
+    std::vector<IntentVariant> intents;
+    intents.emplace_back(MoveIntent(1, Point(0, 1), Angle::zero(), 1, 1));
+    intents.emplace_back(MoveIntent(0, Point(1, 0), Angle::zero(), 1, 2));
+
+    const std::vector<PrimitiveVariant> &primitives =
+        navigator.getAssignedPrimitives(world, intents);
+
+    ASSERT_EQ(2, primitives.size());
+    // The higher priority robot keeps its move, and the other robot stops before the
+    // two moves come too close
+    EXPECT_EQ(MovePrimitive(0, Point(1, 0), Angle::zero(), 1),
+              std::get<MovePrimitive>(primitives.at(1)));
+    MovePrimitive stopped_primitive = std::get<MovePrimitive>(primitives.at(0));
+    EXPECT_DOUBLE_EQ(0, stopped_primitive.getDestination().x());
+    // The moves are tried in steps of a tenth of the move, which is 0.2m here
+    EXPECT_LE(stopped_primitive.getDestination().y(), -0.2);
+    EXPECT_GE(stopped_primitive.getDestination().y(), -0.4 - 1e-9);
+    EXPECT_EQ(0, stopped_primitive.getFinalSpeed());
+}
+
+TEST_F(PathPlanningNavigatorTest, intents_that_are_not_moves_are_converted_directly)
+{
+    World world = ::Test::TestUtil::createBlankTestingWorld();
+    world       = ::Test::TestUtil::setFriendlyRobotPositions(world, {Point(-2, 0)},
+                                                        Timestamp::fromSeconds(0));
+
+    std::vector<IntentVariant> intents;
+    intents.emplace_back(StopIntent(0, false, 1));
+    intents.emplace_back(KickIntent(0, Point(), Angle::half(), 3, 1));
+
+    const std::vector<PrimitiveVariant> &primitives =
+        navigator.getAssignedPrimitives(world, intents);
+
+    ASSERT_EQ(2, primitives.size());
+    EXPECT_EQ(StopPrimitive(0, false), std::get<StopPrimitive>(primitives.at(0)));
+    EXPECT_EQ(KickPrimitive(0, Point(), Angle::half(), 3),
+              std::get<KickPrimitive>(primitives.at(1)));
+}
+
+TEST_F(PathPlanningNavigatorTest, move_for_robot_not_in_world_is_converted_directly)
+{
+    World world = ::Test::TestUtil::createBlankTestingWorld();
+
+    std::vector<IntentVariant> intents;
+    intents.emplace_back(MoveIntent(4, Point(1, 1), Angle::zero(), 0, 1));
+
+    const std::vector<PrimitiveVariant> &primitives =
+        navigator.getAssignedPrimitives(world, intents);
+
+    ASSERT_EQ(1, primitives.size());
+    EXPECT_EQ(MovePrimitive(4, Point(1, 1), Angle::zero(), 0),
+              std::get<MovePrimitive>(primitives.at(0)));
+}
@@ -9,16 +9,17 @@ TEST(PlaceholderNavigatorTest, convert_catch_intent_to_catch_primitive)
     World world = ::Test::TestUtil::createBlankTestingWorld();
     PlaceholderNavigator placeholderNavigator;
 
-    std::vector<std::unique_ptr<Intent>> intents;
-    intents.emplace_back(std::make_unique<CatchIntent>(1, 0, 10, 0.3, 0));
+    std::vector<IntentVariant> intents;
+    intents.emplace_back(CatchIntent(1, 0, 10, 0.3, 0));
 
-    auto primitive_ptrs = placeholderNavigator.getAssignedPrimitives(world, intents);
+    const std::vector<PrimitiveVariant> &primitives =
+        placeholderNavigator.getAssignedPrimitives(world, intents);
 
     // Make sure we got exactly 1 primitive back
-    EXPECT_EQ(primitive_ptrs.size(), 1);
+    EXPECT_EQ(primitives.size(), 1);
 
     auto expected_primitive = CatchPrimitive(1, 0, 10, 0.3);
-    auto primitive          = dynamic_cast<CatchPrimitive &>(*(primitive_ptrs.at(0)));
+    auto primitive          = std::get<CatchPrimitive>(primitives.at(0));
     EXPECT_EQ(expected_primitive, primitive);
 }
 
@@ -27,17 +28,17 @@ TEST(PlaceholderNavigatorTest, convert_chip_intent_to_chip_primitive)
     World world = ::Test::TestUtil::createBlankTestingWorld();
     PlaceholderNavigator placeholderNavigator;
 
-    std::vector<std::unique_ptr<Intent>> intents;
-    intents.emplace_back(
-        std::make_unique<ChipIntent>(0, Point(), Angle::quarter(), 0, 1));
+    std::vector<IntentVariant> intents;
+    intents.emplace_back(ChipIntent(0, Point(), Angle::quarter(), 0, 1));
 
-    auto primitive_ptrs = placeholderNavigator.getAssignedPrimitives(world, intents);
+    const std::vector<PrimitiveVariant> &primitives =
+        placeholderNavigator.getAssignedPrimitives(world, intents);
 
     // Make sure we got exactly 1 primitive back
-    EXPECT_EQ(primitive_ptrs.size(), 1);
+    EXPECT_EQ(primitives.size(), 1);
 
     auto expected_primitive = ChipPrimitive(0, Point(), Angle::quarter(), 0);
-    auto primitive          = dynamic_cast<ChipPrimitive &>(*(primitive_ptrs.at(0)));
+    auto primitive          = std::get<ChipPrimitive>(primitives.at(0));
     EXPECT_EQ(expected_primitive, primitive);
 }
 
@@ -47,16 +48,17 @@ TEST(PlaceholderNavigatorTest,
     World world = ::Test::TestUtil::createBlankTestingWorld();
     PlaceholderNavigator placeholderNavigator;
 
-    std::vector<std::unique_ptr<Intent>> intents;
-    intents.emplace_back(std::make_unique<DirectVelocityIntent>(3, 1, -2, 0.4, 1000, 4));
+    std::vector<IntentVariant> intents;
+    intents.emplace_back(DirectVelocityIntent(3, 1, -2, 0.4, 1000, 4));
 
-    auto primitive_ptrs = placeholderNavigator.getAssignedPrimitives(world, intents);
+    const std::vector<PrimitiveVariant> &primitives =
+        placeholderNavigator.getAssignedPrimitives(world, intents);
 
     // Make sure we got exactly 1 primitive back
-    EXPECT_EQ(primitive_ptrs.size(), 1);
+    EXPECT_EQ(primitives.size(), 1);
 
     auto expected_primitive = DirectVelocityPrimitive(3, 1, -2, 0.4, 1000);
-    auto primitive = dynamic_cast<DirectVelocityPrimitive &>(*(primitive_ptrs.at(0)));
+    auto primitive          = std::get<DirectVelocityPrimitive>(primitives.at(0));
     EXPECT_EQ(expected_primitive, primitive);
 }
 
@@ -65,17 +67,17 @@ TEST(PlaceholderNavigatorTest, convert_direct_wheels_intent_to_direct_wheels_pri
     World world = ::Test::TestUtil::createBlankTestingWorld();
     PlaceholderNavigator placeholderNavigator;
 
-    std::vector<std::unique_ptr<Intent>> intents;
-    intents.emplace_back(
-        std::make_unique<DirectWheelsIntent>(2, 80, 22, 55, 201, 5000, 60));
+    std::vector<IntentVariant> intents;
+    intents.emplace_back(DirectWheelsIntent(2, 80, 22, 55, 201, 5000, 60));
 
-    auto primitive_ptrs = placeholderNavigator.getAssignedPrimitives(world, intents);
+    const std::vector<PrimitiveVariant> &primitives =
+        placeholderNavigator.getAssignedPrimitives(world, intents);
 
     // Make sure we got exactly 1 primitive back
-    EXPECT_EQ(primitive_ptrs.size(), 1);
+    EXPECT_EQ(primitives.size(), 1);
 
     auto expected_primitive = DirectWheelsPrimitive(2, 80, 22, 55, 201, 5000);
-    auto primitive = dynamic_cast<DirectWheelsPrimitive &>(*(primitive_ptrs.at(0)));
+    auto primitive          = std::get<DirectWheelsPrimitive>(primitives.at(0));
     EXPECT_EQ(expected_primitive, primitive);
 }
 
@@ -84,18 +86,18 @@ TEST(PlaceholderNavigatorTest, convert_dribble_intent_to_dribble_primitive)
     World world = ::Test::TestUtil::createBlankTestingWorld();
     PlaceholderNavigator placeholderNavigator;
 
-    std::vector<std::unique_ptr<Intent>> intents;
-    intents.emplace_back(
-        std::make_unique<DribbleIntent>(0, Point(), Angle::quarter(), 0, 8888, true, 50));
+    std::vector<IntentVariant> intents;
+    intents.emplace_back(DribbleIntent(0, Point(), Angle::quarter(), 0, 8888, true, 50));
 
-    auto primitive_ptrs = placeholderNavigator.getAssignedPrimitives(world, intents);
+    const std::vector<PrimitiveVariant> &primitives =
+        placeholderNavigator.getAssignedPrimitives(world, intents);
 
     // Make sure we got exactly 1 primitive back
-    EXPECT_EQ(primitive_ptrs.size(), 1);
+    EXPECT_EQ(primitives.size(), 1);
 
     auto expected_primitive =
         DribblePrimitive(0, Point(), Angle::quarter(), 0, 8888, true);
-    auto primitive = dynamic_cast<DribblePrimitive &>(*(primitive_ptrs.at(0)));
+    auto primitive = std::get<DribblePrimitive>(primitives.at(0));
     EXPECT_EQ(expected_primitive, primitive);
 }
 
@@ -104,17 +106,17 @@ TEST(PlaceholderNavigatorTest, convert_kick_intent_to_kick_primitive)
     World world = ::Test::TestUtil::createBlankTestingWorld();
     PlaceholderNavigator placeholderNavigator;
 
-    std::vector<std::unique_ptr<Intent>> intents;
-    intents.emplace_back(
-        std::make_unique<KickIntent>(0, Point(), Angle::quarter(), 0, 1));
+    std::vector<IntentVariant> intents;
+    intents.emplace_back(KickIntent(0, Point(), Angle::quarter(), 0, 1));
 
-    auto primitive_ptrs = placeholderNavigator.getAssignedPrimitives(world, intents);
+    const std::vector<PrimitiveVariant> &primitives =
+        placeholderNavigator.getAssignedPrimitives(world, intents);
 
     // Make sure we got exactly 1 primitive back
-    EXPECT_EQ(primitive_ptrs.size(), 1);
+    EXPECT_EQ(primitives.size(), 1);
 
     auto expected_primitive = KickPrimitive(0, Point(), Angle::quarter(), 0);
-    auto primitive          = dynamic_cast<KickPrimitive &>(*(primitive_ptrs.at(0)));
+    auto primitive          = std::get<KickPrimitive>(primitives.at(0));
     EXPECT_EQ(expected_primitive, primitive);
 }
 
@@ -123,17 +125,17 @@ TEST(PlaceholderNavigatorTest, convert_move_intent_to_move_primitive)
     World world = ::Test::TestUtil::createBlankTestingWorld();
     PlaceholderNavigator placeholderNavigator;
 
-    std::vector<std::unique_ptr<Intent>> intents;
-    intents.emplace_back(
-        std::make_unique<MoveIntent>(0, Point(), Angle::quarter(), 0, 1));
+    std::vector<IntentVariant> intents;
+    intents.emplace_back(MoveIntent(0, Point(), Angle::quarter(), 0, 1));
 
-    auto primitive_ptrs = placeholderNavigator.getAssignedPrimitives(world, intents);
+    const std::vector<PrimitiveVariant> &primitives =
+        placeholderNavigator.getAssignedPrimitives(world, intents);
 
     // Make sure we got exactly 1 primitive back
-    EXPECT_EQ(primitive_ptrs.size(), 1);
+    EXPECT_EQ(primitives.size(), 1);
 
     auto expected_primitive = MovePrimitive(0, Point(), Angle::quarter(), 0);
-    auto primitive          = dynamic_cast<MovePrimitive &>(*(primitive_ptrs.at(0)));
+    auto primitive          = std::get<MovePrimitive>(primitives.at(0));
     EXPECT_EQ(expected_primitive, primitive);
 }
 
@@ -142,17 +144,17 @@ TEST(PlaceholderNavigatorTest, convert_movespin_intent_to_movespin_primitive)
     World world = ::Test::TestUtil::createBlankTestingWorld();
     PlaceholderNavigator placeholderNavigator;
 
-    std::vector<std::unique_ptr<Intent>> intents;
-    intents.emplace_back(
-        std::make_unique<MoveSpinIntent>(0, Point(), AngularVelocity::full(), 1));
+    std::vector<IntentVariant> intents;
+    intents.emplace_back(MoveSpinIntent(0, Point(), AngularVelocity::full(), 1));
 
-    auto primitive_ptrs = placeholderNavigator.getAssignedPrimitives(world, intents);
+    const std::vector<PrimitiveVariant> &primitives =
+        placeholderNavigator.getAssignedPrimitives(world, intents);
 
     // Make sure we got exactly 1 primitive back
-    EXPECT_EQ(primitive_ptrs.size(), 1);
+    EXPECT_EQ(primitives.size(), 1);
 
     auto expected_primitive = MoveSpinPrimitive(0, Point(), AngularVelocity::full());
-    auto primitive          = dynamic_cast<MoveSpinPrimitive &>(*(primitive_ptrs.at(0)));
+    auto primitive          = std::get<MoveSpinPrimitive>(primitives.at(0));
     EXPECT_EQ(expected_primitive, primitive);
 }
 
@@ -161,17 +163,17 @@ TEST(PlaceholderNavigatorTest, convert_pivot_intent_to_pivot_primitive)
     World world = ::Test::TestUtil::createBlankTestingWorld();
     PlaceholderNavigator placeholderNavigator;
 
-    std::vector<std::unique_ptr<Intent>> intents;
-    intents.emplace_back(
-        std::make_unique<PivotIntent>(0, Point(1, 0.4), Angle::half(), 3.2, 1));
+    std::vector<IntentVariant> intents;
+    intents.emplace_back(PivotIntent(0, Point(1, 0.4), Angle::half(), 3.2, 1));
 
-    auto primitive_ptrs = placeholderNavigator.getAssignedPrimitives(world, intents);
+    const std::vector<PrimitiveVariant> &primitives =
+        placeholderNavigator.getAssignedPrimitives(world, intents);
 
     // Make sure we got exactly 1 primitive back
-    EXPECT_EQ(primitive_ptrs.size(), 1);
+    EXPECT_EQ(primitives.size(), 1);
 
     auto expected_primitive = PivotPrimitive(0, Point(1, 0.4), Angle::half(), 3.2);
-    auto primitive          = dynamic_cast<PivotPrimitive &>(*(primitive_ptrs.at(0)));
+    auto primitive          = std::get<PivotPrimitive>(primitives.at(0));
     EXPECT_EQ(expected_primitive, primitive);
 }
 
@@ -180,16 +182,17 @@ TEST(PlaceholderNavigatorTest, convert_stop_intent_to_stop_primitive)
     World world = ::Test::TestUtil::createBlankTestingWorld();
     PlaceholderNavigator placeholderNavigator;
 
-    std::vector<std::unique_ptr<Intent>> intents;
-    intents.emplace_back(std::make_unique<StopIntent>(0, false, 1));
+    std::vector<IntentVariant> intents;
+    intents.emplace_back(StopIntent(0, false, 1));
 
-    auto primitive_ptrs = placeholderNavigator.getAssignedPrimitives(world, intents);
+    const std::vector<PrimitiveVariant> &primitives =
+        placeholderNavigator.getAssignedPrimitives(world, intents);
 
     // Make sure we got exactly 1 primitive back
-    EXPECT_EQ(primitive_ptrs.size(), 1);
+    EXPECT_EQ(primitives.size(), 1);
 
     auto expected_primitive = StopPrimitive(0, false);
-    auto primitive          = dynamic_cast<StopPrimitive &>(*(primitive_ptrs.at(0)));
+    auto primitive          = std::get<StopPrimitive>(primitives.at(0));
     EXPECT_EQ(expected_primitive, primitive);
 }
 
@@ -198,25 +201,47 @@ TEST(PlaceholderNavigatorTest, convert_multiple_intents_to_primitives)
     World world = ::Test::TestUtil::createBlankTestingWorld();
     PlaceholderNavigator placeholderNavigator;
 
-    std::vector<std::unique_ptr<Intent>> intents;
-    intents.emplace_back(std::make_unique<StopIntent>(0, false, 1));
-    intents.emplace_back(
-        std::make_unique<PivotIntent>(0, Point(1, 0.4), Angle::half(), 3.2, 1));
-    intents.emplace_back(
-        std::make_unique<MoveIntent>(0, Point(), Angle::quarter(), 0, 1));
+    std::vector<IntentVariant> intents;
+    intents.emplace_back(StopIntent(0, false, 1));
+    intents.emplace_back(PivotIntent(0, Point(1, 0.4), Angle::half(), 3.2, 1));
+    intents.emplace_back(MoveIntent(0, Point(), Angle::quarter(), 0, 1));
 
-    auto primitive_ptrs = placeholderNavigator.getAssignedPrimitives(world, intents);
+    const std::vector<PrimitiveVariant> &primitives =
+        placeholderNavigator.getAssignedPrimitives(world, intents);
 
     // Make sure we got exactly 3 primitives back
-    EXPECT_EQ(primitive_ptrs.size(), 3);
+    EXPECT_EQ(primitives.size(), 3);
 
     auto expected_stop_primitive = StopPrimitive(0, false);
-    auto stop_primitive          = dynamic_cast<StopPrimitive &>(*(primitive_ptrs.at(0)));
+    auto stop_primitive          = std::get<StopPrimitive>(primitives.at(0));
     EXPECT_EQ(expected_stop_primitive, stop_primitive);
     auto expected_pivot_primitive = PivotPrimitive(0, Point(1, 0.4), Angle::half(), 3.2);
-    auto pivot_primitive = dynamic_cast<PivotPrimitive &>(*(primitive_ptrs.at(1)));
+    auto pivot_primitive          = std::get<PivotPrimitive>(primitives.at(1));
     EXPECT_EQ(expected_pivot_primitive, pivot_primitive);
     auto expected_move_primitive = MovePrimitive(0, Point(), Angle::quarter(), 0);
-    auto move_primitive          = dynamic_cast<MovePrimitive &>(*(primitive_ptrs.at(2)));
+    auto move_primitive          = std::get<MovePrimitive>(primitives.at(2));
     EXPECT_EQ(expected_move_primitive, move_primitive);
 }
+
+TEST(PlaceholderNavigatorTest, primitives_from_previous_call_are_replaced)
+{
+    World world = ::Test::TestUtil::createBlankTestingWorld();
+    PlaceholderNavigator placeholderNavigator;
+
+    std::vector<IntentVariant> first_intents;
+    first_intents.emplace_back(StopIntent(0, false, 1));
+    first_intents.emplace_back(StopIntent(1, false, 1));
+    placeholderNavigator.getAssignedPrimitives(world, first_intents);
+
+    std::vector<IntentVariant> second_intents;
+    second_intents.emplace_back(MoveIntent(2, Point(), Angle::quarter(), 0, 1));
+    const std::vector<PrimitiveVariant> &primitives =
+        placeholderNavigator.getAssignedPrimitives(world, second_intents);
+
+    // Make sure only the primitive from the second call is returned
+    EXPECT_EQ(primitives.size(), 1);
+
+    auto expected_primitive = MovePrimitive(2, Point(), Angle::quarter(), 0);
+    auto primitive          = std::get<MovePrimitive>(primitives.at(0));
+    EXPECT_EQ(expected_primitive, primitive);
+}
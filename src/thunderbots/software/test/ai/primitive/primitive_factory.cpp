@@ -302,3 +302,30 @@ TEST(PrimitiveFactoryTest, convert_DribblePrimitive_to_message_and_back_to_MoveP
     EXPECT_DOUBLE_EQ(rpm, params[4]);
     EXPECT_EQ(small_kick_allowed, extraBits[0]);
 }
+
+// Test that a MovePrimitive translated like `Primitive` -> `ROS Message` ->
+// `PrimitiveVariant` holds the same MovePrimitive we started with
+TEST(PrimitiveFactoryTest, convert_MovePrimitive_to_message_and_back_to_PrimitiveVariant)
+{
+    MovePrimitive move_prim = MovePrimitive(3, Point(1, -2), Angle::ofRadians(0.5), 1.5);
+
+    thunderbots_msgs::Primitive prim_message = move_prim.createMsg();
+
+    PrimitiveVariant new_prim =
+        AI::Primitive::createPrimitiveVariantFromROSMessage(prim_message);
+
+    ASSERT_TRUE(std::holds_alternative<MovePrimitive>(new_prim));
+    EXPECT_EQ(move_prim, std::get<MovePrimitive>(new_prim));
+    EXPECT_EQ("Move Primitive", getPrimitive(new_prim).getPrimitiveName());
+}
+
+TEST(PrimitiveFactoryTest, convert_message_with_unknown_primitive_name_throws)
+{
+    thunderbots_msgs::Primitive prim_message = StopPrimitive(0, true).createMsg();
+    prim_message.primitive_name              = "Unknown Primitive";
+
+    EXPECT_THROW(AI::Primitive::createPrimitiveVariantFromROSMessage(prim_message),
+                 std::invalid_argument);
+    EXPECT_THROW(AI::Primitive::createPrimitiveFromROSMessage(prim_message),
+                 std::invalid_argument);
+}
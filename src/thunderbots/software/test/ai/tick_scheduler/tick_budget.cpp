@@ -0,0 +1,118 @@
+#include "ai/tick_scheduler/tick_budget.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+TEST(TickBudgetTest, budget_is_never_exhausted_without_a_tick)
+{
+    TickBudget tick_budget;
+
+    EXPECT_FALSE(tick_budget.isExhausted());
+    EXPECT_GT(tick_budget.getTimeRemaining(), Duration::fromSeconds(3600));
+}
+
+TEST(TickBudgetTest, budget_is_exhausted_after_deadline)
+{
+    TickBudget tick_budget;
+
+    tick_budget.startTick(std::chrono::steady_clock::now() + std::chrono::hours(1));
+    EXPECT_FALSE(tick_budget.isExhausted());
+    EXPECT_GT(tick_budget.getTimeRemaining(), Duration::fromSeconds(3500));
+
+    tick_budget.startTick(std::chrono::steady_clock::now() - std::chrono::seconds(1));
+    EXPECT_TRUE(tick_budget.isExhausted());
+    EXPECT_LT(tick_budget.getTimeRemaining(), Duration::fromSeconds(0));
+}
+
+TEST(TickBudgetTest, must_run_evaluation_runs_when_budget_is_exhausted)
+{
+    TickBudget tick_budget;
+    int num_runs                    = 0;
+    std::function<int()> evaluation = [&num_runs]() { return ++num_runs; };
+
+    tick_budget.startTick(std::chrono::steady_clock::now() - std::chrono::seconds(1));
+    EXPECT_EQ(1, tick_budget.runEvaluation("must_run", EvaluationPriority::MUST_RUN,
+                                           evaluation));
+    EXPECT_EQ(2, tick_budget.runEvaluation("must_run", EvaluationPriority::MUST_RUN,
+                                           evaluation));
+    EXPECT_EQ(0, tick_budget.getNumDegradedEvaluations());
+}
+
+TEST(TickBudgetTest, anytime_evaluation_runs_when_budget_is_not_exhausted)
+{
+    TickBudget tick_budget;
+    int num_runs                    = 0;
+    std::function<int()> evaluation = [&num_runs]() { return ++num_runs; };
+
+    tick_budget.startTick(std::chrono::steady_clock::now() + std::chrono::hours(1));
+    EXPECT_EQ(
+        1, tick_budget.runEvaluation("anytime", EvaluationPriority::ANYTIME, evaluation));
+    EXPECT_EQ(
+        2, tick_budget.runEvaluation("anytime", EvaluationPriority::ANYTIME, evaluation));
+    EXPECT_EQ(0, tick_budget.getNumDegradedEvaluations());
+}
+
+TEST(TickBudgetTest, anytime_evaluation_uses_previous_result_when_budget_is_exhausted)
+{
+    TickBudget tick_budget;
+    int num_runs                    = 0;
+    std::function<int()> evaluation = [&num_runs]() { return ++num_runs; };
+
+    tick_budget.startTick(std::chrono::steady_clock::now() + std::chrono::hours(1));
+    EXPECT_EQ(
+        1, tick_budget.runEvaluation("anytime", EvaluationPriority::ANYTIME, evaluation));
+
+    tick_budget.startTick(std::chrono::steady_clock::now() - std::chrono::seconds(1));
+    EXPECT_EQ(
+        1, tick_budget.runEvaluation("anytime", EvaluationPriority::ANYTIME, evaluation));
+    EXPECT_EQ(1, num_runs);
+    EXPECT_EQ(1, tick_budget.getNumDegradedEvaluations());
+
+    // The count of degraded evaluations is reset every tick
+    tick_budget.startTick(std::chrono::steady_clock::now() + std::chrono::hours(1));
+    EXPECT_EQ(0, tick_budget.getNumDegradedEvaluations());
+}
+
+TEST(TickBudgetTest, anytime_evaluation_without_previous_result_runs_when_exhausted)
+{
+    TickBudget tick_budget;
+    std::function<std::string()> evaluation = []() { return std::string("result"); };
+
+    tick_budget.startTick(std::chrono::steady_clock::now() - std::chrono::seconds(1));
+    EXPECT_EQ("result", tick_budget.runEvaluation("anytime", EvaluationPriority::ANYTIME,
+                                                  evaluation));
+    EXPECT_EQ(0, tick_budget.getNumDegradedEvaluations());
+}
+
+TEST(TickBudgetTest, evaluations_are_recorded_as_stages)
+{
+    TickBudget tick_budget;
+    std::function<int()> evaluation = []() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        return 0;
+    };
+
+    tick_budget.startTick(std::chrono::steady_clock::now() + std::chrono::hours(1));
+    tick_budget.runEvaluation("slow", EvaluationPriority::MUST_RUN, evaluation);
+
+    ASSERT_EQ(1, tick_budget.getStageDurations().count("evaluation/slow"));
+    EXPECT_GE(tick_budget.getStageDurations().at("evaluation/slow"),
+              Duration::fromMilliseconds(5));
+}
+
+TEST(TickBudgetTest, stages_recorded_more_than_once_are_added_together)
+{
+    TickBudget tick_budget;
+
+    tick_budget.recordStage("stage", Duration::fromMilliseconds(2));
+    tick_budget.recordStage("stage", Duration::fromMilliseconds(3));
+    tick_budget.recordStage("other_stage", Duration::fromMilliseconds(1));
+
+    EXPECT_EQ(2, tick_budget.getStageDurations().size());
+    EXPECT_DOUBLE_EQ(5, tick_budget.getStageDurations().at("stage").getMilliseconds());
+
+    // Stages are cleared when a new tick starts
+    tick_budget.startTick(std::chrono::steady_clock::now());
+    EXPECT_TRUE(tick_budget.getStageDurations().empty());
+}
@@ -0,0 +1,128 @@
+#include "ai/tick_scheduler/tick_scheduler.h"
+
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <thread>
+
+class TickSchedulerTest : public ::testing::Test
+{
+   protected:
+    thunderbots_msgs::FrameTrace createTrace(uint64_t frame_id)
+    {
+        thunderbots_msgs::FrameTrace trace;
+        trace.frame_id = frame_id;
+        return trace;
+    }
+
+    // Waits until the scheduler has run the given number of ticks, or a few seconds
+    // have passed
+    void waitForTicks(const TickScheduler& tick_scheduler, uint64_t num_ticks)
+    {
+        auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (tick_scheduler.getNumTicks() < num_ticks &&
+               std::chrono::steady_clock::now() < timeout)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    Util::LatencyTracker latency_tracker    = Util::LatencyTracker("tick_scheduler_test");
+    std::shared_ptr<TickBudget> tick_budget = std::make_shared<TickBudget>();
+};
+
+TEST_F(TickSchedulerTest, throws_with_non_positive_period_or_deadline)
+{
+    auto tick_function = [](const World&, const thunderbots_msgs::FrameTrace&) {};
+    EXPECT_THROW(
+        TickScheduler(Duration::fromMilliseconds(0), Duration::fromMilliseconds(10),
+                      tick_budget, latency_tracker, tick_function),
+        std::invalid_argument);
+    EXPECT_THROW(
+        TickScheduler(Duration::fromMilliseconds(10), Duration::fromMilliseconds(-1),
+                      tick_budget, latency_tracker, tick_function),
+        std::invalid_argument);
+}
+
+TEST_F(TickSchedulerTest, no_tick_is_run_without_a_world)
+{
+    std::atomic<int> num_calls(0);
+    TickScheduler tick_scheduler(
+        Duration::fromMilliseconds(1), Duration::fromMilliseconds(1), tick_budget,
+        latency_tracker,
+        [&num_calls](const World&, const thunderbots_msgs::FrameTrace&) { num_calls++; });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(0, num_calls);
+    EXPECT_EQ(0, tick_scheduler.getNumTicks());
+}
+
+TEST_F(TickSchedulerTest, tick_is_run_on_new_world_with_deadline)
+{
+    std::atomic<uint64_t> last_frame_id(0);
+    std::atomic<bool> had_deadline(false);
+    TickScheduler tick_scheduler(
+        Duration::fromMilliseconds(10), Duration::fromSeconds(1), tick_budget,
+        latency_tracker,
+        [this, &last_frame_id, &had_deadline](const World&,
+                                              const thunderbots_msgs::FrameTrace& trace) {
+            had_deadline  = tick_budget->getTimeRemaining() <= Duration::fromSeconds(1);
+            last_frame_id = trace.frame_id;
+        });
+
+    tick_scheduler.updateWorld(World(), createTrace(1));
+    waitForTicks(tick_scheduler, 1);
+
+    EXPECT_EQ(1, tick_scheduler.getNumTicks());
+    EXPECT_EQ(1, last_frame_id);
+    EXPECT_TRUE(had_deadline);
+    EXPECT_EQ(0, tick_scheduler.getNumMissedDeadlines());
+}
+
+TEST_F(TickSchedulerTest, worlds_that_arrive_within_a_period_are_merged_into_one_tick)
+{
+    std::atomic<uint64_t> last_frame_id(0);
+    TickScheduler tick_scheduler(
+        Duration::fromMilliseconds(200), Duration::fromMilliseconds(100), tick_budget,
+        latency_tracker,
+        [&last_frame_id](const World&, const thunderbots_msgs::FrameTrace& trace) {
+            last_frame_id = trace.frame_id;
+        });
+
+    tick_scheduler.updateWorld(World(), createTrace(1));
+    waitForTicks(tick_scheduler, 1);
+    ASSERT_EQ(1, last_frame_id);
+
+    // These all arrive before the period is up, so only the latest one is run
+    for (uint64_t frame_id = 2; frame_id <= 5; frame_id++)
+    {
+        tick_scheduler.updateWorld(World(), createTrace(frame_id));
+    }
+    EXPECT_EQ(1, tick_scheduler.getNumTicks());
+
+    waitForTicks(tick_scheduler, 2);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(2, tick_scheduler.getNumTicks());
+    EXPECT_EQ(5, last_frame_id);
+}
+
+TEST_F(TickSchedulerTest, tick_that_runs_past_deadline_is_recorded_as_missed)
+{
+    TickScheduler tick_scheduler(
+        Duration::fromMilliseconds(1), Duration::fromMilliseconds(1), tick_budget,
+        latency_tracker, [](const World&, const thunderbots_msgs::FrameTrace&) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        });
+
+    tick_scheduler.updateWorld(World(), createTrace(1));
+    waitForTicks(tick_scheduler, 1);
+
+    EXPECT_EQ(1, tick_scheduler.getNumMissedDeadlines());
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << argv[0] << std::endl;
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -97,6 +97,82 @@ TEST_F(TeamTest, update_with_new_team)
     EXPECT_EQ(team_update, team);
 }
 
+TEST_F(TeamTest, update_single_robot_adds_new_robot)
+{
+    Team team = Team(Duration::fromMilliseconds(1000));
+
+    Robot robot_0 = Robot(0, Point(0, 1), Vector(-1, -2), Angle::half(),
+                          AngularVelocity::threeQuarter(), current_time);
+
+    team.updateRobot(robot_0);
+
+    EXPECT_EQ(1, team.numRobots());
+    EXPECT_EQ(robot_0, team.getRobotById(0));
+}
+
+TEST_F(TeamTest, update_single_robot_updates_existing_robot)
+{
+    Team team = Team(Duration::fromMilliseconds(1000));
+
+    Robot robot_0 = Robot(0, Point(0, 1), Vector(-1, -2), Angle::half(),
+                          AngularVelocity::threeQuarter(), current_time);
+
+    Robot robot_1 = Robot(1, Point(3, -1), Vector(), Angle::zero(),
+                          AngularVelocity::zero(), current_time);
+
+    team.updateRobots({robot_0, robot_1});
+
+    Robot updated_robot_0 = Robot(0, Point(2, 2), Vector(1, 0), Angle::zero(),
+                                  AngularVelocity::zero(), one_second_future);
+
+    team.updateRobot(updated_robot_0);
+
+    EXPECT_EQ(2, team.numRobots());
+    EXPECT_EQ(updated_robot_0, team.getRobotById(0));
+    EXPECT_EQ(one_second_future, team.getRobotById(0)->lastUpdateTimestamp());
+    EXPECT_EQ(robot_1, team.getRobotById(1));
+}
+
+TEST_F(TeamTest, update_single_robot_with_past_timestamp)
+{
+    Team team = Team(Duration::fromMilliseconds(1000));
+
+    Robot robot_0 = Robot(0, Point(0, 1), Vector(-1, -2), Angle::half(),
+                          AngularVelocity::threeQuarter(), current_time);
+
+    team.updateRobot(robot_0);
+
+    Robot old_robot_0 = Robot(0, Point(2, 2), Vector(1, 0), Angle::zero(),
+                              AngularVelocity::zero(), one_second_past);
+
+    EXPECT_THROW(team.updateRobot(old_robot_0), std::invalid_argument);
+}
+
+TEST_F(TeamTest, remove_robot)
+{
+    Team team = Team(Duration::fromMilliseconds(1000));
+
+    Robot robot_0 = Robot(0, Point(0, 1), Vector(-1, -2), Angle::half(),
+                          AngularVelocity::threeQuarter(), current_time);
+
+    Robot robot_1 = Robot(1, Point(3, -1), Vector(), Angle::zero(),
+                          AngularVelocity::zero(), current_time);
+
+    team.updateRobots({robot_0, robot_1});
+    team.assignGoalie(0);
+
+    team.removeRobot(0);
+
+    EXPECT_EQ(1, team.numRobots());
+    EXPECT_EQ(std::nullopt, team.getRobotById(0));
+    EXPECT_EQ(robot_1, team.getRobotById(1));
+    EXPECT_EQ(0, team.getGoalieID());
+
+    // Removing a robot that is not on the team does nothing
+    team.removeRobot(3);
+    EXPECT_EQ(1, team.numRobots());
+}
+
 TEST_F(TeamTest, update_state_to_predicted_state_with_future_timestamp)
 {
     Team team = Team(Duration::fromMilliseconds(1000));
@@ -66,6 +66,46 @@ TEST(PolygonTest, test_polygon_triangle_not_contains_point)
     EXPECT_FALSE(triangle.containsPoint(point));
 }
 
+TEST(PolygonTest, test_polygon_away_from_origin_contains_point)
+{
+    Polygon square{Point(2, 2), Point(4, 2), Point(4, 4), Point(2, 4)};
+    EXPECT_TRUE(square.containsPoint(Point(3, 3)));
+    EXPECT_FALSE(square.containsPoint(Point(5, 3)));
+    EXPECT_FALSE(square.containsPoint(Point(1, 3)));
+    EXPECT_FALSE(square.containsPoint(Point(3, 5)));
+}
+
+TEST(PolygonTest, test_polygon_contains_point_with_ray_through_vertex)
+{
+    // The ray cast from each point passes exactly through the vertices at y = 0
+    Polygon diamond{Point(0, -1), Point(1, 0), Point(0, 1), Point(-1, 0)};
+    EXPECT_TRUE(diamond.containsPoint(Point(0, 0)));
+    EXPECT_TRUE(diamond.containsPoint(Point(0.5, 0)));
+    EXPECT_FALSE(diamond.containsPoint(Point(-2, 0)));
+    EXPECT_FALSE(diamond.containsPoint(Point(2, 0)));
+}
+
+TEST(PolygonTest, test_polygon_contains_points_on_bottom_but_not_top_edge)
+{
+    // Each edge includes its lower end but not its upper end, so points on the bottom
+    // edge are inside and points on the top edge are outside
+    Polygon square{Point(0, 0), Point(2, 0), Point(2, 2), Point(0, 2)};
+    EXPECT_TRUE(square.containsPoint(Point(1, 0)));
+    EXPECT_FALSE(square.containsPoint(Point(1, 2)));
+}
+
+TEST(PolygonTest, test_concave_polygon_contains_point)
+{
+    // A U shape, open at the top between x = 1 and x = 2
+    Polygon u_shape{Point(0, 0), Point(3, 0), Point(3, 3), Point(2, 3),
+                    Point(2, 1), Point(1, 1), Point(1, 3), Point(0, 3)};
+    EXPECT_TRUE(u_shape.containsPoint(Point(0.5, 2)));
+    EXPECT_TRUE(u_shape.containsPoint(Point(2.5, 2)));
+    EXPECT_TRUE(u_shape.containsPoint(Point(1.5, 0.5)));
+    EXPECT_FALSE(u_shape.containsPoint(Point(1.5, 2)));
+    EXPECT_FALSE(u_shape.containsPoint(Point(-0.5, 2)));
+}
+
 TEST(PolygonTest, test_polygon_triangle_intersects_line_segment)
 {
     Point p1{0.0f, 0.0f}, p2{1.0f, 0.0f}, p3{1.0f, 0.0f};
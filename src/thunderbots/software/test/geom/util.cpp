@@ -483,6 +483,22 @@ TEST(GeomUtilTest, test_seg_crosses_seg)
     }
 }
 
+TEST(GeomUtilTest, test_parallel_segs_do_not_cross)
+{
+    Segment seg1(Point(-1, 0.5), Point(1, 0.5));
+    Segment seg2(Point(-0.5, 0.45), Point(0.5, 0.45));
+
+    EXPECT_FALSE(intersects(seg1, seg2));
+}
+
+TEST(GeomUtilTest, test_collinear_overlapping_segs_cross)
+{
+    Segment seg1(Point(0, 0), Point(2, 2));
+    Segment seg2(Point(1, 1), Point(3, 3));
+
+    EXPECT_TRUE(intersects(seg1, seg2));
+}
+
 TEST(GeomUtilTest, test_vector_crosses_seg)
 {
     dbgout << "========= Enter vector_crosses_seg Test ========" << std::endl;
@@ -271,3 +271,32 @@ TEST(GrSimBackendTest, create_grsim_packet_with_dribbler_on)
         google::protobuf::util::MessageDifferencer::Equals(result, expected);
     EXPECT_TRUE(messages_equal);
 }
+
+TEST(GrSimBackendTest, create_grsim_packet_with_primitives_batches_every_robot)
+{
+    GrSimBackend backend = GrSimBackend("127.0.0.1", 20011);
+    Team friendly_team   = Team(Duration::fromSeconds(1));
+    friendly_team.updateRobots(
+        {Robot(0, Point(0, 0), Vector(), Angle::zero(), AngularVelocity::zero(),
+               Timestamp::fromSeconds(0)),
+         Robot(3, Point(1, 1), Vector(), Angle::zero(), AngularVelocity::zero(),
+               Timestamp::fromSeconds(0))});
+    Ball ball = Ball(Point(), Vector(), Timestamp::fromSeconds(0));
+
+    // Robot 5 is not on the friendly team, so it does not get a command
+    std::vector<PrimitiveVariant> primitives = {
+        MovePrimitive(0, Point(1, 0), Angle::zero(), 0),
+        MovePrimitive(3, Point(1, 2), Angle::zero(), 0),
+        MovePrimitive(5, Point(-1, 0), Angle::zero(), 0)};
+
+    grSim_Packet result = backend.createGrSimPacketWithPrimitives(
+        primitives, friendly_team, ball, Duration::fromMilliseconds(5));
+
+    EXPECT_TRUE(result.commands().isteamyellow());
+    ASSERT_EQ(2, result.commands().robot_commands_size());
+    EXPECT_EQ(0, result.commands().robot_commands(0).id());
+    EXPECT_EQ(3, result.commands().robot_commands(1).id());
+    // Both robots start accelerating towards their destinations
+    EXPECT_GT(result.commands().robot_commands(0).veltangent(), 0);
+    EXPECT_GT(result.commands().robot_commands(1).velnormal(), 0);
+}
@@ -0,0 +1,150 @@
+#include "grsim_communication/grsim_command_sender.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+#include "ai/primitive/move_primitive.h"
+#include "ai/primitive/stop_primitive.h"
+
+class GrSimCommandSenderTest : public ::testing::Test
+{
+   protected:
+    // Waits until the sender has sent the given number of packets, or a few seconds
+    // have passed
+    void waitForPackets(const GrSimCommandSender& sender, unsigned long num_packets)
+    {
+        auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (sender.getStatistics().num_packets_sent < num_packets &&
+               std::chrono::steady_clock::now() < timeout)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+};
+
+TEST_F(GrSimCommandSenderTest, throws_with_non_positive_period)
+{
+    auto send_function = [](const std::vector<PrimitiveVariant>&, const World&,
+                            const Duration&) {};
+    EXPECT_THROW(GrSimCommandSender(Duration::fromMilliseconds(0), send_function),
+                 std::invalid_argument);
+    EXPECT_THROW(GrSimCommandSender(Duration::fromMilliseconds(-1), send_function),
+                 std::invalid_argument);
+}
+
+TEST_F(GrSimCommandSenderTest, nothing_is_sent_without_primitives)
+{
+    std::atomic<int> num_calls(0);
+    GrSimCommandSender sender(
+        Duration::fromMilliseconds(1),
+        [&num_calls](const std::vector<PrimitiveVariant>&, const World&,
+                     const Duration&) { num_calls++; });
+    sender.updateWorld(World());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(0, num_calls);
+    EXPECT_EQ(0, sender.getStatistics().num_packets_sent);
+}
+
+TEST_F(GrSimCommandSenderTest, latest_primitives_are_sent_every_cycle)
+{
+    std::mutex sent_mutex;
+    std::vector<unsigned int> sent_robot_ids;
+    GrSimCommandSender sender(
+        Duration::fromMilliseconds(2),
+        [&](const std::vector<PrimitiveVariant>& primitives, const World&,
+            const Duration&) {
+            std::lock_guard<std::mutex> sent_lock(sent_mutex);
+            sent_robot_ids.emplace_back(getPrimitive(primitives.at(0)).getRobotId());
+        });
+
+    sender.updatePrimitives({StopPrimitive(1, false)});
+    waitForPackets(sender, 5);
+    sender.updatePrimitives({MovePrimitive(2, Point(), Angle::zero(), 0)});
+    unsigned long num_packets_with_first_primitives =
+        sender.getStatistics().num_packets_sent;
+    waitForPackets(sender, num_packets_with_first_primitives + 5);
+
+    std::lock_guard<std::mutex> sent_lock(sent_mutex);
+    // The first Primitives are sent again on every cycle until they are replaced
+    ASSERT_GE(sent_robot_ids.size(), 10);
+    EXPECT_EQ(1, sent_robot_ids.front());
+    EXPECT_EQ(1, sent_robot_ids.at(4));
+    EXPECT_EQ(2, sent_robot_ids.back());
+}
+
+TEST_F(GrSimCommandSenderTest, sent_callback_is_called_once_after_primitives_are_sent)
+{
+    std::atomic<int> num_packets_sent(0);
+    std::atomic<int> num_packets_sent_before_callback(-1);
+    std::atomic<int> num_callback_calls(0);
+    GrSimCommandSender sender(
+        Duration::fromMilliseconds(2),
+        [&num_packets_sent](const std::vector<PrimitiveVariant>&, const World&,
+                            const Duration&) { num_packets_sent++; });
+
+    sender.updatePrimitives({StopPrimitive(1, false)}, [&]() {
+        num_packets_sent_before_callback = num_packets_sent.load();
+        num_callback_calls++;
+    });
+    waitForPackets(sender, 5);
+
+    // The callback runs after the first packet is sent, and not again when the same
+    // Primitives are resent
+    EXPECT_EQ(1, num_callback_calls);
+    EXPECT_EQ(1, num_packets_sent_before_callback);
+}
+
+TEST_F(GrSimCommandSenderTest, packets_are_sent_at_the_fixed_rate)
+{
+    std::mutex sent_mutex;
+    std::vector<Duration> delta_times;
+    GrSimCommandSender sender(Duration::fromMilliseconds(5),
+                              [&](const std::vector<PrimitiveVariant>&, const World&,
+                                  const Duration& delta_time) {
+                                  std::lock_guard<std::mutex> sent_lock(sent_mutex);
+                                  delta_times.emplace_back(delta_time);
+                              });
+
+    // The rate does not depend on how often the Primitives are updated
+    sender.updatePrimitives({StopPrimitive(1, false)});
+    waitForPackets(sender, 40);
+
+    GrSimCommandSender::Statistics statistics = sender.getStatistics();
+    EXPECT_GE(statistics.num_packets_sent, 40);
+    // Allow plenty of slack, since the test may not be the only thing running
+    EXPECT_NEAR(200, statistics.packets_per_second, 40);
+    EXPECT_EQ(statistics.num_packets_sent, statistics.jitter.getNumberOfSamples());
+
+    std::lock_guard<std::mutex> sent_lock(sent_mutex);
+    // The first cycle has no previous cycle, so it is given the send period
+    EXPECT_EQ(Duration::fromMilliseconds(5), delta_times.front());
+    for (const Duration& delta_time : delta_times)
+    {
+        EXPECT_GT(delta_time.getMilliseconds(), 0);
+    }
+}
+
+TEST_F(GrSimCommandSenderTest, slow_cycles_are_skipped_rather_than_sent_in_a_burst)
+{
+    std::atomic<int> num_calls(0);
+    GrSimCommandSender sender(
+        Duration::fromMilliseconds(2), [&num_calls](const std::vector<PrimitiveVariant>&,
+                                                    const World&, const Duration&) {
+            // The first cycle takes as long as several periods
+            if (num_calls++ == 0)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            }
+        });
+
+    sender.updatePrimitives({StopPrimitive(1, false)});
+    waitForPackets(sender, 3);
+
+    GrSimCommandSender::Statistics statistics = sender.getStatistics();
+    EXPECT_GE(statistics.num_missed_cycles, 5);
+    // The cycle after the slow one starts late, but the ones after it are on time
+    EXPECT_GE(statistics.jitter.getMaximum().getMilliseconds(), 10);
+}
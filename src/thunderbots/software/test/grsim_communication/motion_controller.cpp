@@ -116,11 +116,25 @@ TEST_F(MotionControllerTest, over_speed_test)
     MotionController::Velocity robot_velocities =
         motionController.bangBangVelocityController(robot, delta_time, motion_command);
 
-    double expected_speed = ROBOT_MAX_SPEED_METERS_PER_SECOND;
+    double max_speed = ROBOT_MAX_SPEED_METERS_PER_SECOND;
 
     Angle expected_angular_velocity = Angle::ofRadians(0);
 
-    EXPECT_DOUBLE_EQ(expected_speed, robot_velocities.linear_velocity.len());
+    // The robot is facing along the x axis, so its robot coordinates are the same as
+    // the field coordinates
+    Vector direction_to_destination = (destination - robot.position()).norm();
+    double initial_sideways_speed =
+        std::abs(robot.velocity().dot(direction_to_destination.perp()));
+    double speed_towards_destination =
+        robot_velocities.linear_velocity.dot(direction_to_destination);
+    double sideways_speed =
+        std::abs(robot_velocities.linear_velocity.dot(direction_to_destination.perp()));
+
+    EXPECT_LE(robot_velocities.linear_velocity.len(), max_speed);
+    // The destination is far enough away that the robot is still heading towards it
+    // faster than the speed it should arrive at, while slowing its sideways motion
+    EXPECT_GE(speed_towards_destination, destination_speed);
+    EXPECT_LT(sideways_speed, initial_sideways_speed);
     EXPECT_EQ(expected_angular_velocity, robot_velocities.angular_velocity);
 }
 
@@ -141,19 +155,35 @@ TEST_F(MotionControllerTest, no_overspeed_acceleration_test)
     MotionController::Velocity robot_velocities =
         motionController.bangBangVelocityController(robot, delta_time, motion_command);
 
-    double expected_speed = ROBOT_MAX_SPEED_METERS_PER_SECOND;
+    double max_speed = ROBOT_MAX_SPEED_METERS_PER_SECOND;
 
     Angle expected_angular_velocity = Angle::ofRadians(0);
 
-    EXPECT_DOUBLE_EQ(expected_speed, robot_velocities.linear_velocity.len());
+    // The robot is facing along the x axis, so its robot coordinates are the same as
+    // the field coordinates
+    Vector direction_to_destination = (destination - robot.position()).norm();
+    double initial_sideways_speed =
+        std::abs(robot.velocity().dot(direction_to_destination.perp()));
+    double speed_towards_destination =
+        robot_velocities.linear_velocity.dot(direction_to_destination);
+    double sideways_speed =
+        std::abs(robot_velocities.linear_velocity.dot(direction_to_destination.perp()));
+
+    EXPECT_LE(robot_velocities.linear_velocity.len(), max_speed);
+    // The destination is far enough away that the robot is still heading towards it
+    // faster than the speed it should arrive at, while slowing its sideways motion
+    EXPECT_GE(speed_towards_destination, destination_speed);
+    EXPECT_LT(sideways_speed, initial_sideways_speed);
     EXPECT_EQ(expected_angular_velocity, robot_velocities.angular_velocity);
 }
 
 TEST_F(MotionControllerTest, no_overspeed_ang_acceleration_test)
 {
-    Robot robot              = Robot(4, Point(-1, -1), Vector(0, 0), Angle::ofRadians(0),
+    Robot robot = Robot(4, Point(-1, -1), Vector(0, 0), Angle::ofRadians(0),
                         AngularVelocity::ofRadians(-3.9), current_time);
-    double delta_time        = 1;
+    // The robot reaches its orientation in less than a second, so we use a short time
+    // step to check the speed while the robot is still turning
+    double delta_time        = 0.1;
     Point destination        = Point(-1, -1);
     Angle destination_angle  = Angle::ofDegrees(210);
     double destination_speed = 0;
@@ -172,10 +202,17 @@ TEST_F(MotionControllerTest, no_overspeed_ang_acceleration_test)
 
     double expected_speed = 0;
 
-    Angle expected_angular_speed = Angle::ofRadians(-4);
+    double max_angular_speed = 4;
+
+    // The shortest way to the destination orientation is clockwise, the way the robot
+    // is already turning. Speeding up for the whole time step would go past the
+    // maximum angular speed, so the robot turns at exactly the maximum instead
+    Angle expected_angular_velocity = Angle::ofRadians(-max_angular_speed);
 
     EXPECT_DOUBLE_EQ(expected_speed, robot_velocities.linear_velocity.len());
-    EXPECT_EQ(expected_angular_speed, robot_velocities.angular_velocity);
+    EXPECT_LE(robot_velocities.angular_velocity.abs().toRadians(), max_angular_speed);
+    EXPECT_NEAR(expected_angular_velocity.toRadians(),
+                robot_velocities.angular_velocity.toRadians(), 1e-9);
 }
 
 TEST_F(MotionControllerTest, negative_time_test)
@@ -0,0 +1,110 @@
+#include "network_input/backend.h"
+
+#include <gtest/gtest.h>
+
+#include <iostream>
+
+#include "proto/messages_robocup_ssl_geometry.pb.h"
+
+class BackendFieldTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        // Geometry for a Division B field, in millimeters
+        SSL_GeometryFieldSize* field = geometry_packet.mutable_field();
+        field->set_field_length(9000);
+        field->set_field_width(6000);
+        field->set_goalwidth(1000);
+        field->set_goal_depth(180);
+        field->set_boundary_width(300);
+
+        SSL_FieldLineSegment* left_field_left_penalty_stretch = field->add_field_lines();
+        left_field_left_penalty_stretch->set_name("LeftFieldLeftPenaltyStretch");
+        left_field_left_penalty_stretch->mutable_p1()->set_x(-4500);
+        left_field_left_penalty_stretch->mutable_p1()->set_y(-1000);
+        left_field_left_penalty_stretch->mutable_p2()->set_x(-3500);
+        left_field_left_penalty_stretch->mutable_p2()->set_y(-1000);
+        left_field_left_penalty_stretch->set_thickness(10);
+
+        SSL_FieldLineSegment* left_penalty_stretch = field->add_field_lines();
+        left_penalty_stretch->set_name("LeftPenaltyStretch");
+        left_penalty_stretch->mutable_p1()->set_x(-3500);
+        left_penalty_stretch->mutable_p1()->set_y(-1000);
+        left_penalty_stretch->mutable_p2()->set_x(-3500);
+        left_penalty_stretch->mutable_p2()->set_y(1000);
+        left_penalty_stretch->set_thickness(10);
+
+        SSL_FieldCicularArc* center_circle = field->add_field_arcs();
+        center_circle->set_name("CenterCircle");
+        center_circle->mutable_center()->set_x(0);
+        center_circle->mutable_center()->set_y(0);
+        center_circle->set_radius(500);
+        center_circle->set_a1(0);
+        center_circle->set_a2(6.28);
+        center_circle->set_thickness(10);
+    }
+
+    Backend backend;
+    SSL_GeometryData geometry_packet;
+};
+
+TEST_F(BackendFieldTest, first_geometry_creates_field)
+{
+    std::optional<Field> field = backend.getFieldData(geometry_packet);
+
+    ASSERT_TRUE(field);
+    EXPECT_DOUBLE_EQ(field->length(), 9.0);
+    EXPECT_DOUBLE_EQ(field->width(), 6.0);
+    EXPECT_DOUBLE_EQ(field->defenseAreaLength(), 1.0);
+    EXPECT_DOUBLE_EQ(field->defenseAreaWidth(), 2.0);
+    EXPECT_DOUBLE_EQ(field->goalWidth(), 1.0);
+    EXPECT_DOUBLE_EQ(field->boundaryWidth(), 0.3);
+    EXPECT_DOUBLE_EQ(field->centreCircleRadius(), 0.5);
+    EXPECT_EQ(backend.getField(), *field);
+}
+
+TEST_F(BackendFieldTest, repeated_geometry_does_not_change_field)
+{
+    ASSERT_TRUE(backend.getFieldData(geometry_packet));
+    Field field = backend.getField();
+
+    EXPECT_FALSE(backend.getFieldData(geometry_packet));
+    EXPECT_EQ(backend.getField(), field);
+}
+
+TEST_F(BackendFieldTest, changed_geometry_changes_field)
+{
+    ASSERT_TRUE(backend.getFieldData(geometry_packet));
+
+    geometry_packet.mutable_field()->set_field_length(12000);
+    std::optional<Field> field = backend.getFieldData(geometry_packet);
+
+    ASSERT_TRUE(field);
+    EXPECT_DOUBLE_EQ(field->length(), 12.0);
+    EXPECT_EQ(backend.getField(), *field);
+}
+
+TEST_F(BackendFieldTest, changed_field_line_changes_field)
+{
+    ASSERT_TRUE(backend.getFieldData(geometry_packet));
+
+    geometry_packet.mutable_field()->mutable_field_lines(1)->mutable_p2()->set_y(1200);
+    std::optional<Field> field = backend.getFieldData(geometry_packet);
+
+    ASSERT_TRUE(field);
+    EXPECT_DOUBLE_EQ(field->defenseAreaWidth(), 2.2);
+}
+
+TEST_F(BackendFieldTest, geometry_packet_without_field_does_not_change_field)
+{
+    SSL_GeometryData empty_geometry_packet;
+    EXPECT_FALSE(backend.getFieldData(empty_geometry_packet));
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << argv[0] << std::endl;
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,165 @@
+#include "network_input/networking/packet_log.h"
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+class PacketLogTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        char path_template[] = "/tmp/packet_log_test_XXXXXX";
+        int file_descriptor  = mkstemp(path_template);
+        close(file_descriptor);
+        log_file_path = path_template;
+        // Start with no file, so the writer has to create it
+        std::remove(log_file_path.c_str());
+    }
+
+    void TearDown() override
+    {
+        std::remove(log_file_path.c_str());
+    }
+
+    std::string log_file_path;
+};
+
+TEST_F(PacketLogTest, read_packets_in_order_they_were_written)
+{
+    std::string vision_data         = "vision packet";
+    std::string gamecontroller_data = "gamecontroller packet";
+    {
+        PacketLogWriter writer(log_file_path);
+        writer.writePacket(SSLPacketType::VISION, vision_data.data(), vision_data.size(),
+                           1.5);
+        writer.writePacket(SSLPacketType::GAMECONTROLLER, gamecontroller_data.data(),
+                           gamecontroller_data.size(), 2.25);
+    }
+
+    PacketLogReader reader(log_file_path);
+
+    auto first_packet = reader.getNextPacket();
+    ASSERT_TRUE(first_packet);
+    EXPECT_EQ(first_packet->packet_type, SSLPacketType::VISION);
+    EXPECT_DOUBLE_EQ(first_packet->receive_timestamp, 1.5);
+    EXPECT_EQ(std::string(first_packet->packet_data, first_packet->packet_length),
+              vision_data);
+
+    auto second_packet = reader.getNextPacket();
+    ASSERT_TRUE(second_packet);
+    EXPECT_EQ(second_packet->packet_type, SSLPacketType::GAMECONTROLLER);
+    EXPECT_DOUBLE_EQ(second_packet->receive_timestamp, 2.25);
+    EXPECT_EQ(std::string(second_packet->packet_data, second_packet->packet_length),
+              gamecontroller_data);
+
+    EXPECT_FALSE(reader.getNextPacket());
+}
+
+TEST_F(PacketLogTest, writer_appends_to_existing_log)
+{
+    std::string data = "packet";
+    {
+        PacketLogWriter writer(log_file_path);
+        writer.writePacket(SSLPacketType::VISION, data.data(), data.size(), 1.0);
+    }
+    {
+        PacketLogWriter writer(log_file_path);
+        writer.writePacket(SSLPacketType::VISION, data.data(), data.size(), 2.0);
+    }
+
+    PacketLogReader reader(log_file_path);
+    EXPECT_DOUBLE_EQ(reader.getNextPacket()->receive_timestamp, 1.0);
+    EXPECT_DOUBLE_EQ(reader.getNextPacket()->receive_timestamp, 2.0);
+    EXPECT_FALSE(reader.getNextPacket());
+}
+
+TEST_F(PacketLogTest, rewind_returns_to_first_packet)
+{
+    std::string data = "packet";
+    {
+        PacketLogWriter writer(log_file_path);
+        writer.writePacket(SSLPacketType::VISION, data.data(), data.size(), 1.0);
+    }
+
+    PacketLogReader reader(log_file_path);
+    EXPECT_TRUE(reader.getNextPacket());
+    EXPECT_FALSE(reader.getNextPacket());
+
+    reader.rewind();
+    EXPECT_TRUE(reader.getNextPacket());
+}
+
+TEST_F(PacketLogTest, incomplete_last_record_is_ignored)
+{
+    std::string data = "a complete packet";
+    {
+        PacketLogWriter writer(log_file_path);
+        writer.writePacket(SSLPacketType::VISION, data.data(), data.size(), 1.0);
+        writer.writePacket(SSLPacketType::VISION, data.data(), data.size(), 2.0);
+    }
+    // Cut off the end of the last packet, as if the recording process had crashed
+    std::ifstream log_file(log_file_path, std::ios::binary | std::ios::ate);
+    auto log_length = static_cast<off_t>(log_file.tellg());
+    log_file.close();
+    ASSERT_EQ(truncate(log_file_path.c_str(), log_length - 3), 0);
+
+    PacketLogReader reader(log_file_path);
+    EXPECT_DOUBLE_EQ(reader.getNextPacket()->receive_timestamp, 1.0);
+    EXPECT_FALSE(reader.getNextPacket());
+}
+
+TEST_F(PacketLogTest, writer_discards_incomplete_last_record_before_appending)
+{
+    std::string data = "a complete packet";
+    {
+        PacketLogWriter writer(log_file_path);
+        writer.writePacket(SSLPacketType::VISION, data.data(), data.size(), 1.0);
+        writer.writePacket(SSLPacketType::VISION, data.data(), data.size(), 2.0);
+    }
+    // Cut off the end of the last packet, as if the recording process had crashed
+    std::ifstream log_file(log_file_path, std::ios::binary | std::ios::ate);
+    auto log_length = static_cast<off_t>(log_file.tellg());
+    log_file.close();
+    ASSERT_EQ(truncate(log_file_path.c_str(), log_length - 3), 0);
+
+    {
+        PacketLogWriter writer(log_file_path);
+        writer.writePacket(SSLPacketType::VISION, data.data(), data.size(), 3.0);
+    }
+
+    // The packet written after reopening the log follows the last complete packet
+    PacketLogReader reader(log_file_path);
+    EXPECT_DOUBLE_EQ(reader.getNextPacket()->receive_timestamp, 1.0);
+    auto appended_packet = reader.getNextPacket();
+    ASSERT_TRUE(appended_packet);
+    EXPECT_DOUBLE_EQ(appended_packet->receive_timestamp, 3.0);
+    EXPECT_EQ(std::string(appended_packet->packet_data, appended_packet->packet_length),
+              data);
+    EXPECT_FALSE(reader.getNextPacket());
+}
+
+TEST_F(PacketLogTest, reading_file_that_is_not_a_packet_log_throws_exception)
+{
+    std::ofstream(log_file_path) << "this is not a packet log";
+
+    EXPECT_THROW(PacketLogReader reader(log_file_path), std::runtime_error);
+    EXPECT_THROW(PacketLogWriter writer(log_file_path), std::runtime_error);
+}
+
+TEST_F(PacketLogTest, reading_file_that_does_not_exist_throws_exception)
+{
+    EXPECT_THROW(PacketLogReader reader(log_file_path), std::runtime_error);
+}
+
+int main(int argc, char **argv)
+{
+    std::cout << argv[0] << std::endl;
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,148 @@
+#include "radio_communication/mrf/drive_packet_pipeline.h"
+
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <vector>
+
+class DrivePacketPipelineTest : public ::testing::Test
+{
+   protected:
+    DrivePacketPipelineTest()
+        : pipeline([this](const uint8_t *packet, std::size_t length) {
+              submitted_packets.emplace_back(packet, packet + length);
+          })
+    {
+    }
+
+    // Encodes a packet made of the given bytes
+    void encodePacket(const std::vector<uint8_t> &packet)
+    {
+        uint8_t *buffer = pipeline.get_encode_buffer();
+        for (std::size_t i = 0; i < packet.size(); i++)
+        {
+            buffer[i] = packet[i];
+        }
+        pipeline.finish_encoding(packet.size());
+    }
+
+    std::vector<std::vector<uint8_t>> submitted_packets;
+    DrivePacketPipeline pipeline;
+};
+
+TEST_F(DrivePacketPipelineTest, packet_is_submitted_right_away_when_idle)
+{
+    encodePacket({1, 2, 3});
+
+    ASSERT_EQ(1, submitted_packets.size());
+    EXPECT_EQ(std::vector<uint8_t>({1, 2, 3}), submitted_packets.at(0));
+    EXPECT_TRUE(pipeline.is_transfer_in_flight());
+    EXPECT_FALSE(pipeline.has_pending_packet());
+
+    const DrivePacketPipeline::Statistics &statistics = pipeline.get_statistics();
+    EXPECT_EQ(1, statistics.num_packets_encoded);
+    EXPECT_EQ(1, statistics.num_packets_submitted);
+    EXPECT_EQ(0, statistics.num_packets_completed);
+    EXPECT_EQ(1, statistics.encode_to_submit.getNumberOfSamples());
+}
+
+TEST_F(DrivePacketPipelineTest, packet_waits_for_the_transfer_in_flight)
+{
+    encodePacket({1});
+    encodePacket({2});
+
+    ASSERT_EQ(1, submitted_packets.size());
+    EXPECT_TRUE(pipeline.has_pending_packet());
+
+    pipeline.handle_transfer_done();
+
+    ASSERT_EQ(2, submitted_packets.size());
+    EXPECT_EQ(std::vector<uint8_t>({2}), submitted_packets.at(1));
+    EXPECT_TRUE(pipeline.is_transfer_in_flight());
+    EXPECT_FALSE(pipeline.has_pending_packet());
+}
+
+TEST_F(DrivePacketPipelineTest, newest_pending_packet_wins)
+{
+    encodePacket({1});
+    encodePacket({2});
+    encodePacket({3, 4});
+    encodePacket({5, 6, 7});
+
+    pipeline.handle_transfer_done();
+
+    // The packets encoded while the first was in flight replaced each other, so only
+    // the newest one is sent
+    ASSERT_EQ(2, submitted_packets.size());
+    EXPECT_EQ(std::vector<uint8_t>({1}), submitted_packets.at(0));
+    EXPECT_EQ(std::vector<uint8_t>({5, 6, 7}), submitted_packets.at(1));
+
+    const DrivePacketPipeline::Statistics &statistics = pipeline.get_statistics();
+    EXPECT_EQ(4, statistics.num_packets_encoded);
+    EXPECT_EQ(2, statistics.num_packets_submitted);
+    EXPECT_EQ(2, statistics.num_packets_superseded);
+    EXPECT_EQ(1, statistics.num_packets_completed);
+}
+
+TEST_F(DrivePacketPipelineTest, completing_with_nothing_pending_leaves_pipeline_idle)
+{
+    encodePacket({1});
+    pipeline.handle_transfer_done();
+
+    EXPECT_FALSE(pipeline.is_transfer_in_flight());
+    EXPECT_EQ(1, submitted_packets.size());
+
+    // Completing again without a transfer in flight is ignored
+    pipeline.handle_transfer_done();
+
+    const DrivePacketPipeline::Statistics &statistics = pipeline.get_statistics();
+    EXPECT_EQ(1, statistics.num_packets_completed);
+    EXPECT_EQ(1, statistics.submit_to_complete.getNumberOfSamples());
+
+    encodePacket({2});
+    ASSERT_EQ(2, submitted_packets.size());
+    EXPECT_EQ(std::vector<uint8_t>({2}), submitted_packets.at(1));
+}
+
+TEST_F(DrivePacketPipelineTest, encode_buffer_is_never_the_pending_packet)
+{
+    encodePacket({1});
+    encodePacket({2});
+
+    // Starting to encode a newer packet must not change the one waiting to be sent
+    pipeline.get_encode_buffer()[0] = 9;
+    pipeline.handle_transfer_done();
+
+    ASSERT_EQ(2, submitted_packets.size());
+    EXPECT_EQ(std::vector<uint8_t>({2}), submitted_packets.at(1));
+}
+
+TEST_F(DrivePacketPipelineTest, failed_submission_keeps_the_packet_pending)
+{
+    bool should_fail = true;
+    DrivePacketPipeline failing_pipeline([&should_fail](const uint8_t *, std::size_t) {
+        if (should_fail)
+        {
+            throw std::runtime_error("submit failed");
+        }
+    });
+
+    EXPECT_THROW(failing_pipeline.finish_encoding(1), std::runtime_error);
+    EXPECT_FALSE(failing_pipeline.is_transfer_in_flight());
+    EXPECT_TRUE(failing_pipeline.has_pending_packet());
+
+    should_fail = false;
+    EXPECT_THROW(failing_pipeline.finish_encoding(
+                     DrivePacketPipeline::MAX_DRIVE_PACKET_LENGTH + 1),
+                 std::invalid_argument);
+    failing_pipeline.finish_encoding(2);
+    EXPECT_TRUE(failing_pipeline.is_transfer_in_flight());
+    EXPECT_EQ(1, failing_pipeline.get_statistics().num_packets_superseded);
+}
+
+int main(int argc, char **argv)
+{
+    std::cout << argv[0] << std::endl;
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,209 @@
+#include "scenario_runner/scenario_report.h"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+class ScenarioReportTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        results = {createResult("kickoff_0", 1, 0, 6, 4, 4, 2),
+                   createResult("kickoff_1", 0, 1, 5, 5, 2, 1),
+                   createResult("defend_shot_0", 0, 0, 2, 3, 0, 0)};
+    }
+
+    static ScenarioResult createResult(const std::string& name, unsigned int goals_for,
+                                       unsigned int goals_against,
+                                       double friendly_possession_seconds,
+                                       double enemy_possession_seconds,
+                                       unsigned int passes_attempted,
+                                       unsigned int passes_completed)
+    {
+        ScenarioResult result;
+        result.scenario_name = name;
+        result.goals_for     = goals_for;
+        result.goals_against = goals_against;
+        result.friendly_possession_time =
+            Duration::fromSeconds(friendly_possession_seconds);
+        result.enemy_possession_time = Duration::fromSeconds(enemy_possession_seconds);
+        result.passes_attempted      = passes_attempted;
+        result.passes_completed      = passes_completed;
+        for (int i = 0; i < 100; i++)
+        {
+            result.ai_tick_latency.record(Duration::fromMilliseconds(2));
+        }
+        return result;
+    }
+
+    // Saves the report as a baseline and reads it back
+    static ScenarioReport saveAndLoad(const ScenarioReport& report,
+                                      bool include_latency = false)
+    {
+        std::stringstream baseline;
+        report.writeBaseline(baseline, include_latency);
+        return ScenarioReport::readBaseline(baseline);
+    }
+
+    std::vector<ScenarioResult> results;
+};
+
+TEST_F(ScenarioReportTest, test_no_regressions_against_own_baseline)
+{
+    ScenarioReport report(results);
+
+    EXPECT_TRUE(report.findRegressions(saveAndLoad(report)).empty());
+    EXPECT_TRUE(report.findRegressions(saveAndLoad(report, true)).empty());
+}
+
+TEST_F(ScenarioReportTest, test_fewer_goals_scored_is_a_regression)
+{
+    ScenarioReport baseline = saveAndLoad(ScenarioReport(results));
+    results[0].goals_for    = 0;
+
+    std::vector<std::string> regressions =
+        ScenarioReport(results).findRegressions(baseline);
+
+    ASSERT_EQ(1, regressions.size());
+    EXPECT_NE(std::string::npos, regressions[0].find("kickoff_0"));
+}
+
+TEST_F(ScenarioReportTest, test_more_goals_conceded_is_a_regression)
+{
+    ScenarioReport baseline  = saveAndLoad(ScenarioReport(results));
+    results[2].goals_against = 1;
+
+    std::vector<std::string> regressions =
+        ScenarioReport(results).findRegressions(baseline);
+
+    ASSERT_EQ(1, regressions.size());
+    EXPECT_NE(std::string::npos, regressions[0].find("defend_shot_0"));
+}
+
+TEST_F(ScenarioReportTest, test_better_outcomes_are_not_regressions)
+{
+    ScenarioReport baseline     = saveAndLoad(ScenarioReport(results));
+    results[1].goals_for        = 2;
+    results[1].goals_against    = 0;
+    results[1].passes_completed = 2;
+
+    EXPECT_TRUE(ScenarioReport(results).findRegressions(baseline).empty());
+}
+
+TEST_F(ScenarioReportTest, test_possession_drop_beyond_tolerance_is_a_regression)
+{
+    ScenarioReport baseline = saveAndLoad(ScenarioReport(results));
+    // Possession drops from 13/25 to 12/25, which is within the tolerance
+    results[0].friendly_possession_time = Duration::fromSeconds(5);
+    results[0].enemy_possession_time    = Duration::fromSeconds(5);
+    EXPECT_TRUE(ScenarioReport(results).findRegressions(baseline).empty());
+
+    // Possession drops from 13/25 to 9/25, which is not
+    results[0].friendly_possession_time = Duration::fromSeconds(2);
+    results[0].enemy_possession_time    = Duration::fromSeconds(8);
+    std::vector<std::string> regressions =
+        ScenarioReport(results).findRegressions(baseline);
+    ASSERT_EQ(1, regressions.size());
+    EXPECT_NE(std::string::npos, regressions[0].find("Possession"));
+}
+
+TEST_F(ScenarioReportTest, test_pass_completion_drop_is_a_regression)
+{
+    ScenarioReport baseline     = saveAndLoad(ScenarioReport(results));
+    results[0].passes_completed = 0;
+
+    std::vector<std::string> regressions =
+        ScenarioReport(results).findRegressions(baseline);
+
+    ASSERT_EQ(1, regressions.size());
+    EXPECT_NE(std::string::npos, regressions[0].find("Pass completion"));
+}
+
+TEST_F(ScenarioReportTest, test_slower_ai_ticks_are_a_regression)
+{
+    ScenarioReport baseline = saveAndLoad(ScenarioReport(results), true);
+    for (int i = 0; i < 10; i++)
+    {
+        results[0].ai_tick_latency.record(Duration::fromMilliseconds(20));
+    }
+
+    std::vector<std::string> regressions =
+        ScenarioReport(results).findRegressions(baseline);
+
+    // The 99th percentile is much slower, but the median and 90th percentile are not
+    ASSERT_EQ(1, regressions.size());
+    EXPECT_NE(std::string::npos, regressions[0].find("p99"));
+}
+
+TEST_F(ScenarioReportTest, test_small_latency_changes_are_not_regressions)
+{
+    ScenarioReport baseline = saveAndLoad(ScenarioReport(results), true);
+    for (ScenarioResult& result : results)
+    {
+        result.ai_tick_latency.reset();
+        for (int i = 0; i < 100; i++)
+        {
+            result.ai_tick_latency.record(Duration::fromMilliseconds(2.4));
+        }
+    }
+
+    EXPECT_TRUE(ScenarioReport(results).findRegressions(baseline).empty());
+}
+
+TEST_F(ScenarioReportTest, test_latency_is_not_compared_without_latency_baseline)
+{
+    std::stringstream baseline;
+    ScenarioReport(results).writeBaseline(baseline);
+    EXPECT_EQ(std::string::npos, baseline.str().find("ai_tick_latency_ms"));
+
+    ScenarioReport outcomes_baseline = ScenarioReport::readBaseline(baseline);
+    for (int i = 0; i < 10; i++)
+    {
+        results[0].ai_tick_latency.record(Duration::fromMilliseconds(20));
+    }
+
+    EXPECT_TRUE(ScenarioReport(results).findRegressions(outcomes_baseline).empty());
+}
+
+TEST_F(ScenarioReportTest, test_failed_and_missing_scenarios_are_regressions)
+{
+    ScenarioReport baseline = saveAndLoad(ScenarioReport(results));
+    results[0].error        = "no applicable plays";
+    results.pop_back();
+
+    std::vector<std::string> regressions =
+        ScenarioReport(results).findRegressions(baseline);
+
+    ASSERT_EQ(2, regressions.size());
+    EXPECT_NE(std::string::npos, regressions[0].find("defend_shot_0 was not run"));
+    EXPECT_NE(std::string::npos, regressions[1].find("no applicable plays"));
+}
+
+TEST_F(ScenarioReportTest, test_print_summarizes_scenario_groups)
+{
+    std::stringstream output;
+    ScenarioReport(results).print(output);
+
+    std::string summary = output.str();
+    EXPECT_NE(std::string::npos, summary.find("kickoff "));
+    EXPECT_NE(std::string::npos, summary.find("defend_shot "));
+    EXPECT_EQ(std::string::npos, summary.find("kickoff_0"));
+    EXPECT_NE(std::string::npos, summary.find("3/6"));
+}
+
+TEST_F(ScenarioReportTest, test_duplicate_scenario_names_are_rejected)
+{
+    results.emplace_back(results[0]);
+
+    EXPECT_THROW(ScenarioReport report(results), std::invalid_argument);
+}
+
+TEST_F(ScenarioReportTest, test_malformed_baseline_is_rejected)
+{
+    std::stringstream missing_fields("scenario kickoff_0 1 0 6.0");
+    std::stringstream unknown_line("goals 3");
+
+    EXPECT_THROW(ScenarioReport::readBaseline(missing_fields), std::invalid_argument);
+    EXPECT_THROW(ScenarioReport::readBaseline(unknown_line), std::invalid_argument);
+}
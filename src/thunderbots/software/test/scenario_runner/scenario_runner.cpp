@@ -0,0 +1,228 @@
+#include "scenario_runner/scenario_runner.h"
+
+#include <gtest/gtest.h>
+
+#include "ai/primitive/dribble_primitive.h"
+#include "ai/primitive/kick_primitive.h"
+#include "scenario_runner/scenarios.h"
+#include "test/test_util/test_util.h"
+
+class ScenarioRunnerTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        scenario.name             = "test_scenario";
+        scenario.world            = ::Test::TestUtil::createBlankTestingWorld();
+        scenario.referee_commands = {
+            {Duration::fromSeconds(0), RefboxGameState::FORCE_START}};
+        scenario.duration = Duration::fromSeconds(3);
+        scenario.seed     = 0;
+    }
+
+    // Adds a still robot to the given team
+    void addRobot(Team& team, unsigned int id, const Point& position,
+                  const Angle& orientation)
+    {
+        team.updateRobots({Robot(id, position, Vector(), orientation,
+                                 AngularVelocity::zero(), Timestamp::fromSeconds(0))});
+    }
+
+    // Creates an AI that gives the friendly robots the same Primitives on every tick
+    static ScenarioRunner::AIFactory createScriptedAI(
+        const std::vector<PrimitiveVariant>& primitives)
+    {
+        return [primitives](unsigned int seed) {
+            return [primitives](const World& world) { return primitives; };
+        };
+    }
+
+    Scenario scenario;
+};
+
+TEST_F(ScenarioRunnerTest, test_shot_into_enemy_goal_is_goal_for)
+{
+    addRobot(scenario.world.mutableFriendlyTeam(), 0, Point(3.5, 0), Angle::zero());
+    scenario.world.updateBallState(
+        Ball(Point(3.8, 0), Vector(), Timestamp::fromSeconds(0)));
+    ScenarioRunner runner(
+        createScriptedAI({KickPrimitive(0, Point(3.8, 0), Angle::zero(), 5)}), 1);
+
+    ScenarioResult result = runner.runScenario(scenario);
+
+    EXPECT_EQ("test_scenario", result.scenario_name);
+    EXPECT_FALSE(result.error);
+    EXPECT_EQ(1, result.goals_for);
+    EXPECT_EQ(0, result.goals_against);
+    // A shot at the goal is not a pass
+    EXPECT_EQ(0, result.passes_attempted);
+    // The Scenario ends as soon as the goal is scored
+    EXPECT_LT(result.ai_tick_latency.getNumberOfSamples(), 60);
+}
+
+TEST_F(ScenarioRunnerTest, test_enemy_shot_into_friendly_goal_is_goal_against)
+{
+    addRobot(scenario.world.mutableEnemyTeam(), 0, Point(-3.5, 0), Angle::half());
+    scenario.world.updateBallState(
+        Ball(Point(-3.8, 0), Vector(), Timestamp::fromSeconds(0)));
+    scenario.enemy_primitives = {KickPrimitive(0, Point(-3.8, 0), Angle::half(), 5)};
+    ScenarioRunner runner(createScriptedAI({}), 1);
+
+    ScenarioResult result = runner.runScenario(scenario);
+
+    EXPECT_EQ(0, result.goals_for);
+    EXPECT_EQ(1, result.goals_against);
+    EXPECT_GT(result.enemy_possession_time, Duration::fromSeconds(0));
+    EXPECT_EQ(Duration::fromSeconds(0), result.friendly_possession_time);
+}
+
+TEST_F(ScenarioRunnerTest, test_pass_to_teammate_is_completed)
+{
+    addRobot(scenario.world.mutableFriendlyTeam(), 0, Point(0, -0.5), Angle::quarter());
+    addRobot(scenario.world.mutableFriendlyTeam(), 1, Point(0, 1.5), -Angle::quarter());
+    // The receiver holds on to the ball with its dribbler
+    ScenarioRunner runner(
+        createScriptedAI(
+            {KickPrimitive(0, Point(0, 0), Angle::quarter(), 3),
+             DribblePrimitive(1, Point(0, 1.5), -Angle::quarter(), 0, 10000, false)}),
+        1);
+
+    ScenarioResult result = runner.runScenario(scenario);
+
+    EXPECT_EQ(1, result.passes_attempted);
+    EXPECT_EQ(1, result.passes_completed);
+    EXPECT_GT(result.friendly_possession_time, Duration::fromSeconds(2));
+    EXPECT_EQ(Duration::fromSeconds(0), result.enemy_possession_time);
+}
+
+TEST_F(ScenarioRunnerTest, test_intercepted_pass_is_not_completed)
+{
+    addRobot(scenario.world.mutableFriendlyTeam(), 0, Point(0, -0.5), Angle::quarter());
+    addRobot(scenario.world.mutableFriendlyTeam(), 1, Point(0, 1.5), -Angle::quarter());
+    addRobot(scenario.world.mutableEnemyTeam(), 0, Point(0, 0.7), -Angle::quarter());
+    ScenarioRunner runner(
+        createScriptedAI({KickPrimitive(0, Point(0, 0), Angle::quarter(), 3)}), 1);
+
+    ScenarioResult result = runner.runScenario(scenario);
+
+    // The ball may bounce back to the kicker and be kicked again, but no pass reaches
+    // the receiver
+    EXPECT_GE(result.passes_attempted, 1);
+    EXPECT_EQ(0, result.passes_completed);
+    EXPECT_GT(result.enemy_possession_time, Duration::fromSeconds(0));
+}
+
+TEST_F(ScenarioRunnerTest, test_ai_is_timed_on_every_tick)
+{
+    ScenarioRunner runner(createScriptedAI({}), 1, Duration::fromSeconds(0.1));
+
+    ScenarioResult result = runner.runScenario(scenario);
+
+    EXPECT_EQ(30, result.ai_tick_latency.getNumberOfSamples());
+    EXPECT_EQ(0, result.goals_for + result.goals_against);
+}
+
+TEST_F(ScenarioRunnerTest, test_referee_commands_are_given_at_their_times)
+{
+    scenario.referee_commands = {
+        {Duration::fromSeconds(0), RefboxGameState::PREPARE_KICKOFF_US},
+        {Duration::fromSeconds(1), RefboxGameState::NORMAL_START}};
+    auto game_states = std::make_shared<std::vector<RefboxGameState>>();
+    ScenarioRunner runner(
+        [game_states](unsigned int seed) {
+            return [game_states](const World& world) {
+                game_states->emplace_back(world.gameState().getRefboxGameState());
+                return std::vector<PrimitiveVariant>();
+            };
+        },
+        1, Duration::fromSeconds(0.5));
+
+    runner.runScenario(scenario);
+
+    EXPECT_EQ(
+        std::vector<RefboxGameState>(
+            {RefboxGameState::PREPARE_KICKOFF_US, RefboxGameState::PREPARE_KICKOFF_US,
+             RefboxGameState::NORMAL_START, RefboxGameState::NORMAL_START,
+             RefboxGameState::NORMAL_START, RefboxGameState::NORMAL_START}),
+        *game_states);
+}
+
+TEST_F(ScenarioRunnerTest, test_exception_from_ai_is_recorded_as_error)
+{
+    ScenarioRunner runner(
+        [](unsigned int seed) {
+            return [](const World& world) -> std::vector<PrimitiveVariant> {
+                throw std::runtime_error("no applicable plays");
+            };
+        },
+        1);
+
+    ScenarioResult result = runner.runScenario(scenario);
+
+    ASSERT_TRUE(result.error);
+    EXPECT_EQ("no applicable plays", *result.error);
+}
+
+TEST_F(ScenarioRunnerTest, test_results_are_the_same_on_any_number_of_threads)
+{
+    std::vector<Scenario> scenarios = Scenarios::createStandardScenarios(2);
+    // Every robot except the goalie tries to kick the ball at the enemy goal, so the
+    // Scenarios have different outcomes
+    ScenarioRunner::AIFactory ai_factory = [](unsigned int seed) {
+        return [](const World& world) {
+            Point ball_position = world.ball().position();
+            Angle shot_orientation =
+                (world.field().enemyGoal() - ball_position).orientation();
+            std::vector<PrimitiveVariant> primitives;
+            for (unsigned int id = 1; id < 6; id++)
+            {
+                primitives.emplace_back(
+                    KickPrimitive(id, ball_position, shot_orientation, 4));
+            }
+            return primitives;
+        };
+    };
+
+    std::vector<ScenarioResult> serial_results =
+        ScenarioRunner(ai_factory, 1).runScenarios(scenarios);
+    std::vector<ScenarioResult> parallel_results =
+        ScenarioRunner(ai_factory, 3).runScenarios(scenarios);
+
+    ASSERT_EQ(scenarios.size(), serial_results.size());
+    ASSERT_EQ(scenarios.size(), parallel_results.size());
+    for (size_t i = 0; i < scenarios.size(); i++)
+    {
+        EXPECT_EQ(scenarios[i].name, serial_results[i].scenario_name);
+        EXPECT_EQ(scenarios[i].name, parallel_results[i].scenario_name);
+        EXPECT_EQ(serial_results[i].goals_for, parallel_results[i].goals_for);
+        EXPECT_EQ(serial_results[i].goals_against, parallel_results[i].goals_against);
+        EXPECT_EQ(serial_results[i].friendly_possession_time,
+                  parallel_results[i].friendly_possession_time);
+        EXPECT_EQ(serial_results[i].enemy_possession_time,
+                  parallel_results[i].enemy_possession_time);
+        EXPECT_EQ(serial_results[i].passes_attempted,
+                  parallel_results[i].passes_attempted);
+        EXPECT_EQ(serial_results[i].passes_completed,
+                  parallel_results[i].passes_completed);
+    }
+}
+
+TEST_F(ScenarioRunnerTest, test_standard_scenarios_have_unique_names)
+{
+    std::vector<Scenario> scenarios = Scenarios::createStandardScenarios(3);
+
+    std::set<std::string> names;
+    for (const Scenario& scenario : scenarios)
+    {
+        names.insert(scenario.name);
+    }
+    EXPECT_EQ(12, scenarios.size());
+    EXPECT_EQ(scenarios.size(), names.size());
+}
+
+TEST_F(ScenarioRunnerTest, test_invalid_arguments_are_rejected)
+{
+    EXPECT_THROW(ScenarioRunner(createScriptedAI({}), 0), std::invalid_argument);
+    EXPECT_THROW(ScenarioRunner(createScriptedAI({}), 1, Duration::fromSeconds(0)),
+                 std::invalid_argument);
+}
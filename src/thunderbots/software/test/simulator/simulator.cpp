@@ -0,0 +1,321 @@
+#include "simulator/simulator.h"
+
+#include <gtest/gtest.h>
+
+#include "ai/primitive/chip_primitive.h"
+#include "ai/primitive/dribble_primitive.h"
+#include "ai/primitive/kick_primitive.h"
+#include "ai/primitive/move_primitive.h"
+#include "shared/constants.h"
+#include "test/test_util/test_util.h"
+
+class SimulatorTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        world = ::Test::TestUtil::createBlankTestingWorld();
+    }
+
+    // Adds a still robot to the given team
+    void addRobot(Team& team, unsigned int id, const Point& position,
+                  const Angle& orientation)
+    {
+        team.updateRobots({Robot(id, position, Vector(), orientation,
+                                 AngularVelocity::zero(), Timestamp::fromSeconds(0))});
+    }
+
+    // Where the ball is when it touches the dribbler of a robot at the given position
+    // and orientation
+    Point dribblerPosition(const Point& robot_position, const Angle& orientation)
+    {
+        return robot_position +
+               Vector::createFromAngle(orientation)
+                   .norm(DIST_TO_FRONT_OF_ROBOT_METERS + BALL_MAX_RADIUS_METERS);
+    }
+
+    World world;
+};
+
+TEST_F(SimulatorTest, test_world_is_unchanged_before_simulating)
+{
+    addRobot(world.mutableFriendlyTeam(), 0, Point(1, 2), Angle::quarter());
+    world.updateBallState(Ball(Point(-1, 0), Vector(1, 0), Timestamp::fromSeconds(0)));
+
+    Simulator simulator(world);
+
+    EXPECT_EQ(Point(1, 2),
+              simulator.getWorld().friendlyTeam().getRobotById(0)->position());
+    EXPECT_EQ(Point(-1, 0), simulator.getWorld().ball().position());
+    EXPECT_EQ(Vector(1, 0), simulator.getWorld().ball().velocity());
+    EXPECT_EQ(Timestamp::fromSeconds(0), simulator.getTimestamp());
+}
+
+TEST_F(SimulatorTest, test_simulation_time_advances)
+{
+    Simulator simulator(world);
+
+    simulator.simulate(Duration::fromSeconds(1.5));
+
+    EXPECT_NEAR(1.5, simulator.getTimestamp().getSeconds(), 1e-9);
+    EXPECT_EQ(simulator.getTimestamp(),
+              simulator.getWorld().ball().lastUpdateTimestamp());
+}
+
+TEST_F(SimulatorTest, test_ball_slows_down_with_rolling_friction)
+{
+    world.updateBallState(Ball(Point(-2, 0), Vector(2, 0), Timestamp::fromSeconds(0)));
+    Simulator simulator(world);
+
+    simulator.simulate(Duration::fromSeconds(1));
+
+    double deceleration =
+        Simulator::BALL_ROLLING_FRICTION_DECELERATION_METERS_PER_SECOND_SQUARED;
+    EXPECT_NEAR(2 - deceleration, simulator.getWorld().ball().velocity().x(), 1e-9);
+    EXPECT_NEAR(-2 + 2 - deceleration / 2, simulator.getWorld().ball().position().x(),
+                0.01);
+    EXPECT_DOUBLE_EQ(0, simulator.getWorld().ball().position().y());
+}
+
+TEST_F(SimulatorTest, test_ball_comes_to_a_stop)
+{
+    world.updateBallState(Ball(Point(-2, 0), Vector(2, 0), Timestamp::fromSeconds(0)));
+    Simulator simulator(world);
+
+    simulator.simulate(Duration::fromSeconds(6));
+
+    // The ball stops after 4 seconds, and 4 metres
+    EXPECT_EQ(Vector(0, 0), simulator.getWorld().ball().velocity());
+    EXPECT_NEAR(2, simulator.getWorld().ball().position().x(), 0.01);
+}
+
+TEST_F(SimulatorTest, test_ball_bounces_off_wall)
+{
+    world.updateBallState(Ball(Point(4, 0), Vector(3, 0), Timestamp::fromSeconds(0)));
+    Simulator simulator(world);
+
+    simulator.simulate(Duration::fromSeconds(0.5));
+
+    EXPECT_LT(simulator.getWorld().ball().velocity().x(), 0);
+    EXPECT_LE(simulator.getWorld().ball().position().x(),
+              world.field().totalLength() / 2 - BALL_MAX_RADIUS_METERS);
+}
+
+TEST_F(SimulatorTest, test_robot_without_primitive_stops)
+{
+    world.mutableFriendlyTeam().updateRobots(
+        {Robot(0, Point(0, 0), Vector(1, 1), Angle::zero(), AngularVelocity::zero(),
+               Timestamp::fromSeconds(0))});
+    Simulator simulator(world);
+
+    simulator.simulate(Duration::fromSeconds(1));
+
+    EXPECT_EQ(Vector(0, 0),
+              simulator.getWorld().friendlyTeam().getRobotById(0)->velocity());
+}
+
+TEST_F(SimulatorTest, test_robot_moves_to_destination)
+{
+    addRobot(world.mutableFriendlyTeam(), 0, Point(0, 0), Angle::zero());
+    Simulator simulator(world);
+
+    simulator.setFriendlyPrimitives({MovePrimitive(0, Point(1, 1), Angle::quarter(), 0)});
+    simulator.simulate(Duration::fromSeconds(3));
+
+    Robot robot = *simulator.getWorld().friendlyTeam().getRobotById(0);
+    EXPECT_LT((robot.position() - Point(1, 1)).len(), 0.01);
+    EXPECT_LT(robot.velocity().len(), 0.01);
+    EXPECT_LT(robot.orientation().minDiff(Angle::quarter()), Angle::ofDegrees(1));
+}
+
+TEST_F(SimulatorTest, test_robot_acceleration_is_limited)
+{
+    addRobot(world.mutableFriendlyTeam(), 0, Point(0, 0), Angle::zero());
+    Simulator simulator(world);
+
+    simulator.setFriendlyPrimitives({MovePrimitive(0, Point(4, 0), Angle::zero(), 0)});
+    simulator.simulate(Duration::fromSeconds(0.1));
+
+    EXPECT_LE(simulator.getWorld().friendlyTeam().getRobotById(0)->velocity().len(),
+              ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED * 0.1 + 1e-9);
+}
+
+TEST_F(SimulatorTest, test_robots_do_not_pass_through_each_other)
+{
+    addRobot(world.mutableFriendlyTeam(), 0, Point(-1, 0), Angle::zero());
+    addRobot(world.mutableEnemyTeam(), 0, Point(0, 0), Angle::zero());
+    Simulator simulator(world);
+
+    simulator.setFriendlyPrimitives({MovePrimitive(0, Point(1, 0), Angle::zero(), 0)});
+    for (int i = 0; i < 100; i++)
+    {
+        simulator.simulate(Duration::fromSeconds(0.02));
+        Point friendly_position =
+            simulator.getWorld().friendlyTeam().getRobotById(0)->position();
+        Point enemy_position =
+            simulator.getWorld().enemyTeam().getRobotById(0)->position();
+        EXPECT_GE((friendly_position - enemy_position).len(),
+                  2 * ROBOT_MAX_RADIUS_METERS - 1e-9);
+    }
+}
+
+TEST_F(SimulatorTest, test_robot_stays_inside_walls)
+{
+    addRobot(world.mutableFriendlyTeam(), 0, Point(4, 0), Angle::zero());
+    Simulator simulator(world);
+
+    simulator.setFriendlyPrimitives({MovePrimitive(0, Point(10, 0), Angle::zero(), 0)});
+    simulator.simulate(Duration::fromSeconds(3));
+
+    EXPECT_LE(simulator.getWorld().friendlyTeam().getRobotById(0)->position().x(),
+              world.field().totalLength() / 2 - ROBOT_MAX_RADIUS_METERS);
+}
+
+TEST_F(SimulatorTest, test_ball_bounces_off_robot)
+{
+    addRobot(world.mutableFriendlyTeam(), 0, Point(0, 0), Angle::zero());
+    world.updateBallState(
+        Ball(Point(-1, 0.3), Vector(2, -0.6), Timestamp::fromSeconds(0)));
+    Simulator simulator(world);
+
+    simulator.simulate(Duration::fromSeconds(1));
+
+    // The ball hits the back of the robot, and bounces back the way it came
+    EXPECT_LT(simulator.getWorld().ball().velocity().x(), 0);
+    EXPECT_GE((simulator.getWorld().ball().position() - Point(0, 0)).len(),
+              ROBOT_MAX_RADIUS_METERS + BALL_MAX_RADIUS_METERS - 1e-9);
+}
+
+TEST_F(SimulatorTest, test_robot_kicks_ball)
+{
+    addRobot(world.mutableFriendlyTeam(), 0, Point(-0.5, 0), Angle::zero());
+    world.updateBallState(Ball(Point(0, 0), Vector(), Timestamp::fromSeconds(0)));
+    Simulator simulator(world);
+
+    simulator.setFriendlyPrimitives({KickPrimitive(0, Point(0, 0), Angle::zero(), 5)});
+    simulator.simulate(Duration::fromSeconds(1));
+
+    Ball ball = simulator.getWorld().ball();
+    EXPECT_GT(ball.position().x(), 2);
+    EXPECT_NEAR(0, ball.position().y(), 0.2);
+    EXPECT_GT(ball.velocity().x(), 4);
+}
+
+TEST_F(SimulatorTest, test_no_ball_contact_before_ball_is_touched)
+{
+    addRobot(world.mutableFriendlyTeam(), 0, Point(-1, 0), Angle::zero());
+    world.updateBallState(Ball(Point(1, 0), Vector(), Timestamp::fromSeconds(0)));
+    Simulator simulator(world);
+
+    simulator.simulate(Duration::fromSeconds(1));
+
+    EXPECT_FALSE(simulator.getLastBallContact());
+}
+
+TEST_F(SimulatorTest, test_kick_is_recorded_as_ball_contact)
+{
+    addRobot(world.mutableFriendlyTeam(), 3, Point(-0.5, 0), Angle::zero());
+    world.updateBallState(Ball(Point(0, 0), Vector(), Timestamp::fromSeconds(0)));
+    Simulator simulator(world);
+
+    simulator.setFriendlyPrimitives({KickPrimitive(3, Point(0, 0), Angle::zero(), 5)});
+    simulator.simulate(Duration::fromSeconds(1));
+
+    std::optional<Simulator::BallContact> contact = simulator.getLastBallContact();
+    ASSERT_TRUE(contact);
+    EXPECT_TRUE(contact->friendly);
+    EXPECT_EQ(3, contact->robot_id);
+    EXPECT_TRUE(contact->kicked);
+    EXPECT_GT(contact->timestamp, Timestamp::fromSeconds(0));
+    EXPECT_LE(contact->timestamp, simulator.getTimestamp());
+}
+
+TEST_F(SimulatorTest, test_ball_hitting_enemy_robot_is_recorded_as_ball_contact)
+{
+    addRobot(world.mutableEnemyTeam(), 1, Point(1, 0), Angle::zero());
+    world.updateBallState(Ball(Point(0, 0), Vector(2, 0), Timestamp::fromSeconds(0)));
+    Simulator simulator(world);
+
+    simulator.simulate(Duration::fromSeconds(1));
+
+    std::optional<Simulator::BallContact> contact = simulator.getLastBallContact();
+    ASSERT_TRUE(contact);
+    EXPECT_FALSE(contact->friendly);
+    EXPECT_EQ(1, contact->robot_id);
+    EXPECT_FALSE(contact->kicked);
+}
+
+TEST_F(SimulatorTest, test_chipped_ball_flies_over_robot)
+{
+    addRobot(world.mutableFriendlyTeam(), 0, Point(-0.5, 0), Angle::zero());
+    addRobot(world.mutableEnemyTeam(), 0, Point(1, 0), Angle::half());
+    world.updateBallState(Ball(Point(0, 0), Vector(), Timestamp::fromSeconds(0)));
+    Simulator simulator(world);
+
+    simulator.setFriendlyPrimitives({ChipPrimitive(0, Point(0, 0), Angle::zero(), 3)});
+    simulator.simulate(Duration::fromSeconds(1.5));
+
+    EXPECT_GT(simulator.getWorld().ball().position().x(), 1.5);
+}
+
+TEST_F(SimulatorTest, test_dribbler_holds_ball)
+{
+    addRobot(world.mutableFriendlyTeam(), 0, Point(0, 0), Angle::zero());
+    world.updateBallState(Ball(dribblerPosition(Point(0, 0), Angle::zero()), Vector(),
+                               Timestamp::fromSeconds(0)));
+    Simulator simulator(world);
+
+    // Back away, so the ball only comes along if the dribbler holds it
+    simulator.setFriendlyPrimitives(
+        {DribblePrimitive(0, Point(-1, 0), Angle::zero(), 0, 10000, false)});
+    simulator.simulate(Duration::fromSeconds(3));
+
+    Robot robot = *simulator.getWorld().friendlyTeam().getRobotById(0);
+    EXPECT_LT((robot.position() - Point(-1, 0)).len(), 0.01);
+    EXPECT_LT((simulator.getWorld().ball().position() -
+               dribblerPosition(robot.position(), robot.orientation()))
+                  .len(),
+              0.01);
+}
+
+TEST_F(SimulatorTest, test_same_seed_gives_same_result)
+{
+    addRobot(world.mutableFriendlyTeam(), 0, Point(-0.5, 0), Angle::zero());
+    world.updateBallState(Ball(Point(0, 0), Vector(), Timestamp::fromSeconds(0)));
+    Simulator simulator(world, 7);
+    Simulator same_seed_simulator(world, 7);
+    Simulator other_seed_simulator(world, 8);
+
+    for (Simulator* s : {&simulator, &same_seed_simulator, &other_seed_simulator})
+    {
+        s->setFriendlyPrimitives({KickPrimitive(0, Point(0, 0), Angle::zero(), 5)});
+        s->simulate(Duration::fromSeconds(1));
+    }
+
+    EXPECT_EQ(simulator.getWorld().ball(), same_seed_simulator.getWorld().ball());
+    EXPECT_EQ(simulator.getWorld().friendlyTeam(),
+              same_seed_simulator.getWorld().friendlyTeam());
+    // The noise on the kick is different with a different seed
+    EXPECT_NE(simulator.getWorld().ball(), other_seed_simulator.getWorld().ball());
+}
+
+TEST_F(SimulatorTest, test_game_state_is_updated)
+{
+    Simulator simulator(world);
+
+    simulator.updateRefboxGameState(RefboxGameState::PREPARE_KICKOFF_US);
+
+    EXPECT_TRUE(simulator.getWorld().gameState().isOurKickoff());
+}
+
+TEST_F(SimulatorTest, test_non_positive_time_step_is_rejected)
+{
+    EXPECT_THROW(Simulator(world, 0, Duration::fromSeconds(0)), std::invalid_argument);
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << argv[0] << std::endl;
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
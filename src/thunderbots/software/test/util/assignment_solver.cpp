@@ -0,0 +1,246 @@
+/**
+ * Tests for the `AssignmentSolver`
+ */
+
+#include "util/assignment_solver.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace Util;
+
+namespace
+{
+    using Solver = AssignmentSolver<8>;
+
+    double getTotalCost(const Solver::CostMatrix& costs,
+                        const Solver::Assignment& assignment, size_t num_rows)
+    {
+        double total_cost = 0;
+        for (size_t row = 0; row < num_rows; row++)
+        {
+            total_cost += costs[row][assignment[row]];
+        }
+        return total_cost;
+    }
+
+    // Finds the smallest total cost by trying every assignment
+    double getBruteForceMinCost(const Solver::CostMatrix& costs, size_t num_rows,
+                                size_t num_cols)
+    {
+        std::vector<size_t> columns(num_cols);
+        std::iota(columns.begin(), columns.end(), 0);
+
+        double min_cost = std::numeric_limits<double>::infinity();
+        do
+        {
+            double cost = 0;
+            for (size_t row = 0; row < num_rows; row++)
+            {
+                cost += costs[row][columns[row]];
+            }
+            min_cost = std::min(min_cost, cost);
+        } while (std::next_permutation(columns.begin(), columns.end()));
+
+        return min_cost;
+    }
+
+    Solver::CostMatrix createRandomCosts(std::mt19937& random_number_generator)
+    {
+        std::uniform_real_distribution<double> cost_distribution(0, 1);
+        Solver::CostMatrix costs;
+        for (auto& row : costs)
+        {
+            for (auto& cost : row)
+            {
+                cost = cost_distribution(random_number_generator);
+            }
+        }
+        return costs;
+    }
+
+    void expectValidAssignment(const Solver::Assignment& assignment, size_t num_rows,
+                               size_t num_cols)
+    {
+        std::set<size_t> assigned_columns;
+        for (size_t row = 0; row < num_rows; row++)
+        {
+            EXPECT_LT(assignment[row], num_cols);
+            assigned_columns.insert(assignment[row]);
+        }
+        EXPECT_EQ(assigned_columns.size(), num_rows);
+        for (size_t row = num_rows; row < assignment.size(); row++)
+        {
+            EXPECT_EQ(assignment[row], Solver::UNASSIGNED);
+        }
+    }
+}  // namespace
+
+TEST(AssignmentSolverTest, solve_empty_problem)
+{
+    Solver solver;
+    Solver::CostMatrix costs = {};
+
+    auto assignment = solver.solve(costs, 0, 3);
+
+    expectValidAssignment(assignment, 0, 3);
+}
+
+TEST(AssignmentSolverTest, solve_problem_where_greedy_assignment_is_not_optimal)
+{
+    // Row 0 is cheapest in column 0, but giving it column 0 forces row 1 to take the
+    // very expensive column 1
+    Solver solver;
+    Solver::CostMatrix costs = {};
+    costs[0]                 = {0.1, 0.2};
+    costs[1]                 = {0.2, 1.0};
+
+    auto assignment = solver.solve(costs, 2, 2);
+
+    EXPECT_EQ(assignment[0], 1);
+    EXPECT_EQ(assignment[1], 0);
+}
+
+TEST(AssignmentSolverTest, solve_problem_with_more_columns_than_rows)
+{
+    Solver solver;
+    Solver::CostMatrix costs = {};
+    costs[0]                 = {0.9, 0.5, 0.1};
+    costs[1]                 = {0.8, 0.1, 0.7};
+
+    auto assignment = solver.solve(costs, 2, 3);
+
+    EXPECT_EQ(assignment[0], 2);
+    EXPECT_EQ(assignment[1], 1);
+    EXPECT_EQ(assignment[2], Solver::UNASSIGNED);
+}
+
+TEST(AssignmentSolverTest, solve_random_problems_matches_brute_force)
+{
+    std::mt19937 random_number_generator(0);
+    Solver solver;
+
+    for (size_t num_cols = 1; num_cols <= 7; num_cols++)
+    {
+        for (size_t num_rows = 1; num_rows <= num_cols; num_rows++)
+        {
+            auto costs      = createRandomCosts(random_number_generator);
+            auto assignment = solver.solve(costs, num_rows, num_cols);
+
+            expectValidAssignment(assignment, num_rows, num_cols);
+            EXPECT_NEAR(getTotalCost(costs, assignment, num_rows),
+                        getBruteForceMinCost(costs, num_rows, num_cols), 1e-9);
+        }
+    }
+}
+
+TEST(AssignmentSolverTest, warm_start_with_same_costs_keeps_every_row)
+{
+    std::mt19937 random_number_generator(1);
+    Solver solver;
+    auto costs = createRandomCosts(random_number_generator);
+
+    Solver::Assignment first_assignment = solver.solve(costs, 5, 7);
+    auto second_assignment              = solver.solve(costs, 5, 7, first_assignment);
+
+    EXPECT_EQ(solver.getNumWarmStartedRows(), 5);
+    EXPECT_EQ(first_assignment, second_assignment);
+}
+
+TEST(AssignmentSolverTest, warm_start_with_changing_costs_matches_brute_force)
+{
+    std::mt19937 random_number_generator(2);
+    std::normal_distribution<double> cost_change_distribution(0, 0.05);
+    Solver solver;
+    auto costs = createRandomCosts(random_number_generator);
+
+    Solver::Assignment assignment = solver.solve(costs, 6, 7);
+    size_t num_warm_started_rows  = 0;
+    for (int i = 0; i < 100; i++)
+    {
+        for (size_t row = 0; row < 6; row++)
+        {
+            for (size_t col = 0; col < 7; col++)
+            {
+                costs[row][col] += cost_change_distribution(random_number_generator);
+            }
+        }
+
+        assignment = solver.solve(costs, 6, 7, assignment);
+        num_warm_started_rows += solver.getNumWarmStartedRows();
+
+        expectValidAssignment(assignment, 6, 7);
+        EXPECT_NEAR(getTotalCost(costs, assignment, 6), getBruteForceMinCost(costs, 6, 7),
+                    1e-9);
+    }
+
+    // Small changes to the costs should leave most rows where they were
+    EXPECT_GT(num_warm_started_rows, 100 * 6 / 2);
+}
+
+TEST(AssignmentSolverTest, warm_start_from_non_optimal_assignment_is_still_optimal)
+{
+    Solver solver;
+    Solver::CostMatrix costs = {};
+    costs[0]                 = {0.1, 0.2};
+    costs[1]                 = {0.2, 1.0};
+
+    solver.solve(costs, 2, 2);
+    // The greedy assignment, which is not optimal
+    Solver::Assignment initial_assignment;
+    initial_assignment.fill(Solver::UNASSIGNED);
+    initial_assignment[0] = 0;
+    initial_assignment[1] = 1;
+
+    auto assignment = solver.solve(costs, 2, 2, initial_assignment);
+
+    EXPECT_EQ(assignment[0], 1);
+    EXPECT_EQ(assignment[1], 0);
+}
+
+TEST(AssignmentSolverTest, warm_start_ignores_invalid_initial_columns)
+{
+    std::mt19937 random_number_generator(3);
+    Solver solver;
+    auto costs = createRandomCosts(random_number_generator);
+
+    Solver::Assignment initial_assignment;
+    initial_assignment.fill(2);
+    initial_assignment[1] = 6;
+
+    auto assignment = solver.solve(costs, 4, 5, initial_assignment);
+
+    EXPECT_LE(solver.getNumWarmStartedRows(), 1);
+    expectValidAssignment(assignment, 4, 5);
+    EXPECT_NEAR(getTotalCost(costs, assignment, 4), getBruteForceMinCost(costs, 4, 5),
+                1e-9);
+}
+
+TEST(AssignmentSolverTest, solve_with_more_rows_than_columns_throws)
+{
+    Solver solver;
+    Solver::CostMatrix costs = {};
+
+    EXPECT_THROW(solver.solve(costs, 3, 2), std::invalid_argument);
+}
+
+TEST(AssignmentSolverTest, solve_with_more_columns_than_max_size_throws)
+{
+    Solver solver;
+    Solver::CostMatrix costs = {};
+
+    EXPECT_THROW(solver.solve(costs, 2, 9), std::invalid_argument);
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << argv[0] << std::endl;
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,168 @@
+#include "util/event_loop/epoll_event_loop.h"
+
+#include <gtest/gtest.h>
+#include <sys/epoll.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+class EpollEventLoopTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        ASSERT_EQ(0, pipe(pipe_fds));
+    }
+
+    void TearDown() override
+    {
+        close(pipe_fds[0]);
+        close(pipe_fds[1]);
+    }
+
+    void writeToPipe()
+    {
+        char data = 'x';
+        ASSERT_EQ(1, write(pipe_fds[1], &data, 1));
+    }
+
+    void readFromPipe()
+    {
+        char data;
+        ASSERT_EQ(1, read(pipe_fds[0], &data, 1));
+    }
+
+    Util::EpollEventLoop event_loop;
+    int pipe_fds[2];
+};
+
+TEST_F(EpollEventLoopTest, times_out_without_events)
+{
+    auto start_time = std::chrono::steady_clock::now();
+
+    EXPECT_FALSE(event_loop.runOnce(Duration::fromMilliseconds(20)));
+
+    EXPECT_GE(std::chrono::steady_clock::now() - start_time,
+              std::chrono::milliseconds(20));
+}
+
+TEST_F(EpollEventLoopTest, zero_timeout_does_not_sleep)
+{
+    auto start_time = std::chrono::steady_clock::now();
+
+    EXPECT_FALSE(event_loop.runOnce(Duration::fromMilliseconds(0)));
+
+    EXPECT_LT(std::chrono::steady_clock::now() - start_time,
+              std::chrono::milliseconds(10));
+}
+
+TEST_F(EpollEventLoopTest, handler_is_called_when_fd_is_ready)
+{
+    int num_calls = 0;
+    event_loop.addFd(pipe_fds[0], EPOLLIN, [this, &num_calls]() {
+        readFromPipe();
+        num_calls++;
+    });
+    EXPECT_EQ(1, event_loop.getNumFds());
+
+    EXPECT_FALSE(event_loop.runOnce(Duration::fromMilliseconds(0)));
+    EXPECT_EQ(0, num_calls);
+
+    writeToPipe();
+    EXPECT_TRUE(event_loop.runOnce(Duration::fromSeconds(5)));
+    EXPECT_EQ(1, num_calls);
+
+    // The handler read the data, so the fd is no longer ready
+    EXPECT_FALSE(event_loop.runOnce(Duration::fromMilliseconds(0)));
+    EXPECT_EQ(1, num_calls);
+}
+
+TEST_F(EpollEventLoopTest, removed_fd_is_not_handled)
+{
+    int num_calls = 0;
+    event_loop.addFd(pipe_fds[0], EPOLLIN, [&num_calls]() { num_calls++; });
+    event_loop.removeFd(pipe_fds[0]);
+    // Removing an fd that isn't watched does nothing
+    event_loop.removeFd(pipe_fds[0]);
+    EXPECT_EQ(0, event_loop.getNumFds());
+
+    writeToPipe();
+
+    EXPECT_FALSE(event_loop.runOnce(Duration::fromMilliseconds(0)));
+    EXPECT_EQ(0, num_calls);
+}
+
+TEST_F(EpollEventLoopTest, handler_can_remove_its_own_fd)
+{
+    int num_calls = 0;
+    event_loop.addFd(pipe_fds[0], EPOLLIN, [this, &num_calls]() {
+        num_calls++;
+        event_loop.removeFd(pipe_fds[0]);
+    });
+    writeToPipe();
+
+    EXPECT_TRUE(event_loop.runOnce(Duration::fromSeconds(5)));
+    EXPECT_FALSE(event_loop.runOnce(Duration::fromMilliseconds(0)));
+    EXPECT_EQ(1, num_calls);
+}
+
+TEST_F(EpollEventLoopTest, adding_an_fd_twice_throws)
+{
+    event_loop.addFd(pipe_fds[0], EPOLLIN, []() {});
+
+    EXPECT_THROW(event_loop.addFd(pipe_fds[0], EPOLLIN, []() {}), std::runtime_error);
+}
+
+TEST_F(EpollEventLoopTest, posted_tasks_run_in_order_on_the_loop_thread)
+{
+    std::vector<int> task_order;
+    std::thread::id task_thread_id;
+    std::thread poster([&]() {
+        for (int i = 0; i < 3; i++)
+        {
+            event_loop.post([&task_order, &task_thread_id, i]() {
+                task_order.emplace_back(i);
+                task_thread_id = std::this_thread::get_id();
+            });
+        }
+    });
+    poster.join();
+
+    EXPECT_TRUE(event_loop.runOnce(Duration::fromSeconds(5)));
+
+    EXPECT_EQ(std::vector<int>({0, 1, 2}), task_order);
+    EXPECT_EQ(std::this_thread::get_id(), task_thread_id);
+}
+
+TEST_F(EpollEventLoopTest, post_wakes_up_a_sleeping_loop)
+{
+    bool task_run = false;
+    std::thread poster([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        event_loop.post([&task_run]() { task_run = true; });
+    });
+
+    auto start_time = std::chrono::steady_clock::now();
+    EXPECT_TRUE(event_loop.runOnce(Duration::fromSeconds(5)));
+    poster.join();
+
+    EXPECT_TRUE(task_run);
+    EXPECT_LT(std::chrono::steady_clock::now() - start_time, std::chrono::seconds(4));
+}
+
+TEST_F(EpollEventLoopTest, wake_up_returns_without_running_anything)
+{
+    event_loop.wakeUp();
+
+    EXPECT_TRUE(event_loop.runOnce(Duration::fromSeconds(5)));
+    EXPECT_FALSE(event_loop.runOnce(Duration::fromMilliseconds(0)));
+}
+
+int main(int argc, char **argv)
+{
+    std::cout << argv[0] << std::endl;
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,239 @@
+#include "util/shared_memory/shared_world_ring.h"
+
+#include <gtest/gtest.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <iostream>
+#include <thread>
+
+#include "util/shared_memory/world_frame.h"
+
+class SharedWorldRingTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        // Use a segment name unique to this process so tests that run at the same time
+        // don't interfere with each other
+        segment_name = "/thunderbots_world_test_" + std::to_string(getpid());
+        shm_unlink(segment_name.c_str());
+    }
+
+    void TearDown() override
+    {
+        shm_unlink(segment_name.c_str());
+    }
+
+    World createTestWorld()
+    {
+        Field field(9.0, 6.0, 1.0, 2.0, 1.0, 0.3, 0.5);
+        Ball ball(Point(1, 2), Vector(-3, 4), Timestamp::fromSeconds(5));
+
+        Team friendly_team(Duration::fromMilliseconds(1000));
+        friendly_team.updateRobots(
+            {Robot(0, Point(1, 1), Vector(0.5, 0), Angle::ofRadians(0.5),
+                   AngularVelocity::ofRadians(1), Timestamp::fromSeconds(5)),
+             Robot(3, Point(-2, 1), Vector(0, -1), Angle::ofRadians(-1),
+                   AngularVelocity::ofRadians(0), Timestamp::fromSeconds(5))});
+        friendly_team.assignGoalie(3);
+
+        Team enemy_team(Duration::fromMilliseconds(500));
+        enemy_team.updateRobots(
+            {Robot(7, Point(3, -1), Vector(), Angle::ofRadians(2),
+                   AngularVelocity::ofRadians(0), Timestamp::fromSeconds(5))});
+
+        World world(field, ball, friendly_team, enemy_team);
+        world.updateRefboxGameState(RefboxGameState::FORCE_START);
+        return world;
+    }
+
+    Util::WorldFrame createTestWorldFrame(uint64_t frame_id)
+    {
+        thunderbots_msgs::FrameTrace trace;
+        trace.frame_id          = frame_id;
+        trace.receive_timestamp = 10.0 + frame_id;
+        return Util::createWorldFrame(createTestWorld(), trace);
+    }
+
+    std::string segment_name;
+};
+
+TEST_F(SharedWorldRingTest, world_frame_round_trip)
+{
+    World world = createTestWorld();
+    thunderbots_msgs::FrameTrace trace;
+    trace.frame_id                = 42;
+    trace.receive_timestamp       = 1.5;
+    trace.world_publish_timestamp = 2.5;
+
+    Util::WorldFrame world_frame = Util::createWorldFrame(world, trace);
+    World converted_world        = Util::createWorldFromWorldFrame(world_frame);
+
+    EXPECT_EQ(world.field(), converted_world.field());
+    EXPECT_EQ(world.ball(), converted_world.ball());
+    EXPECT_EQ(world.friendlyTeam(), converted_world.friendlyTeam());
+    EXPECT_EQ(world.enemyTeam(), converted_world.enemyTeam());
+    EXPECT_EQ(3, *converted_world.friendlyTeam().getGoalieID());
+    EXPECT_FALSE(converted_world.enemyTeam().getGoalieID());
+    EXPECT_EQ(RefboxGameState::FORCE_START,
+              converted_world.gameState().getRefboxGameState());
+
+    thunderbots_msgs::FrameTrace converted_trace =
+        Util::createFrameTraceFromWorldFrame(world_frame);
+    EXPECT_EQ(42, converted_trace.frame_id);
+    EXPECT_DOUBLE_EQ(1.5, converted_trace.receive_timestamp);
+    EXPECT_DOUBLE_EQ(2.5, converted_trace.world_publish_timestamp);
+}
+
+TEST_F(SharedWorldRingTest, reader_throws_if_segment_does_not_exist)
+{
+    EXPECT_THROW(Util::SharedWorldRingReader reader(segment_name), std::runtime_error);
+}
+
+TEST_F(SharedWorldRingTest, no_frame_to_read_before_first_write)
+{
+    Util::SharedWorldRingWriter writer(segment_name);
+    Util::SharedWorldRingReader reader(segment_name);
+
+    Util::WorldFrame world_frame = {};
+    EXPECT_FALSE(reader.readLatest(world_frame));
+}
+
+TEST_F(SharedWorldRingTest, read_written_frame_once)
+{
+    Util::SharedWorldRingWriter writer(segment_name);
+    Util::SharedWorldRingReader reader(segment_name);
+
+    writer.write(createTestWorldFrame(1));
+
+    Util::WorldFrame world_frame = {};
+    ASSERT_TRUE(reader.readLatest(world_frame));
+    EXPECT_EQ(1, world_frame.trace.frame_id);
+    EXPECT_EQ(createTestWorld().ball(),
+              Util::createWorldFromWorldFrame(world_frame).ball());
+
+    // The same frame is not read twice
+    EXPECT_FALSE(reader.readLatest(world_frame));
+}
+
+TEST_F(SharedWorldRingTest, reader_skips_to_latest_frame_after_ring_wraps_around)
+{
+    Util::SharedWorldRingWriter writer(segment_name);
+    Util::SharedWorldRingReader reader(segment_name);
+
+    for (uint64_t frame_id = 1; frame_id <= 3 * Util::SharedWorldRing::NUM_SLOTS + 1;
+         frame_id++)
+    {
+        writer.write(createTestWorldFrame(frame_id));
+    }
+
+    Util::WorldFrame world_frame = {};
+    ASSERT_TRUE(reader.readLatest(world_frame));
+    EXPECT_EQ(3 * Util::SharedWorldRing::NUM_SLOTS + 1, world_frame.trace.frame_id);
+    EXPECT_FALSE(reader.readLatest(world_frame));
+}
+
+TEST_F(SharedWorldRingTest, new_reader_ignores_frames_written_before_it_was_created)
+{
+    Util::SharedWorldRingWriter writer(segment_name);
+    writer.write(createTestWorldFrame(1));
+
+    Util::SharedWorldRingReader reader(segment_name);
+    Util::WorldFrame world_frame = {};
+    EXPECT_FALSE(reader.readLatest(world_frame));
+
+    writer.write(createTestWorldFrame(2));
+    ASSERT_TRUE(reader.readLatest(world_frame));
+    EXPECT_EQ(2, world_frame.trace.frame_id);
+}
+
+TEST_F(SharedWorldRingTest, restarted_writer_keeps_existing_readers_working)
+{
+    auto writer = std::make_unique<Util::SharedWorldRingWriter>(segment_name);
+    Util::SharedWorldRingReader reader(segment_name);
+    writer->write(createTestWorldFrame(1));
+
+    Util::WorldFrame world_frame = {};
+    ASSERT_TRUE(reader.readLatest(world_frame));
+
+    writer = std::make_unique<Util::SharedWorldRingWriter>(segment_name);
+    writer->write(createTestWorldFrame(2));
+    ASSERT_TRUE(reader.readLatest(world_frame));
+    EXPECT_EQ(2, world_frame.trace.frame_id);
+}
+
+TEST_F(SharedWorldRingTest, wait_for_new_frame_times_out_without_writes)
+{
+    Util::SharedWorldRingWriter writer(segment_name);
+    Util::SharedWorldRingReader reader(segment_name);
+
+    EXPECT_FALSE(reader.waitForNewFrame(std::chrono::milliseconds(10)));
+}
+
+TEST_F(SharedWorldRingTest, wait_for_new_frame_wakes_up_when_frame_is_written)
+{
+    Util::SharedWorldRingWriter writer(segment_name);
+    Util::SharedWorldRingReader reader(segment_name);
+
+    std::thread writer_thread([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        writer.write(createTestWorldFrame(1));
+    });
+
+    auto start_time = std::chrono::steady_clock::now();
+    EXPECT_TRUE(reader.waitForNewFrame(std::chrono::seconds(10)));
+    EXPECT_LT(std::chrono::steady_clock::now() - start_time, std::chrono::seconds(5));
+    writer_thread.join();
+
+    Util::WorldFrame world_frame = {};
+    EXPECT_TRUE(reader.readLatest(world_frame));
+    EXPECT_EQ(1, world_frame.trace.frame_id);
+}
+
+TEST_F(SharedWorldRingTest, reader_never_sees_partially_written_frame)
+{
+    Util::SharedWorldRingWriter writer(segment_name);
+    Util::SharedWorldRingReader reader(segment_name);
+
+    // Fields near the start, middle and end of each frame are all set to the frame id,
+    // so a torn read would show up as a frame with different values in these fields
+    constexpr uint64_t NUM_FRAMES = 20000;
+    std::thread writer_thread([&]() {
+        Util::WorldFrame world_frame = {};
+        for (uint64_t frame_id = 1; frame_id <= NUM_FRAMES; frame_id++)
+        {
+            world_frame.trace.frame_id  = frame_id;
+            world_frame.ball.position_x = static_cast<double>(frame_id);
+            world_frame.enemy_team.robots[Util::WorldFrame::MAX_ROBOTS_PER_TEAM - 1]
+                .timestamp_seconds = static_cast<double>(frame_id);
+            writer.write(world_frame);
+        }
+    });
+
+    Util::WorldFrame world_frame = {};
+    uint64_t last_frame_id       = 0;
+    while (last_frame_id < NUM_FRAMES)
+    {
+        if (reader.readLatest(world_frame))
+        {
+            ASSERT_GT(world_frame.trace.frame_id, last_frame_id);
+            ASSERT_EQ(static_cast<double>(world_frame.trace.frame_id),
+                      world_frame.ball.position_x);
+            ASSERT_EQ(
+                static_cast<double>(world_frame.trace.frame_id),
+                world_frame.enemy_team.robots[Util::WorldFrame::MAX_ROBOTS_PER_TEAM - 1]
+                    .timestamp_seconds);
+            last_frame_id = world_frame.trace.frame_id;
+        }
+    }
+
+    writer_thread.join();
+}
+
+int main(int argc, char **argv)
+{
+    std::cout << argv[0] << std::endl;
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,117 @@
+/**
+ * Tests for the `SPSCQueue`
+ */
+
+#include "util/spsc_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <thread>
+
+using namespace Util;
+
+TEST(SPSCQueueTest, new_queue_is_empty)
+{
+    SPSCQueue<int, 4> queue;
+    EXPECT_EQ(queue.size(), 0);
+    EXPECT_EQ(queue.front(), nullptr);
+    EXPECT_EQ(queue.capacity(), 4);
+}
+
+TEST(SPSCQueueTest, values_come_out_in_the_order_they_went_in)
+{
+    SPSCQueue<int, 4> queue;
+    EXPECT_TRUE(queue.push(1));
+    EXPECT_TRUE(queue.push(2));
+    EXPECT_TRUE(queue.push(3));
+    EXPECT_EQ(queue.size(), 3);
+
+    for (int expected_value : {1, 2, 3})
+    {
+        ASSERT_NE(queue.front(), nullptr);
+        EXPECT_EQ(*queue.front(), expected_value);
+        queue.pop();
+    }
+    EXPECT_EQ(queue.front(), nullptr);
+}
+
+TEST(SPSCQueueTest, push_to_full_queue_fails)
+{
+    SPSCQueue<int, 2> queue;
+    EXPECT_TRUE(queue.push(1));
+    EXPECT_TRUE(queue.push(2));
+    EXPECT_FALSE(queue.push(3));
+    EXPECT_EQ(queue.startPush(), nullptr);
+    EXPECT_EQ(queue.size(), 2);
+
+    // Making room lets us push again
+    queue.pop();
+    EXPECT_TRUE(queue.push(3));
+    EXPECT_EQ(*queue.front(), 2);
+}
+
+TEST(SPSCQueueTest, value_written_in_place_is_not_visible_until_push_finishes)
+{
+    SPSCQueue<std::vector<int>, 2> queue;
+    std::vector<int>* slot = queue.startPush();
+    ASSERT_NE(slot, nullptr);
+    slot->assign({1, 2, 3});
+    EXPECT_EQ(queue.front(), nullptr);
+
+    queue.finishPush();
+    ASSERT_NE(queue.front(), nullptr);
+    EXPECT_EQ(*queue.front(), std::vector<int>({1, 2, 3}));
+}
+
+TEST(SPSCQueueTest, indices_wrap_around)
+{
+    SPSCQueue<int, 2> queue;
+    for (int i = 0; i < 100; i++)
+    {
+        EXPECT_TRUE(queue.push(i));
+        EXPECT_EQ(*queue.front(), i);
+        queue.pop();
+    }
+    EXPECT_EQ(queue.size(), 0);
+}
+
+TEST(SPSCQueueTest, values_pass_between_threads_in_order)
+{
+    SPSCQueue<int, 8> queue;
+    const int num_values = 100000;
+
+    std::thread producer([&queue]() {
+        for (int i = 0; i < num_values; i++)
+        {
+            while (!queue.push(i))
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    int expected_value = 0;
+    while (expected_value < num_values)
+    {
+        int* value = queue.front();
+        if (!value)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        ASSERT_EQ(*value, expected_value);
+        queue.pop();
+        expected_value++;
+    }
+
+    producer.join();
+    EXPECT_EQ(queue.size(), 0);
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << argv[0] << std::endl;
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
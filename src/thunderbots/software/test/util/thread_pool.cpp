@@ -0,0 +1,128 @@
+/**
+ * Tests for the `ThreadPool`
+ */
+
+#include "util/thread_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <iostream>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+using namespace Util;
+
+TEST(ThreadPoolTest, every_task_is_run_exactly_once)
+{
+    ThreadPool thread_pool(3);
+    std::vector<std::atomic<int>> num_times_run(100);
+
+    thread_pool.parallelFor(num_times_run.size(),
+                            [&num_times_run](size_t i) { num_times_run[i]++; });
+
+    for (const auto& count : num_times_run)
+    {
+        EXPECT_EQ(count, 1);
+    }
+}
+
+TEST(ThreadPoolTest, results_written_by_index_are_in_order)
+{
+    ThreadPool thread_pool(4);
+    std::vector<size_t> results(50);
+
+    // Run several batches to make sure the pool can be reused
+    for (int batch = 0; batch < 20; batch++)
+    {
+        thread_pool.parallelFor(results.size(),
+                                [&results, batch](size_t i) { results[i] = i + batch; });
+
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            EXPECT_EQ(results[i], i + batch);
+        }
+    }
+}
+
+TEST(ThreadPoolTest, pool_without_worker_threads_runs_tasks_in_order)
+{
+    ThreadPool thread_pool(0);
+    std::vector<size_t> task_order;
+
+    thread_pool.parallelFor(5, [&task_order](size_t i) { task_order.emplace_back(i); });
+
+    EXPECT_EQ(thread_pool.getNumWorkerThreads(), 0);
+    EXPECT_EQ(task_order, std::vector<size_t>({0, 1, 2, 3, 4}));
+}
+
+TEST(ThreadPoolTest, tasks_are_run_on_more_than_one_thread)
+{
+    ThreadPool thread_pool(2);
+    std::mutex mutex;
+    std::set<std::thread::id> thread_ids;
+    std::atomic<int> num_tasks_started(0);
+
+    // Every task waits until all 3 have started, so they can only finish if they are
+    // run on 3 different threads at once
+    thread_pool.parallelFor(3, [&](size_t i) {
+        {
+            std::scoped_lock<std::mutex> lock(mutex);
+            thread_ids.insert(std::this_thread::get_id());
+        }
+        num_tasks_started++;
+        while (num_tasks_started < 3)
+        {
+            std::this_thread::yield();
+        }
+    });
+
+    EXPECT_EQ(thread_ids.size(), 3);
+}
+
+TEST(ThreadPoolTest, exception_from_lowest_task_index_is_rethrown)
+{
+    ThreadPool thread_pool(3);
+    std::atomic<int> num_tasks_run(0);
+
+    try
+    {
+        thread_pool.parallelFor(20, [&num_tasks_run](size_t i) {
+            num_tasks_run++;
+            if (i == 7 || i == 13)
+            {
+                throw std::runtime_error(std::to_string(i));
+            }
+        });
+        FAIL() << "parallelFor should have thrown";
+    }
+    catch (const std::runtime_error& e)
+    {
+        EXPECT_EQ(std::string(e.what()), "7");
+    }
+    EXPECT_EQ(num_tasks_run, 20);
+
+    // The pool can still be used after a task threw
+    std::vector<int> results(10, 0);
+    thread_pool.parallelFor(results.size(), [&results](size_t i) { results[i] = 1; });
+    EXPECT_EQ(std::accumulate(results.begin(), results.end(), 0), 10);
+}
+
+TEST(ThreadPoolTest, empty_batch_does_nothing)
+{
+    ThreadPool thread_pool(2);
+    bool task_run = false;
+
+    thread_pool.parallelFor(0, [&task_run](size_t i) { task_run = true; });
+
+    EXPECT_FALSE(task_run);
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << argv[0] << std::endl;
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,99 @@
+#include "util/time/latency_histogram.h"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+TEST(LatencyHistogramTest, empty_histogram_reports_zero_latency)
+{
+    LatencyHistogram histogram;
+    EXPECT_EQ(histogram.getNumberOfSamples(), 0);
+    EXPECT_DOUBLE_EQ(histogram.getPercentile(0.5).getSeconds(), 0);
+    EXPECT_DOUBLE_EQ(histogram.getMaximum().getSeconds(), 0);
+}
+
+TEST(LatencyHistogramTest, single_sample_is_every_percentile)
+{
+    LatencyHistogram histogram;
+    histogram.record(Duration::fromMilliseconds(3));
+
+    EXPECT_EQ(histogram.getNumberOfSamples(), 1);
+    EXPECT_DOUBLE_EQ(histogram.getPercentile(0).getMilliseconds(), 3);
+    EXPECT_DOUBLE_EQ(histogram.getPercentile(0.5).getMilliseconds(), 3);
+    EXPECT_DOUBLE_EQ(histogram.getPercentile(1).getMilliseconds(), 3);
+    EXPECT_DOUBLE_EQ(histogram.getMaximum().getMilliseconds(), 3);
+}
+
+TEST(LatencyHistogramTest, percentiles_are_within_bucket_precision)
+{
+    LatencyHistogram histogram;
+    for (int i = 1; i <= 100; i++)
+    {
+        histogram.record(Duration::fromMilliseconds(i));
+    }
+
+    EXPECT_EQ(histogram.getNumberOfSamples(), 100);
+    EXPECT_NEAR(histogram.getPercentile(0.5).getMilliseconds(), 50, 50 * 0.05);
+    EXPECT_NEAR(histogram.getPercentile(0.99).getMilliseconds(), 99, 99 * 0.05);
+    EXPECT_GE(histogram.getPercentile(0.5).getMilliseconds(), 50);
+    EXPECT_DOUBLE_EQ(histogram.getMaximum().getMilliseconds(), 100);
+}
+
+TEST(LatencyHistogramTest, negative_latency_is_recorded_as_zero)
+{
+    LatencyHistogram histogram;
+    histogram.record(Duration::fromMilliseconds(-5));
+
+    EXPECT_EQ(histogram.getNumberOfSamples(), 1);
+    EXPECT_DOUBLE_EQ(histogram.getMaximum().getSeconds(), 0);
+    EXPECT_DOUBLE_EQ(histogram.getPercentile(1).getSeconds(), 0);
+}
+
+TEST(LatencyHistogramTest, very_large_latency_is_not_lost)
+{
+    LatencyHistogram histogram;
+    histogram.record(Duration::fromSeconds(10000));
+
+    EXPECT_DOUBLE_EQ(histogram.getPercentile(1).getSeconds(), 10000);
+    EXPECT_DOUBLE_EQ(histogram.getMaximum().getSeconds(), 10000);
+}
+
+TEST(LatencyHistogramTest, reset_removes_all_samples)
+{
+    LatencyHistogram histogram;
+    histogram.record(Duration::fromMilliseconds(7));
+    histogram.reset();
+
+    EXPECT_EQ(histogram.getNumberOfSamples(), 0);
+    EXPECT_DOUBLE_EQ(histogram.getPercentile(0.99).getSeconds(), 0);
+    EXPECT_DOUBLE_EQ(histogram.getMaximum().getSeconds(), 0);
+}
+
+TEST(LatencyHistogramTest, merge_combines_samples_of_both_histograms)
+{
+    LatencyHistogram histogram;
+    LatencyHistogram other_histogram;
+    for (int i = 0; i < 90; i++)
+    {
+        histogram.record(Duration::fromMilliseconds(1));
+    }
+    for (int i = 0; i < 10; i++)
+    {
+        other_histogram.record(Duration::fromMilliseconds(20));
+    }
+
+    histogram.merge(other_histogram);
+
+    EXPECT_EQ(histogram.getNumberOfSamples(), 100);
+    EXPECT_NEAR(histogram.getPercentile(0.9).getSeconds(), 0.001, 0.001 * 0.05);
+    EXPECT_DOUBLE_EQ(histogram.getPercentile(0.95).getSeconds(), 0.02);
+    EXPECT_DOUBLE_EQ(histogram.getMaximum().getSeconds(), 0.02);
+    EXPECT_EQ(other_histogram.getNumberOfSamples(), 10);
+}
+
+TEST(LatencyHistogramTest, percentile_out_of_range_throws_exception)
+{
+    LatencyHistogram histogram;
+    EXPECT_THROW(histogram.getPercentile(-0.1), std::invalid_argument);
+    EXPECT_THROW(histogram.getPercentile(1.1), std::invalid_argument);
+}
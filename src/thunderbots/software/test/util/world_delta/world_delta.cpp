@@ -0,0 +1,265 @@
+#include <gtest/gtest.h>
+
+#include <iostream>
+
+#include "util/world_delta/world_delta_decoder.h"
+#include "util/world_delta/world_delta_encoder.h"
+
+class WorldDeltaTest : public ::testing::Test
+{
+   protected:
+    World createTestWorld()
+    {
+        Field field(9.0, 6.0, 1.0, 2.0, 1.0, 0.3, 0.5);
+        Ball ball(Point(1, 2), Vector(-3, 4), Timestamp::fromSeconds(5));
+
+        Team friendly_team(Duration::fromMilliseconds(1000));
+        friendly_team.updateRobots(
+            {Robot(0, Point(1, 1), Vector(0.5, 0), Angle::ofRadians(0.5),
+                   AngularVelocity::ofRadians(1), Timestamp::fromSeconds(5)),
+             Robot(3, Point(-2, 1), Vector(0, -1), Angle::ofRadians(-1),
+                   AngularVelocity::ofRadians(0), Timestamp::fromSeconds(5))});
+        friendly_team.assignGoalie(3);
+
+        Team enemy_team(Duration::fromMilliseconds(500));
+        enemy_team.updateRobots(
+            {Robot(7, Point(3, -1), Vector(), Angle::ofRadians(2),
+                   AngularVelocity::ofRadians(0), Timestamp::fromSeconds(5))});
+
+        return World(field, ball, friendly_team, enemy_team);
+    }
+
+    thunderbots_msgs::RefboxData createRefboxData(int command)
+    {
+        thunderbots_msgs::RefboxData refbox_data;
+        refbox_data.command.command = command;
+        return refbox_data;
+    }
+
+    void expectWorldsEqual(const World& expected, const World& actual)
+    {
+        EXPECT_EQ(expected.field(), actual.field());
+        EXPECT_EQ(expected.ball(), actual.ball());
+        EXPECT_EQ(expected.ball().lastUpdateTimestamp(),
+                  actual.ball().lastUpdateTimestamp());
+        EXPECT_EQ(expected.friendlyTeam(), actual.friendlyTeam());
+        EXPECT_EQ(expected.enemyTeam(), actual.enemyTeam());
+        EXPECT_EQ(expected.friendlyTeam().getRobotExpiryBufferDuration(),
+                  actual.friendlyTeam().getRobotExpiryBufferDuration());
+        EXPECT_EQ(expected.enemyTeam().getRobotExpiryBufferDuration(),
+                  actual.enemyTeam().getRobotExpiryBufferDuration());
+    }
+
+    thunderbots_msgs::FrameTrace trace;
+};
+
+TEST_F(WorldDeltaTest, first_delta_is_keyframe_with_entire_world)
+{
+    Util::WorldDeltaEncoder encoder(60);
+    World world = createTestWorld();
+
+    const thunderbots_msgs::WorldDelta& world_delta = encoder.encode(
+        world, createRefboxData(thunderbots_msgs::RefboxCommand::HALT), false, trace);
+
+    EXPECT_TRUE(world_delta.is_keyframe);
+    EXPECT_EQ(0, world_delta.sequence_number);
+    EXPECT_TRUE(world_delta.field_changed);
+    EXPECT_TRUE(world_delta.refbox_data_changed);
+    EXPECT_TRUE(world_delta.ball_changed);
+    EXPECT_EQ(2, world_delta.friendly_team.updated_robots.size());
+    EXPECT_EQ(1, world_delta.enemy_team.updated_robots.size());
+    EXPECT_TRUE(world_delta.friendly_team.settings_changed);
+    EXPECT_EQ(3, world_delta.friendly_team.goalie_id);
+    EXPECT_EQ(-1, world_delta.enemy_team.goalie_id);
+}
+
+TEST_F(WorldDeltaTest, unchanged_world_gives_empty_delta)
+{
+    Util::WorldDeltaEncoder encoder(60);
+    World world = createTestWorld();
+    thunderbots_msgs::RefboxData refbox_data =
+        createRefboxData(thunderbots_msgs::RefboxCommand::HALT);
+
+    encoder.encode(world, refbox_data, true, trace);
+    const thunderbots_msgs::WorldDelta& world_delta =
+        encoder.encode(world, refbox_data, false, trace);
+
+    EXPECT_FALSE(world_delta.is_keyframe);
+    EXPECT_EQ(1, world_delta.sequence_number);
+    EXPECT_FALSE(world_delta.field_changed);
+    EXPECT_FALSE(world_delta.refbox_data_changed);
+    EXPECT_FALSE(world_delta.ball_changed);
+    EXPECT_TRUE(world_delta.friendly_team.updated_robots.empty());
+    EXPECT_TRUE(world_delta.friendly_team.removed_robot_ids.empty());
+    EXPECT_FALSE(world_delta.friendly_team.settings_changed);
+    EXPECT_TRUE(world_delta.enemy_team.updated_robots.empty());
+    EXPECT_TRUE(world_delta.enemy_team.removed_robot_ids.empty());
+    EXPECT_FALSE(world_delta.enemy_team.settings_changed);
+}
+
+TEST_F(WorldDeltaTest, delta_only_contains_changed_robots)
+{
+    Util::WorldDeltaEncoder encoder(60);
+    World world = createTestWorld();
+    thunderbots_msgs::RefboxData refbox_data =
+        createRefboxData(thunderbots_msgs::RefboxCommand::HALT);
+    encoder.encode(world, refbox_data, false, trace);
+
+    // Move one robot, remove another and add a new one
+    world.mutableFriendlyTeam().updateRobot(
+        Robot(0, Point(1.5, 1), Vector(0.5, 0), Angle::ofRadians(0.5),
+              AngularVelocity::ofRadians(1), Timestamp::fromSeconds(6)));
+    world.mutableEnemyTeam().removeRobot(7);
+    world.mutableEnemyTeam().updateRobot(Robot(2, Point(0, 0), Vector(), Angle::zero(),
+                                               AngularVelocity::zero(),
+                                               Timestamp::fromSeconds(6)));
+
+    const thunderbots_msgs::WorldDelta& world_delta =
+        encoder.encode(world, refbox_data, false, trace);
+
+    ASSERT_EQ(1, world_delta.friendly_team.updated_robots.size());
+    EXPECT_EQ(0, world_delta.friendly_team.updated_robots[0].id);
+    EXPECT_TRUE(world_delta.friendly_team.removed_robot_ids.empty());
+    ASSERT_EQ(1, world_delta.enemy_team.updated_robots.size());
+    EXPECT_EQ(2, world_delta.enemy_team.updated_robots[0].id);
+    ASSERT_EQ(1, world_delta.enemy_team.removed_robot_ids.size());
+    EXPECT_EQ(7, world_delta.enemy_team.removed_robot_ids[0]);
+}
+
+TEST_F(WorldDeltaTest, robot_with_new_timestamp_is_sent_even_if_it_has_not_moved)
+{
+    Util::WorldDeltaEncoder encoder(60);
+    World world = createTestWorld();
+    thunderbots_msgs::RefboxData refbox_data =
+        createRefboxData(thunderbots_msgs::RefboxCommand::HALT);
+    encoder.encode(world, refbox_data, false, trace);
+
+    world.mutableEnemyTeam().updateRobot(
+        Robot(7, Point(3, -1), Vector(), Angle::ofRadians(2),
+              AngularVelocity::ofRadians(0), Timestamp::fromSeconds(6)));
+
+    const thunderbots_msgs::WorldDelta& world_delta =
+        encoder.encode(world, refbox_data, false, trace);
+
+    EXPECT_TRUE(world_delta.friendly_team.updated_robots.empty());
+    EXPECT_EQ(1, world_delta.enemy_team.updated_robots.size());
+}
+
+TEST_F(WorldDeltaTest, keyframe_is_sent_every_keyframe_period)
+{
+    Util::WorldDeltaEncoder encoder(3);
+    World world = createTestWorld();
+    thunderbots_msgs::RefboxData refbox_data =
+        createRefboxData(thunderbots_msgs::RefboxCommand::HALT);
+
+    std::vector<bool> is_keyframe;
+    for (int i = 0; i < 7; i++)
+    {
+        is_keyframe.emplace_back(
+            encoder.encode(world, refbox_data, false, trace).is_keyframe);
+    }
+
+    EXPECT_EQ(std::vector<bool>({true, false, false, true, false, false, true}),
+              is_keyframe);
+}
+
+TEST_F(WorldDeltaTest, encoder_throws_with_keyframe_period_of_0)
+{
+    EXPECT_THROW(Util::WorldDeltaEncoder encoder(0), std::invalid_argument);
+}
+
+TEST_F(WorldDeltaTest, decoder_is_invalid_before_keyframe)
+{
+    Util::WorldDeltaEncoder encoder(60);
+    Util::WorldDeltaDecoder decoder;
+    World world = createTestWorld();
+    thunderbots_msgs::RefboxData refbox_data =
+        createRefboxData(thunderbots_msgs::RefboxCommand::HALT);
+
+    // Skip the keyframe, as if the decoder started late
+    encoder.encode(world, refbox_data, false, trace);
+    EXPECT_FALSE(decoder.apply(encoder.encode(world, refbox_data, false, trace)));
+    EXPECT_FALSE(decoder.isValid());
+}
+
+TEST_F(WorldDeltaTest, decoder_rebuilds_world_from_deltas)
+{
+    Util::WorldDeltaEncoder encoder(60);
+    Util::WorldDeltaDecoder decoder;
+    World world = createTestWorld();
+
+    ASSERT_TRUE(decoder.apply(encoder.encode(
+        world, createRefboxData(thunderbots_msgs::RefboxCommand::HALT), true, trace)));
+    expectWorldsEqual(world, decoder.world());
+    EXPECT_EQ(3, *decoder.world().friendlyTeam().getGoalieID());
+    EXPECT_EQ(RefboxGameState::HALT, decoder.world().gameState().getRefboxGameState());
+
+    world.updateFieldGeometry(Field(6.0, 4.0, 1.0, 2.0, 1.0, 0.3, 0.5));
+    world.updateBallState(Ball(Point(2, 2), Vector(), Timestamp::fromSeconds(6)));
+    world.mutableFriendlyTeam().updateRobot(
+        Robot(0, Point(1.5, 1), Vector(0.5, 0), Angle::ofRadians(0.5),
+              AngularVelocity::ofRadians(1), Timestamp::fromSeconds(6)));
+    world.mutableFriendlyTeam().clearGoalie();
+    world.mutableEnemyTeam().removeRobot(7);
+    world.mutableEnemyTeam().setRobotExpiryBuffer(Duration::fromMilliseconds(250));
+
+    ASSERT_TRUE(decoder.apply(encoder.encode(
+        world, createRefboxData(thunderbots_msgs::RefboxCommand::FORCE_START), true,
+        trace)));
+    expectWorldsEqual(world, decoder.world());
+    EXPECT_FALSE(decoder.world().friendlyTeam().getGoalieID());
+    EXPECT_EQ(RefboxGameState::FORCE_START,
+              decoder.world().gameState().getRefboxGameState());
+}
+
+TEST_F(WorldDeltaTest, decoder_waits_for_keyframe_after_missed_delta)
+{
+    Util::WorldDeltaEncoder encoder(3);
+    Util::WorldDeltaDecoder decoder;
+    World world = createTestWorld();
+    thunderbots_msgs::RefboxData refbox_data =
+        createRefboxData(thunderbots_msgs::RefboxCommand::HALT);
+
+    ASSERT_TRUE(decoder.apply(encoder.encode(world, refbox_data, false, trace)));
+
+    // Miss a delta that removes a robot
+    world.mutableEnemyTeam().removeRobot(7);
+    encoder.encode(world, refbox_data, false, trace);
+
+    EXPECT_FALSE(decoder.apply(encoder.encode(world, refbox_data, false, trace)));
+    EXPECT_FALSE(decoder.isValid());
+
+    // The next keyframe brings the decoder back up to date
+    const thunderbots_msgs::WorldDelta& keyframe =
+        encoder.encode(world, refbox_data, false, trace);
+    ASSERT_TRUE(keyframe.is_keyframe);
+    EXPECT_TRUE(decoder.apply(keyframe));
+    expectWorldsEqual(world, decoder.world());
+}
+
+TEST_F(WorldDeltaTest, decoder_accepts_keyframe_from_restarted_encoder)
+{
+    Util::WorldDeltaDecoder decoder;
+
+    Util::WorldDeltaEncoder encoder(60);
+    World world = createTestWorld();
+    world.updateBallState(Ball(Point(2, 2), Vector(), Timestamp::fromSeconds(100)));
+    thunderbots_msgs::RefboxData refbox_data =
+        createRefboxData(thunderbots_msgs::RefboxCommand::HALT);
+    ASSERT_TRUE(decoder.apply(encoder.encode(world, refbox_data, false, trace)));
+    ASSERT_TRUE(decoder.apply(encoder.encode(world, refbox_data, false, trace)));
+
+    // A new encoder starts again from sequence number 0 with older timestamps
+    Util::WorldDeltaEncoder restarted_encoder(60);
+    World restarted_world = createTestWorld();
+    EXPECT_TRUE(decoder.apply(
+        restarted_encoder.encode(restarted_world, refbox_data, false, trace)));
+    expectWorldsEqual(restarted_world, decoder.world());
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << argv[0] << std::endl;
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,170 @@
+/**
+ * This file contains the declaration for the AssignmentSolver
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+namespace Util
+{
+    /**
+     * Solves the assignment problem: given a matrix of costs where each row is a job
+     * and each column is a worker, it assigns every job to a different worker so that
+     * the total cost is as small as possible.
+     *
+     * This is an implementation of the Hungarian algorithm (also known as the Munkres
+     * algorithm) in its O(n^3) shortest augmenting path form, which keeps a potential for
+     * every row and column:
+     * https://en.wikipedia.org/wiki/Hungarian_algorithm
+     * https://cp-algorithms.com/graph/hungarian-algorithm.html
+     *
+     * All of the memory used by the solver is stored in fixed-size arrays inside the
+     * solver, so solving never allocates. This makes it suitable for problems that are
+     * known to be small and are solved every tick, like assigning robots to tactics.
+     *
+     * The solver can be warm started with the assignment from the last time the problem
+     * was solved. The column potentials of the last solve are kept, and every job that
+     * is still optimally assigned to the same worker under those potentials is kept
+     * without being searched for again. When the costs change only a little between
+     * solves, most of the work of the algorithm is skipped. Warm starting never changes
+     * the cost of the result, only how long it takes to find.
+     *
+     * As this class is templated, it is header-only. To split up definition and
+     * implementation of functions has been moved to a `.tpp` file that is included at
+     * the end of this file.
+     *
+     * @tparam MAX_SIZE The largest number of rows and columns the solver can solve
+     */
+    template <size_t MAX_SIZE>
+    class AssignmentSolver
+    {
+       public:
+        // The cost of assigning each row (job) to each column (worker). Only the
+        // first num_rows rows and num_cols columns given to solve are used
+        using CostMatrix = std::array<std::array<double, MAX_SIZE>, MAX_SIZE>;
+        // The column (worker) assigned to each row (job)
+        using Assignment = std::array<size_t, MAX_SIZE>;
+
+        // The value in an Assignment for a row that has no column assigned
+        static constexpr size_t UNASSIGNED = MAX_SIZE;
+
+        /**
+         * Creates a new AssignmentSolver
+         */
+        AssignmentSolver();
+
+        /**
+         * Finds the assignment of rows to columns with the smallest total cost
+         *
+         * @param costs The cost of assigning each row to each column
+         * @param num_rows The number of rows in the problem
+         * @param num_cols The number of columns in the problem
+         *
+         * @throws std::invalid_argument if there are more rows than columns, or more
+         * columns than MAX_SIZE
+         *
+         * @return The column assigned to each row. The first num_rows entries are
+         * different columns, and the rest are UNASSIGNED. The result is only valid until
+         * the next call to solve
+         */
+        const Assignment& solve(const CostMatrix& costs, size_t num_rows,
+                                size_t num_cols);
+
+        /**
+         * Finds the assignment of rows to columns with the smallest total cost, starting
+         * from a previous assignment
+         *
+         * @param costs The cost of assigning each row to each column
+         * @param num_rows The number of rows in the problem
+         * @param num_cols The number of columns in the problem
+         * @param initial_assignment The column each row was assigned to the last time
+         * the problem was solved, or UNASSIGNED for rows that were not assigned. It does
+         * not have to be a valid assignment: out of range and repeated columns are
+         * ignored
+         *
+         * @throws std::invalid_argument if there are more rows than columns, or more
+         * columns than MAX_SIZE
+         *
+         * @return The column assigned to each row. The first num_rows entries are
+         * different columns, and the rest are UNASSIGNED. The result is only valid until
+         * the next call to solve
+         */
+        const Assignment& solve(const CostMatrix& costs, size_t num_rows, size_t num_cols,
+                                const Assignment& initial_assignment);
+
+        /**
+         * Returns how many rows of the last solve were kept from the initial assignment
+         * without being searched for
+         *
+         * @return how many rows of the last solve were kept from the initial assignment
+         */
+        size_t getNumWarmStartedRows() const;
+
+       private:
+        // Rows and columns are numbered from 1 in the arrays below, so that 0 can be
+        // used for the imaginary column every augmenting path starts from and for a
+        // column that has no row assigned
+        using RowArray    = std::array<double, MAX_SIZE + 1>;
+        using ColumnArray = std::array<double, MAX_SIZE + 1>;
+        using IndexArray  = std::array<size_t, MAX_SIZE + 1>;
+
+        // How much larger than its potentials the cost of a row and column can be
+        // while still being treated as a tight (optimal) pair when warm starting
+        static constexpr double TIGHTNESS_TOLERANCE = 1e-9;
+
+        /**
+         * Matches as many rows as possible to their column in the initial assignment
+         * while keeping the potentials feasible. Rows that are not matched are left for
+         * augmentPath
+         *
+         * @param costs The cost of assigning each row to each column
+         * @param num_rows The number of rows in the problem
+         * @param num_cols The number of columns in the problem
+         * @param initial_assignment The initial column of each row, or UNASSIGNED
+         */
+        void warmStart(const CostMatrix& costs, size_t num_rows, size_t num_cols,
+                       const Assignment& initial_assignment);
+
+        /**
+         * Sets the potential of every row to the smallest reduced cost in the row, so
+         * that every row and column pair is feasible
+         *
+         * @param costs The cost of assigning each row to each column
+         * @param num_rows The number of rows in the problem
+         * @param num_cols The number of columns in the problem
+         */
+        void updateRowPotentials(const CostMatrix& costs, size_t num_rows,
+                                 size_t num_cols);
+
+        /**
+         * Assigns an unassigned row to a column by finding the shortest augmenting path
+         * from it, and updates the potentials so that they stay feasible
+         *
+         * @param costs The cost of assigning each row to each column
+         * @param num_cols The number of columns in the problem
+         * @param row The row to assign, numbered from 1
+         */
+        void augmentPath(const CostMatrix& costs, size_t num_cols, size_t row);
+
+        RowArray row_potentials;
+        // The column potentials are kept between solves to warm start the next solve
+        ColumnArray column_potentials;
+
+        // The row assigned to each column, or 0 if the column is unassigned
+        IndexArray column_to_row;
+
+        // Scratch space for augmentPath: the column before each column on the
+        // shortest path, the shortest distance to each column, and whether each column
+        // has been visited
+        IndexArray previous_column;
+        ColumnArray min_slack;
+        std::array<bool, MAX_SIZE + 1> visited;
+
+        Assignment assignment;
+        size_t num_warm_started_rows;
+    };
+
+}  // namespace Util
+
+#include "util/assignment_solver.tpp"
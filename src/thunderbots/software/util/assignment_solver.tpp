@@ -0,0 +1,233 @@
+/**
+ * This file contains the implementation of the AssignmentSolver
+ *
+ * NOTE: We do not use `using namespace ...` here, because this is still a header file,
+ *       and as such anything that includes `assignment_solver.h` (which includes this
+ *       file), would get any namespaces we use here
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#include "util/assignment_solver.h"
+
+template <size_t MAX_SIZE>
+Util::AssignmentSolver<MAX_SIZE>::AssignmentSolver()
+    : row_potentials(),
+      column_potentials(),
+      column_to_row(),
+      previous_column(),
+      min_slack(),
+      visited(),
+      assignment(),
+      num_warm_started_rows(0)
+{
+    assignment.fill(UNASSIGNED);
+}
+
+template <size_t MAX_SIZE>
+const typename Util::AssignmentSolver<MAX_SIZE>::Assignment&
+Util::AssignmentSolver<MAX_SIZE>::solve(const CostMatrix& costs, size_t num_rows,
+                                        size_t num_cols)
+{
+    Assignment initial_assignment;
+    initial_assignment.fill(UNASSIGNED);
+    return solve(costs, num_rows, num_cols, initial_assignment);
+}
+
+template <size_t MAX_SIZE>
+const typename Util::AssignmentSolver<MAX_SIZE>::Assignment&
+Util::AssignmentSolver<MAX_SIZE>::solve(const CostMatrix& costs, size_t num_rows,
+                                        size_t num_cols,
+                                        const Assignment& initial_assignment)
+{
+    if (num_rows > num_cols || num_cols > MAX_SIZE)
+    {
+        throw std::invalid_argument(
+            "Error: An AssignmentSolver can only solve problems with at most as many "
+            "rows as columns, and at most MAX_SIZE columns");
+    }
+
+    warmStart(costs, num_rows, num_cols, initial_assignment);
+
+    // Every row that was not kept from the initial assignment is marked as unassigned
+    // here, so it can be found below
+    assignment.fill(UNASSIGNED);
+    for (size_t col = 1; col <= num_cols; col++)
+    {
+        if (column_to_row[col] != 0)
+        {
+            assignment[column_to_row[col] - 1] = col - 1;
+        }
+    }
+
+    for (size_t row = 1; row <= num_rows; row++)
+    {
+        if (assignment[row - 1] == UNASSIGNED)
+        {
+            augmentPath(costs, num_cols, row);
+        }
+    }
+
+    for (size_t col = 1; col <= num_cols; col++)
+    {
+        if (column_to_row[col] != 0)
+        {
+            assignment[column_to_row[col] - 1] = col - 1;
+        }
+    }
+
+    return assignment;
+}
+
+template <size_t MAX_SIZE>
+size_t Util::AssignmentSolver<MAX_SIZE>::getNumWarmStartedRows() const
+{
+    return num_warm_started_rows;
+}
+
+template <size_t MAX_SIZE>
+void Util::AssignmentSolver<MAX_SIZE>::warmStart(const CostMatrix& costs, size_t num_rows,
+                                                 size_t num_cols,
+                                                 const Assignment& initial_assignment)
+{
+    // Each column can only be kept by the first row that was assigned to it
+    column_to_row.fill(0);
+    for (size_t row = 1; row <= num_rows; row++)
+    {
+        size_t col = initial_assignment[row - 1];
+        if (col < num_cols && column_to_row[col + 1] == 0)
+        {
+            column_to_row[col + 1] = row;
+        }
+    }
+
+    // The potentials are only optimal if every column that ends up unassigned has a
+    // potential of 0. Columns can only become assigned while solving, never
+    // unassigned, so only the columns that are kept can start with the potentials from
+    // the last solve
+    for (size_t col = 1; col <= num_cols; col++)
+    {
+        if (column_to_row[col] == 0)
+        {
+            column_potentials[col] = 0;
+        }
+    }
+
+    // A row can only be kept if its column is still one of the cheapest for it under
+    // the current potentials. Dropping a column resets its potential, which can make
+    // other rows lose their columns, so this is repeated until nothing changes. At
+    // least one column is dropped every time, so this runs at most num_rows times
+    bool dropped_column = true;
+    while (dropped_column)
+    {
+        dropped_column = false;
+        updateRowPotentials(costs, num_rows, num_cols);
+
+        for (size_t col = 1; col <= num_cols; col++)
+        {
+            size_t row = column_to_row[col];
+            if (row != 0 &&
+                costs[row - 1][col - 1] - row_potentials[row] - column_potentials[col] >
+                    TIGHTNESS_TOLERANCE)
+            {
+                column_to_row[col]     = 0;
+                column_potentials[col] = 0;
+                dropped_column         = true;
+            }
+        }
+    }
+
+    num_warm_started_rows = 0;
+    for (size_t col = 1; col <= num_cols; col++)
+    {
+        if (column_to_row[col] != 0)
+        {
+            num_warm_started_rows++;
+        }
+    }
+}
+
+template <size_t MAX_SIZE>
+void Util::AssignmentSolver<MAX_SIZE>::updateRowPotentials(const CostMatrix& costs,
+                                                           size_t num_rows,
+                                                           size_t num_cols)
+{
+    for (size_t row = 1; row <= num_rows; row++)
+    {
+        double min_reduced_cost = std::numeric_limits<double>::infinity();
+        for (size_t col = 1; col <= num_cols; col++)
+        {
+            min_reduced_cost = std::min(min_reduced_cost,
+                                        costs[row - 1][col - 1] - column_potentials[col]);
+        }
+        row_potentials[row] = min_reduced_cost;
+    }
+}
+
+template <size_t MAX_SIZE>
+void Util::AssignmentSolver<MAX_SIZE>::augmentPath(const CostMatrix& costs,
+                                                   size_t num_cols, size_t row)
+{
+    // Every path starts from the imaginary column 0, which is assigned to the row we
+    // are looking for a column for
+    column_to_row[0] = row;
+    min_slack.fill(std::numeric_limits<double>::infinity());
+    visited.fill(false);
+
+    size_t current_col = 0;
+    do
+    {
+        visited[current_col] = true;
+        size_t current_row   = column_to_row[current_col];
+        double delta         = std::numeric_limits<double>::infinity();
+        size_t next_col      = 0;
+
+        for (size_t col = 1; col <= num_cols; col++)
+        {
+            if (visited[col])
+            {
+                continue;
+            }
+
+            double reduced_cost = costs[current_row - 1][col - 1] -
+                                  row_potentials[current_row] - column_potentials[col];
+            if (reduced_cost < min_slack[col])
+            {
+                min_slack[col]       = reduced_cost;
+                previous_column[col] = current_col;
+            }
+            if (min_slack[col] < delta)
+            {
+                delta    = min_slack[col];
+                next_col = col;
+            }
+        }
+
+        for (size_t col = 0; col <= num_cols; col++)
+        {
+            if (visited[col])
+            {
+                row_potentials[column_to_row[col]] += delta;
+                column_potentials[col] -= delta;
+            }
+            else
+            {
+                min_slack[col] -= delta;
+            }
+        }
+
+        current_col = next_col;
+    } while (column_to_row[current_col] != 0);
+
+    // Flip the assignments along the path, which ends at the unassigned column we found
+    do
+    {
+        size_t col                 = previous_column[current_col];
+        column_to_row[current_col] = column_to_row[col];
+        current_col                = col;
+    } while (current_col != 0);
+}
@@ -16,10 +16,17 @@ namespace Util
         static const std::string NETWORK_INPUT_ENEMY_TEAM_TOPIC = "backend/enemy_team";
         static const std::string NETWORK_INPUT_GAMECONTROLLER_TOPIC =
             "backend/gamecontroller";
-        static const std::string NETWORK_INPUT_WORLD_TOPIC   = "backend/world";
-        static const std::string AI_PRIMITIVES_TOPIC         = "backend/primitives";
-        static const std::string ROBOT_STATUS_TOPIC          = "log/robot_status";
-        static const std::string VISUALIZER_DRAW_LAYER_TOPIC = "visualizer/layers";
+        static const std::string NETWORK_INPUT_WORLD_TOPIC       = "backend/world";
+        static const std::string NETWORK_INPUT_WORLD_DELTA_TOPIC = "backend/world_delta";
+        // Every WorldDelta is needed to rebuild the World, so subscribers queue this
+        // many of them rather than only keeping the latest one
+        static const uint32_t NETWORK_INPUT_WORLD_DELTA_QUEUE_SIZE = 100;
+        static const std::string AI_PRIMITIVES_TOPIC               = "backend/primitives";
+        static const std::string ROBOT_STATUS_TOPIC                = "log/robot_status";
+        static const std::string VISUALIZER_DRAW_LAYER_TOPIC       = "visualizer/layers";
+        static const std::string LATENCY_DIAGNOSTICS_TOPIC = "diagnostics/latency";
+        static const std::string NETWORK_INPUT_QUEUE_STATUS_TOPIC =
+            "diagnostics/network_input_queues";
         // The topic published by the joy_node that contains information about any plugged
         // in joysticks / controllers
         static const std::string JOY_NODE_TOPIC = "joy";
@@ -35,6 +42,9 @@ namespace Util
         // TODO: BETTER NAMES
         static const std::string GRSIM_COMMAND_NETWORK_ADDRESS = "127.0.0.1";
         static const short GRSIM_COMMAND_NETWORK_PORT          = 20011;
+        // How many times per second the motion controller is run and commands are sent
+        // to grSim, regardless of how often the AI publishes Primitives
+        static const double GRSIM_COMMAND_RATE_HZ = 200;
 
         // Refbox address
         static const std::string SSL_GAMECONTROLLER_MULTICAST_ADDRESS = "224.5.23.1";
@@ -46,6 +56,9 @@ namespace Util
         // Visualizer messenger message publishing frequency
         static const unsigned int DESIRED_VISUALIZER_MESSAGE_FREQ = 60;
 
+        // How often each node publishes and logs a summary of the latencies it measured
+        static const unsigned int LATENCY_REPORT_PERIOD_SECONDS = 5;
+
         // How many milliseconds a robot must not be seen in vision before it is
         // considered as "gone" and no longer reported.
         static const unsigned int ROBOT_DEBOUNCE_DURATION_MILLISECONDS = 200;
@@ -0,0 +1,149 @@
+#include "util/event_loop/epoll_event_loop.h"
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace Util
+{
+    EpollEventLoop::EpollEventLoop()
+        : epoll_fd(epoll_create1(EPOLL_CLOEXEC)),
+          wake_up_fd(eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK)),
+          fd_handlers(),
+          posted_tasks(),
+          running_tasks()
+    {
+        epoll_event event = {};
+        event.events      = EPOLLIN;
+        event.data.fd     = wake_up_fd;
+        if (epoll_fd < 0 || wake_up_fd < 0 ||
+            epoll_ctl(epoll_fd, EPOLL_CTL_ADD, wake_up_fd, &event) != 0)
+        {
+            std::string error = std::strerror(errno);
+            close(epoll_fd);
+            close(wake_up_fd);
+            throw std::runtime_error("Error: Failed to create an EpollEventLoop: " +
+                                     error);
+        }
+    }
+
+    EpollEventLoop::~EpollEventLoop()
+    {
+        close(wake_up_fd);
+        close(epoll_fd);
+    }
+
+    void EpollEventLoop::addFd(int fd, uint32_t events, std::function<void()> handler)
+    {
+        epoll_event event = {};
+        event.events      = events;
+        event.data.fd     = fd;
+        if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event) != 0)
+        {
+            throw std::runtime_error("Error: Failed to watch file descriptor " +
+                                     std::to_string(fd) + ": " + std::strerror(errno));
+        }
+        fd_handlers[fd] = handler;
+    }
+
+    void EpollEventLoop::removeFd(int fd)
+    {
+        if (fd_handlers.erase(fd) > 0)
+        {
+            // The file descriptor may already have been closed, which removes it from
+            // the epoll instance anyway, so any error is ignored
+            epoll_ctl(epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+        }
+    }
+
+    void EpollEventLoop::post(std::function<void()> task)
+    {
+        {
+            std::lock_guard<std::mutex> task_lock(task_mutex);
+            posted_tasks.emplace_back(std::move(task));
+        }
+        wakeUp();
+    }
+
+    void EpollEventLoop::wakeUp()
+    {
+        uint64_t one = 1;
+        // This can only fail if the counter would overflow, in which case the loop is
+        // already going to wake up
+        ssize_t num_bytes_written = write(wake_up_fd, &one, sizeof(one));
+        (void)num_bytes_written;
+    }
+
+    bool EpollEventLoop::runOnce(const Duration& timeout)
+    {
+        double timeout_milliseconds =
+            std::clamp(std::ceil(timeout.getMilliseconds()), 0.0,
+                       static_cast<double>(std::numeric_limits<int>::max()));
+
+        std::array<epoll_event, MAX_EVENTS_PER_WAIT> events;
+        int num_events = epoll_wait(epoll_fd, events.data(), MAX_EVENTS_PER_WAIT,
+                                    static_cast<int>(timeout_milliseconds));
+        // A signal interrupting the wait is treated like the loop being woken up, so
+        // that the caller gets a chance to check if it should stop
+        if (num_events < 0)
+        {
+            return errno == EINTR;
+        }
+
+        for (int i = 0; i < num_events; i++)
+        {
+            int fd = events[i].data.fd;
+            if (fd == wake_up_fd)
+            {
+                uint64_t count;
+                ssize_t num_bytes_read = read(wake_up_fd, &count, sizeof(count));
+                (void)num_bytes_read;
+                continue;
+            }
+
+            // An earlier handler may have stopped watching this file descriptor. The
+            // handler is copied since it may stop watching its own file descriptor
+            auto iter = fd_handlers.find(fd);
+            if (iter != fd_handlers.end())
+            {
+                std::function<void()> handler = iter->second;
+                handler();
+            }
+        }
+
+        bool ran_tasks = runPostedTasks();
+
+        return num_events > 0 || ran_tasks;
+    }
+
+    size_t EpollEventLoop::getNumFds() const
+    {
+        return fd_handlers.size();
+    }
+
+    bool EpollEventLoop::runPostedTasks()
+    {
+        {
+            std::lock_guard<std::mutex> task_lock(task_mutex);
+            std::swap(running_tasks, posted_tasks);
+        }
+
+        for (const std::function<void()>& task : running_tasks)
+        {
+            task();
+        }
+
+        bool ran_tasks = !running_tasks.empty();
+        running_tasks.clear();
+        return ran_tasks;
+    }
+}  // namespace Util
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "util/time/duration.h"
+
+namespace Util
+{
+    /**
+     * A single threaded event loop that sleeps in epoll until one of the file
+     * descriptors it watches is ready, or another thread gives it work to do, so a node
+     * that waits on both doesn't have to poll either in a busy loop.
+     *
+     * The loop is run by calling runOnce from the thread that owns it. Every other
+     * function except post and wakeUp must also be called from that thread (including
+     * from the handlers and tasks the loop runs). post and wakeUp can be called from
+     * any thread.
+     */
+    class EpollEventLoop
+    {
+       public:
+        /**
+         * Creates a new EpollEventLoop that isn't watching any file descriptors
+         *
+         * @throws std::runtime_error if the epoll instance or the eventfd used to wake
+         * up the loop can't be created
+         */
+        explicit EpollEventLoop();
+
+        ~EpollEventLoop();
+
+        EpollEventLoop& operator=(const EpollEventLoop&) = delete;
+        EpollEventLoop(const EpollEventLoop&)            = delete;
+
+        /**
+         * Starts watching a file descriptor. The handler is called from runOnce
+         * whenever any of the given events are ready. Events are level triggered, so
+         * the handler is called again on the next runOnce if it doesn't handle all of
+         * them
+         *
+         * @param fd The file descriptor to watch
+         * @param events The epoll events to watch for, such as EPOLLIN
+         * @param handler The function to call when the events are ready
+         *
+         * @throws std::runtime_error if the file descriptor can't be watched, for
+         * example because it is already being watched
+         */
+        void addFd(int fd, uint32_t events, std::function<void()> handler);
+
+        /**
+         * Stops watching a file descriptor. This does nothing if the file descriptor
+         * isn't being watched
+         *
+         * @param fd The file descriptor to stop watching
+         */
+        void removeFd(int fd);
+
+        /**
+         * Queues a task to be run on the thread of the loop, and wakes the loop up if
+         * it is sleeping. Tasks are run in the order they are posted. This can be
+         * called from any thread
+         *
+         * @param task The task to run
+         */
+        void post(std::function<void()> task);
+
+        /**
+         * Wakes the loop up if it is sleeping, or makes the next runOnce return right
+         * away if it isn't, without giving it any work. This can be called from any
+         * thread
+         */
+        void wakeUp();
+
+        /**
+         * Sleeps until any watched file descriptor is ready, a task is posted, wakeUp
+         * is called or the timeout passes, then calls the handlers of the ready file
+         * descriptors and runs the posted tasks
+         *
+         * @param timeout The longest time to sleep for. It is rounded up to a whole
+         * number of milliseconds, so the loop never wakes up before it has passed.
+         * A timeout of 0 doesn't sleep at all
+         *
+         * @return true if any handler or task was run, or the loop was woken up, and
+         * false if the timeout passed
+         */
+        bool runOnce(const Duration& timeout);
+
+        /**
+         * Returns the number of file descriptors being watched
+         *
+         * @return the number of file descriptors being watched
+         */
+        size_t getNumFds() const;
+
+       private:
+        // The most events handled in a single runOnce. Any others are handled on the
+        // next call, since all events are level triggered
+        static constexpr int MAX_EVENTS_PER_WAIT = 32;
+
+        /**
+         * Runs every task that has been posted so far
+         *
+         * @return true if any task was run, and false otherwise
+         */
+        bool runPostedTasks();
+
+        int epoll_fd;
+        // Written to by post and wakeUp to wake up the loop
+        int wake_up_fd;
+
+        std::unordered_map<int, std::function<void()>> fd_handlers;
+
+        // The tasks waiting to be run. Protected by the task_mutex
+        std::mutex task_mutex;
+        std::vector<std::function<void()>> posted_tasks;
+        // The tasks being run. Only used by the thread of the loop, and kept as a
+        // member so its memory is reused
+        std::vector<std::function<void()>> running_tasks;
+    };
+}  // namespace Util
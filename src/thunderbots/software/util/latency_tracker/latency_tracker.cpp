@@ -0,0 +1,109 @@
+#include "util/latency_tracker/latency_tracker.h"
+
+#include <iomanip>
+#include <sstream>
+
+#include "thunderbots_msgs/LatencyReport.h"
+#include "util/constants.h"
+#include "util/logger/init.h"
+
+namespace Util
+{
+    LatencyTracker::LatencyTracker(std::string node_name)
+        : node_name(node_name), time_last_reported(std::chrono::steady_clock::now())
+    {
+    }
+
+    void LatencyTracker::initializePublisher(ros::NodeHandle node_handle)
+    {
+        publisher = node_handle.advertise<thunderbots_msgs::LatencyReport>(
+            Util::Constants::LATENCY_DIAGNOSTICS_TOPIC, 8);
+    }
+
+    void LatencyTracker::recordStageLatency(const std::string& stage_name,
+                                            double start_timestamp, double end_timestamp)
+    {
+        if (start_timestamp == 0.0)
+        {
+            return;
+        }
+
+        stage_latencies[stage_name].record(
+            Duration::fromSeconds(end_timestamp - start_timestamp));
+    }
+
+    void LatencyTracker::recordStageDuration(const std::string& stage_name,
+                                             const Duration& duration)
+    {
+        stage_latencies[stage_name].record(duration);
+    }
+
+    void LatencyTracker::recordPrimitivesSent(const thunderbots_msgs::FrameTrace& trace,
+                                              double receive_timestamp,
+                                              double send_timestamp)
+    {
+        recordStageLatency("primitives_transport", trace.primitives_publish_timestamp,
+                           receive_timestamp);
+        recordStageLatency("primitives_send", receive_timestamp, send_timestamp);
+        recordStageLatency("vision_to_command", trace.receive_timestamp, send_timestamp);
+    }
+
+    void LatencyTracker::publishAndLogIfReportDue()
+    {
+        auto now = std::chrono::steady_clock::now();
+        if (now - time_last_reported <
+            std::chrono::seconds(Util::Constants::LATENCY_REPORT_PERIOD_SECONDS))
+        {
+            return;
+        }
+        time_last_reported = now;
+
+        thunderbots_msgs::LatencyReport report;
+        report.node_name = node_name;
+
+        std::stringstream summary;
+        summary << std::fixed << std::setprecision(3) << "Latency summary for "
+                << node_name << " (p50 / p99 / max in ms):";
+
+        for (auto& [stage_name, latencies] : stage_latencies)
+        {
+            if (latencies.getNumberOfSamples() == 0)
+            {
+                continue;
+            }
+
+            thunderbots_msgs::StageLatency stage_msg;
+            stage_msg.stage_name       = stage_name;
+            stage_msg.num_samples      = latencies.getNumberOfSamples();
+            stage_msg.p50_milliseconds = latencies.getPercentile(0.5).getMilliseconds();
+            stage_msg.p99_milliseconds = latencies.getPercentile(0.99).getMilliseconds();
+            stage_msg.max_milliseconds = latencies.getMaximum().getMilliseconds();
+            report.stages.emplace_back(stage_msg);
+
+            summary << std::endl
+                    << "    " << stage_name << ": " << stage_msg.p50_milliseconds << " / "
+                    << stage_msg.p99_milliseconds << " / " << stage_msg.max_milliseconds
+                    << " (" << stage_msg.num_samples << " samples)";
+
+            latencies.reset();
+        }
+
+        if (report.stages.empty())
+        {
+            return;
+        }
+
+        if (publisher)
+        {
+            publisher.publish(report);
+        }
+        LOG(INFO) << summary.str() << std::endl;
+    }
+
+    double LatencyTracker::getCurrentTimestamp()
+    {
+        return std::chrono::duration<double>(
+                   std::chrono::system_clock::now().time_since_epoch())
+            .count();
+    }
+}  // namespace Util
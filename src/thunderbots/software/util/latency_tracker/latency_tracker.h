@@ -0,0 +1,98 @@
+#pragma once
+
+#include <ros/ros.h>
+
+#include <chrono>
+#include <map>
+#include <string>
+
+#include "thunderbots_msgs/FrameTrace.h"
+#include "util/time/latency_histogram.h"
+
+namespace Util
+{
+    /**
+     * Measures how long each stage of the pipeline between receiving data from the
+     * network and sending commands to the robots takes. Each node records the latency of
+     * the stages it can see (using the timestamps carried in the FrameTrace of the
+     * messages it receives), and the tracker periodically publishes the p50, p99 and
+     * maximum latency of every stage as a LatencyReport and logs a summary.
+     *
+     * All timestamps are wall clock times in seconds since the unix epoch, so that
+     * timestamps taken by different nodes can be compared.
+     */
+    class LatencyTracker
+    {
+       public:
+        /**
+         * Creates a new LatencyTracker
+         *
+         * @param node_name The name of the node this tracker measures, used to identify
+         * the reports it publishes
+         */
+        explicit LatencyTracker(std::string node_name);
+
+        /**
+         * Initializes the publisher used to send latency reports
+         *
+         * @param node_handle The NodeHandle to create the publisher with
+         */
+        void initializePublisher(ros::NodeHandle node_handle);
+
+        /**
+         * Records the latency of a stage that started and ended at the given times. If
+         * the start time is 0 the stage did not happen (for example a World created from
+         * a GameController packet has no AI timestamps yet) and nothing is recorded
+         *
+         * @param stage_name The name of the stage
+         * @param start_timestamp When the stage started
+         * @param end_timestamp When the stage ended
+         */
+        void recordStageLatency(const std::string& stage_name, double start_timestamp,
+                                double end_timestamp);
+
+        /**
+         * Records the latency of a stage that took the given amount of time
+         *
+         * @param stage_name The name of the stage
+         * @param duration How long the stage took
+         */
+        void recordStageDuration(const std::string& stage_name, const Duration& duration);
+
+        /**
+         * Records the latency of every stage between the AI publishing Primitives and
+         * the Primitives being sent to the robots, as well as the end-to-end latency
+         * from the vision packet being received to the Primitives being sent
+         *
+         * @param trace The trace of the frame the Primitives were created from
+         * @param receive_timestamp When the Primitives were received by this node
+         * @param send_timestamp When the Primitives were sent to the robots
+         */
+        void recordPrimitivesSent(const thunderbots_msgs::FrameTrace& trace,
+                                  double receive_timestamp, double send_timestamp);
+
+        /**
+         * Publishes and logs a summary of the latencies recorded since the last report,
+         * if a full reporting period has passed since then. The recorded latencies are
+         * cleared after every report
+         */
+        void publishAndLogIfReportDue();
+
+        /**
+         * Returns the current wall clock time, to be used as the timestamp of a stage
+         *
+         * @return the current wall clock time, in seconds since the unix epoch
+         */
+        static double getCurrentTimestamp();
+
+       private:
+        std::string node_name;
+        ros::Publisher publisher;
+
+        // The latencies recorded for each stage since the last report
+        std::map<std::string, LatencyHistogram> stage_latencies;
+
+        // When the last report was published
+        std::chrono::steady_clock::time_point time_last_reported;
+    };
+}  // namespace Util
@@ -0,0 +1,233 @@
+#include "util/shared_memory/shared_world_ring.h"
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <climits>
+#include <cstring>
+#include <ctime>
+#include <stdexcept>
+
+namespace Util
+{
+    namespace
+    {
+        // The futex system call has no glibc wrapper. We deliberately use the shared
+        // (not FUTEX_PRIVATE) operations, since the waiters are in other processes
+        uint32_t* getFutexAddress(std::atomic<uint32_t>& word)
+        {
+            return reinterpret_cast<uint32_t*>(&word);
+        }
+
+        void futexWake(std::atomic<uint32_t>& word)
+        {
+            syscall(SYS_futex, getFutexAddress(word), FUTEX_WAKE, INT_MAX, nullptr,
+                    nullptr, 0);
+        }
+
+        void futexWait(std::atomic<uint32_t>& word, uint32_t expected_value,
+                       std::chrono::milliseconds timeout)
+        {
+            timespec timeout_spec;
+            timeout_spec.tv_sec  = timeout.count() / 1000;
+            timeout_spec.tv_nsec = (timeout.count() % 1000) * 1000000;
+            syscall(SYS_futex, getFutexAddress(word), FUTEX_WAIT, expected_value,
+                    &timeout_spec, nullptr, 0);
+        }
+
+        SharedWorldRing::Layout* mapSegment(int file_descriptor,
+                                            const std::string& segment_name)
+        {
+            void* address = mmap(nullptr, sizeof(SharedWorldRing::Layout),
+                                 PROT_READ | PROT_WRITE, MAP_SHARED, file_descriptor, 0);
+            if (address == MAP_FAILED)
+            {
+                close(file_descriptor);
+                throw std::runtime_error("Failed to map the shared memory segment " +
+                                         segment_name + ": " + std::strerror(errno));
+            }
+
+            return static_cast<SharedWorldRing::Layout*>(address);
+        }
+    }  // namespace
+
+    SharedWorldRingWriter::SharedWorldRingWriter(const std::string& segment_name)
+    {
+        file_descriptor = shm_open(segment_name.c_str(), O_RDWR | O_CREAT, 0666);
+        if (file_descriptor < 0)
+        {
+            throw std::runtime_error("Failed to open the shared memory segment " +
+                                     segment_name + ": " + std::strerror(errno));
+        }
+
+        if (ftruncate(file_descriptor, sizeof(SharedWorldRing::Layout)) != 0)
+        {
+            close(file_descriptor);
+            throw std::runtime_error("Failed to resize the shared memory segment " +
+                                     segment_name + ": " + std::strerror(errno));
+        }
+
+        layout = mapSegment(file_descriptor, segment_name);
+
+        // If the segment was left behind by a previous writer with the same layout we
+        // keep counting frames from where it left off, so that readers that are still
+        // attached to it see the new frames as new
+        if (layout->magic != SharedWorldRing::MAGIC ||
+            layout->version != SharedWorldRing::VERSION ||
+            layout->world_frame_size != sizeof(WorldFrame))
+        {
+            layout->magic = 0;
+            std::atomic_thread_fence(std::memory_order_release);
+
+            layout->latest_frame_number.store(0, std::memory_order_relaxed);
+            layout->num_waiting_readers.store(0, std::memory_order_relaxed);
+            for (SharedWorldRing::Slot& slot : layout->slots)
+            {
+                slot.sequence.store(0, std::memory_order_relaxed);
+                std::memset(&slot.world_frame, 0, sizeof(WorldFrame));
+            }
+            layout->version          = SharedWorldRing::VERSION;
+            layout->world_frame_size = sizeof(WorldFrame);
+
+            // The magic is written last, so a reader never sees a segment that is only
+            // half initialized as valid
+            std::atomic_thread_fence(std::memory_order_release);
+            layout->magic = SharedWorldRing::MAGIC;
+        }
+    }
+
+    SharedWorldRingWriter::~SharedWorldRingWriter()
+    {
+        munmap(layout, sizeof(SharedWorldRing::Layout));
+        close(file_descriptor);
+    }
+
+    void SharedWorldRingWriter::write(const WorldFrame& world_frame)
+    {
+        uint32_t frame_number =
+            layout->latest_frame_number.load(std::memory_order_relaxed) + 1;
+        SharedWorldRing::Slot& slot =
+            layout->slots[frame_number % SharedWorldRing::NUM_SLOTS];
+
+        // Make the sequence number odd while we write, so that readers know to retry if
+        // they read the slot at the same time
+        uint32_t sequence = slot.sequence.load(std::memory_order_relaxed);
+        slot.sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        std::memcpy(&slot.world_frame, &world_frame, sizeof(WorldFrame));
+
+        slot.sequence.store(sequence + 2, std::memory_order_release);
+
+        // Publishing the frame number and checking for waiting readers must not be
+        // reordered, otherwise a reader could start waiting just after we checked and
+        // miss this frame
+        layout->latest_frame_number.store(frame_number, std::memory_order_seq_cst);
+        if (layout->num_waiting_readers.load(std::memory_order_seq_cst) > 0)
+        {
+            futexWake(layout->latest_frame_number);
+        }
+    }
+
+    SharedWorldRingReader::SharedWorldRingReader(const std::string& segment_name)
+    {
+        // The reader also needs write access, since waiting readers are counted in the
+        // segment
+        file_descriptor = shm_open(segment_name.c_str(), O_RDWR, 0);
+        if (file_descriptor < 0)
+        {
+            throw std::runtime_error("Failed to open the shared memory segment " +
+                                     segment_name + ": " + std::strerror(errno));
+        }
+
+        struct stat segment_stat;
+        if (fstat(file_descriptor, &segment_stat) != 0 ||
+            static_cast<size_t>(segment_stat.st_size) < sizeof(SharedWorldRing::Layout))
+        {
+            close(file_descriptor);
+            throw std::runtime_error("The shared memory segment " + segment_name +
+                                     " is not a SharedWorldRing");
+        }
+
+        layout = mapSegment(file_descriptor, segment_name);
+
+        bool is_valid = layout->magic == SharedWorldRing::MAGIC;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (!is_valid || layout->version != SharedWorldRing::VERSION ||
+            layout->world_frame_size != sizeof(WorldFrame))
+        {
+            munmap(layout, sizeof(SharedWorldRing::Layout));
+            close(file_descriptor);
+            throw std::runtime_error(
+                "The shared memory segment " + segment_name +
+                " was not created by a compatible SharedWorldRingWriter");
+        }
+
+        // Only frames written after the reader is created are new. Any frame already in
+        // the ring may have been left there by a writer that is no longer running
+        last_read_frame_number =
+            layout->latest_frame_number.load(std::memory_order_acquire);
+    }
+
+    SharedWorldRingReader::~SharedWorldRingReader()
+    {
+        munmap(layout, sizeof(SharedWorldRing::Layout));
+        close(file_descriptor);
+    }
+
+    bool SharedWorldRingReader::readLatest(WorldFrame& world_frame)
+    {
+        uint32_t frame_number =
+            layout->latest_frame_number.load(std::memory_order_acquire);
+        if (frame_number == last_read_frame_number)
+        {
+            return false;
+        }
+
+        while (true)
+        {
+            const SharedWorldRing::Slot& slot =
+                layout->slots[frame_number % SharedWorldRing::NUM_SLOTS];
+
+            uint32_t sequence_before = slot.sequence.load(std::memory_order_acquire);
+            if (sequence_before % 2 == 0)
+            {
+                std::memcpy(&world_frame, &slot.world_frame, sizeof(WorldFrame));
+                std::atomic_thread_fence(std::memory_order_acquire);
+
+                uint32_t sequence_after = slot.sequence.load(std::memory_order_relaxed);
+                if (sequence_before == sequence_after)
+                {
+                    last_read_frame_number = frame_number;
+                    return true;
+                }
+            }
+
+            // The writer has wrapped around the ring and is writing to this slot, so
+            // there is a newer frame to read instead
+            frame_number = layout->latest_frame_number.load(std::memory_order_acquire);
+        }
+    }
+
+    bool SharedWorldRingReader::waitForNewFrame(std::chrono::milliseconds timeout)
+    {
+        if (layout->latest_frame_number.load(std::memory_order_acquire) !=
+            last_read_frame_number)
+        {
+            return true;
+        }
+
+        layout->num_waiting_readers.fetch_add(1, std::memory_order_seq_cst);
+        // The futex only sleeps if the frame number is still the one we last read, so
+        // a frame written after the check above is never missed
+        futexWait(layout->latest_frame_number, last_read_frame_number, timeout);
+        layout->num_waiting_readers.fetch_sub(1, std::memory_order_seq_cst);
+
+        return layout->latest_frame_number.load(std::memory_order_acquire) !=
+               last_read_frame_number;
+    }
+}  // namespace Util
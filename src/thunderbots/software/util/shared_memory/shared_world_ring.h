@@ -0,0 +1,165 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "util/shared_memory/world_frame.h"
+
+namespace Util
+{
+    /**
+     * A SharedWorldRing passes WorldFrames from one writer process to any number of
+     * reader processes on the same machine through a POSIX shared memory segment (which
+     * lives in /dev/shm), so that readers can use the World without it being
+     * serialized, sent over a socket and deserialized.
+     *
+     * The segment holds a small ring of slots, each protected by a seqlock. The writer
+     * fills the slot after the latest one in place and then publishes it as the latest
+     * frame, so it never waits for readers. A reader copies the latest slot and checks
+     * that its sequence number did not change while it was copying; if the writer wrote
+     * to the slot in the meantime the copy is thrown away and retried. Since the writer
+     * has to go all the way around the ring before it writes to the latest slot again,
+     * retries are very rare.
+     *
+     * Readers only care about the latest frame, so a reader that falls behind skips
+     * frames rather than reading them all.
+     */
+    namespace SharedWorldRing
+    {
+        // The name of the shared memory segment used to share the World from
+        // network_input
+        static const std::string NETWORK_INPUT_WORLD_SEGMENT = "/thunderbots_world";
+
+        // Identifies a shared memory segment as a SharedWorldRing
+        static constexpr uint64_t MAGIC = 0x54424f54574f524cULL;
+        // The version of the layout of the segment. This must be changed whenever the
+        // Layout or WorldFrame changes
+        static constexpr uint32_t VERSION = 1;
+        // The number of slots in the ring
+        static constexpr size_t NUM_SLOTS = 4;
+
+        struct Slot
+        {
+            // Odd while the writer is writing to this slot
+            alignas(64) std::atomic<uint32_t> sequence;
+            WorldFrame world_frame;
+        };
+
+        // The layout of the shared memory segment
+        struct Layout
+        {
+            uint64_t magic;
+            uint32_t version;
+            uint32_t world_frame_size;
+            // The number of frames written so far. The latest frame is in the slot at
+            // this number modulo NUM_SLOTS. Readers can wait on this with a futex
+            alignas(64) std::atomic<uint32_t> latest_frame_number;
+            // How many readers are waiting for a new frame, so that the writer can skip
+            // waking them up if nobody is waiting
+            std::atomic<uint32_t> num_waiting_readers;
+            Slot slots[NUM_SLOTS];
+        };
+
+        static_assert(std::atomic<uint32_t>::is_always_lock_free,
+                      "The atomics in a SharedWorldRing must be lock-free so that they "
+                      "work between processes");
+    }  // namespace SharedWorldRing
+
+    /**
+     * Writes WorldFrames to a SharedWorldRing. There must only be one writer for each
+     * shared memory segment.
+     */
+    class SharedWorldRingWriter
+    {
+       public:
+        /**
+         * Creates the shared memory segment with the given name if it does not exist,
+         * and maps it for writing. If the segment exists but was created with a
+         * different layout it is reset
+         *
+         * @param segment_name The name of the shared memory segment. This must start
+         * with a '/'
+         * @throws std::runtime_error if the segment could not be created or mapped
+         */
+        explicit SharedWorldRingWriter(const std::string& segment_name);
+
+        /**
+         * Unmaps the shared memory segment. The segment itself is left in place so
+         * that readers can keep using it, and so it can be reused if the writer is
+         * restarted
+         */
+        ~SharedWorldRingWriter();
+
+        SharedWorldRingWriter& operator=(const SharedWorldRingWriter&) = delete;
+        SharedWorldRingWriter(const SharedWorldRingWriter&)            = delete;
+
+        /**
+         * Writes a WorldFrame to the ring and makes it the latest frame, waking up any
+         * readers that are waiting for it
+         *
+         * @param world_frame The WorldFrame to write
+         */
+        void write(const WorldFrame& world_frame);
+
+       private:
+        int file_descriptor;
+        SharedWorldRing::Layout* layout;
+    };
+
+    /**
+     * Reads the latest WorldFrame from a SharedWorldRing. Any number of readers can
+     * read from the same shared memory segment, but each reader must only be used by
+     * one thread.
+     */
+    class SharedWorldRingReader
+    {
+       public:
+        /**
+         * Maps the existing shared memory segment with the given name for reading
+         *
+         * @param segment_name The name of the shared memory segment. This must start
+         * with a '/'
+         * @throws std::runtime_error if the segment does not exist yet, could not be
+         * mapped, or was created with a different layout
+         */
+        explicit SharedWorldRingReader(const std::string& segment_name);
+
+        /**
+         * Unmaps the shared memory segment
+         */
+        ~SharedWorldRingReader();
+
+        SharedWorldRingReader& operator=(const SharedWorldRingReader&) = delete;
+        SharedWorldRingReader(const SharedWorldRingReader&)            = delete;
+
+        /**
+         * Copies the latest WorldFrame, if it has not already been read by this reader
+         *
+         * @param world_frame The WorldFrame to copy the latest frame into. This is not
+         * changed if there is no new frame
+         *
+         * @return true if a new frame was copied, and false otherwise
+         */
+        bool readLatest(WorldFrame& world_frame);
+
+        /**
+         * Sleeps until there is a frame this reader has not read yet, or until the
+         * timeout passes. Returns immediately if there is already a new frame
+         *
+         * @param timeout The longest time to wait for
+         *
+         * @return true if there is a new frame to read, and false if the timeout passed
+         * first
+         */
+        bool waitForNewFrame(std::chrono::milliseconds timeout);
+
+       private:
+        int file_descriptor;
+        SharedWorldRing::Layout* layout;
+        // The number of the last frame this reader read
+        uint32_t last_read_frame_number;
+    };
+}  // namespace Util
@@ -0,0 +1,108 @@
+#include "util/shared_memory/shared_world_subscriber.h"
+
+#include <stdexcept>
+
+#include "util/logger/init.h"
+
+namespace Util
+{
+    SharedWorldSubscriber::SharedWorldSubscriber(
+        std::string segment_name,
+        std::function<void(const World&, const thunderbots_msgs::FrameTrace&)>
+            handle_function)
+        : segment_name(segment_name),
+          handle_function(handle_function),
+          reader(),
+          time_of_last_open_attempt(),
+          world_frame(),
+          time_last_received(NEVER_RECEIVED),
+          is_running(false)
+    {
+    }
+
+    SharedWorldSubscriber::~SharedWorldSubscriber()
+    {
+        is_running = false;
+        if (background_thread.joinable())
+        {
+            background_thread.join();
+        }
+    }
+
+    bool SharedWorldSubscriber::openReaderIfDue()
+    {
+        if (reader)
+        {
+            return true;
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        if (now - time_of_last_open_attempt <
+            std::chrono::milliseconds(OPEN_RETRY_PERIOD_MILLISECONDS))
+        {
+            return false;
+        }
+        time_of_last_open_attempt = now;
+
+        try
+        {
+            reader = std::make_unique<SharedWorldRingReader>(segment_name);
+            LOG(INFO) << "Receiving the World through shared memory from " << segment_name
+                      << std::endl;
+            return true;
+        }
+        catch (const std::runtime_error& ex)
+        {
+            // This is expected until the writer has started, so we just try again later
+            return false;
+        }
+    }
+
+    bool SharedWorldSubscriber::poll()
+    {
+        if (!openReaderIfDue() || !reader->readLatest(world_frame))
+        {
+            return false;
+        }
+
+        time_last_received = std::chrono::steady_clock::now().time_since_epoch().count();
+        handle_function(createWorldFromWorldFrame(world_frame),
+                        createFrameTraceFromWorldFrame(world_frame));
+        return true;
+    }
+
+    void SharedWorldSubscriber::startBackgroundThread()
+    {
+        is_running        = true;
+        background_thread = std::thread([this]() {
+            while (is_running)
+            {
+                if (!openReaderIfDue())
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                    continue;
+                }
+
+                // Waking up periodically lets the thread notice when it should stop
+                if (reader->waitForNewFrame(std::chrono::milliseconds(100)))
+                {
+                    poll();
+                }
+            }
+        });
+    }
+
+    bool SharedWorldSubscriber::isReceiving() const
+    {
+        if (time_last_received.load() == NEVER_RECEIVED)
+        {
+            return false;
+        }
+
+        auto time_since_received =
+            std::chrono::steady_clock::now().time_since_epoch() -
+            std::chrono::steady_clock::duration(time_last_received.load());
+        return time_since_received <
+               std::chrono::milliseconds(RECEIVE_TIMEOUT_MILLISECONDS);
+    }
+}  // namespace Util
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <thunderbots_msgs/FrameTrace.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "ai/world/world.h"
+#include "util/shared_memory/shared_world_ring.h"
+
+namespace Util
+{
+    /**
+     * Receives the World from a SharedWorldRing, in place of subscribing to the World
+     * over ROS. The ROS topic is kept as a fallback: nodes should ignore the World from
+     * ROS while isReceiving() is true, and use it otherwise (for example if network_input
+     * is running on a different machine, or was built without shared memory support).
+     *
+     * The writer may start after the subscriber, so the subscriber keeps trying to open
+     * the shared memory segment until it exists.
+     */
+    class SharedWorldSubscriber
+    {
+       public:
+        /**
+         * Creates a new SharedWorldSubscriber. Nothing is received until poll is called
+         * or the background thread is started
+         *
+         * @param segment_name The name of the shared memory segment to read from
+         * @param handle_function The function to call with every new World and its
+         * trace
+         */
+        explicit SharedWorldSubscriber(
+            std::string segment_name,
+            std::function<void(const World&, const thunderbots_msgs::FrameTrace&)>
+                handle_function);
+
+        /**
+         * Stops the background thread, if it is running
+         */
+        ~SharedWorldSubscriber();
+
+        SharedWorldSubscriber& operator=(const SharedWorldSubscriber&) = delete;
+        SharedWorldSubscriber(const SharedWorldSubscriber&)            = delete;
+
+        /**
+         * Calls the handle_function with the latest World, if there is one that has not
+         * been handled yet. This never blocks, so it can be called from a node's main
+         * loop. It must not be called while the background thread is running
+         *
+         * @return true if the handle_function was called, and false otherwise
+         */
+        bool poll();
+
+        /**
+         * Starts a thread that calls the handle_function for every new World as soon as
+         * it is written. The handle_function is called from this thread, so it must be
+         * safe to call alongside any ROS callbacks the node has
+         */
+        void startBackgroundThread();
+
+        /**
+         * Returns whether a World has been received from shared memory recently
+         *
+         * @return true if a World was received within the last
+         * RECEIVE_TIMEOUT_MILLISECONDS, and false otherwise
+         */
+        bool isReceiving() const;
+
+       private:
+        // How long after the last World was received from shared memory we fall back
+        // to receiving it over ROS
+        static constexpr int RECEIVE_TIMEOUT_MILLISECONDS = 500;
+        // How often we try to open the shared memory segment if it doesn't exist yet
+        static constexpr int OPEN_RETRY_PERIOD_MILLISECONDS = 1000;
+
+        /**
+         * Opens the shared memory segment if it is not open yet, and it has been long
+         * enough since the last attempt
+         *
+         * @return true if the segment is open, and false otherwise
+         */
+        bool openReaderIfDue();
+
+        std::string segment_name;
+        std::function<void(const World&, const thunderbots_msgs::FrameTrace&)>
+            handle_function;
+
+        std::unique_ptr<SharedWorldRingReader> reader;
+        std::chrono::steady_clock::time_point time_of_last_open_attempt;
+        // The frame read from shared memory. This is kept as a member since it is too
+        // large to comfortably copy onto the stack for every frame
+        WorldFrame world_frame;
+
+        // The value of time_last_received before any World has been received
+        static constexpr std::chrono::steady_clock::rep NEVER_RECEIVED =
+            std::numeric_limits<std::chrono::steady_clock::rep>::min();
+        // When a World was last received, as a count of steady_clock ticks. This is
+        // atomic since it is read by ROS callbacks on a different thread
+        std::atomic<std::chrono::steady_clock::rep> time_last_received;
+
+        std::atomic<bool> is_running;
+        std::thread background_thread;
+    };
+}  // namespace Util
@@ -0,0 +1,147 @@
+#include "util/shared_memory/world_frame.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include "util/refbox_constants.h"
+#include "util/time/timestamp.h"
+
+namespace Util
+{
+    namespace
+    {
+        void storeTeam(const Team& team, WorldFrame::TeamState& team_state)
+        {
+            std::vector<Robot> robots = team.getAllRobots();
+            team_state.num_robots     = static_cast<uint32_t>(
+                std::min<size_t>(robots.size(), WorldFrame::MAX_ROBOTS_PER_TEAM));
+            team_state.goalie_id =
+                team.getGoalieID() ? static_cast<int32_t>(*team.getGoalieID()) : -1;
+            team_state.robot_expiry_buffer_milliseconds =
+                team.getRobotExpiryBufferDuration().getMilliseconds();
+
+            for (uint32_t i = 0; i < team_state.num_robots; i++)
+            {
+                const Robot& robot                  = robots[i];
+                WorldFrame::RobotState& robot_state = team_state.robots[i];
+                robot_state.id                      = robot.id();
+                robot_state.reserved                = 0;
+                robot_state.position_x              = robot.position().x();
+                robot_state.position_y              = robot.position().y();
+                robot_state.velocity_x              = robot.velocity().x();
+                robot_state.velocity_y              = robot.velocity().y();
+                robot_state.orientation             = robot.orientation().toRadians();
+                robot_state.angular_velocity        = robot.angularVelocity().toRadians();
+                robot_state.timestamp_seconds = robot.lastUpdateTimestamp().getSeconds();
+            }
+        }
+
+        Team createTeam(const WorldFrame::TeamState& team_state)
+        {
+            std::vector<Robot> robots;
+            uint32_t num_robots =
+                std::min(team_state.num_robots, WorldFrame::MAX_ROBOTS_PER_TEAM);
+            robots.reserve(num_robots);
+            for (uint32_t i = 0; i < num_robots; i++)
+            {
+                const WorldFrame::RobotState& robot_state = team_state.robots[i];
+                robots.emplace_back(
+                    robot_state.id, Point(robot_state.position_x, robot_state.position_y),
+                    Vector(robot_state.velocity_x, robot_state.velocity_y),
+                    Angle::ofRadians(robot_state.orientation),
+                    AngularVelocity::ofRadians(robot_state.angular_velocity),
+                    Timestamp::fromSeconds(robot_state.timestamp_seconds));
+            }
+
+            Team team(
+                Duration::fromMilliseconds(team_state.robot_expiry_buffer_milliseconds));
+            team.updateRobots(robots);
+
+            if (team_state.goalie_id >= 0)
+            {
+                // The goalie may not be one of the robots we can see, which is not an
+                // error here (see createTeamFromROSMessage)
+                try
+                {
+                    team.assignGoalie(static_cast<unsigned int>(team_state.goalie_id));
+                }
+                catch (std::invalid_argument)
+                {
+                    // Do nothing
+                }
+            }
+
+            return team;
+        }
+    }  // namespace
+
+    WorldFrame createWorldFrame(const World& world,
+                                const thunderbots_msgs::FrameTrace& trace)
+    {
+        WorldFrame world_frame = {};
+
+        const Field& field                     = world.field();
+        world_frame.field.length               = field.length();
+        world_frame.field.width                = field.width();
+        world_frame.field.defense_length       = field.defenseAreaLength();
+        world_frame.field.defense_width        = field.defenseAreaWidth();
+        world_frame.field.goal_width           = field.goalWidth();
+        world_frame.field.boundary_width       = field.boundaryWidth();
+        world_frame.field.center_circle_radius = field.centreCircleRadius();
+
+        const Ball& ball                   = world.ball();
+        world_frame.ball.position_x        = ball.position().x();
+        world_frame.ball.position_y        = ball.position().y();
+        world_frame.ball.velocity_x        = ball.velocity().x();
+        world_frame.ball.velocity_y        = ball.velocity().y();
+        world_frame.ball.timestamp_seconds = ball.lastUpdateTimestamp().getSeconds();
+
+        storeTeam(world.friendlyTeam(), world_frame.friendly_team);
+        storeTeam(world.enemyTeam(), world_frame.enemy_team);
+
+        world_frame.refbox_game_state =
+            static_cast<int32_t>(world.gameState().getRefboxGameState());
+
+        world_frame.trace.frame_id                = trace.frame_id;
+        world_frame.trace.receive_timestamp       = trace.receive_timestamp;
+        world_frame.trace.world_publish_timestamp = trace.world_publish_timestamp;
+        world_frame.trace.ai_start_timestamp      = trace.ai_start_timestamp;
+        world_frame.trace.primitives_publish_timestamp =
+            trace.primitives_publish_timestamp;
+
+        return world_frame;
+    }
+
+    World createWorldFromWorldFrame(const WorldFrame& world_frame)
+    {
+        Field field(world_frame.field.length, world_frame.field.width,
+                    world_frame.field.defense_length, world_frame.field.defense_width,
+                    world_frame.field.goal_width, world_frame.field.boundary_width,
+                    world_frame.field.center_circle_radius);
+        Ball ball(Point(world_frame.ball.position_x, world_frame.ball.position_y),
+                  Vector(world_frame.ball.velocity_x, world_frame.ball.velocity_y),
+                  Timestamp::fromSeconds(world_frame.ball.timestamp_seconds));
+
+        World world(field, ball, createTeam(world_frame.friendly_team),
+                    createTeam(world_frame.enemy_team));
+        world.updateRefboxGameState(
+            static_cast<RefboxGameState>(world_frame.refbox_game_state));
+
+        return world;
+    }
+
+    thunderbots_msgs::FrameTrace createFrameTraceFromWorldFrame(
+        const WorldFrame& world_frame)
+    {
+        thunderbots_msgs::FrameTrace trace;
+        trace.frame_id                = world_frame.trace.frame_id;
+        trace.receive_timestamp       = world_frame.trace.receive_timestamp;
+        trace.world_publish_timestamp = world_frame.trace.world_publish_timestamp;
+        trace.ai_start_timestamp      = world_frame.trace.ai_start_timestamp;
+        trace.primitives_publish_timestamp =
+            world_frame.trace.primitives_publish_timestamp;
+
+        return trace;
+    }
+}  // namespace Util
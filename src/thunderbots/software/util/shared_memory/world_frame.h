@@ -0,0 +1,122 @@
+#pragma once
+
+#include <thunderbots_msgs/FrameTrace.h>
+
+#include <cstdint>
+#include <type_traits>
+
+#include "ai/world/world.h"
+
+namespace Util
+{
+    /**
+     * A copy of the World with a fixed size and layout, so that it can be written
+     * directly into shared memory by one process and read by another without any
+     * serialization. It only contains plain numbers and fixed-size arrays, so copying
+     * a WorldFrame is a single memcpy and it means the same thing in every process that
+     * maps it.
+     */
+    struct WorldFrame
+    {
+        // The most robots we can store for each team. SSL Vision robot ids are in the
+        // range [0, 15], so a team can never have more robots than this
+        static constexpr uint32_t MAX_ROBOTS_PER_TEAM = 16;
+
+        struct FieldState
+        {
+            double length;
+            double width;
+            double defense_length;
+            double defense_width;
+            double goal_width;
+            double boundary_width;
+            double center_circle_radius;
+        };
+
+        struct BallState
+        {
+            double position_x;
+            double position_y;
+            double velocity_x;
+            double velocity_y;
+            double timestamp_seconds;
+        };
+
+        struct RobotState
+        {
+            uint32_t id;
+            uint32_t reserved;
+            double position_x;
+            double position_y;
+            double velocity_x;
+            double velocity_y;
+            double orientation;
+            double angular_velocity;
+            double timestamp_seconds;
+        };
+
+        struct TeamState
+        {
+            uint32_t num_robots;
+            // The id of the goalie, or -1 if the team has no goalie
+            int32_t goalie_id;
+            double robot_expiry_buffer_milliseconds;
+            RobotState robots[MAX_ROBOTS_PER_TEAM];
+        };
+
+        // The same timestamps as the FrameTrace message
+        struct TraceState
+        {
+            uint64_t frame_id;
+            double receive_timestamp;
+            double world_publish_timestamp;
+            double ai_start_timestamp;
+            double primitives_publish_timestamp;
+        };
+
+        FieldState field;
+        BallState ball;
+        TeamState friendly_team;
+        TeamState enemy_team;
+        // The RefboxGameState, stored as its underlying value
+        int32_t refbox_game_state;
+        uint32_t reserved;
+        TraceState trace;
+    };
+
+    static_assert(
+        std::is_trivially_copyable<WorldFrame>::value &&
+            std::is_standard_layout<WorldFrame>::value,
+        "A WorldFrame must be plain data so it can be shared between processes");
+
+    /**
+     * Creates a WorldFrame from the given World and trace. If a team has more than
+     * WorldFrame::MAX_ROBOTS_PER_TEAM robots, only the first robots are stored
+     *
+     * @param world The World to store
+     * @param trace The trace of the World
+     *
+     * @return A WorldFrame containing the World and trace
+     */
+    WorldFrame createWorldFrame(const World& world,
+                                const thunderbots_msgs::FrameTrace& trace);
+
+    /**
+     * Creates a World from the given WorldFrame
+     *
+     * @param world_frame The WorldFrame to create the World from
+     *
+     * @return The World stored in the WorldFrame
+     */
+    World createWorldFromWorldFrame(const WorldFrame& world_frame);
+
+    /**
+     * Creates a FrameTrace message from the trace stored in the given WorldFrame
+     *
+     * @param world_frame The WorldFrame to get the trace of
+     *
+     * @return The trace stored in the WorldFrame
+     */
+    thunderbots_msgs::FrameTrace createFrameTraceFromWorldFrame(
+        const WorldFrame& world_frame);
+}  // namespace Util
@@ -0,0 +1,114 @@
+/**
+ * This file contains the declaration for the SPSCQueue
+ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace Util
+{
+    /**
+     * A fixed-capacity, lock-free queue that passes values from exactly one producer
+     * thread to exactly one consumer thread. Neither side ever blocks or allocates
+     * memory: if the queue is full the producer is told so and can decide what to do
+     * with the value (usually drop it).
+     *
+     * The slots of the queue are reused, and values can be written and read in place
+     * (see startPush and front). This means a type that keeps its memory when assigned
+     * to (like a protobuf message or a std::vector) can be passed through the queue
+     * without allocating once the queue has warmed up.
+     *
+     * As this class is templated, it is header-only. To split up definition and
+     * implementation of functions has been moved to a `.tpp` file that is included at
+     * the end of this file.
+     *
+     * @tparam T The type of value stored in the queue. It must be default constructible
+     * @tparam CAPACITY The maximum number of values in the queue. This must be a power
+     * of two so that indices can wrap around cheaply
+     */
+    template <typename T, size_t CAPACITY>
+    class SPSCQueue
+    {
+        static_assert(CAPACITY > 0 && (CAPACITY & (CAPACITY - 1)) == 0,
+                      "The capacity of an SPSCQueue must be a power of two");
+
+       public:
+        /**
+         * Creates a new empty SPSCQueue
+         */
+        SPSCQueue();
+
+        /**
+         * Copies a value to the back of the queue. Must only be called by the producer
+         *
+         * @param value The value to copy into the queue
+         * @return true if the value was added, and false if the queue was full
+         */
+        bool push(const T& value);
+
+        /**
+         * Returns the slot at the back of the queue so the producer can write a value
+         * into it in place. The value is not visible to the consumer until finishPush
+         * is called. Must only be called by the producer
+         *
+         * @return The slot to write the next value into, or nullptr if the queue is full.
+         * The slot still contains whatever value was last stored in it
+         */
+        T* startPush();
+
+        /**
+         * Makes the value written into the slot returned by startPush visible to the
+         * consumer. Must only be called by the producer, after a successful startPush
+         */
+        void finishPush();
+
+        /**
+         * Returns the value at the front of the queue without removing it. Must only be
+         * called by the consumer
+         *
+         * @return The value at the front of the queue, or nullptr if the queue is empty.
+         * The value remains valid until pop is called
+         */
+        T* front();
+
+        /**
+         * Removes the value at the front of the queue. Must only be called by the
+         * consumer, when the queue is not empty
+         */
+        void pop();
+
+        /**
+         * Returns the number of values in the queue. Since the other thread may be
+         * using the queue at the same time this is only a snapshot, but it can be called
+         * from either thread
+         *
+         * @return The number of values in the queue
+         */
+        size_t size() const;
+
+        /**
+         * Returns the maximum number of values the queue can hold
+         *
+         * @return The maximum number of values the queue can hold
+         */
+        static constexpr size_t capacity();
+
+       private:
+        // The indices only ever increase, and are wrapped around to find the slot they
+        // refer to. This means a full queue and an empty queue are easy to tell apart
+        static constexpr size_t INDEX_MASK = CAPACITY - 1;
+
+        std::array<T, CAPACITY> slots;
+
+        // The index of the value at the front of the queue. Only written by the consumer.
+        // The indices are kept on separate cache lines so the two threads don't slow
+        // each other down by writing to the same cache line
+        alignas(64) std::atomic<size_t> front_index;
+        // The index of the next slot to write a value into. Only written by the producer
+        alignas(64) std::atomic<size_t> back_index;
+    };
+}  // namespace Util
+
+#include "util/spsc_queue.tpp"
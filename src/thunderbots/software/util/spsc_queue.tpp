@@ -0,0 +1,82 @@
+/**
+ * This file contains the implementation for the SPSCQueue
+ */
+
+#pragma once
+
+#include "util/spsc_queue.h"
+
+template <typename T, size_t CAPACITY>
+Util::SPSCQueue<T, CAPACITY>::SPSCQueue() : front_index(0), back_index(0)
+{
+}
+
+template <typename T, size_t CAPACITY>
+bool Util::SPSCQueue<T, CAPACITY>::push(const T& value)
+{
+    T* slot = startPush();
+    if (!slot)
+    {
+        return false;
+    }
+
+    *slot = value;
+    finishPush();
+    return true;
+}
+
+template <typename T, size_t CAPACITY>
+T* Util::SPSCQueue<T, CAPACITY>::startPush()
+{
+    size_t back = back_index.load(std::memory_order_relaxed);
+    // Acquire so that the consumer is finished reading the slot before we overwrite it
+    if (back - front_index.load(std::memory_order_acquire) == CAPACITY)
+    {
+        return nullptr;
+    }
+
+    return &slots[back & INDEX_MASK];
+}
+
+template <typename T, size_t CAPACITY>
+void Util::SPSCQueue<T, CAPACITY>::finishPush()
+{
+    // Release so that the value written into the slot is visible to the consumer before
+    // the new index is
+    back_index.store(back_index.load(std::memory_order_relaxed) + 1,
+                     std::memory_order_release);
+}
+
+template <typename T, size_t CAPACITY>
+T* Util::SPSCQueue<T, CAPACITY>::front()
+{
+    size_t front = front_index.load(std::memory_order_relaxed);
+    if (front == back_index.load(std::memory_order_acquire))
+    {
+        return nullptr;
+    }
+
+    return &slots[front & INDEX_MASK];
+}
+
+template <typename T, size_t CAPACITY>
+void Util::SPSCQueue<T, CAPACITY>::pop()
+{
+    front_index.store(front_index.load(std::memory_order_relaxed) + 1,
+                      std::memory_order_release);
+}
+
+template <typename T, size_t CAPACITY>
+size_t Util::SPSCQueue<T, CAPACITY>::size() const
+{
+    // Load the front first, so that the back can only have moved further ahead of it
+    size_t front = front_index.load(std::memory_order_acquire);
+    size_t back  = back_index.load(std::memory_order_acquire);
+    return back - front;
+}
+
+template <typename T, size_t CAPACITY>
+constexpr size_t Util::SPSCQueue<T, CAPACITY>::capacity()
+{
+    return CAPACITY;
+}
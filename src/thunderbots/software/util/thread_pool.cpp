@@ -0,0 +1,147 @@
+#include "util/thread_pool.h"
+
+Util::ThreadPool::ThreadPool(size_t num_worker_threads)
+    : current_task(nullptr),
+      num_tasks(0),
+      next_task_index(0),
+      batch_number(0),
+      num_busy_worker_threads(0),
+      first_exception(nullptr),
+      first_exception_task_index(0),
+      stopping(false)
+{
+    worker_threads.reserve(num_worker_threads);
+    for (size_t i = 0; i < num_worker_threads; i++)
+    {
+        worker_threads.emplace_back(&ThreadPool::runWorker, this);
+    }
+}
+
+Util::ThreadPool::~ThreadPool()
+{
+    {
+        std::scoped_lock<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    batch_started.notify_all();
+
+    for (auto& worker_thread : worker_threads)
+    {
+        worker_thread.join();
+    }
+}
+
+void Util::ThreadPool::parallelFor(size_t num_tasks,
+                                   const std::function<void(size_t)>& task)
+{
+    // Waking up the worker threads costs more than running a single task, so small
+    // batches are run on the calling thread
+    if (worker_threads.empty() || num_tasks <= 1)
+    {
+        std::exception_ptr exception;
+        for (size_t i = 0; i < num_tasks; i++)
+        {
+            try
+            {
+                task(i);
+            }
+            catch (...)
+            {
+                if (!exception)
+                {
+                    exception = std::current_exception();
+                }
+            }
+        }
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+        return;
+    }
+
+    {
+        std::scoped_lock<std::mutex> lock(mutex);
+        current_task               = &task;
+        this->num_tasks            = num_tasks;
+        next_task_index            = 0;
+        first_exception            = nullptr;
+        first_exception_task_index = num_tasks;
+        num_busy_worker_threads    = worker_threads.size();
+        batch_number++;
+    }
+    batch_started.notify_all();
+
+    runTasks();
+
+    std::exception_ptr exception;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        batch_finished.wait(lock, [this] { return num_busy_worker_threads == 0; });
+        current_task = nullptr;
+        exception    = first_exception;
+    }
+
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+}
+
+size_t Util::ThreadPool::getNumWorkerThreads() const
+{
+    return worker_threads.size();
+}
+
+void Util::ThreadPool::runWorker()
+{
+    uint64_t last_batch_number = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            batch_started.wait(lock, [this, last_batch_number] {
+                return stopping || batch_number != last_batch_number;
+            });
+            if (stopping)
+            {
+                return;
+            }
+            last_batch_number = batch_number;
+        }
+
+        runTasks();
+
+        bool last_worker_thread_finished;
+        {
+            std::scoped_lock<std::mutex> lock(mutex);
+            num_busy_worker_threads--;
+            last_worker_thread_finished = num_busy_worker_threads == 0;
+        }
+        if (last_worker_thread_finished)
+        {
+            batch_finished.notify_one();
+        }
+    }
+}
+
+void Util::ThreadPool::runTasks()
+{
+    for (size_t task_index = next_task_index++; task_index < num_tasks;
+         task_index        = next_task_index++)
+    {
+        try
+        {
+            (*current_task)(task_index);
+        }
+        catch (...)
+        {
+            std::scoped_lock<std::mutex> lock(mutex);
+            if (task_index < first_exception_task_index)
+            {
+                first_exception            = std::current_exception();
+                first_exception_task_index = task_index;
+            }
+        }
+    }
+}
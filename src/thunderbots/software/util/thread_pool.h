@@ -0,0 +1,110 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "util/noncopyable.h"
+
+namespace Util
+{
+    /**
+     * A small, persistent pool of worker threads that runs a batch of independent tasks
+     * in parallel and waits for all of them to finish.
+     *
+     * The worker threads are created once, when the pool is created, and wait for work
+     * between batches, so running a batch does not create any threads. The thread that
+     * calls parallelFor also runs tasks, so a pool with no worker threads simply runs
+     * every task in order on the calling thread.
+     *
+     * Each task is given its index in the batch. Tasks may run in any order and on any
+     * thread, so to get results in a deterministic order each task should write its
+     * result to a slot chosen by its index, rather than appending it to a shared
+     * container.
+     */
+    class ThreadPool : public NonCopyable
+    {
+       public:
+        /**
+         * Creates a new ThreadPool and starts its worker threads
+         *
+         * @param num_worker_threads The number of threads to create, in addition to the
+         * thread that calls parallelFor. If this is 0, every task is run on the
+         * calling thread
+         */
+        explicit ThreadPool(size_t num_worker_threads);
+
+        /**
+         * Stops and joins every worker thread
+         */
+        ~ThreadPool();
+
+        /**
+         * Calls task(i) for every i in [0, num_tasks) across the worker threads and the
+         * calling thread, and returns once every task has finished.
+         *
+         * This must not be called from more than one thread at a time, or from inside
+         * a task.
+         *
+         * @param num_tasks The number of tasks to run
+         * @param task The function to run for each task. It is given the index of the
+         * task, and must be safe to call from several threads at once
+         *
+         * @throws Whatever the task with the lowest index threw, if any task threw.
+         * Every task is still run, even if an earlier one threw
+         */
+        void parallelFor(size_t num_tasks, const std::function<void(size_t)>& task);
+
+        /**
+         * Returns the number of worker threads in the pool, not counting the thread that
+         * calls parallelFor
+         *
+         * @return The number of worker threads in the pool
+         */
+        size_t getNumWorkerThreads() const;
+
+       private:
+        /**
+         * The function run by each worker thread. Waits for a batch of tasks, helps run
+         * it, and repeats until the pool is destroyed
+         */
+        void runWorker();
+
+        /**
+         * Runs tasks from the current batch until there are none left. Each task is
+         * taken by exactly one thread
+         */
+        void runTasks();
+
+        std::vector<std::thread> worker_threads;
+
+        // Protects everything below except next_task_index
+        std::mutex mutex;
+        // Notified when a new batch is started or the pool is being destroyed
+        std::condition_variable batch_started;
+        // Notified when the last worker thread finishes its part of a batch
+        std::condition_variable batch_finished;
+
+        // The batch currently being run
+        const std::function<void(size_t)>* current_task;
+        size_t num_tasks;
+        // The index of the next task to be taken by a thread
+        std::atomic<size_t> next_task_index;
+        // Increased every time a batch is started, so the worker threads can tell a new
+        // batch from one they already ran
+        uint64_t batch_number;
+        // The number of worker threads still running the current batch
+        size_t num_busy_worker_threads;
+        // The exception thrown by the task with the lowest index, and that index
+        std::exception_ptr first_exception;
+        size_t first_exception_task_index;
+        // Set when the pool is destroyed, to stop the worker threads
+        bool stopping;
+    };
+}  // namespace Util
@@ -0,0 +1,103 @@
+#include "latency_histogram.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+LatencyHistogram::LatencyHistogram()
+{
+    reset();
+}
+
+void LatencyHistogram::record(const Duration& latency)
+{
+    double latency_seconds = std::max(latency.getSeconds(), 0.0);
+
+    bucket_counts[getBucketIndex(latency_seconds)]++;
+    num_samples++;
+    max_latency_seconds = std::max(max_latency_seconds, latency_seconds);
+}
+
+Duration LatencyHistogram::getPercentile(double percentile) const
+{
+    if (percentile < 0.0 || percentile > 1.0)
+    {
+        throw std::invalid_argument("Percentiles must be in the range [0, 1], but got " +
+                                    std::to_string(percentile));
+    }
+
+    if (num_samples == 0)
+    {
+        return Duration::fromSeconds(0);
+    }
+
+    // The number of samples that must be less than or equal to the returned latency.
+    // We always need at least one sample so that the 0th percentile is the minimum
+    // rather than the lower bound of the histogram
+    auto target_num_samples =
+        std::max(static_cast<unsigned long>(std::ceil(percentile * num_samples)), 1ul);
+
+    unsigned long samples_seen = 0;
+    for (unsigned int i = 0; i < NUM_BUCKETS; i++)
+    {
+        samples_seen += bucket_counts[i];
+        if (samples_seen >= target_num_samples)
+        {
+            return Duration::fromSeconds(
+                std::min(getBucketUpperBoundSeconds(i), max_latency_seconds));
+        }
+    }
+
+    return getMaximum();
+}
+
+Duration LatencyHistogram::getMaximum() const
+{
+    return Duration::fromSeconds(max_latency_seconds);
+}
+
+unsigned long LatencyHistogram::getNumberOfSamples() const
+{
+    return num_samples;
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other)
+{
+    for (unsigned int i = 0; i < NUM_BUCKETS; i++)
+    {
+        bucket_counts[i] += other.bucket_counts[i];
+    }
+    num_samples += other.num_samples;
+    max_latency_seconds = std::max(max_latency_seconds, other.max_latency_seconds);
+}
+
+void LatencyHistogram::reset()
+{
+    bucket_counts.fill(0);
+    num_samples         = 0;
+    max_latency_seconds = 0.0;
+}
+
+unsigned int LatencyHistogram::getBucketIndex(double latency_seconds)
+{
+    if (latency_seconds <= MIN_BUCKET_UPPER_BOUND_SECONDS)
+    {
+        return 0;
+    }
+
+    double index = std::ceil(std::log(latency_seconds / MIN_BUCKET_UPPER_BOUND_SECONDS) /
+                             std::log(BUCKET_GROWTH_FACTOR));
+    return static_cast<unsigned int>(std::min(index, NUM_BUCKETS - 1.0));
+}
+
+double LatencyHistogram::getBucketUpperBoundSeconds(unsigned int bucket_index)
+{
+    // The last bucket holds every latency too large to fit in the other buckets
+    if (bucket_index >= NUM_BUCKETS - 1)
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    return MIN_BUCKET_UPPER_BOUND_SECONDS * std::pow(BUCKET_GROWTH_FACTOR, bucket_index);
+}
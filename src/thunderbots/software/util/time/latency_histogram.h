@@ -0,0 +1,102 @@
+#pragma once
+
+#include <array>
+
+#include "duration.h"
+
+/**
+ * A histogram of latency measurements that can report percentiles of the recorded
+ * latencies. The buckets grow geometrically so the histogram has the same relative
+ * precision (about 5%) for latencies anywhere between a microsecond and a few minutes,
+ * and recording a latency never allocates any memory
+ */
+class LatencyHistogram
+{
+   public:
+    /**
+     * Creates a new empty LatencyHistogram
+     */
+    LatencyHistogram();
+
+    /**
+     * Records a latency in the histogram. Negative latencies (which can be caused by
+     * the clocks of different machines being out of sync) are recorded as 0
+     *
+     * @param latency The latency to record
+     */
+    void record(const Duration& latency);
+
+    /**
+     * Returns the latency that the given fraction of recorded latencies are less than
+     * or equal to. The returned value is the upper bound of the bucket the percentile
+     * falls in, so it may overestimate the true value by up to the bucket width, but it
+     * is never greater than the maximum recorded latency
+     *
+     * @param percentile The percentile to get, in the range [0, 1]. For example 0.99
+     * gives the 99th percentile
+     * @throws std::invalid_argument if the percentile is not in the range [0, 1]
+     * @return The latency at the given percentile, or a Duration of 0 if no latencies
+     * have been recorded
+     */
+    Duration getPercentile(double percentile) const;
+
+    /**
+     * Returns the largest latency that has been recorded
+     *
+     * @return The largest latency that has been recorded, or a Duration of 0 if no
+     * latencies have been recorded
+     */
+    Duration getMaximum() const;
+
+    /**
+     * Returns the number of latencies that have been recorded
+     *
+     * @return The number of latencies that have been recorded
+     */
+    unsigned long getNumberOfSamples() const;
+
+    /**
+     * Adds all the latencies recorded in another histogram to this histogram, for
+     * example to combine histograms recorded on different threads
+     *
+     * @param other The histogram to add the latencies of
+     */
+    void merge(const LatencyHistogram& other);
+
+    /**
+     * Removes all recorded latencies from the histogram
+     */
+    void reset();
+
+   private:
+    /**
+     * Returns the index of the bucket the given latency belongs in
+     *
+     * @param latency_seconds The latency, in seconds
+     * @return The index of the bucket the given latency belongs in
+     */
+    static unsigned int getBucketIndex(double latency_seconds);
+
+    /**
+     * Returns the largest latency that belongs in the bucket with the given index
+     *
+     * @param bucket_index The index of the bucket
+     * @return The largest latency that belongs in the bucket, in seconds. This is
+     * infinite for the last bucket
+     */
+    static double getBucketUpperBoundSeconds(unsigned int bucket_index);
+
+    // The upper bound of the first bucket. Every latency smaller than this is recorded
+    // in the first bucket
+    static constexpr double MIN_BUCKET_UPPER_BOUND_SECONDS = 1e-6;
+    // How much larger the upper bound of each bucket is than the one before it
+    static constexpr double BUCKET_GROWTH_FACTOR = 1.05;
+    // With the values above this covers latencies up to a few minutes. Anything larger
+    // is recorded in the last bucket
+    static constexpr unsigned int NUM_BUCKETS = 400;
+
+    // How many recorded latencies fall into each bucket
+    std::array<unsigned long, NUM_BUCKETS> bucket_counts;
+    unsigned long num_samples;
+    double max_latency_seconds;
+};
@@ -0,0 +1,136 @@
+#include "util/world_delta/world_delta_decoder.h"
+
+#include <stdexcept>
+
+#include "util/logger/init.h"
+#include "util/ros_messages.h"
+
+namespace Util
+{
+    WorldDeltaDecoder::WorldDeltaDecoder()
+        : world_(), is_valid(false), last_sequence_number(0)
+    {
+    }
+
+    bool WorldDeltaDecoder::apply(const thunderbots_msgs::WorldDelta& world_delta)
+    {
+        if (!world_delta.is_keyframe)
+        {
+            if (!is_valid)
+            {
+                // We are waiting for a keyframe
+                return false;
+            }
+            if (world_delta.sequence_number != last_sequence_number + 1)
+            {
+                LOG(WARNING) << "Missed "
+                             << world_delta.sequence_number - last_sequence_number - 1
+                             << " World updates, waiting for the next keyframe"
+                             << std::endl;
+                is_valid = false;
+                return false;
+            }
+        }
+        last_sequence_number = world_delta.sequence_number;
+
+        try
+        {
+            if (world_delta.field_changed)
+            {
+                world_.updateFieldGeometry(
+                    Util::ROSMessages::createFieldFromROSMessage(world_delta.field));
+            }
+
+            if (world_delta.refbox_data_changed)
+            {
+                world_.updateRefboxGameState(
+                    Util::ROSMessages::createGameStateFromROSMessage(
+                        world_delta.refbox_data.command));
+            }
+
+            if (world_delta.ball_changed)
+            {
+                Ball ball = Util::ROSMessages::createBallFromROSMessage(world_delta.ball);
+                if (world_delta.is_keyframe)
+                {
+                    // A keyframe replaces the ball, even if the sender has restarted
+                    // and its timestamps went backwards
+                    world_.mutableBall() = ball;
+                }
+                else
+                {
+                    world_.updateBallState(ball);
+                }
+            }
+
+            applyTeamDelta(world_delta.friendly_team, world_delta.is_keyframe,
+                           world_.mutableFriendlyTeam());
+            applyTeamDelta(world_delta.enemy_team, world_delta.is_keyframe,
+                           world_.mutableEnemyTeam());
+        }
+        catch (const std::invalid_argument& ex)
+        {
+            LOG(WARNING) << "Could not apply a World update, waiting for the next "
+                            "keyframe: "
+                         << ex.what() << std::endl;
+            is_valid = false;
+            return false;
+        }
+
+        is_valid = true;
+        return true;
+    }
+
+    bool WorldDeltaDecoder::isValid() const
+    {
+        return is_valid;
+    }
+
+    const World& WorldDeltaDecoder::world() const
+    {
+        return world_;
+    }
+
+    void WorldDeltaDecoder::applyTeamDelta(const thunderbots_msgs::TeamDelta& team_delta,
+                                           bool is_keyframe, Team& team)
+    {
+        if (is_keyframe)
+        {
+            team.clearAllRobots();
+        }
+
+        for (const auto& robot_msg : team_delta.updated_robots)
+        {
+            team.updateRobot(Util::ROSMessages::createRobotFromROSMessage(robot_msg));
+        }
+
+        for (unsigned int robot_id : team_delta.removed_robot_ids)
+        {
+            team.removeRobot(robot_id);
+        }
+
+        if (team_delta.settings_changed)
+        {
+            team.setRobotExpiryBuffer(
+                Duration::fromMilliseconds(team_delta.robot_expiry_buffer_milliseconds));
+
+            if (team_delta.goalie_id < 0)
+            {
+                team.clearGoalie();
+            }
+            else
+            {
+                // The goalie may not be one of the robots we can see, which is not an
+                // error here (see createTeamFromROSMessage)
+                try
+                {
+                    team.assignGoalie(static_cast<unsigned int>(team_delta.goalie_id));
+                }
+                catch (std::invalid_argument)
+                {
+                    // Do nothing
+                }
+            }
+        }
+    }
+}  // namespace Util
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <thunderbots_msgs/WorldDelta.h>
+
+#include "ai/world/world.h"
+
+namespace Util
+{
+    /**
+     * Rebuilds the World from a stream of WorldDelta messages created by a
+     * WorldDeltaEncoder. The World is kept for the lifetime of the decoder and each
+     * WorldDelta is applied to it in place, so applying a WorldDelta only costs time for
+     * the parts of the World that changed.
+     *
+     * The World is only valid once a keyframe has been applied. If a WorldDelta is
+     * missed, the World becomes invalid again until the next keyframe, since we can't
+     * know what the missed WorldDelta changed.
+     */
+    class WorldDeltaDecoder
+    {
+       public:
+        /**
+         * Creates a new WorldDeltaDecoder. Its World is invalid until a keyframe is
+         * applied
+         */
+        explicit WorldDeltaDecoder();
+
+        /**
+         * Applies the given WorldDelta to the World
+         *
+         * @param world_delta The WorldDelta to apply. This should be the WorldDelta that
+         * follows the last one applied, or a keyframe
+         *
+         * @return true if the World is valid after applying the WorldDelta, and false
+         * otherwise
+         */
+        bool apply(const thunderbots_msgs::WorldDelta& world_delta);
+
+        /**
+         * Returns whether the World is complete and up to date. The World should not be
+         * used while this is false
+         *
+         * @return whether the World is valid
+         */
+        bool isValid() const;
+
+        /**
+         * Returns the World built from the WorldDeltas applied so far
+         *
+         * @return the World built from the WorldDeltas applied so far
+         */
+        const World& world() const;
+
+       private:
+        /**
+         * Applies the given TeamDelta to the team
+         *
+         * @param team_delta The TeamDelta to apply
+         * @param is_keyframe Whether the TeamDelta is part of a keyframe, in which case
+         * it replaces every robot on the team
+         * @param team The team to apply the TeamDelta to
+         *
+         * @throws std::invalid_argument if a robot is updated with data older than its
+         * current state
+         */
+        static void applyTeamDelta(const thunderbots_msgs::TeamDelta& team_delta,
+                                   bool is_keyframe, Team& team);
+
+        World world_;
+
+        // Whether a keyframe has been applied, with every WorldDelta since it
+        bool is_valid;
+
+        // The sequence number of the last WorldDelta applied
+        uint64_t last_sequence_number;
+    };
+}  // namespace Util
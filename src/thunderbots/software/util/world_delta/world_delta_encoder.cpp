@@ -0,0 +1,141 @@
+#include "util/world_delta/world_delta_encoder.h"
+
+#include <stdexcept>
+
+#include "util/ros_messages.h"
+
+namespace Util
+{
+    WorldDeltaEncoder::WorldDeltaEncoder(unsigned int keyframe_period)
+        : keyframe_period(keyframe_period),
+          num_deltas_encoded(0),
+          encoded_field(),
+          encoded_ball(),
+          encoded_friendly_team{{}, std::nullopt, Duration()},
+          encoded_enemy_team{{}, std::nullopt, Duration()},
+          world_delta()
+    {
+        if (keyframe_period == 0)
+        {
+            throw std::invalid_argument(
+                "Error: The keyframe period of a WorldDeltaEncoder must be at least 1");
+        }
+    }
+
+    const thunderbots_msgs::WorldDelta& WorldDeltaEncoder::encode(
+        const World& world, const thunderbots_msgs::RefboxData& refbox_data,
+        bool refbox_data_changed, const thunderbots_msgs::FrameTrace& trace)
+    {
+        bool is_keyframe = num_deltas_encoded % keyframe_period == 0;
+
+        world_delta.sequence_number = num_deltas_encoded++;
+        world_delta.is_keyframe     = is_keyframe;
+        world_delta.trace           = trace;
+
+        world_delta.field_changed =
+            is_keyframe || !encoded_field || *encoded_field != world.field();
+        if (world_delta.field_changed)
+        {
+            world_delta.field =
+                Util::ROSMessages::convertFieldToROSMessage(world.field());
+            encoded_field = world.field();
+        }
+
+        world_delta.refbox_data_changed = is_keyframe || refbox_data_changed;
+        if (world_delta.refbox_data_changed)
+        {
+            world_delta.refbox_data = refbox_data;
+        }
+
+        // The equality operator of the Ball ignores the timestamp, but the timestamp is
+        // needed to predict where the ball will be
+        world_delta.ball_changed =
+            is_keyframe || !encoded_ball || *encoded_ball != world.ball() ||
+            encoded_ball->lastUpdateTimestamp() != world.ball().lastUpdateTimestamp();
+        if (world_delta.ball_changed)
+        {
+            world_delta.ball = Util::ROSMessages::convertBallToROSMessage(world.ball());
+            encoded_ball     = world.ball();
+        }
+
+        encodeTeam(world.friendlyTeam(), is_keyframe, encoded_friendly_team,
+                   world_delta.friendly_team);
+        encodeTeam(world.enemyTeam(), is_keyframe, encoded_enemy_team,
+                   world_delta.enemy_team);
+
+        return world_delta;
+    }
+
+    void WorldDeltaEncoder::encodeTeam(const Team& team, bool is_keyframe,
+                                       EncodedTeam& encoded_team,
+                                       thunderbots_msgs::TeamDelta& team_delta)
+    {
+        // Clearing keeps the memory the vectors have already allocated
+        team_delta.updated_robots.clear();
+        team_delta.removed_robot_ids.clear();
+
+        // Both the robots on the team and the encoded robots are sorted by id, so the
+        // robots that were removed can be found in a single pass over both
+        std::vector<Robot> robots = team.getAllRobots();
+        auto encoded_it           = encoded_team.robots.begin();
+        for (const Robot& robot : robots)
+        {
+            while (encoded_it != encoded_team.robots.end() &&
+                   encoded_it->first < robot.id())
+            {
+                team_delta.removed_robot_ids.emplace_back(encoded_it->first);
+                encoded_it = encoded_team.robots.erase(encoded_it);
+            }
+
+            if (encoded_it != encoded_team.robots.end() &&
+                encoded_it->first == robot.id())
+            {
+                // Like the Ball, the equality operator of the Robot ignores the
+                // timestamp
+                if (is_keyframe || encoded_it->second != robot ||
+                    encoded_it->second.lastUpdateTimestamp() !=
+                        robot.lastUpdateTimestamp())
+                {
+                    team_delta.updated_robots.emplace_back(
+                        Util::ROSMessages::convertRobotToROSMessage(robot));
+                    encoded_it->second = robot;
+                }
+                encoded_it++;
+            }
+            else
+            {
+                team_delta.updated_robots.emplace_back(
+                    Util::ROSMessages::convertRobotToROSMessage(robot));
+                encoded_it = encoded_team.robots.emplace_hint(
+                    encoded_it, std::make_pair(robot.id(), robot));
+                encoded_it++;
+            }
+        }
+        while (encoded_it != encoded_team.robots.end())
+        {
+            team_delta.removed_robot_ids.emplace_back(encoded_it->first);
+            encoded_it = encoded_team.robots.erase(encoded_it);
+        }
+
+        // A keyframe replaces the whole team, so there is nothing to remove
+        if (is_keyframe)
+        {
+            team_delta.removed_robot_ids.clear();
+        }
+
+        team_delta.settings_changed = is_keyframe ||
+                                      encoded_team.goalie_id != team.getGoalieID() ||
+                                      encoded_team.robot_expiry_buffer_duration !=
+                                          team.getRobotExpiryBufferDuration();
+        if (team_delta.settings_changed)
+        {
+            team_delta.goalie_id =
+                team.getGoalieID() ? static_cast<int32_t>(*team.getGoalieID()) : -1;
+            team_delta.robot_expiry_buffer_milliseconds =
+                team.getRobotExpiryBufferDuration().getMilliseconds();
+            encoded_team.goalie_id = team.getGoalieID();
+            encoded_team.robot_expiry_buffer_duration =
+                team.getRobotExpiryBufferDuration();
+        }
+    }
+}  // namespace Util
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <thunderbots_msgs/FrameTrace.h>
+#include <thunderbots_msgs/RefboxData.h>
+#include <thunderbots_msgs/WorldDelta.h>
+
+#include <map>
+#include <optional>
+
+#include "ai/world/world.h"
+
+namespace Util
+{
+    /**
+     * Encodes a World as a stream of WorldDelta messages, each of which only contains
+     * what has changed since the previous one. Converting a World to a message costs
+     * time for every robot, so encoding only what changed keeps the cost of each
+     * update proportional to how much of the World actually moved.
+     *
+     * Every keyframe_period WorldDeltas, the entire World is sent as a keyframe so that
+     * receivers that start late or miss a WorldDelta can recover (see
+     * WorldDeltaDecoder).
+     */
+    class WorldDeltaEncoder
+    {
+       public:
+        /**
+         * Creates a new WorldDeltaEncoder. The first WorldDelta it encodes is always a
+         * keyframe
+         *
+         * @param keyframe_period How many WorldDeltas are sent for every keyframe. Must
+         * be at least 1. A period of 1 makes every WorldDelta a keyframe
+         *
+         * @throws std::invalid_argument if the keyframe_period is 0
+         */
+        explicit WorldDeltaEncoder(unsigned int keyframe_period);
+
+        /**
+         * Encodes what has changed in the World since the last call to this function.
+         *
+         * The refbox data is passed in separately, since the World only stores the
+         * RefboxGameState and we want to send everything we got from the refbox
+         *
+         * @param world The current World
+         * @param refbox_data The current refbox data
+         * @param refbox_data_changed Whether the refbox data has changed since the last
+         * call to this function
+         * @param trace The trace of this update of the World
+         *
+         * @return The WorldDelta describing the change. It is owned by this encoder and
+         * is overwritten by the next call to this function, which lets the memory it
+         * allocated for its robots be reused
+         */
+        const thunderbots_msgs::WorldDelta& encode(
+            const World& world, const thunderbots_msgs::RefboxData& refbox_data,
+            bool refbox_data_changed, const thunderbots_msgs::FrameTrace& trace);
+
+       private:
+        // What we last sent about a team
+        struct EncodedTeam
+        {
+            std::map<unsigned int, Robot> robots;
+            std::optional<unsigned int> goalie_id;
+            Duration robot_expiry_buffer_duration;
+        };
+
+        /**
+         * Fills in the team_delta with what has changed on the team since it was last
+         * encoded, and updates the encoded_team to match the team
+         *
+         * @param team The current team
+         * @param is_keyframe Whether the entire team should be encoded
+         * @param encoded_team What we last sent about the team
+         * @param team_delta The message to fill in
+         */
+        static void encodeTeam(const Team& team, bool is_keyframe,
+                               EncodedTeam& encoded_team,
+                               thunderbots_msgs::TeamDelta& team_delta);
+
+        const unsigned int keyframe_period;
+
+        // How many WorldDeltas have been encoded
+        uint64_t num_deltas_encoded;
+
+        // What we last sent about the World. The field and ball are empty until the
+        // first WorldDelta is encoded
+        std::optional<Field> encoded_field;
+        std::optional<Ball> encoded_ball;
+        EncodedTeam encoded_friendly_team;
+        EncodedTeam encoded_enemy_team;
+
+        // The message returned by encode. It is kept so the memory it allocates is
+        // reused
+        thunderbots_msgs::WorldDelta world_delta;
+    };
+}  // namespace Util